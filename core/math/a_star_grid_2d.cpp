@@ -121,6 +121,7 @@ void AStarGrid2D::update() {
 	}
 
 	dirty = false;
+	_reset_clusters();
 }
 
 bool AStarGrid2D::is_in_bounds(int32_t p_x, int32_t p_y) const {
@@ -143,9 +144,24 @@ bool AStarGrid2D::is_jumping_enabled() const {
 	return jumping_enabled;
 }
 
+void AStarGrid2D::set_cluster_size(int p_cluster_size) {
+	ERR_FAIL_COND(p_cluster_size < 0);
+	if (p_cluster_size != cluster_size) {
+		cluster_size = p_cluster_size;
+		_reset_clusters();
+	}
+}
+
+int AStarGrid2D::get_cluster_size() const {
+	return cluster_size;
+}
+
 void AStarGrid2D::set_diagonal_mode(DiagonalMode p_diagonal_mode) {
 	ERR_FAIL_INDEX((int)p_diagonal_mode, (int)DIAGONAL_MODE_MAX);
-	diagonal_mode = p_diagonal_mode;
+	if (p_diagonal_mode != diagonal_mode) {
+		diagonal_mode = p_diagonal_mode;
+		_reset_clusters();
+	}
 }
 
 AStarGrid2D::DiagonalMode AStarGrid2D::get_diagonal_mode() const {
@@ -154,7 +170,10 @@ AStarGrid2D::DiagonalMode AStarGrid2D::get_diagonal_mode() const {
 
 void AStarGrid2D::set_default_compute_heuristic(Heuristic p_heuristic) {
 	ERR_FAIL_INDEX((int)p_heuristic, (int)HEURISTIC_MAX);
-	default_compute_heuristic = p_heuristic;
+	if (p_heuristic != default_compute_heuristic) {
+		default_compute_heuristic = p_heuristic;
+		_reset_clusters();
+	}
 }
 
 AStarGrid2D::Heuristic AStarGrid2D::get_default_compute_heuristic() const {
@@ -174,6 +193,7 @@ void AStarGrid2D::set_point_solid(const Vector2i &p_id, bool p_solid) {
 	ERR_FAIL_COND_MSG(dirty, "Grid is not initialized. Call the update method.");
 	ERR_FAIL_COND_MSG(!is_in_boundsv(p_id), vformat("Can't set if point is disabled. Point %s out of bounds %s.", p_id, region));
 	_get_point_unchecked(p_id)->solid = p_solid;
+	_mark_clusters_dirty(Rect2i(p_id, Size2i(1, 1)));
 }
 
 bool AStarGrid2D::is_point_solid(const Vector2i &p_id) const {
@@ -187,6 +207,7 @@ void AStarGrid2D::set_point_weight_scale(const Vector2i &p_id, real_t p_weight_s
 	ERR_FAIL_COND_MSG(!is_in_boundsv(p_id), vformat("Can't set point's weight scale. Point %s out of bounds %s.", p_id, region));
 	ERR_FAIL_COND_MSG(p_weight_scale < 0.0, vformat("Can't set point's weight scale less than 0.0: %f.", p_weight_scale));
 	_get_point_unchecked(p_id)->weight_scale = p_weight_scale;
+	_mark_clusters_dirty(Rect2i(p_id, Size2i(1, 1)));
 }
 
 real_t AStarGrid2D::get_point_weight_scale(const Vector2i &p_id) const {
@@ -207,6 +228,7 @@ void AStarGrid2D::fill_solid_region(const Rect2i &p_region, bool p_solid) {
 			_get_point_unchecked(x, y)->solid = p_solid;
 		}
 	}
+	_mark_clusters_dirty(safe_region);
 }
 
 void AStarGrid2D::fill_weight_scale_region(const Rect2i &p_region, real_t p_weight_scale) {
@@ -222,6 +244,7 @@ void AStarGrid2D::fill_weight_scale_region(const Rect2i &p_region, real_t p_weig
 			_get_point_unchecked(x, y)->weight_scale = p_weight_scale;
 		}
 	}
+	_mark_clusters_dirty(safe_region);
 }
 
 AStarGrid2D::Point *AStarGrid2D::_jump(Point *p_from, Point *p_to) {
@@ -416,7 +439,7 @@ void AStarGrid2D::_get_nbors(Point *p_point, LocalVector<Point *> &r_nbors) {
 	}
 }
 
-bool AStarGrid2D::_solve(Point *p_begin_point, Point *p_end_point) {
+bool AStarGrid2D::_solve(Point *p_begin_point, Point *p_end_point, const Rect2i &p_bounds) {
 	pass++;
 
 	if (p_end_point->solid) {
@@ -428,6 +451,10 @@ bool AStarGrid2D::_solve(Point *p_begin_point, Point *p_end_point) {
 	LocalVector<Point *> open_list;
 	SortArray<Point *, SortPoints> sorter;
 
+	// Jumps can leave the bounds, so they are only used for unbounded searches.
+	const bool bounded = p_bounds.has_area();
+	const bool jumping = jumping_enabled && !bounded;
+
 	p_begin_point->g_score = 0;
 	p_begin_point->f_score = _estimate_cost(p_begin_point->id, p_end_point->id);
 	open_list.push_back(p_begin_point);
@@ -451,7 +478,11 @@ bool AStarGrid2D::_solve(Point *p_begin_point, Point *p_end_point) {
 		for (Point *e : nbors) {
 			real_t weight_scale = 1.0;
 
-			if (jumping_enabled) {
+			if (bounded && !p_bounds.has_point(e->id)) {
+				continue;
+			}
+
+			if (jumping) {
 				// TODO: Make it works with weight_scale.
 				e = _jump(p, e);
 				if (!e || e->closed_pass == pass) {
@@ -490,6 +521,484 @@ bool AStarGrid2D::_solve(Point *p_begin_point, Point *p_end_point) {
 	return found_route;
 }
 
+void AStarGrid2D::_append_solved_path(Point *p_begin_point, Point *p_end_point, LocalVector<Point *> &r_path) const {
+	const uint32_t start = r_path.size();
+
+	Point *p = p_end_point;
+	while (p != p_begin_point) {
+		r_path.push_back(p);
+		p = p->prev_point;
+	}
+	if (start == 0) {
+		r_path.push_back(p_begin_point); // Otherwise it already ends the previous segment.
+	}
+
+	// Points were added from the end, reverse the new segment.
+	for (uint32_t i = start, j = r_path.size() - 1; i < j; i++, j--) {
+		SWAP(r_path[i], r_path[j]);
+	}
+}
+
+void AStarGrid2D::_dijkstra(const LocalVector<Point *> &p_sources, const Rect2i &p_bounds, bool p_reverse, LocalVector<real_t> &r_dist, LocalVector<int32_t> &r_next) {
+	const uint32_t count = p_bounds.size.x * p_bounds.size.y;
+	r_dist.resize(count);
+	r_next.resize(count);
+	for (uint32_t i = 0; i < count; i++) {
+		r_dist[i] = INFINITY;
+		r_next[i] = -1;
+	}
+
+	LocalVector<DijkstraEntry> open_list;
+	SortArray<DijkstraEntry, SortDijkstraEntries> sorter;
+
+	for (const Point *source : p_sources) {
+		DijkstraEntry entry;
+		entry.index = (source->id.y - p_bounds.position.y) * p_bounds.size.x + (source->id.x - p_bounds.position.x);
+		r_dist[entry.index] = 0;
+		open_list.push_back(entry);
+		sorter.push_heap(0, open_list.size() - 1, 0, entry, open_list.ptr());
+	}
+
+	LocalVector<Point *> nbors;
+	while (!open_list.is_empty()) {
+		const DijkstraEntry entry = open_list[0];
+		sorter.pop_heap(0, open_list.size(), open_list.ptr());
+		open_list.remove_at(open_list.size() - 1);
+
+		if (entry.dist > r_dist[entry.index]) {
+			continue; // Already reached with a lower cost.
+		}
+
+		Point *p = _get_point_unchecked(p_bounds.position.x + entry.index % p_bounds.size.x, p_bounds.position.y + entry.index / p_bounds.size.x);
+
+		nbors.clear();
+		_get_nbors(p, nbors);
+
+		for (Point *e : nbors) {
+			if (!p_bounds.has_point(e->id)) {
+				continue;
+			}
+
+			// When reversed, distances are the cost to travel from the point to the sources.
+			real_t cost = p_reverse ? _compute_cost(e->id, p->id) * p->weight_scale : _compute_cost(p->id, e->id) * e->weight_scale;
+
+			DijkstraEntry e_entry;
+			e_entry.dist = entry.dist + cost;
+			e_entry.index = (e->id.y - p_bounds.position.y) * p_bounds.size.x + (e->id.x - p_bounds.position.x);
+			if (e_entry.dist < r_dist[e_entry.index]) {
+				r_dist[e_entry.index] = e_entry.dist;
+				r_next[e_entry.index] = entry.index;
+				open_list.push_back(e_entry);
+				sorter.push_heap(0, open_list.size() - 1, 0, e_entry, open_list.ptr());
+			}
+		}
+	}
+}
+
+bool AStarGrid2D::_solve_field(const TypedArray<Vector2i> &p_goals, LocalVector<real_t> &r_dist, LocalVector<int32_t> &r_next) {
+	ERR_FAIL_COND_V_MSG(dirty, false, "Grid is not initialized. Call the update method.");
+
+	LocalVector<Point *> goals;
+	for (int i = 0; i < p_goals.size(); i++) {
+		const Vector2i id = p_goals[i];
+		ERR_CONTINUE_MSG(!is_in_boundsv(id), vformat("Can't use goal point. Point %s out of bounds %s.", id, region));
+		Point *goal = _get_point_unchecked(id);
+		if (!goal->solid) {
+			goals.push_back(goal);
+		}
+	}
+
+	_dijkstra(goals, region, true, r_dist, r_next);
+	return true;
+}
+
+void AStarGrid2D::_reset_clusters() {
+	hierarchical_nodes.clear();
+	cluster_nodes.clear();
+	cluster_dirty.clear();
+	dirty_clusters.clear();
+	cluster_grid_size = Size2i();
+
+	if (cluster_size <= 0 || dirty) {
+		return; // Built when the grid is updated.
+	}
+
+	cluster_grid_size = Size2i((region.size.x + cluster_size - 1) / cluster_size, (region.size.y + cluster_size - 1) / cluster_size);
+	const uint32_t count = cluster_grid_size.x * cluster_grid_size.y;
+	cluster_nodes.resize(count);
+	cluster_dirty.resize(count);
+	for (uint32_t i = 0; i < count; i++) {
+		cluster_dirty[i] = true;
+		dirty_clusters.push_back(i);
+	}
+}
+
+void AStarGrid2D::_mark_clusters_dirty(const Rect2i &p_region) {
+	if (cluster_nodes.is_empty() || !p_region.has_area()) {
+		return;
+	}
+
+	const Vector2i from = _get_cluster_coords(p_region.position);
+	const Vector2i to = _get_cluster_coords(p_region.get_end() - Vector2i(1, 1));
+	for (int32_t y = from.y; y <= to.y; y++) {
+		for (int32_t x = from.x; x <= to.x; x++) {
+			const uint32_t index = y * cluster_grid_size.x + x;
+			if (!cluster_dirty[index]) {
+				cluster_dirty[index] = true;
+				dirty_clusters.push_back(index);
+			}
+		}
+	}
+}
+
+void AStarGrid2D::_add_hierarchical_edge(const Vector2i &p_from, const Vector2i &p_to, real_t p_cost) {
+	HierarchicalNode *node = hierarchical_nodes.getptr(p_from);
+	if (!node) {
+		node = &hierarchical_nodes.insert(p_from, HierarchicalNode())->value;
+		const Vector2i cluster = _get_cluster_coords(p_from);
+		cluster_nodes[cluster.y * cluster_grid_size.x + cluster.x].push_back(p_from);
+	}
+
+	HierarchicalEdge edge;
+	edge.to = p_to;
+	edge.cost = p_cost;
+	node->edges.push_back(edge);
+}
+
+void AStarGrid2D::_add_hierarchical_transition(const Vector2i &p_from, const Vector2i &p_to) {
+	_add_hierarchical_edge(p_from, p_to, _compute_cost(p_from, p_to) * _get_point_unchecked(p_to)->weight_scale);
+	_add_hierarchical_edge(p_to, p_from, _compute_cost(p_to, p_from) * _get_point_unchecked(p_from)->weight_scale);
+}
+
+void AStarGrid2D::_connect_clusters(const Vector2i &p_cluster, const Vector2i &p_neighbor) {
+	const Rect2i rect = _get_cluster_rect(p_cluster);
+	const Vector2i dir = p_neighbor - p_cluster;
+
+	if (dir.x != 0 && dir.y != 0) {
+		// Clusters touching by a corner. A diagonal step between them only needs its own transition when it
+		// squeezes between two solid cells, otherwise it can be replaced by two straight steps through a side cluster.
+		const Vector2i a(dir.x > 0 ? rect.get_end().x - 1 : rect.position.x, dir.y > 0 ? rect.get_end().y - 1 : rect.position.y);
+		const Vector2i b = a + dir;
+		if (diagonal_mode == DIAGONAL_MODE_ALWAYS && !_get_point_unchecked(a)->solid && !_get_point_unchecked(b)->solid && _get_point_unchecked(Vector2i(b.x, a.y))->solid && _get_point_unchecked(Vector2i(a.x, b.y))->solid) {
+			_add_hierarchical_transition(a, b);
+		}
+		return;
+	}
+
+	// Walk along the shared border, a is in the cluster and b in the neighbor.
+	Vector2i a;
+	Vector2i step;
+	int32_t length;
+	if (dir.x != 0) {
+		a = Vector2i(dir.x > 0 ? rect.get_end().x - 1 : rect.position.x, rect.position.y);
+		step = Vector2i(0, 1);
+		length = rect.size.y;
+	} else {
+		a = Vector2i(rect.position.x, dir.y > 0 ? rect.get_end().y - 1 : rect.position.y);
+		step = Vector2i(1, 0);
+		length = rect.size.x;
+	}
+
+	int32_t run_start = -1;
+	for (int32_t i = 0; i <= length; i++) {
+		bool open = false;
+		if (i < length) {
+			const Vector2i cell = a + step * i;
+			open = !_get_point_unchecked(cell)->solid && !_get_point_unchecked(cell + dir)->solid;
+		}
+
+		if (open) {
+			if (run_start < 0) {
+				run_start = i;
+			}
+			continue;
+		}
+		if (run_start < 0) {
+			continue;
+		}
+
+		// Short entrances get a single transition in their middle, long ones one at each end.
+		int32_t transitions[2] = { (run_start + i - 1) / 2, -1 };
+		if (i - run_start >= 6) {
+			transitions[0] = run_start;
+			transitions[1] = i - 1;
+		}
+		for (int32_t t : transitions) {
+			if (t < 0) {
+				continue;
+			}
+			const Vector2i from = a + step * t;
+			_add_hierarchical_transition(from, from + dir);
+		}
+		run_start = -1;
+	}
+
+	if (diagonal_mode != DIAGONAL_MODE_ALWAYS) {
+		return;
+	}
+
+	// Diagonal steps across the border that can't be replaced by straight steps, because both cells beside them
+	// are solid. The other diagonal modes never allow such steps.
+	for (int32_t i = 0; i < length; i++) {
+		const Vector2i from = a + step * i;
+		if (_get_point_unchecked(from)->solid || !_get_point_unchecked(from + dir)->solid) {
+			continue;
+		}
+		for (int32_t side = -1; side <= 1; side += 2) {
+			if (i + side < 0 || i + side >= length) {
+				continue; // Leads to a cluster touching by a corner.
+			}
+			const Vector2i to = from + dir + step * side;
+			if (!_get_point_unchecked(to)->solid && _get_point_unchecked(from + step * side)->solid) {
+				_add_hierarchical_transition(from, to);
+			}
+		}
+	}
+}
+
+void AStarGrid2D::_update_clusters() {
+	if (dirty_clusters.is_empty()) {
+		return;
+	}
+
+	// Clusters touching by a corner are only linked when diagonal steps may pass between two solid cells.
+	static const Vector2i cluster_nbors[8] = { Vector2i(0, -1), Vector2i(1, 0), Vector2i(0, 1), Vector2i(-1, 0), Vector2i(-1, -1), Vector2i(1, -1), Vector2i(1, 1), Vector2i(-1, 1) };
+	const uint32_t cluster_nbor_count = diagonal_mode == DIAGONAL_MODE_ALWAYS ? 8 : 4;
+
+	// Entrances on the borders of dirty clusters may change, so their neighbors are rebuilt too.
+	LocalVector<uint32_t> clusters = dirty_clusters;
+	for (uint32_t index : dirty_clusters) {
+		const Vector2i cluster(index % cluster_grid_size.x, index / cluster_grid_size.x);
+		for (uint32_t i = 0; i < cluster_nbor_count; i++) {
+			const Vector2i nbor = cluster + cluster_nbors[i];
+			if (nbor.x < 0 || nbor.y < 0 || nbor.x >= cluster_grid_size.x || nbor.y >= cluster_grid_size.y) {
+				continue;
+			}
+			const uint32_t nbor_index = nbor.y * cluster_grid_size.x + nbor.x;
+			if (!cluster_dirty[nbor_index]) {
+				cluster_dirty[nbor_index] = true;
+				clusters.push_back(nbor_index);
+			}
+		}
+	}
+
+	// Remove the nodes of the rebuilt clusters, and the edges leading to them from untouched clusters.
+	for (uint32_t index : clusters) {
+		for (const Vector2i &id : cluster_nodes[index]) {
+			hierarchical_nodes.erase(id);
+		}
+		cluster_nodes[index].clear();
+	}
+	for (uint32_t index : clusters) {
+		const Vector2i cluster(index % cluster_grid_size.x, index / cluster_grid_size.x);
+		for (uint32_t i = 0; i < cluster_nbor_count; i++) {
+			const Vector2i nbor = cluster + cluster_nbors[i];
+			if (nbor.x < 0 || nbor.y < 0 || nbor.x >= cluster_grid_size.x || nbor.y >= cluster_grid_size.y) {
+				continue;
+			}
+			const uint32_t nbor_index = nbor.y * cluster_grid_size.x + nbor.x;
+			if (cluster_dirty[nbor_index]) {
+				continue;
+			}
+			for (const Vector2i &id : cluster_nodes[nbor_index]) {
+				LocalVector<HierarchicalEdge> &edges = hierarchical_nodes[id].edges;
+				for (uint32_t j = 0; j < edges.size();) {
+					if (_get_cluster_coords(edges[j].to) == cluster) {
+						edges.remove_at_unordered(j);
+					} else {
+						j++;
+					}
+				}
+			}
+		}
+	}
+
+	// Find the entrances, each shared border is processed once.
+	for (uint32_t index : clusters) {
+		const Vector2i cluster(index % cluster_grid_size.x, index / cluster_grid_size.x);
+		for (uint32_t i = 0; i < cluster_nbor_count; i++) {
+			const Vector2i nbor = cluster + cluster_nbors[i];
+			if (nbor.x < 0 || nbor.y < 0 || nbor.x >= cluster_grid_size.x || nbor.y >= cluster_grid_size.y) {
+				continue;
+			}
+			const uint32_t nbor_index = nbor.y * cluster_grid_size.x + nbor.x;
+			if (cluster_dirty[nbor_index] && nbor_index < index) {
+				continue;
+			}
+			_connect_clusters(cluster, nbor);
+		}
+	}
+
+	// Connect the entrances inside each cluster.
+	LocalVector<real_t> dist;
+	LocalVector<int32_t> next;
+	LocalVector<Point *> sources;
+	for (uint32_t index : clusters) {
+		const Rect2i rect = _get_cluster_rect(Vector2i(index % cluster_grid_size.x, index / cluster_grid_size.x));
+		const LocalVector<Vector2i> &nodes = cluster_nodes[index];
+		for (const Vector2i &from : nodes) {
+			sources.clear();
+			sources.push_back(_get_point_unchecked(from));
+			_dijkstra(sources, rect, false, dist, next);
+
+			for (const Vector2i &to : nodes) {
+				const real_t cost = dist[(to.y - rect.position.y) * rect.size.x + (to.x - rect.position.x)];
+				if (to != from && cost < INFINITY) {
+					_add_hierarchical_edge(from, to, cost);
+				}
+			}
+		}
+		cluster_dirty[index] = false;
+	}
+
+	dirty_clusters.clear();
+}
+
+bool AStarGrid2D::_solve_hierarchical(Point *p_begin_point, Point *p_end_point, LocalVector<Point *> &r_path) {
+	if (p_end_point->solid) {
+		return false;
+	}
+
+	const Vector2i begin_cluster = _get_cluster_coords(p_begin_point->id);
+	const Vector2i end_cluster = _get_cluster_coords(p_end_point->id);
+
+	if (begin_cluster == end_cluster) {
+		// Close enough for a regular search, which can also find paths leaving the cluster.
+		if (!_solve(p_begin_point, p_end_point)) {
+			return false;
+		}
+		_append_solved_path(p_begin_point, p_end_point, r_path);
+		return true;
+	}
+
+	_update_clusters();
+
+	// Costs from the begin point to the entrances of its cluster, and from the entrances of the end cluster to the end point.
+	const Rect2i begin_rect = _get_cluster_rect(begin_cluster);
+	const Rect2i end_rect = _get_cluster_rect(end_cluster);
+	LocalVector<real_t> begin_dist;
+	LocalVector<real_t> end_dist;
+	{
+		LocalVector<int32_t> next;
+		LocalVector<Point *> sources;
+		sources.push_back(p_begin_point);
+		_dijkstra(sources, begin_rect, false, begin_dist, next);
+		sources[0] = p_end_point;
+		_dijkstra(sources, end_rect, true, end_dist, next);
+	}
+
+	// A* on the abstract graph.
+	struct SearchNode {
+		Vector2i prev;
+		real_t g_score = 0;
+		bool closed = false;
+	};
+	HashMap<Vector2i, SearchNode> search;
+	LocalVector<DijkstraEntry> open_list;
+	LocalVector<Vector2i> open_ids;
+	SortArray<DijkstraEntry, SortDijkstraEntries> sorter;
+
+	const Vector2i begin_id = p_begin_point->id;
+	const Vector2i end_id = p_end_point->id;
+	const uint32_t end_cluster_index = end_cluster.y * cluster_grid_size.x + end_cluster.x;
+
+	auto relax = [&](const Vector2i &p_from, const Vector2i &p_to, real_t p_g_score) {
+		HashMap<Vector2i, SearchNode>::Iterator E = search.find(p_to);
+		if (E) {
+			if (E->value.closed || p_g_score >= E->value.g_score) {
+				return;
+			}
+		} else {
+			E = search.insert(p_to, SearchNode());
+		}
+		E->value.prev = p_from;
+		E->value.g_score = p_g_score;
+
+		DijkstraEntry entry;
+		entry.dist = p_g_score + _estimate_cost(p_to, end_id);
+		entry.index = open_ids.size();
+		open_ids.push_back(p_to);
+		open_list.push_back(entry);
+		sorter.push_heap(0, open_list.size() - 1, 0, entry, open_list.ptr());
+	};
+
+	search.insert(begin_id, SearchNode())->value.closed = true;
+	for (const Vector2i &id : cluster_nodes[begin_cluster.y * cluster_grid_size.x + begin_cluster.x]) {
+		const real_t cost = begin_dist[(id.y - begin_rect.position.y) * begin_rect.size.x + (id.x - begin_rect.position.x)];
+		if (cost < INFINITY) {
+			relax(begin_id, id, cost);
+		}
+	}
+	if (const HierarchicalNode *begin_node = hierarchical_nodes.getptr(begin_id)) {
+		for (const HierarchicalEdge &edge : begin_node->edges) {
+			relax(begin_id, edge.to, edge.cost);
+		}
+	}
+
+	bool found_route = false;
+	while (!open_list.is_empty()) {
+		const Vector2i id = open_ids[open_list[0].index];
+		sorter.pop_heap(0, open_list.size(), open_list.ptr());
+		open_list.remove_at(open_list.size() - 1);
+
+		SearchNode &node = search[id];
+		if (node.closed) {
+			continue; // Already reached with a lower cost.
+		}
+		node.closed = true;
+
+		if (id == end_id) {
+			found_route = true;
+			break;
+		}
+
+		const real_t g_score = node.g_score; // The node may move while the search map grows.
+		if (const HierarchicalNode *hierarchical_node = hierarchical_nodes.getptr(id)) {
+			for (const HierarchicalEdge &edge : hierarchical_node->edges) {
+				relax(id, edge.to, g_score + edge.cost);
+			}
+		}
+
+		const Vector2i cluster = _get_cluster_coords(id);
+		if (uint32_t(cluster.y * cluster_grid_size.x + cluster.x) == end_cluster_index) {
+			const real_t cost = end_dist[(id.y - end_rect.position.y) * end_rect.size.x + (id.x - end_rect.position.x)];
+			if (cost < INFINITY) {
+				relax(id, end_id, g_score + cost);
+			}
+		}
+	}
+
+	if (!found_route) {
+		return false;
+	}
+
+	LocalVector<Vector2i> abstract_path;
+	for (Vector2i id = end_id; id != begin_id; id = search[id].prev) {
+		abstract_path.push_back(id);
+	}
+	abstract_path.push_back(begin_id);
+	abstract_path.invert();
+
+	// Refine each step of the abstract path, steps inside a cluster are searched within its bounds.
+	r_path.push_back(p_begin_point);
+	for (uint32_t i = 1; i < abstract_path.size(); i++) {
+		Point *from = _get_point_unchecked(abstract_path[i - 1]);
+		Point *to = _get_point_unchecked(abstract_path[i]);
+		const Vector2i cluster = _get_cluster_coords(from->id);
+		if (cluster != _get_cluster_coords(to->id)) {
+			r_path.push_back(to); // Entrances are next to each other.
+			continue;
+		}
+		if (!_solve(from, to, _get_cluster_rect(cluster))) {
+			r_path.clear();
+			return false;
+		}
+		_append_solved_path(from, to, r_path);
+	}
+
+	return true;
+}
+
 real_t AStarGrid2D::_estimate_cost(const Vector2i &p_from_id, const Vector2i &p_to_id) {
 	real_t scost;
 	if (GDVIRTUAL_CALL(_estimate_cost, p_from_id, p_to_id, scost)) {
@@ -509,6 +1018,7 @@ real_t AStarGrid2D::_compute_cost(const Vector2i &p_from_id, const Vector2i &p_t
 void AStarGrid2D::clear() {
 	points.clear();
 	region = Rect2i();
+	_reset_clusters();
 }
 
 Vector2 AStarGrid2D::get_point_position(const Vector2i &p_id) const {
@@ -531,6 +1041,21 @@ Vector<Vector2> AStarGrid2D::get_point_path(const Vector2i &p_from_id, const Vec
 		return ret;
 	}
 
+	if (cluster_size > 0) {
+		LocalVector<Point *> point_path;
+		if (!_solve_hierarchical(a, b, point_path)) {
+			return Vector<Vector2>();
+		}
+
+		Vector<Vector2> path;
+		path.resize(point_path.size());
+		Vector2 *w = path.ptrw();
+		for (uint32_t i = 0; i < point_path.size(); i++) {
+			w[i] = point_path[i]->pos;
+		}
+		return path;
+	}
+
 	Point *begin_point = a;
 	Point *end_point = b;
 
@@ -579,6 +1104,20 @@ TypedArray<Vector2i> AStarGrid2D::get_id_path(const Vector2i &p_from_id, const V
 		return ret;
 	}
 
+	if (cluster_size > 0) {
+		LocalVector<Point *> point_path;
+		if (!_solve_hierarchical(a, b, point_path)) {
+			return TypedArray<Vector2i>();
+		}
+
+		TypedArray<Vector2i> path;
+		path.resize(point_path.size());
+		for (uint32_t i = 0; i < point_path.size(); i++) {
+			path[i] = point_path[i]->id;
+		}
+		return path;
+	}
+
 	Point *begin_point = a;
 	Point *end_point = b;
 
@@ -611,6 +1150,42 @@ TypedArray<Vector2i> AStarGrid2D::get_id_path(const Vector2i &p_from_id, const V
 	return path;
 }
 
+PackedFloat32Array AStarGrid2D::get_distance_field(const TypedArray<Vector2i> &p_goals) {
+	LocalVector<real_t> dist;
+	LocalVector<int32_t> next;
+	if (!_solve_field(p_goals, dist, next)) {
+		return PackedFloat32Array();
+	}
+
+	PackedFloat32Array field;
+	field.resize(dist.size());
+	float *w = field.ptrw();
+	for (uint32_t i = 0; i < dist.size(); i++) {
+		w[i] = dist[i];
+	}
+	return field;
+}
+
+PackedVector2Array AStarGrid2D::get_flow_field(const TypedArray<Vector2i> &p_goals) {
+	LocalVector<real_t> dist;
+	LocalVector<int32_t> next;
+	if (!_solve_field(p_goals, dist, next)) {
+		return PackedVector2Array();
+	}
+
+	PackedVector2Array field;
+	field.resize(next.size());
+	Vector2 *w = field.ptrw();
+	for (uint32_t i = 0; i < next.size(); i++) {
+		if (next[i] < 0) {
+			w[i] = Vector2(); // Goal or unreachable point.
+		} else {
+			w[i] = Vector2(next[i] % region.size.x - int32_t(i) % region.size.x, next[i] / region.size.x - int32_t(i) / region.size.x);
+		}
+	}
+	return field;
+}
+
 void AStarGrid2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_region", "region"), &AStarGrid2D::set_region);
 	ClassDB::bind_method(D_METHOD("get_region"), &AStarGrid2D::get_region);
@@ -626,6 +1201,8 @@ void AStarGrid2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("update"), &AStarGrid2D::update);
 	ClassDB::bind_method(D_METHOD("set_jumping_enabled", "enabled"), &AStarGrid2D::set_jumping_enabled);
 	ClassDB::bind_method(D_METHOD("is_jumping_enabled"), &AStarGrid2D::is_jumping_enabled);
+	ClassDB::bind_method(D_METHOD("set_cluster_size", "cluster_size"), &AStarGrid2D::set_cluster_size);
+	ClassDB::bind_method(D_METHOD("get_cluster_size"), &AStarGrid2D::get_cluster_size);
 	ClassDB::bind_method(D_METHOD("set_diagonal_mode", "mode"), &AStarGrid2D::set_diagonal_mode);
 	ClassDB::bind_method(D_METHOD("get_diagonal_mode"), &AStarGrid2D::get_diagonal_mode);
 	ClassDB::bind_method(D_METHOD("set_default_compute_heuristic", "heuristic"), &AStarGrid2D::set_default_compute_heuristic);
@@ -643,6 +1220,8 @@ void AStarGrid2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_point_position", "id"), &AStarGrid2D::get_point_position);
 	ClassDB::bind_method(D_METHOD("get_point_path", "from_id", "to_id"), &AStarGrid2D::get_point_path);
 	ClassDB::bind_method(D_METHOD("get_id_path", "from_id", "to_id"), &AStarGrid2D::get_id_path);
+	ClassDB::bind_method(D_METHOD("get_distance_field", "goals"), &AStarGrid2D::get_distance_field);
+	ClassDB::bind_method(D_METHOD("get_flow_field", "goals"), &AStarGrid2D::get_flow_field);
 
 	GDVIRTUAL_BIND(_estimate_cost, "from_id", "to_id")
 	GDVIRTUAL_BIND(_compute_cost, "from_id", "to_id")
@@ -653,6 +1232,7 @@ void AStarGrid2D::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::VECTOR2, "cell_size"), "set_cell_size", "get_cell_size");
 
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "jumping_enabled"), "set_jumping_enabled", "is_jumping_enabled");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "cluster_size", PROPERTY_HINT_RANGE, "0,64,1,or_greater"), "set_cluster_size", "get_cluster_size");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "default_compute_heuristic", PROPERTY_HINT_ENUM, "Euclidean,Manhattan,Octile,Chebyshev"), "set_default_compute_heuristic", "get_default_compute_heuristic");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "default_estimate_heuristic", PROPERTY_HINT_ENUM, "Euclidean,Manhattan,Octile,Chebyshev"), "set_default_estimate_heuristic", "get_default_estimate_heuristic");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "diagonal_mode", PROPERTY_HINT_ENUM, "Never,Always,At Least One Walkable,Only If No Obstacles"), "set_diagonal_mode", "get_diagonal_mode");
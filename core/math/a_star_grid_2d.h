@@ -33,6 +33,7 @@
 
 #include "core/object/gdvirtual.gen.inc"
 #include "core/object/ref_counted.h"
+#include "core/templates/hash_map.h"
 #include "core/templates/list.h"
 #include "core/templates/local_vector.h"
 
@@ -63,6 +64,7 @@ private:
 	bool dirty = false;
 
 	bool jumping_enabled = false;
+	int cluster_size = 0;
 	DiagonalMode diagonal_mode = DIAGONAL_MODE_ALWAYS;
 	Heuristic default_compute_heuristic = HEURISTIC_EUCLIDEAN;
 	Heuristic default_estimate_heuristic = HEURISTIC_EUCLIDEAN;
@@ -104,6 +106,34 @@ private:
 
 	uint64_t pass = 1;
 
+	struct DijkstraEntry {
+		real_t dist = 0;
+		uint32_t index = 0;
+	};
+
+	struct SortDijkstraEntries {
+		_FORCE_INLINE_ bool operator()(const DijkstraEntry &A, const DijkstraEntry &B) const { // Returns true when the entry A is worse than B.
+			return A.dist > B.dist;
+		}
+	};
+
+	// Abstract graph used for hierarchical pathfinding. The grid is split in clusters of cluster_size cells,
+	// the nodes are the entrance cells on the cluster borders.
+	struct HierarchicalEdge {
+		Vector2i to;
+		real_t cost = 0;
+	};
+
+	struct HierarchicalNode {
+		LocalVector<HierarchicalEdge> edges;
+	};
+
+	HashMap<Vector2i, HierarchicalNode> hierarchical_nodes;
+	Size2i cluster_grid_size;
+	LocalVector<LocalVector<Vector2i>> cluster_nodes; // Entrance cells of each cluster.
+	LocalVector<bool> cluster_dirty;
+	LocalVector<uint32_t> dirty_clusters;
+
 private: // Internal routines.
 	_FORCE_INLINE_ bool _is_walkable(int32_t p_x, int32_t p_y) const {
 		if (region.has_point(Vector2i(p_x, p_y))) {
@@ -131,9 +161,28 @@ private: // Internal routines.
 		return &points[p_id.y - region.position.y][p_id.x - region.position.x];
 	}
 
+	_FORCE_INLINE_ Vector2i _get_cluster_coords(const Vector2i &p_id) const {
+		return (p_id - region.position) / cluster_size;
+	}
+
+	_FORCE_INLINE_ Rect2i _get_cluster_rect(const Vector2i &p_cluster) const {
+		return Rect2i(region.position + p_cluster * cluster_size, Size2i(cluster_size, cluster_size)).intersection(region);
+	}
+
 	void _get_nbors(Point *p_point, LocalVector<Point *> &r_nbors);
 	Point *_jump(Point *p_from, Point *p_to);
-	bool _solve(Point *p_begin_point, Point *p_end_point);
+	bool _solve(Point *p_begin_point, Point *p_end_point, const Rect2i &p_bounds = Rect2i());
+	void _append_solved_path(Point *p_begin_point, Point *p_end_point, LocalVector<Point *> &r_path) const;
+	void _dijkstra(const LocalVector<Point *> &p_sources, const Rect2i &p_bounds, bool p_reverse, LocalVector<real_t> &r_dist, LocalVector<int32_t> &r_next);
+	bool _solve_field(const TypedArray<Vector2i> &p_goals, LocalVector<real_t> &r_dist, LocalVector<int32_t> &r_next);
+
+	void _reset_clusters();
+	void _mark_clusters_dirty(const Rect2i &p_region);
+	void _connect_clusters(const Vector2i &p_cluster, const Vector2i &p_neighbor);
+	void _add_hierarchical_edge(const Vector2i &p_from, const Vector2i &p_to, real_t p_cost);
+	void _add_hierarchical_transition(const Vector2i &p_from, const Vector2i &p_to);
+	void _update_clusters();
+	bool _solve_hierarchical(Point *p_begin_point, Point *p_end_point, LocalVector<Point *> &r_path);
 
 protected:
 	static void _bind_methods();
@@ -166,6 +215,9 @@ public:
 	void set_jumping_enabled(bool p_enabled);
 	bool is_jumping_enabled() const;
 
+	void set_cluster_size(int p_cluster_size);
+	int get_cluster_size() const;
+
 	void set_diagonal_mode(DiagonalMode p_diagonal_mode);
 	DiagonalMode get_diagonal_mode() const;
 
@@ -189,6 +241,9 @@ public:
 	Vector2 get_point_position(const Vector2i &p_id) const;
 	Vector<Vector2> get_point_path(const Vector2i &p_from, const Vector2i &p_to);
 	TypedArray<Vector2i> get_id_path(const Vector2i &p_from, const Vector2i &p_to);
+
+	PackedFloat32Array get_distance_field(const TypedArray<Vector2i> &p_goals);
+	PackedVector2Array get_flow_field(const TypedArray<Vector2i> &p_goals);
 };
 
 VARIANT_ENUM_CAST(AStarGrid2D::DiagonalMode);
@@ -1251,6 +1251,39 @@ bool ClassDB::set_property(Object *p_object, const StringName &p_property, const
 	return false;
 }
 
+// Resolves the binds set_property() and get_property() would call for a property of a native class,
+// so callers can cache them per class. Setter or getter are null when not backed by a plain bind.
+bool ClassDB::get_property_binds(const StringName &p_class, const StringName &p_property, MethodBind **r_setter, MethodBind **r_getter) {
+	OBJTYPE_RLOCK;
+
+	ClassInfo *check = classes.getptr(p_class);
+	bool getter_shadowed = false;
+	while (check) {
+		if (check->gdextension) {
+			return false; // Extensions may handle properties themselves.
+		}
+
+		const PropertySetGet *psg = check->property_setget.getptr(p_property);
+		if (psg) {
+			if (psg->index >= 0) {
+				return false;
+			}
+			*r_setter = psg->_setptr;
+			*r_getter = getter_shadowed ? nullptr : psg->_getptr;
+			return true;
+		}
+
+		// get_property() returns these before looking at inherited properties.
+		if (check->constant_map.has(p_property) || check->method_map.has(p_property) || check->signal_map.has(p_property)) {
+			getter_shadowed = true;
+		}
+
+		check = check->inherits_ptr;
+	}
+
+	return false;
+}
+
 bool ClassDB::get_property(Object *p_object, const StringName &p_property, Variant &r_value) {
 	ERR_FAIL_NULL_V(p_object, false);
 
@@ -1376,6 +1409,23 @@ StringName ClassDB::get_property_getter(const StringName &p_class, const StringN
 	return StringName();
 }
 
+// Resolves the constructor instantiate() would call for a native class, so callers can cache it.
+// Returns null for classes instantiate() must handle itself (extensions, disabled or editor-only classes).
+Object *(*ClassDB::get_native_creation_func(const StringName &p_class))() {
+	OBJTYPE_RLOCK;
+
+	ClassInfo *ti = classes.getptr(p_class);
+	if (!ti || ti->disabled || ti->gdextension) {
+		return nullptr;
+	}
+#ifdef TOOLS_ENABLED
+	if (ti->api == API_EDITOR) {
+		return nullptr;
+	}
+#endif
+	return ti->creation_func;
+}
+
 bool ClassDB::has_property(const StringName &p_class, const StringName &p_property, bool p_no_inheritance) {
 	ClassInfo *type = classes.getptr(p_class);
 	ClassInfo *check = type;
@@ -34,6 +34,7 @@
 #include "core/core_string_names.h"
 #include "core/object/class_db.h"
 #include "core/object/script_language.h"
+#include "core/os/os.h"
 
 #include <stdio.h>
 
@@ -85,12 +86,60 @@ Error CallQueue::push_set(Object *p_object, const StringName &p_prop, const Vari
 }
 
 Error CallQueue::push_callablep(const Callable &p_callable, const Variant **p_args, int p_argcount, bool p_show_error) {
+	return _push_callablep(p_callable, p_args, p_argcount, p_show_error, coalesce_calls ? COALESCE_SAME_ARGS : COALESCE_NONE);
+}
+
+Error CallQueue::push_callable_coalescedp(const Callable &p_callable, const Variant **p_args, int p_argcount, bool p_show_error) {
+	return _push_callablep(p_callable, p_args, p_argcount, p_show_error, COALESCE_REPLACE_ARGS);
+}
+
+Error CallQueue::_push_callablep(const Callable &p_callable, const Variant **p_args, int p_argcount, bool p_show_error, CoalesceMode p_coalesce) {
 	uint32_t room_needed = sizeof(Message) + sizeof(Variant) * p_argcount;
 
 	ERR_FAIL_COND_V_MSG(room_needed > uint32_t(PAGE_SIZE_BYTES), ERR_INVALID_PARAMETER, "Message is too large to fit on a page (" + itos(PAGE_SIZE_BYTES) + " bytes), consider passing less arguments.");
 
 	LOCK_MUTEX;
 
+	// Thread queues get their pages copied into the main queue, which would leave the pointers dangling.
+	if (this == MessageQueue::thread_singleton) {
+		p_coalesce = COALESCE_NONE;
+	}
+
+	if (p_coalesce == COALESCE_SAME_ARGS) {
+		Message **pending = coalesced_messages.getptr(p_callable);
+		if (pending && (*pending)->args == p_argcount) {
+			const Variant *args = (const Variant *)(*pending + 1);
+			bool same_args = true;
+			for (int i = 0; i < p_argcount && same_args; i++) {
+				same_args = args[i].identity_compare(*p_args[i]);
+			}
+			if (same_args) {
+				flush_stats.coalesced++;
+				UNLOCK_MUTEX;
+				return OK;
+			}
+		}
+		// Other arguments make it another call, which becomes the pending one further pushes compare to.
+	} else if (p_coalesce == COALESCE_REPLACE_ARGS) {
+		Message **pending = coalesced_messages.getptr(p_callable);
+		if (pending) {
+			Message *old_msg = *pending;
+			flush_stats.coalesced++;
+			if (old_msg->args == p_argcount) {
+				Variant *args = (Variant *)(old_msg + 1);
+				for (int i = 0; i < p_argcount; i++) {
+					args[i] = *p_args[i];
+				}
+				UNLOCK_MUTEX;
+				return OK;
+			}
+			// Can't be updated in place, so disable the old message and queue a new one at the end.
+			old_msg->callable = Callable();
+			old_msg->type &= ~(FLAG_COALESCE | FLAG_NULL_IS_OK);
+			coalesced_messages.erase(p_callable);
+		}
+	}
+
 	_ensure_first_page();
 
 	if ((page_bytes[pages_used - 1] + room_needed) > uint32_t(PAGE_SIZE_BYTES)) {
@@ -118,6 +167,10 @@ Error CallQueue::push_callablep(const Callable &p_callable, const Variant **p_ar
 	if (p_callable.get_object_id().is_null() && p_callable.is_valid()) {
 		msg->type |= FLAG_NULL_IS_OK;
 	}
+	if (p_coalesce != COALESCE_NONE) {
+		msg->type |= FLAG_COALESCE;
+		coalesced_messages.insert(p_callable, msg);
+	}
 
 	buffer_end += sizeof(Message);
 
@@ -128,6 +181,8 @@ Error CallQueue::push_callablep(const Callable &p_callable, const Variant **p_ar
 	}
 
 	page_bytes[pages_used - 1] += room_needed;
+	pending_messages++;
+	pending_bytes += room_needed;
 
 	UNLOCK_MUTEX;
 
@@ -169,6 +224,8 @@ Error CallQueue::push_set(ObjectID p_id, const StringName &p_prop, const Variant
 	*v = p_value;
 
 	page_bytes[pages_used - 1] += room_needed;
+	pending_messages++;
+	pending_bytes += room_needed;
 	UNLOCK_MUTEX;
 
 	return OK;
@@ -202,6 +259,8 @@ Error CallQueue::push_notification(ObjectID p_id, int p_notification) {
 	msg->notification = p_notification;
 
 	page_bytes[pages_used - 1] += room_needed;
+	pending_messages++;
+	pending_bytes += room_needed;
 	UNLOCK_MUTEX;
 
 	return OK;
@@ -268,15 +327,20 @@ Error CallQueue::_transfer_messages_to_main_queue() {
 		mq->page_bytes[mq->pages_used - 1] = page_bytes[src_page];
 	}
 
+	mq->pending_messages += pending_messages;
+	mq->pending_bytes += pending_bytes;
+
 	mq->mutex.unlock();
 
 	page_bytes[0] = 0;
 	pages_used = 1;
+	pending_messages = 0;
+	pending_bytes = 0;
 
 	return OK;
 }
 
-Error CallQueue::flush() {
+Error CallQueue::flush(uint64_t p_budget_usec) {
 	// Thread overrides are not meant to be flushed, but appended to the main one.
 	if (unlikely(this == MessageQueue::thread_singleton)) {
 		return _transfer_messages_to_main_queue();
@@ -297,8 +361,12 @@ Error CallQueue::flush() {
 
 	flushing = true;
 
-	uint32_t i = 0;
-	uint32_t offset = 0;
+	const uint64_t flush_begin = OS::get_singleton()->get_ticks_usec();
+	flush_stats.max_depth = MAX(flush_stats.max_depth, pending_messages);
+	flush_stats.max_bytes = MAX(flush_stats.max_bytes, pending_bytes);
+
+	uint32_t i = flush_page;
+	uint32_t offset = flush_offset;
 
 	while (i < pages_used && offset < page_bytes[i]) {
 		Page *page = pages[i];
@@ -314,6 +382,16 @@ Error CallQueue::flush() {
 
 		//pre-advance so this function is reentrant
 		offset += advance;
+		pending_messages--;
+		pending_bytes -= advance;
+
+		// Once dispatch starts, pushing the same callable again must queue a new call.
+		if (message->type & FLAG_COALESCE) {
+			Message **pending = coalesced_messages.getptr(message->callable);
+			if (pending && *pending == message) {
+				coalesced_messages.erase(message->callable);
+			}
+		}
 
 		Object *target = message->callable.get_object();
 
@@ -353,10 +431,36 @@ Error CallQueue::flush() {
 			i++;
 			offset = 0;
 		}
+
+		if (p_budget_usec && OS::get_singleton()->get_ticks_usec() - flush_begin >= p_budget_usec) {
+			break;
+		}
 	}
 
-	page_bytes[0] = 0;
-	pages_used = 1;
+	if (i < pages_used && offset < page_bytes[i]) {
+		// Out of budget, resume from here next time. The pages consumed so far are moved after the
+		// used ones, where _add_page() reuses them, so a queue that is never fully drained doesn't
+		// keep growing. Messages are not moved, as coalesced calls point into their pages.
+		for (uint32_t j = 0; j < i; j++) {
+			Page *consumed = pages[0];
+			for (uint32_t k = 1; k < pages_used; k++) {
+				pages[k - 1] = pages[k];
+				page_bytes[k - 1] = page_bytes[k];
+			}
+			pages[pages_used - 1] = consumed;
+			page_bytes[pages_used - 1] = 0;
+		}
+		pages_used -= i;
+		flush_page = 0;
+		flush_offset = offset;
+	} else {
+		page_bytes[0] = 0;
+		pages_used = 1;
+		flush_page = 0;
+		flush_offset = 0;
+	}
+
+	flush_stats.max_flush_usec = MAX(flush_stats.max_flush_usec, OS::get_singleton()->get_ticks_usec() - flush_begin);
 
 	flushing = false;
 	UNLOCK_MUTEX;
@@ -371,8 +475,8 @@ void CallQueue::clear() {
 		return; // Nothing to clear.
 	}
 
-	for (uint32_t i = 0; i < pages_used; i++) {
-		uint32_t offset = 0;
+	for (uint32_t i = flush_page; i < pages_used; i++) {
+		uint32_t offset = i == flush_page ? flush_offset : 0;
 		while (offset < page_bytes[i]) {
 			Page *page = pages[i];
 
@@ -400,6 +504,11 @@ void CallQueue::clear() {
 
 	pages_used = 1;
 	page_bytes[0] = 0;
+	flush_page = 0;
+	flush_offset = 0;
+	pending_messages = 0;
+	pending_bytes = 0;
+	coalesced_messages.clear();
 
 	UNLOCK_MUTEX;
 }
@@ -411,8 +520,8 @@ void CallQueue::statistics() {
 	HashMap<Callable, int> call_count;
 	int null_count = 0;
 
-	for (uint32_t i = 0; i < pages_used; i++) {
-		uint32_t offset = 0;
+	for (uint32_t i = flush_page; i < pages_used; i++) {
+		uint32_t offset = i == flush_page ? flush_offset : 0;
 		while (offset < page_bytes[i]) {
 			Page *page = pages[i];
 
@@ -482,6 +591,7 @@ void CallQueue::statistics() {
 	}
 
 	print_line("TOTAL PAGES: " + itos(pages_used) + " (" + itos(pages_used * PAGE_SIZE_BYTES) + " bytes).");
+	print_line("PENDING: " + itos(pending_messages) + " messages (" + itos(pending_bytes) + " bytes), " + itos(coalesced_messages.size()) + " coalesced.");
 	print_line("NULL count: " + itos(null_count));
 
 	for (const KeyValue<StringName, int> &E : set_count) {
@@ -507,7 +617,7 @@ bool CallQueue::has_messages() const {
 	if (pages_used == 0) {
 		return false;
 	}
-	if (pages_used == 1 && page_bytes[0] == 0) {
+	if (flush_page == pages_used - 1 && flush_offset == page_bytes[flush_page]) {
 		return false;
 	}
 
@@ -518,6 +628,30 @@ int CallQueue::get_max_buffer_usage() const {
 	return pages.size() * PAGE_SIZE_BYTES;
 }
 
+void CallQueue::set_coalesce_calls(bool p_enable) {
+	coalesce_calls = p_enable;
+}
+
+bool CallQueue::is_coalescing_calls() const {
+	return coalesce_calls;
+}
+
+uint32_t CallQueue::get_pending_message_count() const {
+	return pending_messages;
+}
+
+uint32_t CallQueue::get_pending_bytes() const {
+	return pending_bytes;
+}
+
+CallQueue::FlushStatistics CallQueue::get_flush_statistics() const {
+	return flush_stats;
+}
+
+void CallQueue::reset_flush_statistics() {
+	flush_stats = FlushStatistics();
+}
+
 CallQueue::CallQueue(Allocator *p_custom_allocator, uint32_t p_max_pages, const String &p_error_text) {
 	if (p_custom_allocator) {
 		allocator = p_custom_allocator;
@@ -571,6 +705,7 @@ MessageQueue::MessageQueue() :
 				"Message queue out of memory. Try increasing 'memory/limits/message_queue/max_size_mb' in project settings.") {
 	ERR_FAIL_COND_MSG(main_singleton != nullptr, "A MessageQueue singleton already exists.");
 	main_singleton = this;
+	set_coalesce_calls(GLOBAL_DEF("application/run/coalesce_deferred_calls", false));
 }
 
 MessageQueue::~MessageQueue() {
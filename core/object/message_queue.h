@@ -33,6 +33,7 @@
 
 #include "core/object/object_id.h"
 #include "core/os/thread_safe.h"
+#include "core/templates/hash_map.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/paged_allocator.h"
 #include "core/variant/variant.h"
@@ -55,15 +56,30 @@ public:
 	// Needs to lock because there can be multiple of these allocators in several threads.
 	typedef PagedAllocator<Page, true> Allocator;
 
+	// Peak values observed by flush() since the last call to reset_flush_statistics().
+	struct FlushStatistics {
+		uint32_t max_depth = 0; // Messages pending when a flush started.
+		uint32_t max_bytes = 0; // Buffer bytes pending when a flush started.
+		uint64_t max_flush_usec = 0;
+		uint32_t coalesced = 0; // Pushes merged into an already pending message.
+	};
+
 private:
 	enum {
 		TYPE_CALL,
 		TYPE_NOTIFICATION,
 		TYPE_SET,
 		TYPE_END, // End marker.
+		FLAG_COALESCE = 1 << 12,
 		FLAG_NULL_IS_OK = 1 << 13,
 		FLAG_SHOW_ERROR = 1 << 14,
-		FLAG_MASK = FLAG_NULL_IS_OK - 1,
+		FLAG_MASK = FLAG_COALESCE - 1,
+	};
+
+	enum CoalesceMode {
+		COALESCE_NONE,
+		COALESCE_SAME_ARGS, // Merge with the pending call only if the arguments are the same.
+		COALESCE_REPLACE_ARGS, // Merge with the pending call, replacing its arguments.
 	};
 
 	Mutex mutex;
@@ -77,6 +93,14 @@ private:
 	uint32_t pages_used = 0;
 	bool flushing = false;
 
+	// Where the next flush resumes, when a budgeted flush left messages behind.
+	uint32_t flush_page = 0;
+	uint32_t flush_offset = 0;
+
+	uint32_t pending_messages = 0;
+	uint32_t pending_bytes = 0;
+	FlushStatistics flush_stats;
+
 #ifdef DEV_ENABLED
 	bool is_current_thread_override = false;
 #endif
@@ -98,7 +122,13 @@ private:
 		}
 	}
 
+	// Pending calls pushed with coalescing, so a repeated push can update them in place.
+	// Only used by queues that are flushed directly, as thread queues copy their pages around.
+	HashMap<Callable, Message *> coalesced_messages;
+	bool coalesce_calls = false;
+
 	Error _transfer_messages_to_main_queue();
+	Error _push_callablep(const Callable &p_callable, const Variant **p_args, int p_argcount, bool p_show_error, CoalesceMode p_coalesce);
 
 	void _add_page();
 
@@ -122,6 +152,19 @@ public:
 	Error push_set(ObjectID p_id, const StringName &p_prop, const Variant &p_value);
 	Error push_notification(ObjectID p_id, int p_notification);
 
+	// Like push_callablep(), but if the same callable is still pending, its arguments are replaced
+	// instead of queuing a second call.
+	Error push_callable_coalescedp(const Callable &p_callable, const Variant **p_args, int p_argcount, bool p_show_error = false);
+	template <typename... VarArgs>
+	Error push_callable_coalesced(const Callable &p_callable, VarArgs... p_args) {
+		Variant args[sizeof...(p_args) + 1] = { p_args..., Variant() }; // +1 makes sure zero sized arrays are also supported.
+		const Variant *argptrs[sizeof...(p_args) + 1];
+		for (uint32_t i = 0; i < sizeof...(p_args); i++) {
+			argptrs[i] = &args[i];
+		}
+		return push_callable_coalescedp(p_callable, sizeof...(p_args) == 0 ? nullptr : (const Variant **)argptrs, sizeof...(p_args));
+	}
+
 	template <typename... VarArgs>
 	Error push_callable(const Callable &p_callable, VarArgs... p_args) {
 		Variant args[sizeof...(p_args) + 1] = { p_args..., Variant() }; // +1 makes sure zero sized arrays are also supported.
@@ -146,7 +189,8 @@ public:
 	Error push_notification(Object *p_object, int p_notification);
 	Error push_set(Object *p_object, const StringName &p_prop, const Variant &p_value);
 
-	Error flush();
+	// With a non-zero budget, stops once the budget is spent and keeps the remaining messages for the next flush.
+	Error flush(uint64_t p_budget_usec = 0);
 	void clear();
 	void statistics();
 
@@ -155,6 +199,16 @@ public:
 	bool is_flushing() const;
 	int get_max_buffer_usage() const;
 
+	// When enabled, a call pushed to this queue is dropped if the same callable is still pending with
+	// the same arguments. Unlike push_callable_coalescedp(), calls with other arguments are all kept.
+	void set_coalesce_calls(bool p_enable);
+	bool is_coalescing_calls() const;
+
+	uint32_t get_pending_message_count() const;
+	uint32_t get_pending_bytes() const;
+	FlushStatistics get_flush_statistics() const;
+	void reset_flush_statistics();
+
 	CallQueue(Allocator *p_custom_allocator = 0, uint32_t p_max_pages = 8192, const String &p_error_text = String());
 	virtual ~CallQueue();
 };
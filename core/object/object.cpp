@@ -1087,24 +1087,37 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 		return ERR_UNAVAILABLE;
 	}
 
-	// If this is a ref-counted object, prevent it from being destroyed during signal emission,
-	// which is needed in certain edge cases; e.g., https://github.com/godotengine/godot/issues/73889.
-	Ref<RefCounted> rc = Ref<RefCounted>(Object::cast_to<RefCounted>(this));
-
-	List<_ObjectSignalDisconnectData> disconnect_data;
+	if (s->slot_map.is_empty()) {
+		return OK;
+	}
 
-	// Ensure that disconnecting the signal or even deleting the object
-	// will not affect the signal calling.
-	LocalVector<Connection> slot_conns;
-	slot_conns.resize(s->slot_map.size());
-	{
+	if (s->slot_snapshot_dirty) {
+		Vector<Connection> snapshot;
+		snapshot.resize(s->slot_map.size());
+		Connection *snapshot_ptrw = snapshot.ptrw();
 		uint32_t idx = 0;
 		for (const KeyValue<Callable, SignalData::Slot> &slot_kv : s->slot_map) {
-			slot_conns[idx++] = slot_kv.value.conn;
+			snapshot_ptrw[idx++] = slot_kv.value.conn;
 		}
 		DEV_ASSERT(idx == s->slot_map.size());
+		s->slot_snapshot = snapshot;
+		s->slot_snapshot_dirty = false;
 	}
 
+	// If this is a ref-counted object, prevent it from being destroyed during signal emission,
+	// which is needed in certain edge cases; e.g., https://github.com/godotengine/godot/issues/73889.
+	Ref<RefCounted> rc;
+	if (is_ref_counted()) {
+		rc = Ref<RefCounted>(static_cast<RefCounted *>(this));
+	}
+
+	List<_ObjectSignalDisconnectData> disconnect_data;
+
+	// Ensure that disconnecting the signal or even deleting the object
+	// will not affect the signal calling. The snapshot is shared, so
+	// holding it costs a reference instead of a copy.
+	const Vector<Connection> slot_conns = s->slot_snapshot;
+
 	OBJ_DEBUG_LOCK
 
 	Error err = OK;
@@ -1377,6 +1390,9 @@ Error Object::connect(const StringName &p_signal, const Callable &p_callable, ui
 
 	//use callable version as key, so binds can be ignored
 	s->slot_map[*target.get_base_comparator()] = slot;
+	// Drop the stale snapshot now, so it doesn't keep disconnected callables alive.
+	s->slot_snapshot = Vector<Connection>();
+	s->slot_snapshot_dirty = true;
 
 	return OK;
 }
@@ -1436,6 +1452,9 @@ bool Object::_disconnect(const StringName &p_signal, const Callable &p_callable,
 	}
 
 	s->slot_map.erase(*p_callable.get_base_comparator());
+	// Drop the stale snapshot now, so it doesn't keep disconnected callables alive.
+	s->slot_snapshot = Vector<Connection>();
+	s->slot_snapshot_dirty = true;
 
 	if (s->slot_map.is_empty() && ClassDB::has_signal(get_class_name(), p_signal)) {
 		//not user signal, delete
@@ -615,6 +615,10 @@ private:
 
 		MethodInfo user;
 		HashMap<Callable, Slot, HashableHasher<Callable>> slot_map;
+		// Immutable copy of the connections emitted in order. Rebuilt lazily after
+		// connecting or disconnecting; emission only takes a reference to it.
+		Vector<Connection> slot_snapshot;
+		bool slot_snapshot_dirty = false;
 	};
 
 	HashMap<StringName, SignalData> signal_map;
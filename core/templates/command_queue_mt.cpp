@@ -33,12 +33,132 @@
 #include "core/config/project_settings.h"
 #include "core/os/os.h"
 
-void CommandQueueMT::lock() {
-	mutex.lock();
+thread_local CommandQueueMT::ProducerSlots CommandQueueMT::producer_slots;
+SafeNumeric<uint64_t> CommandQueueMT::queue_id_counter;
+
+CommandQueueMT::ProducerSlots::~ProducerSlots() {
+	for (const ProducerSlot &slot : slots) {
+		slot.buffer->orphaned.set();
+		_release_producer(slot.buffer);
+	}
+}
+
+void CommandQueueMT::_release_producer(ProducerBuffer *p_producer) {
+	if (p_producer->refcount.unref()) {
+		memdelete(p_producer);
+	}
+}
+
+CommandQueueMT::ProducerBuffer *CommandQueueMT::_register_producer() {
+	ProducerBuffer *producer = memnew(ProducerBuffer);
+	// One reference for the queue and one for the producing thread.
+	producer->refcount.init(2);
+
+	producers_mutex.lock();
+	// Drop the buffers of threads that exited since, so short-lived threads
+	// don't accumulate. Ones with commands left are kept by the pending list.
+	for (uint32_t i = 0; i < producers.size();) {
+		if (producers[i]->orphaned.is_set()) {
+			_release_producer(producers[i]);
+			producers.remove_at_unordered(i);
+		} else {
+			i++;
+		}
+	}
+	producers.push_back(producer);
+	producers_mutex.unlock();
+
+	ProducerSlot slot;
+	slot.queue_id = queue_id;
+	slot.buffer = producer;
+	producer_slots.slots.push_back(slot);
+	return producer;
 }
 
-void CommandQueueMT::unlock() {
-	mutex.unlock();
+void CommandQueueMT::_flush() {
+	MutexLock flush_lock(flush_mutex);
+	if (flushing) {
+		// Commands flushing the queue they run on wait for the next flush.
+		return;
+	}
+	if (!_has_pending()) {
+		return;
+	}
+
+	// Only producers that pushed since the last flush are visited. Producers
+	// joining the pending list after the cut only hold commands past it, and
+	// those past it are held back below, so no command may be missing while a
+	// later one is executed.
+	pending_mutex.lock();
+	uint64_t cut_seq = command_seq.get();
+	for (ProducerBuffer *producer : pending_producers) {
+		flush_producers.push_back(producer);
+	}
+	pending_producers.clear();
+	pending_mutex.unlock();
+
+	for (ProducerBuffer *producer : flush_producers) {
+		producer->mutex.lock();
+		producer->write_buffer ^= 1;
+		producer->read_ptr = 0;
+		if (producer->last_seq >= cut_seq) {
+			LocalVector<uint8_t> &flush_mem = producer->command_mem[producer->write_buffer ^ 1];
+			uint64_t end = 0;
+			while (*(uint64_t *)&flush_mem[end] < cut_seq) {
+				end += *(uint64_t *)&flush_mem[end + 8] + 16;
+			}
+			LocalVector<uint8_t> &write_mem = producer->command_mem[producer->write_buffer];
+			write_mem.resize(flush_mem.size() - end);
+			memcpy(write_mem.ptr(), &flush_mem[end], write_mem.size());
+			flush_mem.resize(end);
+
+			producer->refcount.ref();
+			pending_mutex.lock();
+			pending_producers.push_back(producer);
+			pending_mutex.unlock();
+		} else {
+			producer->pending = false;
+		}
+		producer->mutex.unlock();
+	}
+	flushed_seq.set(cut_seq);
+
+	flushing = true;
+	while (true) {
+		// Merge the producer buffers back into push order.
+		ProducerBuffer *next = nullptr;
+		uint64_t next_seq = 0;
+		for (ProducerBuffer *producer : flush_producers) {
+			const LocalVector<uint8_t> &flush_mem = producer->command_mem[producer->write_buffer ^ 1];
+			if (producer->read_ptr >= flush_mem.size()) {
+				continue;
+			}
+			uint64_t seq = *(uint64_t *)&flush_mem[producer->read_ptr];
+			if (!next || seq < next_seq) {
+				next = producer;
+				next_seq = seq;
+			}
+		}
+		if (!next) {
+			break;
+		}
+
+		LocalVector<uint8_t> &flush_mem = next->command_mem[next->write_buffer ^ 1];
+		uint64_t size = *(uint64_t *)&flush_mem[next->read_ptr + 8];
+		CommandBase *cmd = reinterpret_cast<CommandBase *>(&flush_mem[next->read_ptr + 16]);
+		next->read_ptr += size + 16;
+
+		cmd->call(); //execute the function
+		cmd->post(); //release in case it needs sync/ret
+		cmd->~CommandBase(); //should be done, so erase the command
+	}
+	flushing = false;
+
+	for (ProducerBuffer *producer : flush_producers) {
+		producer->command_mem[producer->write_buffer ^ 1].clear();
+		_release_producer(producer);
+	}
+	flush_producers.clear();
 }
 
 void CommandQueueMT::wait_for_flush() {
@@ -50,7 +170,7 @@ CommandQueueMT::SyncSemaphore *CommandQueueMT::_alloc_sync_sem() {
 	int idx = -1;
 
 	while (true) {
-		lock();
+		sync_sem_mutex.lock();
 		for (int i = 0; i < SYNC_SEMAPHORES; i++) {
 			if (!sync_sems[i].in_use) {
 				sync_sems[i].in_use = true;
@@ -58,7 +178,7 @@ CommandQueueMT::SyncSemaphore *CommandQueueMT::_alloc_sync_sem() {
 				break;
 			}
 		}
-		unlock();
+		sync_sem_mutex.unlock();
 
 		if (idx == -1) {
 			wait_for_flush();
@@ -71,6 +191,7 @@ CommandQueueMT::SyncSemaphore *CommandQueueMT::_alloc_sync_sem() {
 }
 
 CommandQueueMT::CommandQueueMT(bool p_sync) {
+	queue_id = queue_id_counter.increment();
 	if (p_sync) {
 		sync = memnew(Semaphore);
 	}
@@ -80,4 +201,10 @@ CommandQueueMT::~CommandQueueMT() {
 	if (sync) {
 		memdelete(sync);
 	}
+	for (ProducerBuffer *producer : producers) {
+		_release_producer(producer);
+	}
+	for (ProducerBuffer *producer : pending_producers) {
+		_release_producer(producer);
+	}
 }
@@ -36,6 +36,7 @@
 #include "core/os/semaphore.h"
 #include "core/string/print_string.h"
 #include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
 #include "core/templates/simple_type.h"
 #include "core/typedefs.h"
 
@@ -250,13 +251,12 @@
 #define DECL_PUSH(N)                                                         \
 	template <class T, class M COMMA(N) COMMA_SEP_LIST(TYPE_PARAM, N)>       \
 	void push(T *p_instance, M p_method COMMA(N) COMMA_SEP_LIST(PARAM, N)) { \
-		CMD_TYPE(N) *cmd = allocate_and_lock<CMD_TYPE(N)>();                 \
+		ProducerBuffer *producer = _get_producer();                          \
+		CMD_TYPE(N) *cmd = allocate_and_lock<CMD_TYPE(N)>(producer);         \
 		cmd->instance = p_instance;                                          \
 		cmd->method = p_method;                                              \
 		SEMIC_SEP_LIST(CMD_ASSIGN_PARAM, N);                                 \
-		unlock();                                                            \
-		if (sync)                                                            \
-			sync->post();                                                    \
+		unlock_and_wake(producer);                                           \
 	}
 
 #define CMD_RET_TYPE(N) CommandRet##N<T, M, COMMA_SEP_LIST(TYPE_ARG, N) COMMA(N) R>
@@ -265,15 +265,14 @@
 	template <class T, class M, COMMA_SEP_LIST(TYPE_PARAM, N) COMMA(N) class R>                \
 	void push_and_ret(T *p_instance, M p_method, COMMA_SEP_LIST(PARAM, N) COMMA(N) R *r_ret) { \
 		SyncSemaphore *ss = _alloc_sync_sem();                                                 \
-		CMD_RET_TYPE(N) *cmd = allocate_and_lock<CMD_RET_TYPE(N)>();                           \
+		ProducerBuffer *producer = _get_producer();                                            \
+		CMD_RET_TYPE(N) *cmd = allocate_and_lock<CMD_RET_TYPE(N)>(producer);                   \
 		cmd->instance = p_instance;                                                            \
 		cmd->method = p_method;                                                                \
 		SEMIC_SEP_LIST(CMD_ASSIGN_PARAM, N);                                                   \
 		cmd->ret = r_ret;                                                                      \
 		cmd->sync_sem = ss;                                                                    \
-		unlock();                                                                              \
-		if (sync)                                                                              \
-			sync->post();                                                                      \
+		unlock_and_wake(producer);                                                             \
 		ss->sem.wait();                                                                        \
 		ss->in_use = false;                                                                    \
 	}
@@ -284,14 +283,13 @@
 	template <class T, class M COMMA(N) COMMA_SEP_LIST(TYPE_PARAM, N)>                \
 	void push_and_sync(T *p_instance, M p_method COMMA(N) COMMA_SEP_LIST(PARAM, N)) { \
 		SyncSemaphore *ss = _alloc_sync_sem();                                        \
-		CMD_SYNC_TYPE(N) *cmd = allocate_and_lock<CMD_SYNC_TYPE(N)>();                \
+		ProducerBuffer *producer = _get_producer();                                   \
+		CMD_SYNC_TYPE(N) *cmd = allocate_and_lock<CMD_SYNC_TYPE(N)>(producer);        \
 		cmd->instance = p_instance;                                                   \
 		cmd->method = p_method;                                                       \
 		SEMIC_SEP_LIST(CMD_ASSIGN_PARAM, N);                                          \
 		cmd->sync_sem = ss;                                                           \
-		unlock();                                                                     \
-		if (sync)                                                                     \
-			sync->post();                                                             \
+		unlock_and_wake(producer);                                                    \
 		ss->sem.wait();                                                               \
 		ss->in_use = false;                                                           \
 	}
@@ -336,53 +334,110 @@ class CommandQueueMT {
 		SYNC_SEMAPHORES = 8
 	};
 
-	LocalVector<uint8_t> command_mem;
+	// Every producer thread records commands into its own buffer, so pushes
+	// from different threads never contend on a shared lock. Each command is
+	// stamped with a global sequence number, and flushing merges the buffers
+	// back into push order.
+	struct ProducerBuffer {
+		BinaryMutex mutex;
+		// Double buffered: pushes go to one while a flush drains the other.
+		LocalVector<uint8_t> command_mem[2];
+		uint32_t write_buffer = 0;
+		uint64_t read_ptr = 0;
+		uint64_t last_seq = 0;
+		// Set on the first push after a flush, when the buffer is added to the pending list.
+		bool pending = false;
+		// Set once the producing thread exits, so the queue can drop the buffer.
+		SafeFlag orphaned;
+		// Held by the producing thread, the queue and the pending list.
+		SafeRefCount refcount;
+	};
+
+	struct ProducerSlot {
+		uint64_t queue_id = 0;
+		ProducerBuffer *buffer = nullptr;
+	};
+
+	// Releases the buffers of a thread when it exits.
+	struct ProducerSlots {
+		LocalVector<ProducerSlot> slots;
+		~ProducerSlots();
+	};
+
+	static thread_local ProducerSlots producer_slots;
+	static SafeNumeric<uint64_t> queue_id_counter;
+
+	uint64_t queue_id = 0;
+	LocalVector<ProducerBuffer *> producers;
+	LocalVector<ProducerBuffer *> pending_producers;
+	LocalVector<ProducerBuffer *> flush_producers;
+	BinaryMutex producers_mutex;
+	BinaryMutex pending_mutex;
+	Mutex flush_mutex;
+	bool flushing = false;
+
+	SafeNumeric<uint64_t> command_seq;
+	SafeNumeric<uint64_t> flushed_seq;
+	// Wakeups owed to the consumer; negative while it sleeps in wait_and_flush(),
+	// which is the only time pushing has to touch the semaphore. Pushes made
+	// while a wakeup is already owed are coalesced into it.
+	SafeNumeric<int32_t> pending_wakeups;
+
 	SyncSemaphore sync_sems[SYNC_SEMAPHORES];
-	Mutex mutex;
+	BinaryMutex sync_sem_mutex;
 	Semaphore *sync = nullptr;
 
+	_FORCE_INLINE_ ProducerBuffer *_get_producer() {
+		for (const ProducerSlot &slot : producer_slots.slots) {
+			if (slot.queue_id == queue_id) {
+				return slot.buffer;
+			}
+		}
+		return _register_producer();
+	}
+
 	template <class T>
-	T *allocate() {
-		// alloc size is size+T+safeguard
+	T *allocate_and_lock(ProducerBuffer *p_producer) {
+		p_producer->mutex.lock();
+		uint64_t seq;
+		if (!p_producer->pending) {
+			// The sequence number is taken under the pending lock, so a flush
+			// that missed this producer only cuts before its commands.
+			p_producer->pending = true;
+			p_producer->refcount.ref();
+			pending_mutex.lock();
+			pending_producers.push_back(p_producer);
+			seq = command_seq.postincrement();
+			pending_mutex.unlock();
+		} else {
+			seq = command_seq.postincrement();
+		}
+		// alloc size is sequence+size+T+safeguard
 		uint32_t alloc_size = ((sizeof(T) + 8 - 1) & ~(8 - 1));
+		LocalVector<uint8_t> &command_mem = p_producer->command_mem[p_producer->write_buffer];
 		uint64_t size = command_mem.size();
-		command_mem.resize(size + alloc_size + 8);
-		*(uint64_t *)&command_mem[size] = alloc_size;
-		T *cmd = memnew_placement(&command_mem[size + 8], T);
+		command_mem.resize(size + alloc_size + 16);
+		*(uint64_t *)&command_mem[size] = seq;
+		p_producer->last_seq = seq;
+		*(uint64_t *)&command_mem[size + 8] = alloc_size;
+		T *cmd = memnew_placement(&command_mem[size + 16], T);
 		return cmd;
 	}
 
-	template <class T>
-	T *allocate_and_lock() {
-		lock();
-		T *ret = allocate<T>();
-		return ret;
-	}
-
-	void _flush() {
-		lock();
-
-		uint64_t read_ptr = 0;
-		uint64_t limit = command_mem.size();
-
-		while (read_ptr < limit) {
-			uint64_t size = *(uint64_t *)&command_mem[read_ptr];
-			read_ptr += 8;
-			CommandBase *cmd = reinterpret_cast<CommandBase *>(&command_mem[read_ptr]);
-
-			cmd->call(); //execute the function
-			cmd->post(); //release in case it needs sync/ret
-			cmd->~CommandBase(); //should be done, so erase the command
-
-			read_ptr += size;
+	_FORCE_INLINE_ void unlock_and_wake(ProducerBuffer *p_producer) {
+		p_producer->mutex.unlock();
+		if (sync && pending_wakeups.get() <= 0 && pending_wakeups.postincrement() < 0) {
+			sync->post();
 		}
+	}
 
-		command_mem.clear();
-		unlock();
+	_FORCE_INLINE_ bool _has_pending() const {
+		return command_seq.get() != flushed_seq.get();
 	}
 
-	void lock();
-	void unlock();
+	static void _release_producer(ProducerBuffer *p_producer);
+	ProducerBuffer *_register_producer();
+	void _flush();
 	void wait_for_flush();
 	SyncSemaphore *_alloc_sync_sem();
 
@@ -400,7 +455,7 @@ public:
 	SPACE_SEP_LIST(DECL_PUSH_AND_SYNC, 15)
 
 	_FORCE_INLINE_ void flush_if_pending() {
-		if (unlikely(command_mem.size() > 0)) {
+		if (unlikely(_has_pending())) {
 			_flush();
 		}
 	}
@@ -410,7 +465,13 @@ public:
 
 	void wait_and_flush() {
 		ERR_FAIL_NULL(sync);
-		sync->wait();
+		// Take every wakeup owed so far at once, and only sleep when there are none.
+		int32_t owed = pending_wakeups.get();
+		if (owed > 0) {
+			pending_wakeups.sub(owed);
+		} else if (pending_wakeups.postdecrement() <= 0) {
+			sync->wait();
+		}
 		_flush();
 	}
 
@@ -63,6 +63,7 @@ public:
 	// These functions assume that a framebuffer and texture are bound already. They only manage the shader, uniforms, and vertex array.
 	void copy_to_rect(const Rect2 &p_rect);
 	void copy_to_and_from_rect(const Rect2 &p_rect);
+	void copy_to_rect_from_rect(const Rect2 &p_rect, const Rect2 &p_source_rect);
 	void copy_screen();
 	void copy_cube_to_rect(const Rect2 &p_rect);
 	void bilinear_blur(GLuint p_source_texture, int p_mipmap_count, const Rect2i &p_region);
@@ -45,6 +45,9 @@
 #include "storage/particles_storage.h"
 #include "storage/texture_storage.h"
 
+#define _GL_MAP_PERSISTENT_BIT 0x0040
+#define _GL_MAP_COHERENT_BIT 0x0080
+
 void RasterizerCanvasGLES3::_update_transform_2d_to_mat4(const Transform2D &p_transform, float *p_mat4) {
 	p_mat4[0] = p_transform.columns[0][0];
 	p_mat4[1] = p_transform.columns[0][1];
@@ -111,6 +114,9 @@ void RasterizerCanvasGLES3::canvas_render_items(RID p_to_render_target, Item *p_
 
 	Transform2D canvas_transform_inverse = p_canvas_transform.affine_inverse();
 
+	// Copy textures first drawn last frame into the atlas, this changes the bound framebuffer.
+	texture_storage->update_canvas_texture_atlas();
+
 	// Clear out any state that may have been left from the 3D pass.
 	reset_canvas();
 
@@ -581,17 +587,19 @@ void RasterizerCanvasGLES3::_render_items(RID p_to_render_target, int p_item_cou
 	// Record Batches.
 	// First item always forms its own batch.
 	bool batch_broken = false;
-	_new_batch(batch_broken);
+	_new_batch(batch_broken, RS::CANVAS_BATCH_BREAK_MAX);
 
-	// Override the start position and index as we want to start from where we finished off last time.
-	state.canvas_instance_batches[state.current_batch_index].start = state.last_item_index;
+	// Instances are recorded relative to the chunk, _upload_instance_data() places the chunk in a buffer.
+	state.canvas_instance_batches[state.current_batch_index].start = 0;
+	state.instance_chunk_first_batch = state.current_batch_index;
+	_begin_instance_chunk();
 	index = 0;
 
 	for (int i = 0; i < p_item_count; i++) {
 		Item *ci = items[i];
 
 		if (ci->final_clip_owner != state.canvas_instance_batches[state.current_batch_index].clip) {
-			_new_batch(batch_broken);
+			_new_batch(batch_broken, RS::CANVAS_BATCH_BREAK_CLIP);
 			state.canvas_instance_batches[state.current_batch_index].clip = ci->final_clip_owner;
 			current_clip = ci->final_clip_owner;
 		}
@@ -612,7 +620,7 @@ void RasterizerCanvasGLES3::_render_items(RID p_to_render_target, int p_item_cou
 		}
 
 		if (material != state.canvas_instance_batches[state.current_batch_index].material) {
-			_new_batch(batch_broken);
+			_new_batch(batch_broken, RS::CANVAS_BATCH_BREAK_MATERIAL);
 
 			GLES3::CanvasMaterialData *material_data = nullptr;
 			if (material.is_valid()) {
@@ -636,21 +644,17 @@ void RasterizerCanvasGLES3::_render_items(RID p_to_render_target, int p_item_cou
 
 	if (index == 0) {
 		// Nothing to render, just return.
+		if (state.instance_chunk_in_ring) {
+			state.instance_ring.head -= data.max_instances_per_buffer;
+			state.instance_chunk_in_ring = false;
+		}
 		state.current_batch_index = 0;
 		state.canvas_instance_batches.clear();
 		return;
 	}
 
 	// Copy over all data needed for rendering.
-	glBindBuffer(GL_ARRAY_BUFFER, state.canvas_instance_data_buffers[state.current_data_buffer_index].instance_buffers[state.current_instance_buffer_index]);
-#ifdef WEB_ENABLED
-	glBufferSubData(GL_ARRAY_BUFFER, state.last_item_index * sizeof(InstanceData), sizeof(InstanceData) * index, state.instance_data_array);
-#else
-	// On Desktop and mobile we map the memory without synchronizing for maximum speed.
-	void *buffer = glMapBufferRange(GL_ARRAY_BUFFER, state.last_item_index * sizeof(InstanceData), index * sizeof(InstanceData), GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
-	memcpy(buffer, state.instance_data_array, index * sizeof(InstanceData));
-	glUnmapBuffer(GL_ARRAY_BUFFER);
-#endif
+	_upload_instance_data(index);
 
 	glDisable(GL_SCISSOR_TEST);
 	current_clip = nullptr;
@@ -778,14 +782,16 @@ void RasterizerCanvasGLES3::_render_items(RID p_to_render_target, int p_item_cou
 	glDisable(GL_SCISSOR_TEST);
 	state.current_batch_index = 0;
 	state.canvas_instance_batches.clear();
-	state.last_item_index += index;
+	_fence_instance_ring();
 }
 
 void RasterizerCanvasGLES3::_record_item_commands(const Item *p_item, RID p_render_target, const Transform2D &p_canvas_transform_inverse, Item *&current_clip, GLES3::CanvasShaderData::BlendMode p_blend_mode, Light *p_lights, uint32_t &r_index, bool &r_batch_broken, bool &r_sdf_used) {
+	GLES3::TextureStorage *texture_storage = GLES3::TextureStorage::get_singleton();
+
 	RenderingServer::CanvasItemTextureFilter texture_filter = p_item->texture_filter == RS::CANVAS_ITEM_TEXTURE_FILTER_DEFAULT ? state.default_filter : p_item->texture_filter;
 
 	if (texture_filter != state.canvas_instance_batches[state.current_batch_index].filter) {
-		_new_batch(r_batch_broken);
+		_new_batch(r_batch_broken, RS::CANVAS_BATCH_BREAK_SAMPLER);
 
 		state.canvas_instance_batches[state.current_batch_index].filter = texture_filter;
 	}
@@ -793,7 +799,7 @@ void RasterizerCanvasGLES3::_record_item_commands(const Item *p_item, RID p_rend
 	RenderingServer::CanvasItemTextureRepeat texture_repeat = p_item->texture_repeat == RS::CANVAS_ITEM_TEXTURE_REPEAT_DEFAULT ? state.default_repeat : p_item->texture_repeat;
 
 	if (texture_repeat != state.canvas_instance_batches[state.current_batch_index].repeat) {
-		_new_batch(r_batch_broken);
+		_new_batch(r_batch_broken, RS::CANVAS_BATCH_BREAK_SAMPLER);
 
 		state.canvas_instance_batches[state.current_batch_index].repeat = texture_repeat;
 	}
@@ -837,7 +843,7 @@ void RasterizerCanvasGLES3::_record_item_commands(const Item *p_item, RID p_rend
 	bool lights_disabled = light_count == 0 && !state.using_directional_lights;
 
 	if (lights_disabled != state.canvas_instance_batches[state.current_batch_index].lights_disabled) {
-		_new_batch(r_batch_broken);
+		_new_batch(r_batch_broken, RS::CANVAS_BATCH_BREAK_LIGHTS);
 		state.canvas_instance_batches[state.current_batch_index].lights_disabled = lights_disabled;
 	}
 
@@ -850,29 +856,29 @@ void RasterizerCanvasGLES3::_record_item_commands(const Item *p_item, RID p_rend
 
 		if (c->type != Item::Command::TYPE_MESH) {
 			// For Meshes, this gets updated below.
-			_update_transform_2d_to_mat2x3(base_transform * draw_transform, state.instance_data_array[r_index].world);
+			_update_transform_2d_to_mat2x3(base_transform * draw_transform, state.instance_data[r_index].world);
 		}
 
 		// Zero out most fields.
 		for (int i = 0; i < 4; i++) {
-			state.instance_data_array[r_index].modulation[i] = 0.0;
-			state.instance_data_array[r_index].ninepatch_margins[i] = 0.0;
-			state.instance_data_array[r_index].src_rect[i] = 0.0;
-			state.instance_data_array[r_index].dst_rect[i] = 0.0;
-			state.instance_data_array[r_index].lights[i] = uint32_t(0);
+			state.instance_data[r_index].modulation[i] = 0.0;
+			state.instance_data[r_index].ninepatch_margins[i] = 0.0;
+			state.instance_data[r_index].src_rect[i] = 0.0;
+			state.instance_data[r_index].dst_rect[i] = 0.0;
+			state.instance_data[r_index].lights[i] = uint32_t(0);
 		}
-		state.instance_data_array[r_index].color_texture_pixel_size[0] = 0.0;
-		state.instance_data_array[r_index].color_texture_pixel_size[1] = 0.0;
+		state.instance_data[r_index].color_texture_pixel_size[0] = 0.0;
+		state.instance_data[r_index].color_texture_pixel_size[1] = 0.0;
 
-		state.instance_data_array[r_index].pad[0] = 0.0;
-		state.instance_data_array[r_index].pad[1] = 0.0;
+		state.instance_data[r_index].pad[0] = 0.0;
+		state.instance_data[r_index].pad[1] = 0.0;
 
-		state.instance_data_array[r_index].lights[0] = lights[0];
-		state.instance_data_array[r_index].lights[1] = lights[1];
-		state.instance_data_array[r_index].lights[2] = lights[2];
-		state.instance_data_array[r_index].lights[3] = lights[3];
+		state.instance_data[r_index].lights[0] = lights[0];
+		state.instance_data[r_index].lights[1] = lights[1];
+		state.instance_data[r_index].lights[2] = lights[2];
+		state.instance_data[r_index].lights[3] = lights[3];
 
-		state.instance_data_array[r_index].flags = base_flags | (state.instance_data_array[r_index == 0 ? 0 : r_index - 1].flags & (FLAGS_DEFAULT_NORMAL_MAP_USED | FLAGS_DEFAULT_SPECULAR_MAP_USED)); // Reset on each command for safety, keep canvastexture binding config.
+		state.instance_data[r_index].flags = base_flags | (state.instance_data[r_index == 0 ? 0 : r_index - 1].flags & (FLAGS_DEFAULT_NORMAL_MAP_USED | FLAGS_DEFAULT_SPECULAR_MAP_USED)); // Reset on each command for safety, keep canvastexture binding config.
 
 		Color blend_color = base_color;
 		GLES3::CanvasShaderData::BlendMode blend_mode = p_blend_mode;
@@ -885,7 +891,7 @@ void RasterizerCanvasGLES3::_record_item_commands(const Item *p_item, RID p_rend
 		}
 
 		if (blend_mode != state.canvas_instance_batches[state.current_batch_index].blend_mode || blend_color != state.canvas_instance_batches[state.current_batch_index].blend_color) {
-			_new_batch(r_batch_broken);
+			_new_batch(r_batch_broken, RS::CANVAS_BATCH_BREAK_BLEND_MODE);
 			state.canvas_instance_batches[state.current_batch_index].blend_mode = blend_mode;
 			state.canvas_instance_batches[state.current_batch_index].blend_color = blend_color;
 		}
@@ -895,25 +901,40 @@ void RasterizerCanvasGLES3::_record_item_commands(const Item *p_item, RID p_rend
 				const Item::CommandRect *rect = static_cast<const Item::CommandRect *>(c);
 
 				if (rect->flags & CANVAS_RECT_TILE && state.canvas_instance_batches[state.current_batch_index].repeat != RenderingServer::CanvasItemTextureRepeat::CANVAS_ITEM_TEXTURE_REPEAT_ENABLED) {
-					_new_batch(r_batch_broken);
+					_new_batch(r_batch_broken, RS::CANVAS_BATCH_BREAK_SAMPLER);
 					state.canvas_instance_batches[state.current_batch_index].repeat = RenderingServer::CanvasItemTextureRepeat::CANVAS_ITEM_TEXTURE_REPEAT_ENABLED;
 				}
 
-				if (rect->texture != state.canvas_instance_batches[state.current_batch_index].tex || state.canvas_instance_batches[state.current_batch_index].command_type != Item::Command::TYPE_RECT) {
-					_new_batch(r_batch_broken);
-					state.canvas_instance_batches[state.current_batch_index].tex = rect->texture;
+				// Plain sprites sample from the canvas texture atlas when possible, so that consecutive sprites with different textures share a batch.
+				RID texture = rect->texture;
+				Rect2 atlas_uv_rect;
+				bool use_atlas = false;
+				if (texture.is_valid() && !(rect->flags & (CANVAS_RECT_TILE | CANVAS_RECT_MSDF | CANVAS_RECT_LCD)) && state.canvas_instance_batches[state.current_batch_index].material.is_null() && state.canvas_instance_batches[state.current_batch_index].repeat == RS::CANVAS_ITEM_TEXTURE_REPEAT_DISABLED) {
+					use_atlas = texture_storage->canvas_texture_atlas_get_rect(texture, state.canvas_instance_batches[state.current_batch_index].filter, atlas_uv_rect);
+					if (use_atlas) {
+						texture = texture_storage->canvas_texture_atlas_get_texture();
+					}
+				}
+
+				if (texture != state.canvas_instance_batches[state.current_batch_index].tex || state.canvas_instance_batches[state.current_batch_index].command_type != Item::Command::TYPE_RECT) {
+					_new_batch(r_batch_broken, state.canvas_instance_batches[state.current_batch_index].command_type != Item::Command::TYPE_RECT ? RS::CANVAS_BATCH_BREAK_COMMAND_TYPE : RS::CANVAS_BATCH_BREAK_TEXTURE);
+					state.canvas_instance_batches[state.current_batch_index].tex = texture;
 					state.canvas_instance_batches[state.current_batch_index].command_type = Item::Command::TYPE_RECT;
 					state.canvas_instance_batches[state.current_batch_index].command = c;
 					state.canvas_instance_batches[state.current_batch_index].shader_variant = CanvasShaderGLES3::MODE_QUAD;
 				}
 
-				_prepare_canvas_texture(rect->texture, state.canvas_instance_batches[state.current_batch_index].filter, state.canvas_instance_batches[state.current_batch_index].repeat, r_index, texpixel_size);
+				_prepare_canvas_texture(texture, state.canvas_instance_batches[state.current_batch_index].filter, state.canvas_instance_batches[state.current_batch_index].repeat, r_index, texpixel_size);
 
 				Rect2 src_rect;
 				Rect2 dst_rect;
 
-				if (rect->texture != RID()) {
-					src_rect = (rect->flags & CANVAS_RECT_REGION) ? Rect2(rect->source.position * texpixel_size, rect->source.size * texpixel_size) : Rect2(0, 0, 1, 1);
+				if (texture != RID()) {
+					if (use_atlas) {
+						src_rect = (rect->flags & CANVAS_RECT_REGION) ? Rect2(atlas_uv_rect.position + rect->source.position * texpixel_size, rect->source.size * texpixel_size) : atlas_uv_rect;
+					} else {
+						src_rect = (rect->flags & CANVAS_RECT_REGION) ? Rect2(rect->source.position * texpixel_size, rect->source.size * texpixel_size) : Rect2(0, 0, 1, 1);
+					}
 					dst_rect = Rect2(rect->rect.position, rect->rect.size);
 
 					if (dst_rect.size.width < 0) {
@@ -927,20 +948,20 @@ void RasterizerCanvasGLES3::_record_item_commands(const Item *p_item, RID p_rend
 
 					if (rect->flags & CANVAS_RECT_FLIP_H) {
 						src_rect.size.x *= -1;
-						state.instance_data_array[r_index].flags |= FLAGS_FLIP_H;
+						state.instance_data[r_index].flags |= FLAGS_FLIP_H;
 					}
 
 					if (rect->flags & CANVAS_RECT_FLIP_V) {
 						src_rect.size.y *= -1;
-						state.instance_data_array[r_index].flags |= FLAGS_FLIP_V;
+						state.instance_data[r_index].flags |= FLAGS_FLIP_V;
 					}
 
 					if (rect->flags & CANVAS_RECT_TRANSPOSE) {
-						state.instance_data_array[r_index].flags |= FLAGS_TRANSPOSE_RECT;
+						state.instance_data[r_index].flags |= FLAGS_TRANSPOSE_RECT;
 					}
 
 					if (rect->flags & CANVAS_RECT_CLIP_UV) {
-						state.instance_data_array[r_index].flags |= FLAGS_CLIP_RECT_UV;
+						state.instance_data[r_index].flags |= FLAGS_CLIP_RECT_UV;
 					}
 
 				} else {
@@ -959,29 +980,29 @@ void RasterizerCanvasGLES3::_record_item_commands(const Item *p_item, RID p_rend
 				}
 
 				if (rect->flags & CANVAS_RECT_MSDF) {
-					state.instance_data_array[r_index].flags |= FLAGS_USE_MSDF;
-					state.instance_data_array[r_index].msdf[0] = rect->px_range; // Pixel range.
-					state.instance_data_array[r_index].msdf[1] = rect->outline; // Outline size.
-					state.instance_data_array[r_index].msdf[2] = 0.f; // Reserved.
-					state.instance_data_array[r_index].msdf[3] = 0.f; // Reserved.
+					state.instance_data[r_index].flags |= FLAGS_USE_MSDF;
+					state.instance_data[r_index].msdf[0] = rect->px_range; // Pixel range.
+					state.instance_data[r_index].msdf[1] = rect->outline; // Outline size.
+					state.instance_data[r_index].msdf[2] = 0.f; // Reserved.
+					state.instance_data[r_index].msdf[3] = 0.f; // Reserved.
 				} else if (rect->flags & CANVAS_RECT_LCD) {
-					state.instance_data_array[r_index].flags |= FLAGS_USE_LCD;
+					state.instance_data[r_index].flags |= FLAGS_USE_LCD;
 				}
 
-				state.instance_data_array[r_index].modulation[0] = rect->modulate.r * base_color.r;
-				state.instance_data_array[r_index].modulation[1] = rect->modulate.g * base_color.g;
-				state.instance_data_array[r_index].modulation[2] = rect->modulate.b * base_color.b;
-				state.instance_data_array[r_index].modulation[3] = rect->modulate.a * base_color.a;
+				state.instance_data[r_index].modulation[0] = rect->modulate.r * base_color.r;
+				state.instance_data[r_index].modulation[1] = rect->modulate.g * base_color.g;
+				state.instance_data[r_index].modulation[2] = rect->modulate.b * base_color.b;
+				state.instance_data[r_index].modulation[3] = rect->modulate.a * base_color.a;
 
-				state.instance_data_array[r_index].src_rect[0] = src_rect.position.x;
-				state.instance_data_array[r_index].src_rect[1] = src_rect.position.y;
-				state.instance_data_array[r_index].src_rect[2] = src_rect.size.width;
-				state.instance_data_array[r_index].src_rect[3] = src_rect.size.height;
+				state.instance_data[r_index].src_rect[0] = src_rect.position.x;
+				state.instance_data[r_index].src_rect[1] = src_rect.position.y;
+				state.instance_data[r_index].src_rect[2] = src_rect.size.width;
+				state.instance_data[r_index].src_rect[3] = src_rect.size.height;
 
-				state.instance_data_array[r_index].dst_rect[0] = dst_rect.position.x;
-				state.instance_data_array[r_index].dst_rect[1] = dst_rect.position.y;
-				state.instance_data_array[r_index].dst_rect[2] = dst_rect.size.width;
-				state.instance_data_array[r_index].dst_rect[3] = dst_rect.size.height;
+				state.instance_data[r_index].dst_rect[0] = dst_rect.position.x;
+				state.instance_data[r_index].dst_rect[1] = dst_rect.position.y;
+				state.instance_data[r_index].dst_rect[2] = dst_rect.size.width;
+				state.instance_data[r_index].dst_rect[3] = dst_rect.size.height;
 
 				_add_to_batch(r_index, r_batch_broken);
 			} break;
@@ -990,7 +1011,7 @@ void RasterizerCanvasGLES3::_record_item_commands(const Item *p_item, RID p_rend
 				const Item::CommandNinePatch *np = static_cast<const Item::CommandNinePatch *>(c);
 
 				if (np->texture != state.canvas_instance_batches[state.current_batch_index].tex || state.canvas_instance_batches[state.current_batch_index].command_type != Item::Command::TYPE_NINEPATCH) {
-					_new_batch(r_batch_broken);
+					_new_batch(r_batch_broken, state.canvas_instance_batches[state.current_batch_index].command_type != Item::Command::TYPE_NINEPATCH ? RS::CANVAS_BATCH_BREAK_COMMAND_TYPE : RS::CANVAS_BATCH_BREAK_TEXTURE);
 					state.canvas_instance_batches[state.current_batch_index].tex = np->texture;
 					state.canvas_instance_batches[state.current_batch_index].command_type = Item::Command::TYPE_NINEPATCH;
 					state.canvas_instance_batches[state.current_batch_index].command = c;
@@ -1009,53 +1030,53 @@ void RasterizerCanvasGLES3::_record_item_commands(const Item *p_item, RID p_rend
 				} else {
 					if (np->source != Rect2()) {
 						src_rect = Rect2(np->source.position.x * texpixel_size.width, np->source.position.y * texpixel_size.height, np->source.size.x * texpixel_size.width, np->source.size.y * texpixel_size.height);
-						state.instance_data_array[r_index].color_texture_pixel_size[0] = 1.0 / np->source.size.width;
-						state.instance_data_array[r_index].color_texture_pixel_size[1] = 1.0 / np->source.size.height;
+						state.instance_data[r_index].color_texture_pixel_size[0] = 1.0 / np->source.size.width;
+						state.instance_data[r_index].color_texture_pixel_size[1] = 1.0 / np->source.size.height;
 
 					} else {
 						src_rect = Rect2(0, 0, 1, 1);
 					}
 				}
 
-				state.instance_data_array[r_index].modulation[0] = np->color.r * base_color.r;
-				state.instance_data_array[r_index].modulation[1] = np->color.g * base_color.g;
-				state.instance_data_array[r_index].modulation[2] = np->color.b * base_color.b;
-				state.instance_data_array[r_index].modulation[3] = np->color.a * base_color.a;
+				state.instance_data[r_index].modulation[0] = np->color.r * base_color.r;
+				state.instance_data[r_index].modulation[1] = np->color.g * base_color.g;
+				state.instance_data[r_index].modulation[2] = np->color.b * base_color.b;
+				state.instance_data[r_index].modulation[3] = np->color.a * base_color.a;
 
-				state.instance_data_array[r_index].src_rect[0] = src_rect.position.x;
-				state.instance_data_array[r_index].src_rect[1] = src_rect.position.y;
-				state.instance_data_array[r_index].src_rect[2] = src_rect.size.width;
-				state.instance_data_array[r_index].src_rect[3] = src_rect.size.height;
+				state.instance_data[r_index].src_rect[0] = src_rect.position.x;
+				state.instance_data[r_index].src_rect[1] = src_rect.position.y;
+				state.instance_data[r_index].src_rect[2] = src_rect.size.width;
+				state.instance_data[r_index].src_rect[3] = src_rect.size.height;
 
-				state.instance_data_array[r_index].dst_rect[0] = dst_rect.position.x;
-				state.instance_data_array[r_index].dst_rect[1] = dst_rect.position.y;
-				state.instance_data_array[r_index].dst_rect[2] = dst_rect.size.width;
-				state.instance_data_array[r_index].dst_rect[3] = dst_rect.size.height;
+				state.instance_data[r_index].dst_rect[0] = dst_rect.position.x;
+				state.instance_data[r_index].dst_rect[1] = dst_rect.position.y;
+				state.instance_data[r_index].dst_rect[2] = dst_rect.size.width;
+				state.instance_data[r_index].dst_rect[3] = dst_rect.size.height;
 
-				state.instance_data_array[r_index].flags |= int(np->axis_x) << FLAGS_NINEPATCH_H_MODE_SHIFT;
-				state.instance_data_array[r_index].flags |= int(np->axis_y) << FLAGS_NINEPATCH_V_MODE_SHIFT;
+				state.instance_data[r_index].flags |= int(np->axis_x) << FLAGS_NINEPATCH_H_MODE_SHIFT;
+				state.instance_data[r_index].flags |= int(np->axis_y) << FLAGS_NINEPATCH_V_MODE_SHIFT;
 
 				if (np->draw_center) {
-					state.instance_data_array[r_index].flags |= FLAGS_NINEPACH_DRAW_CENTER;
+					state.instance_data[r_index].flags |= FLAGS_NINEPACH_DRAW_CENTER;
 				}
 
-				state.instance_data_array[r_index].ninepatch_margins[0] = np->margin[SIDE_LEFT];
-				state.instance_data_array[r_index].ninepatch_margins[1] = np->margin[SIDE_TOP];
-				state.instance_data_array[r_index].ninepatch_margins[2] = np->margin[SIDE_RIGHT];
-				state.instance_data_array[r_index].ninepatch_margins[3] = np->margin[SIDE_BOTTOM];
+				state.instance_data[r_index].ninepatch_margins[0] = np->margin[SIDE_LEFT];
+				state.instance_data[r_index].ninepatch_margins[1] = np->margin[SIDE_TOP];
+				state.instance_data[r_index].ninepatch_margins[2] = np->margin[SIDE_RIGHT];
+				state.instance_data[r_index].ninepatch_margins[3] = np->margin[SIDE_BOTTOM];
 
 				_add_to_batch(r_index, r_batch_broken);
 
 				// Restore if overridden.
-				state.instance_data_array[r_index].color_texture_pixel_size[0] = texpixel_size.x;
-				state.instance_data_array[r_index].color_texture_pixel_size[1] = texpixel_size.y;
+				state.instance_data[r_index].color_texture_pixel_size[0] = texpixel_size.x;
+				state.instance_data[r_index].color_texture_pixel_size[1] = texpixel_size.y;
 			} break;
 
 			case Item::Command::TYPE_POLYGON: {
 				const Item::CommandPolygon *polygon = static_cast<const Item::CommandPolygon *>(c);
 
 				// Polygon's can't be batched, so always create a new batch
-				_new_batch(r_batch_broken);
+				_new_batch(r_batch_broken, RS::CANVAS_BATCH_BREAK_UNBATCHABLE_COMMAND);
 
 				state.canvas_instance_batches[state.current_batch_index].tex = polygon->texture;
 				state.canvas_instance_batches[state.current_batch_index].command_type = Item::Command::TYPE_POLYGON;
@@ -1064,15 +1085,15 @@ void RasterizerCanvasGLES3::_record_item_commands(const Item *p_item, RID p_rend
 
 				_prepare_canvas_texture(polygon->texture, state.canvas_instance_batches[state.current_batch_index].filter, state.canvas_instance_batches[state.current_batch_index].repeat, r_index, texpixel_size);
 
-				state.instance_data_array[r_index].modulation[0] = base_color.r;
-				state.instance_data_array[r_index].modulation[1] = base_color.g;
-				state.instance_data_array[r_index].modulation[2] = base_color.b;
-				state.instance_data_array[r_index].modulation[3] = base_color.a;
+				state.instance_data[r_index].modulation[0] = base_color.r;
+				state.instance_data[r_index].modulation[1] = base_color.g;
+				state.instance_data[r_index].modulation[2] = base_color.b;
+				state.instance_data[r_index].modulation[3] = base_color.a;
 
 				for (int j = 0; j < 4; j++) {
-					state.instance_data_array[r_index].src_rect[j] = 0;
-					state.instance_data_array[r_index].dst_rect[j] = 0;
-					state.instance_data_array[r_index].ninepatch_margins[j] = 0;
+					state.instance_data[r_index].src_rect[j] = 0;
+					state.instance_data[r_index].dst_rect[j] = 0;
+					state.instance_data[r_index].ninepatch_margins[j] = 0;
 				}
 
 				_add_to_batch(r_index, r_batch_broken);
@@ -1082,7 +1103,7 @@ void RasterizerCanvasGLES3::_record_item_commands(const Item *p_item, RID p_rend
 				const Item::CommandPrimitive *primitive = static_cast<const Item::CommandPrimitive *>(c);
 
 				if (primitive->point_count != state.canvas_instance_batches[state.current_batch_index].primitive_points || state.canvas_instance_batches[state.current_batch_index].command_type != Item::Command::TYPE_PRIMITIVE) {
-					_new_batch(r_batch_broken);
+					_new_batch(r_batch_broken, RS::CANVAS_BATCH_BREAK_COMMAND_TYPE);
 					state.canvas_instance_batches[state.current_batch_index].tex = primitive->texture;
 					state.canvas_instance_batches[state.current_batch_index].primitive_points = primitive->point_count;
 					state.canvas_instance_batches[state.current_batch_index].command_type = Item::Command::TYPE_PRIMITIVE;
@@ -1093,32 +1114,32 @@ void RasterizerCanvasGLES3::_record_item_commands(const Item *p_item, RID p_rend
 				_prepare_canvas_texture(state.canvas_instance_batches[state.current_batch_index].tex, state.canvas_instance_batches[state.current_batch_index].filter, state.canvas_instance_batches[state.current_batch_index].repeat, r_index, texpixel_size);
 
 				for (uint32_t j = 0; j < MIN(3u, primitive->point_count); j++) {
-					state.instance_data_array[r_index].points[j * 2 + 0] = primitive->points[j].x;
-					state.instance_data_array[r_index].points[j * 2 + 1] = primitive->points[j].y;
-					state.instance_data_array[r_index].uvs[j * 2 + 0] = primitive->uvs[j].x;
-					state.instance_data_array[r_index].uvs[j * 2 + 1] = primitive->uvs[j].y;
+					state.instance_data[r_index].points[j * 2 + 0] = primitive->points[j].x;
+					state.instance_data[r_index].points[j * 2 + 1] = primitive->points[j].y;
+					state.instance_data[r_index].uvs[j * 2 + 0] = primitive->uvs[j].x;
+					state.instance_data[r_index].uvs[j * 2 + 1] = primitive->uvs[j].y;
 					Color col = primitive->colors[j] * base_color;
-					state.instance_data_array[r_index].colors[j * 2 + 0] = (uint32_t(Math::make_half_float(col.g)) << 16) | Math::make_half_float(col.r);
-					state.instance_data_array[r_index].colors[j * 2 + 1] = (uint32_t(Math::make_half_float(col.a)) << 16) | Math::make_half_float(col.b);
+					state.instance_data[r_index].colors[j * 2 + 0] = (uint32_t(Math::make_half_float(col.g)) << 16) | Math::make_half_float(col.r);
+					state.instance_data[r_index].colors[j * 2 + 1] = (uint32_t(Math::make_half_float(col.a)) << 16) | Math::make_half_float(col.b);
 				}
 
 				_add_to_batch(r_index, r_batch_broken);
 
 				if (primitive->point_count == 4) {
 					// Reset base data.
-					_update_transform_2d_to_mat2x3(base_transform * draw_transform, state.instance_data_array[r_index].world);
+					_update_transform_2d_to_mat2x3(base_transform * draw_transform, state.instance_data[r_index].world);
 					_prepare_canvas_texture(state.canvas_instance_batches[state.current_batch_index].tex, state.canvas_instance_batches[state.current_batch_index].filter, state.canvas_instance_batches[state.current_batch_index].repeat, r_index, texpixel_size);
 
 					for (uint32_t j = 0; j < 3; j++) {
 						int offset = j == 0 ? 0 : 1;
 						// Second triangle in the quad. Uses vertices 0, 2, 3.
-						state.instance_data_array[r_index].points[j * 2 + 0] = primitive->points[j + offset].x;
-						state.instance_data_array[r_index].points[j * 2 + 1] = primitive->points[j + offset].y;
-						state.instance_data_array[r_index].uvs[j * 2 + 0] = primitive->uvs[j + offset].x;
-						state.instance_data_array[r_index].uvs[j * 2 + 1] = primitive->uvs[j + offset].y;
+						state.instance_data[r_index].points[j * 2 + 0] = primitive->points[j + offset].x;
+						state.instance_data[r_index].points[j * 2 + 1] = primitive->points[j + offset].y;
+						state.instance_data[r_index].uvs[j * 2 + 0] = primitive->uvs[j + offset].x;
+						state.instance_data[r_index].uvs[j * 2 + 1] = primitive->uvs[j + offset].y;
 						Color col = primitive->colors[j + offset] * base_color;
-						state.instance_data_array[r_index].colors[j * 2 + 0] = (uint32_t(Math::make_half_float(col.g)) << 16) | Math::make_half_float(col.r);
-						state.instance_data_array[r_index].colors[j * 2 + 1] = (uint32_t(Math::make_half_float(col.a)) << 16) | Math::make_half_float(col.b);
+						state.instance_data[r_index].colors[j * 2 + 0] = (uint32_t(Math::make_half_float(col.g)) << 16) | Math::make_half_float(col.r);
+						state.instance_data[r_index].colors[j * 2 + 1] = (uint32_t(Math::make_half_float(col.a)) << 16) | Math::make_half_float(col.b);
 					}
 
 					_add_to_batch(r_index, r_batch_broken);
@@ -1129,14 +1150,14 @@ void RasterizerCanvasGLES3::_record_item_commands(const Item *p_item, RID p_rend
 			case Item::Command::TYPE_MULTIMESH:
 			case Item::Command::TYPE_PARTICLES: {
 				// Mesh's can't be batched, so always create a new batch
-				_new_batch(r_batch_broken);
+				_new_batch(r_batch_broken, RS::CANVAS_BATCH_BREAK_UNBATCHABLE_COMMAND);
 
 				Color modulate(1, 1, 1, 1);
 				state.canvas_instance_batches[state.current_batch_index].shader_variant = CanvasShaderGLES3::MODE_ATTRIBUTES;
 				if (c->type == Item::Command::TYPE_MESH) {
 					const Item::CommandMesh *m = static_cast<const Item::CommandMesh *>(c);
 					state.canvas_instance_batches[state.current_batch_index].tex = m->texture;
-					_update_transform_2d_to_mat2x3(base_transform * draw_transform * m->transform, state.instance_data_array[r_index].world);
+					_update_transform_2d_to_mat2x3(base_transform * draw_transform * m->transform, state.instance_data[r_index].world);
 					modulate = m->modulate;
 
 				} else if (c->type == Item::Command::TYPE_MULTIMESH) {
@@ -1145,21 +1166,20 @@ void RasterizerCanvasGLES3::_record_item_commands(const Item *p_item, RID p_rend
 					state.canvas_instance_batches[state.current_batch_index].shader_variant = CanvasShaderGLES3::MODE_INSTANCED;
 
 					if (GLES3::MeshStorage::get_singleton()->multimesh_uses_colors(mm->multimesh)) {
-						state.instance_data_array[r_index].flags |= FLAGS_INSTANCING_HAS_COLORS;
+						state.instance_data[r_index].flags |= FLAGS_INSTANCING_HAS_COLORS;
 					}
 					if (GLES3::MeshStorage::get_singleton()->multimesh_uses_custom_data(mm->multimesh)) {
-						state.instance_data_array[r_index].flags |= FLAGS_INSTANCING_HAS_CUSTOM_DATA;
+						state.instance_data[r_index].flags |= FLAGS_INSTANCING_HAS_CUSTOM_DATA;
 					}
 				} else if (c->type == Item::Command::TYPE_PARTICLES) {
 					GLES3::ParticlesStorage *particles_storage = GLES3::ParticlesStorage::get_singleton();
-					GLES3::TextureStorage *texture_storage = GLES3::TextureStorage::get_singleton();
 
 					const Item::CommandParticles *pt = static_cast<const Item::CommandParticles *>(c);
 					RID particles = pt->particles;
 					state.canvas_instance_batches[state.current_batch_index].tex = pt->texture;
 					state.canvas_instance_batches[state.current_batch_index].shader_variant = CanvasShaderGLES3::MODE_INSTANCED;
-					state.instance_data_array[r_index].flags |= FLAGS_INSTANCING_HAS_COLORS;
-					state.instance_data_array[r_index].flags |= FLAGS_INSTANCING_HAS_CUSTOM_DATA;
+					state.instance_data[r_index].flags |= FLAGS_INSTANCING_HAS_COLORS;
+					state.instance_data[r_index].flags |= FLAGS_INSTANCING_HAS_CUSTOM_DATA;
 
 					if (particles_storage->particles_has_collision(particles) && texture_storage->render_target_is_sdf_enabled(p_render_target)) {
 						// Pass collision information.
@@ -1187,15 +1207,15 @@ void RasterizerCanvasGLES3::_record_item_commands(const Item *p_item, RID p_rend
 
 				_prepare_canvas_texture(state.canvas_instance_batches[state.current_batch_index].tex, state.canvas_instance_batches[state.current_batch_index].filter, state.canvas_instance_batches[state.current_batch_index].repeat, r_index, texpixel_size);
 
-				state.instance_data_array[r_index].modulation[0] = base_color.r * modulate.r;
-				state.instance_data_array[r_index].modulation[1] = base_color.g * modulate.g;
-				state.instance_data_array[r_index].modulation[2] = base_color.b * modulate.b;
-				state.instance_data_array[r_index].modulation[3] = base_color.a * modulate.a;
+				state.instance_data[r_index].modulation[0] = base_color.r * modulate.r;
+				state.instance_data[r_index].modulation[1] = base_color.g * modulate.g;
+				state.instance_data[r_index].modulation[2] = base_color.b * modulate.b;
+				state.instance_data[r_index].modulation[3] = base_color.a * modulate.a;
 
 				for (int j = 0; j < 4; j++) {
-					state.instance_data_array[r_index].src_rect[j] = 0;
-					state.instance_data_array[r_index].dst_rect[j] = 0;
-					state.instance_data_array[r_index].ninepatch_margins[j] = 0;
+					state.instance_data[r_index].src_rect[j] = 0;
+					state.instance_data[r_index].dst_rect[j] = 0;
+					state.instance_data[r_index].ninepatch_margins[j] = 0;
 				}
 				_add_to_batch(r_index, r_batch_broken);
 			} break;
@@ -1209,7 +1229,7 @@ void RasterizerCanvasGLES3::_record_item_commands(const Item *p_item, RID p_rend
 				const Item::CommandClipIgnore *ci = static_cast<const Item::CommandClipIgnore *>(c);
 				if (current_clip) {
 					if (ci->ignore != reclip) {
-						_new_batch(r_batch_broken);
+						_new_batch(r_batch_broken, RS::CANVAS_BATCH_BREAK_CLIP);
 						if (ci->ignore) {
 							state.canvas_instance_batches[state.current_batch_index].clip = nullptr;
 							reclip = true;
@@ -1253,11 +1273,12 @@ void RasterizerCanvasGLES3::_render_batch(Light *p_lights, uint32_t p_index) {
 		case Item::Command::TYPE_RECT:
 		case Item::Command::TYPE_NINEPATCH: {
 			glBindVertexArray(data.indexed_quad_array);
-			glBindBuffer(GL_ARRAY_BUFFER, state.canvas_instance_data_buffers[state.current_data_buffer_index].instance_buffers[state.canvas_instance_batches[p_index].instance_buffer_index]);
+			glBindBuffer(GL_ARRAY_BUFFER, _get_batch_instance_buffer(p_index));
 			uint32_t range_start = state.canvas_instance_batches[p_index].start * sizeof(InstanceData);
 			_enable_attributes(range_start, false);
 
 			glDrawElementsInstanced(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0, state.canvas_instance_batches[p_index].instance_count);
+			render_info.draw_calls++;
 			glBindVertexArray(0);
 
 		} break;
@@ -1269,7 +1290,7 @@ void RasterizerCanvasGLES3::_render_batch(Light *p_lights, uint32_t p_index) {
 			ERR_FAIL_NULL(pb);
 
 			glBindVertexArray(pb->vertex_array);
-			glBindBuffer(GL_ARRAY_BUFFER, state.canvas_instance_data_buffers[state.current_data_buffer_index].instance_buffers[state.canvas_instance_batches[p_index].instance_buffer_index]);
+			glBindBuffer(GL_ARRAY_BUFFER, _get_batch_instance_buffer(p_index));
 
 			uint32_t range_start = state.canvas_instance_batches[p_index].start * sizeof(InstanceData);
 			_enable_attributes(range_start, false);
@@ -1283,6 +1304,7 @@ void RasterizerCanvasGLES3::_render_batch(Light *p_lights, uint32_t p_index) {
 			} else {
 				glDrawArraysInstanced(prim[polygon->primitive], 0, pb->count, 1);
 			}
+			render_info.draw_calls++;
 			glBindVertexArray(0);
 
 			if (pb->color_disabled && pb->color != Color(1.0, 1.0, 1.0, 1.0)) {
@@ -1293,7 +1315,7 @@ void RasterizerCanvasGLES3::_render_batch(Light *p_lights, uint32_t p_index) {
 
 		case Item::Command::TYPE_PRIMITIVE: {
 			glBindVertexArray(data.canvas_quad_array);
-			glBindBuffer(GL_ARRAY_BUFFER, state.canvas_instance_data_buffers[state.current_data_buffer_index].instance_buffers[state.canvas_instance_batches[p_index].instance_buffer_index]);
+			glBindBuffer(GL_ARRAY_BUFFER, _get_batch_instance_buffer(p_index));
 			uint32_t range_start = state.canvas_instance_batches[p_index].start * sizeof(InstanceData);
 			_enable_attributes(range_start, true);
 
@@ -1302,6 +1324,7 @@ void RasterizerCanvasGLES3::_render_batch(Light *p_lights, uint32_t p_index) {
 			ERR_FAIL_COND(instance_count <= 0);
 			if (instance_count >= 1) {
 				glDrawArraysInstanced(primitive[state.canvas_instance_batches[p_index].primitive_points], 0, state.canvas_instance_batches[p_index].primitive_points, instance_count);
+				render_info.draw_calls++;
 			}
 
 		} break;
@@ -1399,7 +1422,7 @@ void RasterizerCanvasGLES3::_render_batch(Light *p_lights, uint32_t p_index) {
 				index_array_gl = mesh_storage->mesh_surface_get_index_buffer(surface, 0);
 				bool use_index_buffer = false;
 				glBindVertexArray(vertex_array_gl);
-				glBindBuffer(GL_ARRAY_BUFFER, state.canvas_instance_data_buffers[state.current_data_buffer_index].instance_buffers[state.canvas_instance_batches[p_index].instance_buffer_index]);
+				glBindBuffer(GL_ARRAY_BUFFER, _get_batch_instance_buffer(p_index));
 
 				uint32_t range_start = state.canvas_instance_batches[p_index].start * sizeof(InstanceData);
 				_enable_attributes(range_start, false, instance_count);
@@ -1443,6 +1466,7 @@ void RasterizerCanvasGLES3::_render_batch(Light *p_lights, uint32_t p_index) {
 				} else {
 					glDrawArraysInstanced(primitive_gl, 0, mesh_storage->mesh_surface_get_vertices_drawn_count(surface), instance_count);
 				}
+				render_info.draw_calls++;
 				glBindBuffer(GL_ARRAY_BUFFER, 0);
 				glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 				if (use_instancing) {
@@ -1465,28 +1489,20 @@ void RasterizerCanvasGLES3::_render_batch(Light *p_lights, uint32_t p_index) {
 void RasterizerCanvasGLES3::_add_to_batch(uint32_t &r_index, bool &r_batch_broken) {
 	state.canvas_instance_batches[state.current_batch_index].instance_count++;
 	r_index++;
-	if (r_index + state.last_item_index >= data.max_instances_per_buffer) {
+	if (r_index >= data.max_instances_per_buffer) {
 		// Copy over all data needed for rendering right away
 		// then go back to recording item commands.
-		glBindBuffer(GL_ARRAY_BUFFER, state.canvas_instance_data_buffers[state.current_data_buffer_index].instance_buffers[state.current_instance_buffer_index]);
-#ifdef WEB_ENABLED
-		glBufferSubData(GL_ARRAY_BUFFER, state.last_item_index * sizeof(InstanceData), sizeof(InstanceData) * r_index, state.instance_data_array);
-#else
-		// On Desktop and mobile we map the memory without synchronizing for maximum speed.
-		void *buffer = glMapBufferRange(GL_ARRAY_BUFFER, state.last_item_index * sizeof(InstanceData), r_index * sizeof(InstanceData), GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
-		memcpy(buffer, state.instance_data_array, r_index * sizeof(InstanceData));
-		glUnmapBuffer(GL_ARRAY_BUFFER);
-#endif
-		_allocate_instance_buffer();
+		_upload_instance_data(r_index);
 		r_index = 0;
-		state.last_item_index = 0;
 		r_batch_broken = false; // Force a new batch to be created
-		_new_batch(r_batch_broken);
+		_new_batch(r_batch_broken, RS::CANVAS_BATCH_BREAK_BUFFER_FULL);
 		state.canvas_instance_batches[state.current_batch_index].start = 0;
+		state.instance_chunk_first_batch = state.current_batch_index;
+		_begin_instance_chunk();
 	}
 }
 
-void RasterizerCanvasGLES3::_new_batch(bool &r_batch_broken) {
+void RasterizerCanvasGLES3::_new_batch(bool &r_batch_broken, RS::CanvasBatchBreakReason p_reason) {
 	if (state.canvas_instance_batches.size() == 0) {
 		state.canvas_instance_batches.push_back(Batch());
 		return;
@@ -1497,6 +1513,9 @@ void RasterizerCanvasGLES3::_new_batch(bool &r_batch_broken) {
 	}
 
 	r_batch_broken = true;
+	if (p_reason < RS::CANVAS_BATCH_BREAK_MAX) {
+		render_info.batch_breaks[p_reason]++;
+	}
 
 	// Copy the properties of the current batch, we will manually update the things that changed.
 	Batch new_batch = state.canvas_instance_batches[state.current_batch_index];
@@ -1564,6 +1583,21 @@ void RasterizerCanvasGLES3::light_update_shadow(RID p_rid, int p_shadow_index, c
 	cl->shadow.z_far = p_far;
 	cl->shadow.y_offset = float(p_shadow_index * 2 + 1) / float(data.max_lights_per_render * 2);
 
+	// Static lights and occluders produce the same shadow every frame, skip
+	// rendering if this atlas row already holds it.
+	uint64_t shadow_hash = light_shadow_hash(p_light_xform, p_light_mask, p_near, p_far, p_occluders, [this](RID p_occluder) -> uint32_t {
+		// Polygons only get a vertex array once their shape is set, which bumps their version above 0.
+		const OccluderPolygon *co = occluder_polygon_owner.get_or_null(p_occluder);
+		return (co && co->vertex_array != 0) ? co->version : 0;
+	});
+	bool cache_row = p_shadow_index < (int)state.shadow_row_hashes.size();
+	if (cache_row) {
+		if (state.shadow_row_hashes[p_shadow_index] == shadow_hash) {
+			return;
+		}
+		state.shadow_row_hashes[p_shadow_index] = 0; // Cleared below, only valid once drawn.
+	}
+
 	glBindFramebuffer(GL_FRAMEBUFFER, state.shadow_fb);
 	glViewport(0, p_shadow_index * 2, state.shadow_texture_size, 2);
 
@@ -1589,6 +1623,10 @@ void RasterizerCanvasGLES3::light_update_shadow(RID p_rid, int p_shadow_index, c
 		return;
 	}
 
+	if (cache_row) {
+		state.shadow_row_hashes[p_shadow_index] = shadow_hash;
+	}
+
 	for (int i = 0; i < 4; i++) {
 		glViewport((state.shadow_texture_size / 4) * i, p_shadow_index * 2, (state.shadow_texture_size / 4), 2);
 
@@ -1665,6 +1703,10 @@ void RasterizerCanvasGLES3::light_update_directional_shadow(RID p_rid, int p_sha
 
 	_update_shadow_atlas();
 
+	if (p_shadow_index < (int)state.shadow_row_hashes.size()) {
+		state.shadow_row_hashes[p_shadow_index] = 0; // Directional shadows are not cached.
+	}
+
 	Vector2 light_dir = p_light_xform.columns[1].normalized();
 
 	Vector2 center = p_clip_rect.get_center();
@@ -1772,6 +1814,11 @@ void RasterizerCanvasGLES3::_update_shadow_atlas() {
 	if (state.shadow_fb == 0) {
 		glActiveTexture(GL_TEXTURE0);
 
+		state.shadow_row_hashes.resize(data.max_lights_per_render);
+		for (uint64_t &row_hash : state.shadow_row_hashes) {
+			row_hash = 0;
+		}
+
 		glGenFramebuffers(1, &state.shadow_fb);
 		glBindFramebuffer(GL_FRAMEBUFFER, state.shadow_fb);
 
@@ -1885,6 +1932,7 @@ RID RasterizerCanvasGLES3::occluder_polygon_create() {
 void RasterizerCanvasGLES3::occluder_polygon_set_shape(RID p_occluder, const Vector<Vector2> &p_points, bool p_closed) {
 	OccluderPolygon *oc = occluder_polygon_owner.get_or_null(p_occluder);
 	ERR_FAIL_NULL(oc);
+	oc->version++;
 
 	Vector<Vector2> lines;
 
@@ -2058,6 +2106,9 @@ void RasterizerCanvasGLES3::occluder_polygon_set_shape(RID p_occluder, const Vec
 void RasterizerCanvasGLES3::occluder_polygon_set_cull_mode(RID p_occluder, RS::CanvasOccluderPolygonCullMode p_mode) {
 	OccluderPolygon *oc = occluder_polygon_owner.get_or_null(p_occluder);
 	ERR_FAIL_NULL(oc);
+	if (oc->cull_mode != p_mode) {
+		oc->version++;
+	}
 	oc->cull_mode = p_mode;
 }
 
@@ -2275,27 +2326,27 @@ void RasterizerCanvasGLES3::_prepare_canvas_texture(RID p_texture, RS::CanvasIte
 	GLES3::Texture *normal_map = texture_storage->get_texture(ct->normal_map);
 
 	if (ct->specular_color.a < 0.999) {
-		state.instance_data_array[r_index].flags |= FLAGS_DEFAULT_SPECULAR_MAP_USED;
+		state.instance_data[r_index].flags |= FLAGS_DEFAULT_SPECULAR_MAP_USED;
 	} else {
-		state.instance_data_array[r_index].flags &= ~FLAGS_DEFAULT_SPECULAR_MAP_USED;
+		state.instance_data[r_index].flags &= ~FLAGS_DEFAULT_SPECULAR_MAP_USED;
 	}
 
 	if (normal_map) {
-		state.instance_data_array[r_index].flags |= FLAGS_DEFAULT_NORMAL_MAP_USED;
+		state.instance_data[r_index].flags |= FLAGS_DEFAULT_NORMAL_MAP_USED;
 	} else {
-		state.instance_data_array[r_index].flags &= ~FLAGS_DEFAULT_NORMAL_MAP_USED;
+		state.instance_data[r_index].flags &= ~FLAGS_DEFAULT_NORMAL_MAP_USED;
 	}
 
-	state.instance_data_array[r_index].specular_shininess = uint32_t(CLAMP(ct->specular_color.a * 255.0, 0, 255)) << 24;
-	state.instance_data_array[r_index].specular_shininess |= uint32_t(CLAMP(ct->specular_color.b * 255.0, 0, 255)) << 16;
-	state.instance_data_array[r_index].specular_shininess |= uint32_t(CLAMP(ct->specular_color.g * 255.0, 0, 255)) << 8;
-	state.instance_data_array[r_index].specular_shininess |= uint32_t(CLAMP(ct->specular_color.r * 255.0, 0, 255));
+	state.instance_data[r_index].specular_shininess = uint32_t(CLAMP(ct->specular_color.a * 255.0, 0, 255)) << 24;
+	state.instance_data[r_index].specular_shininess |= uint32_t(CLAMP(ct->specular_color.b * 255.0, 0, 255)) << 16;
+	state.instance_data[r_index].specular_shininess |= uint32_t(CLAMP(ct->specular_color.g * 255.0, 0, 255)) << 8;
+	state.instance_data[r_index].specular_shininess |= uint32_t(CLAMP(ct->specular_color.r * 255.0, 0, 255));
 
 	r_texpixel_size.x = 1.0 / float(size_cache.x);
 	r_texpixel_size.y = 1.0 / float(size_cache.y);
 
-	state.instance_data_array[r_index].color_texture_pixel_size[0] = r_texpixel_size.x;
-	state.instance_data_array[r_index].color_texture_pixel_size[1] = r_texpixel_size.y;
+	state.instance_data[r_index].color_texture_pixel_size[0] = r_texpixel_size.x;
+	state.instance_data[r_index].color_texture_pixel_size[1] = r_texpixel_size.y;
 }
 
 void RasterizerCanvasGLES3::reset_canvas() {
@@ -2532,6 +2583,186 @@ void RasterizerCanvasGLES3::_allocate_instance_buffer() {
 	glBindBuffer(GL_ARRAY_BUFFER, 0);
 }
 
+// The ring is sized to hold a full item buffer for each of the frames OpenGL can have in flight.
+void RasterizerCanvasGLES3::_allocate_instance_ring() {
+#ifndef WEB_ENABLED
+	InstanceRing &ring = state.instance_ring;
+	ring.size = data.max_instances_per_buffer * 3;
+	uint32_t ring_size = ring.size * sizeof(InstanceData);
+
+	glGenBuffers(1, &ring.buffer);
+	glBindBuffer(GL_ARRAY_BUFFER, ring.buffer);
+	GLES3::Config *config = GLES3::Config::get_singleton();
+	if (config->buffer_storage_supported) {
+		// Instances are recorded in place and their flags are updated while recording, so the ring is read too.
+		const GLbitfield flags = GL_MAP_READ_BIT | GL_MAP_WRITE_BIT | _GL_MAP_PERSISTENT_BIT | _GL_MAP_COHERENT_BIT;
+		config->buffer_storage_func(GL_ARRAY_BUFFER, ring_size, nullptr, flags);
+		ring.mapped = (InstanceData *)glMapBufferRange(GL_ARRAY_BUFFER, 0, ring_size, flags);
+		if (ring.mapped) {
+			GLES3::Utilities::get_singleton()->buffer_allocated_data(ring.buffer, ring_size, "2D Instance Ring");
+		} else {
+			// Immutable storage can't be orphaned, start over with a regular buffer.
+			glDeleteBuffers(1, &ring.buffer);
+			glGenBuffers(1, &ring.buffer);
+			glBindBuffer(GL_ARRAY_BUFFER, ring.buffer);
+		}
+	}
+	if (!ring.mapped) {
+		GLES3::Utilities::get_singleton()->buffer_allocate_data(GL_ARRAY_BUFFER, ring.buffer, ring_size, nullptr, GL_STREAM_DRAW, "2D Instance Ring");
+	}
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+#endif
+}
+
+// Finds room for p_count instances in the ring, waiting on (or orphaning) regions the GPU may still read.
+// Returns false if the ring can't be used, for example when the current call already filled all of it.
+bool RasterizerCanvasGLES3::_instance_ring_reserve(uint32_t p_count, uint32_t &r_offset) {
+	InstanceRing &ring = state.instance_ring;
+	if (ring.buffer == 0 || p_count > ring.size) {
+		return false;
+	}
+
+	uint64_t head = ring.head;
+	uint32_t offset = head % ring.size;
+	if (offset + p_count > ring.size) {
+		// Chunks are never split, skip the space left at the end of the ring.
+		head += ring.size - offset;
+		offset = 0;
+	}
+
+	uint64_t end = head + p_count;
+	if (end - ring.call_start > ring.size) {
+		// The instances written by this call haven't been drawn yet.
+		return false;
+	}
+
+	while (!ring.regions.is_empty() && ring.regions[0].end + ring.size > end) {
+		InstanceRing::Region &region = ring.regions[0];
+		GLint sync_status;
+		glGetSynciv(region.fence, GL_SYNC_STATUS, 1, nullptr, &sync_status);
+		if (sync_status == GL_UNSIGNALED) {
+			if (ring.mapped) {
+				// Writing before the fence is signaled would overwrite data the GPU may still read.
+				GLenum wait_status;
+				do {
+					wait_status = glClientWaitSync(region.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 100000000); // wait for up to 100ms at a time
+				} while (wait_status == GL_TIMEOUT_EXPIRED);
+				if (wait_status == GL_WAIT_FAILED) {
+					return false;
+				}
+			} else {
+				if (ring.call_start != ring.head) {
+					// Orphaning would discard the instances this call hasn't drawn yet.
+					return false;
+				}
+				// Let the driver hand us fresh storage while the GPU finishes with the old one.
+				glBindBuffer(GL_ARRAY_BUFFER, ring.buffer);
+				glBufferData(GL_ARRAY_BUFFER, ring.size * sizeof(InstanceData), nullptr, GL_STREAM_DRAW);
+				for (uint32_t i = 0; i < ring.regions.size(); i++) {
+					glDeleteSync(ring.regions[i].fence);
+				}
+				ring.regions.clear();
+				break;
+			}
+		}
+		glDeleteSync(region.fence);
+		ring.regions.remove_at(0);
+	}
+
+	ring.head = end;
+	r_offset = offset;
+	return true;
+}
+
+// Fences the ring region written by the current _render_items() call once its batches are submitted.
+void RasterizerCanvasGLES3::_fence_instance_ring() {
+	InstanceRing &ring = state.instance_ring;
+
+	// Release regions the GPU is already done with so fences don't pile up.
+	while (!ring.regions.is_empty()) {
+		GLint sync_status;
+		glGetSynciv(ring.regions[0].fence, GL_SYNC_STATUS, 1, nullptr, &sync_status);
+		if (sync_status == GL_UNSIGNALED) {
+			break;
+		}
+		glDeleteSync(ring.regions[0].fence);
+		ring.regions.remove_at(0);
+	}
+
+	if (ring.head == ring.call_start) {
+		return;
+	}
+
+	InstanceRing::Region region;
+	region.end = ring.head;
+	region.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	ring.regions.push_back(region);
+	ring.call_start = ring.head;
+}
+
+// Picks where the next chunk of instances is recorded. With a persistently mapped ring the chunk is
+// written in place, room for a full chunk is reserved and the unused part is returned on upload.
+void RasterizerCanvasGLES3::_begin_instance_chunk() {
+	uint32_t offset = 0;
+	state.instance_chunk_in_ring = state.instance_ring.mapped && _instance_ring_reserve(data.max_instances_per_buffer, offset);
+	if (state.instance_chunk_in_ring) {
+		state.instance_chunk_offset = offset;
+		state.instance_data = state.instance_ring.mapped + offset;
+	} else {
+		state.instance_data = state.instance_data_array;
+	}
+}
+
+// Places the recorded chunk of instance data in a GPU buffer and points its batches at it.
+// Chunks recorded in the mapped ring are already in place. Otherwise the ring is preferred
+// and the per-frame instance buffers are used when it has no room.
+void RasterizerCanvasGLES3::_upload_instance_data(uint32_t p_count) {
+	uint32_t buffer_index = INSTANCE_RING_BUFFER_INDEX;
+	uint32_t offset = 0;
+
+	if (state.instance_chunk_in_ring) {
+		state.instance_ring.head -= data.max_instances_per_buffer - p_count;
+		state.instance_chunk_in_ring = false;
+		offset = state.instance_chunk_offset;
+	} else {
+		GLuint buffer = state.instance_ring.buffer;
+		// A mapped ring that had no room for the chunk is skipped, it can't be orphaned.
+		if (state.instance_ring.mapped || !_instance_ring_reserve(p_count, offset)) {
+			if (state.last_item_index + p_count > data.max_instances_per_buffer) {
+				_allocate_instance_buffer();
+				state.last_item_index = 0;
+			}
+			buffer_index = state.current_instance_buffer_index;
+			offset = state.last_item_index;
+			buffer = state.canvas_instance_data_buffers[state.current_data_buffer_index].instance_buffers[buffer_index];
+			state.last_item_index += p_count;
+		}
+
+		glBindBuffer(GL_ARRAY_BUFFER, buffer);
+#ifdef WEB_ENABLED
+		glBufferSubData(GL_ARRAY_BUFFER, offset * sizeof(InstanceData), sizeof(InstanceData) * p_count, state.instance_data_array);
+#else
+		// On Desktop and mobile we map the memory without synchronizing for maximum speed.
+		void *mapped = glMapBufferRange(GL_ARRAY_BUFFER, offset * sizeof(InstanceData), p_count * sizeof(InstanceData), GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+		memcpy(mapped, state.instance_data_array, p_count * sizeof(InstanceData));
+		glUnmapBuffer(GL_ARRAY_BUFFER);
+#endif
+	}
+
+	for (uint32_t i = state.instance_chunk_first_batch; i <= state.current_batch_index; i++) {
+		state.canvas_instance_batches[i].start += offset;
+		state.canvas_instance_batches[i].instance_buffer_index = buffer_index;
+	}
+}
+
+GLuint RasterizerCanvasGLES3::_get_batch_instance_buffer(uint32_t p_index) const {
+	uint32_t buffer_index = state.canvas_instance_batches[p_index].instance_buffer_index;
+	if (buffer_index == INSTANCE_RING_BUFFER_INDEX) {
+		return state.instance_ring.buffer;
+	}
+	return state.canvas_instance_data_buffers[state.current_data_buffer_index].instance_buffers[buffer_index];
+}
+
 void RasterizerCanvasGLES3::set_time(double p_time) {
 	state.time = p_time;
 }
@@ -2709,8 +2940,11 @@ RasterizerCanvasGLES3::RasterizerCanvasGLES3() {
 	glBindBuffer(GL_UNIFORM_BUFFER, 0);
 
 	state.instance_data_array = memnew_arr(InstanceData, data.max_instances_per_buffer);
+	state.instance_data = state.instance_data_array;
 	state.light_uniforms = memnew_arr(LightUniform, data.max_lights_per_render);
 
+	_allocate_instance_ring();
+
 	{
 		const uint32_t indices[6] = { 0, 2, 1, 3, 2, 0 };
 		glGenVertexArrays(1, &data.indexed_quad_array);
@@ -2834,6 +3068,18 @@ RasterizerCanvasGLES3::~RasterizerCanvasGLES3() {
 			GLES3::Utilities::get_singleton()->buffer_free_data(state.canvas_instance_data_buffers[i].state_ubo);
 		}
 	}
+
+	if (state.instance_ring.buffer) {
+		if (state.instance_ring.mapped) {
+			glBindBuffer(GL_ARRAY_BUFFER, state.instance_ring.buffer);
+			glUnmapBuffer(GL_ARRAY_BUFFER);
+			glBindBuffer(GL_ARRAY_BUFFER, 0);
+		}
+		GLES3::Utilities::get_singleton()->buffer_free_data(state.instance_ring.buffer);
+		for (uint32_t i = 0; i < state.instance_ring.regions.size(); i++) {
+			glDeleteSync(state.instance_ring.regions[i].fence);
+		}
+	}
 }
 
 #endif // GLES3_ENABLED
@@ -118,6 +118,7 @@ class RasterizerCanvasGLES3 : public RendererCanvasRender {
 
 	struct OccluderPolygon {
 		RS::CanvasOccluderPolygonCullMode cull_mode = RS::CANVAS_OCCLUDER_POLYGON_CULL_DISABLED;
+		uint32_t version = 0; // Bumped on shape or cull mode changes, invalidates cached shadows.
 		int line_point_count = 0;
 		GLuint vertex_buffer = 0;
 		GLuint vertex_array = 0;
@@ -251,6 +252,9 @@ public:
 		uint32_t max_instance_buffer_size = 16384 * 128;
 	} data;
 
+	// Batches with this buffer index read their instance data from the instance ring.
+	static constexpr uint32_t INSTANCE_RING_BUFFER_INDEX = UINT32_MAX;
+
 	struct Batch {
 		// Position in the UBO measured in bytes
 		uint32_t start = 0;
@@ -288,6 +292,24 @@ public:
 		GLsync fence = GLsync();
 	};
 
+	// InstanceRing is a single large streaming buffer for instance data shared by all frames.
+	// When buffer storage is supported it stays persistently mapped, otherwise it is orphaned
+	// once the GPU still uses the space we need. Every _render_items() call fences the region
+	// it wrote so that region can be reused as soon as the GPU is done with it.
+	struct InstanceRing {
+		struct Region {
+			uint64_t end = 0;
+			GLsync fence = GLsync();
+		};
+
+		GLuint buffer = 0;
+		InstanceData *mapped = nullptr;
+		uint32_t size = 0; // Measured in instances.
+		uint64_t head = 0; // Instances written so far, the buffer offset is head % size.
+		uint64_t call_start = 0; // Head when the current _render_items() call started writing.
+		LocalVector<Region> regions; // Oldest first.
+	};
+
 	struct State {
 		LocalVector<DataBuffer> canvas_instance_data_buffers;
 		LocalVector<Batch> canvas_instance_batches;
@@ -295,8 +317,14 @@ public:
 		uint32_t current_instance_buffer_index = 0;
 		uint32_t current_batch_index = 0;
 		uint32_t last_item_index = 0;
+		uint32_t instance_chunk_first_batch = 0;
+
+		InstanceRing instance_ring;
+		bool instance_chunk_in_ring = false; // The chunk is recorded straight into the mapped ring.
+		uint32_t instance_chunk_offset = 0;
 
-		InstanceData *instance_data_array = nullptr;
+		InstanceData *instance_data = nullptr; // Where the current chunk is recorded.
+		InstanceData *instance_data_array = nullptr; // Staging for chunks uploaded with glMapBufferRange() or glBufferSubData().
 
 		LightUniform *light_uniforms = nullptr;
 
@@ -304,6 +332,8 @@ public:
 		GLuint shadow_depth_buffer = 0;
 		GLuint shadow_fb = 0;
 		int shadow_texture_size = 2048;
+		// Hash of what each row of the shadow atlas was last rendered with, 0 if unknown.
+		LocalVector<uint64_t> shadow_row_hashes;
 
 		bool using_directional_lights = false;
 
@@ -359,10 +389,16 @@ public:
 	void _record_item_commands(const Item *p_item, RID p_render_target, const Transform2D &p_canvas_transform_inverse, Item *&current_clip, GLES3::CanvasShaderData::BlendMode p_blend_mode, Light *p_lights, uint32_t &r_index, bool &r_break_batch, bool &r_sdf_used);
 	void _render_batch(Light *p_lights, uint32_t p_index);
 	bool _bind_material(GLES3::CanvasMaterialData *p_material_data, CanvasShaderGLES3::ShaderVariant p_variant, uint64_t p_specialization);
-	void _new_batch(bool &r_batch_broken);
+	void _new_batch(bool &r_batch_broken, RS::CanvasBatchBreakReason p_reason);
 	void _add_to_batch(uint32_t &r_index, bool &r_batch_broken);
 	void _allocate_instance_data_buffer();
 	void _allocate_instance_buffer();
+	void _allocate_instance_ring();
+	bool _instance_ring_reserve(uint32_t p_count, uint32_t &r_offset);
+	void _fence_instance_ring();
+	void _begin_instance_chunk();
+	void _upload_instance_data(uint32_t p_count);
+	_FORCE_INLINE_ GLuint _get_batch_instance_buffer(uint32_t p_index) const;
 	void _enable_attributes(uint32_t p_start, bool p_primitive, uint32_t p_rate = 1);
 
 	void set_time(double p_time);
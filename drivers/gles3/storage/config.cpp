@@ -35,10 +35,59 @@
 #include "../rasterizer_gles3.h"
 #include "texture_storage.h"
 
+#if defined(WINDOWS_ENABLED) && defined(GLAD_ENABLED)
+#include <windows.h>
+#elif defined(X11_ENABLED) && defined(GLAD_ENABLED)
+#include "thirdparty/glad/glad/glx.h"
+#endif
+
 using namespace GLES3;
 
 #define _GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT 0x84FF
 
+#if defined(WINDOWS_ENABLED) && defined(GLAD_ENABLED)
+#if defined(__GNUC__)
+// Workaround GCC warning from -Wcast-function-type.
+#define GetProcAddress (void *)GetProcAddress
+#endif
+
+typedef void *(APIENTRY *PFNWGLGETPROCADDRESS)(LPCSTR);
+#endif
+
+// glBufferStorage() is not part of the generated glad loader, so it's resolved through
+// the loader of whichever context is current.
+static PFNGLBUFFERSTORAGEPROC _get_buffer_storage_proc(const char *p_name) {
+#if defined(ANDROID_ENABLED)
+	return (PFNGLBUFFERSTORAGEPROC)eglGetProcAddress(p_name);
+#else
+#ifdef EGL_ENABLED
+#if defined(EGL_STATIC)
+	bool has_egl = true;
+#else
+	bool has_egl = (eglGetProcAddress != nullptr && eglGetCurrentContext != nullptr);
+#endif
+	if (has_egl && eglGetCurrentContext() != EGL_NO_CONTEXT) {
+		return (PFNGLBUFFERSTORAGEPROC)eglGetProcAddress(p_name);
+	}
+#endif // EGL_ENABLED
+
+#if defined(WINDOWS_ENABLED) && defined(GLAD_ENABLED)
+	// The WGL context already loaded opengl32.dll.
+	HMODULE module = GetModuleHandleW(L"opengl32.dll");
+	PFNWGLGETPROCADDRESS get_proc_address = module ? (PFNWGLGETPROCADDRESS)GetProcAddress(module, "wglGetProcAddress") : nullptr;
+	if (get_proc_address) {
+		return (PFNGLBUFFERSTORAGEPROC)get_proc_address(p_name);
+	}
+#elif defined(X11_ENABLED) && defined(GLAD_ENABLED)
+	// Loaded by GLManager_X11 before the context was created.
+	if (glXGetProcAddressARB != nullptr) {
+		return (PFNGLBUFFERSTORAGEPROC)glXGetProcAddressARB((const GLubyte *)p_name);
+	}
+#endif
+	return nullptr;
+#endif // ANDROID_ENABLED
+}
+
 Config *Config::singleton = nullptr;
 
 Config::Config() {
@@ -102,6 +151,16 @@ Config::Config() {
 	}
 #endif
 
+	if (RasterizerGLES3::is_gles_over_gl()) {
+		if (extensions.has("GL_ARB_buffer_storage")) {
+			buffer_storage_func = _get_buffer_storage_proc("glBufferStorage");
+		}
+	} else if (extensions.has("GL_EXT_buffer_storage")) {
+		buffer_storage_func = _get_buffer_storage_proc("glBufferStorageEXT");
+	}
+	// WebGL can't map buffers at all.
+	buffer_storage_supported = buffer_storage_func != nullptr;
+
 	force_vertex_shading = false; //GLOBAL_GET("rendering/quality/shading/force_vertex_shading");
 	use_nearest_mip_filter = GLOBAL_GET("rendering/textures/default_filters/use_nearest_mipmap_filter");
 
@@ -125,6 +184,7 @@ Config::Config() {
 	max_renderable_elements = GLOBAL_GET("rendering/limits/opengl/max_renderable_elements");
 	max_renderable_lights = GLOBAL_GET("rendering/limits/opengl/max_renderable_lights");
 	max_lights_per_object = GLOBAL_GET("rendering/limits/opengl/max_lights_per_object");
+	canvas_texture_atlas_size = MIN(int64_t(GLOBAL_GET("rendering/gl_compatibility/canvas_texture_atlas_size")), max_texture_size);
 }
 
 Config::~Config() {
@@ -44,6 +44,12 @@
 typedef void (*PFNGLFRAMEBUFFERTEXTUREMULTIVIEWOVRPROC)(GLenum, GLenum, GLuint, GLint, GLint, GLsizei);
 #endif
 
+#ifdef GLAD_ENABLED
+typedef void(GLAD_API_PTR *PFNGLBUFFERSTORAGEPROC)(GLenum, GLsizeiptr, const void *, GLbitfield);
+#else
+typedef void (*PFNGLBUFFERSTORAGEPROC)(GLenum, GLsizeiptr, const void *, GLbitfield);
+#endif
+
 namespace GLES3 {
 
 class Config {
@@ -62,6 +68,7 @@ public:
 	int64_t max_renderable_elements = 0;
 	int64_t max_renderable_lights = 0;
 	int64_t max_lights_per_object = 0;
+	int64_t canvas_texture_atlas_size = 0;
 
 	bool generate_wireframes = false;
 
@@ -86,6 +93,9 @@ public:
 	PFNGLFRAMEBUFFERTEXTUREMULTIVIEWOVRPROC eglFramebufferTextureMultiviewOVR = nullptr;
 #endif
 
+	bool buffer_storage_supported = false;
+	PFNGLBUFFERSTORAGEPROC buffer_storage_func = nullptr; // glBufferStorage() or glBufferStorageEXT().
+
 	static Config *get_singleton() { return singleton; };
 
 	Config();
@@ -216,6 +216,9 @@ TextureStorage::TextureStorage() {
 		sdf_shader.shader_version = sdf_shader.shader.version_create();
 	}
 
+	canvas_texture_atlas.size = Config::get_singleton()->canvas_texture_atlas_size;
+	canvas_texture_atlas.max_texture_size = canvas_texture_atlas.size / 8;
+
 #ifdef GL_API_ENABLED
 	if (RasterizerGLES3::is_gles_over_gl()) {
 		glEnable(GL_PROGRAM_POINT_SIZE);
@@ -234,6 +237,14 @@ TextureStorage::~TextureStorage() {
 	texture_atlas.texture = 0;
 	glDeleteFramebuffers(1, &texture_atlas.framebuffer);
 	texture_atlas.framebuffer = 0;
+	if (canvas_texture_atlas.texture.is_valid()) {
+		Texture *t = texture_owner.get_or_null(canvas_texture_atlas.texture);
+		GLES3::Utilities::get_singleton()->texture_free_data(t->tex_id);
+		texture_free(canvas_texture_atlas.texture);
+		canvas_texture_atlas.texture = RID();
+		glDeleteFramebuffers(1, &canvas_texture_atlas.framebuffer);
+		canvas_texture_atlas.framebuffer = 0;
+	}
 	sdf_shader.shader.version_free(sdf_shader.shader_version);
 }
 
@@ -728,6 +739,7 @@ void TextureStorage::texture_free(RID p_texture) {
 	}
 
 	texture_atlas_remove_texture(p_texture);
+	canvas_texture_atlas_remove_texture(p_texture);
 
 	for (int i = 0; i < t->proxies.size(); i++) {
 		Texture *p = texture_owner.get_or_null(t->proxies[i]);
@@ -867,11 +879,60 @@ void TextureStorage::texture_2d_update(RID p_texture, const Ref<Image> &p_image,
 	ERR_FAIL_NULL(tex);
 	GLES3::Utilities::get_singleton()->texture_resize_data(tex->tex_id, tex->total_data_size);
 
+	canvas_texture_atlas_mark_dirty_on_texture(p_texture);
+
 #ifdef TOOLS_ENABLED
 	tex->image_cache_2d.unref();
 #endif
 }
 
+void TextureStorage::texture_2d_update_region(RID p_texture, const Ref<Image> &p_image, const Vector2i &p_position, int p_mipmap, int p_layer) {
+	Texture *texture = texture_owner.get_or_null(p_texture);
+	ERR_FAIL_NULL(texture);
+	ERR_FAIL_COND(!texture->active);
+	ERR_FAIL_COND(texture->is_render_target || texture->is_proxy);
+	ERR_FAIL_COND(texture->target != GL_TEXTURE_2D && texture->target != GL_TEXTURE_2D_ARRAY);
+	ERR_FAIL_COND(p_image.is_null() || p_image->is_empty());
+	ERR_FAIL_COND(texture->format != p_image->get_format());
+	ERR_FAIL_COND_MSG(p_image->is_compressed() || p_image->has_mipmaps(), "Texture regions must be updated with uncompressed images without mipmaps.");
+	ERR_FAIL_COND_MSG(texture->alloc_width != texture->width || texture->alloc_height != texture->height, "Can't update a region of a texture that was resized to a power of 2.");
+	ERR_FAIL_INDEX(p_mipmap, texture->mipmaps);
+	if (texture->target == GL_TEXTURE_2D_ARRAY) {
+		ERR_FAIL_INDEX(p_layer, texture->layers);
+	}
+
+	int mip_width = MAX(texture->alloc_width >> p_mipmap, 1);
+	int mip_height = MAX(texture->alloc_height >> p_mipmap, 1);
+	ERR_FAIL_COND(p_position.x < 0 || p_position.y < 0);
+	ERR_FAIL_COND(p_position.x + p_image->get_width() > mip_width || p_position.y + p_image->get_height() > mip_height);
+
+	GLenum type;
+	GLenum format;
+	GLenum internal_format;
+	bool compressed = false;
+
+	Image::Format real_format;
+	Ref<Image> img = _get_gl_image_and_format(p_image, p_image->get_format(), real_format, format, internal_format, type, compressed, false);
+	ERR_FAIL_COND(img.is_null() || compressed);
+
+	Vector<uint8_t> read = img->get_data();
+
+	glActiveTexture(GL_TEXTURE0);
+	glBindTexture(texture->target, texture->tex_id);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	if (texture->target == GL_TEXTURE_2D_ARRAY) {
+		glTexSubImage3D(GL_TEXTURE_2D_ARRAY, p_mipmap, p_position.x, p_position.y, p_layer, img->get_width(), img->get_height(), 1, format, type, read.ptr());
+	} else {
+		glTexSubImage2D(GL_TEXTURE_2D, p_mipmap, p_position.x, p_position.y, img->get_width(), img->get_height(), format, type, read.ptr());
+	}
+
+	canvas_texture_atlas_mark_dirty_on_texture(p_texture);
+
+#ifdef TOOLS_ENABLED
+	texture->image_cache_2d.unref();
+#endif
+}
+
 void TextureStorage::texture_proxy_update(RID p_texture, RID p_proxy_to) {
 	Texture *tex = texture_owner.get_or_null(p_texture);
 	ERR_FAIL_NULL(tex);
@@ -1104,8 +1165,10 @@ void TextureStorage::texture_replace(RID p_texture, RID p_by_texture) {
 	}
 	//delete last, so proxies can be updated
 	texture_owner.free(p_by_texture);
+	canvas_texture_atlas_remove_texture(p_by_texture);
 
 	texture_atlas_mark_dirty_on_texture(p_texture);
+	canvas_texture_atlas_mark_dirty_on_texture(p_texture);
 }
 
 void TextureStorage::texture_set_size_override(RID p_texture, int p_width, int p_height) {
@@ -1623,6 +1686,225 @@ void TextureStorage::update_texture_atlas() {
 	glBindFramebuffer(GL_FRAMEBUFFER, 0);
 }
 
+/* CANVAS TEXTURE ATLAS API */
+
+bool TextureStorage::_canvas_texture_atlas_allocate(const Size2i &p_size, Rect2i &r_rect) {
+	// Shelf packing: reuse the shortest shelf that fits without wasting more than a quarter of its height.
+	int best_shelf = -1;
+	for (uint32_t i = 0; i < canvas_texture_atlas.shelves.size(); i++) {
+		const CanvasTextureAtlas::Shelf &shelf = canvas_texture_atlas.shelves[i];
+		if (shelf.height < p_size.height || p_size.height * 4 < shelf.height * 3 || shelf.width_used + p_size.width > canvas_texture_atlas.size) {
+			continue;
+		}
+		if (best_shelf == -1 || shelf.height < canvas_texture_atlas.shelves[best_shelf].height) {
+			best_shelf = i;
+		}
+	}
+
+	if (best_shelf == -1) {
+		if (canvas_texture_atlas.shelves_height + p_size.height > canvas_texture_atlas.size) {
+			return false;
+		}
+		CanvasTextureAtlas::Shelf shelf;
+		shelf.y = canvas_texture_atlas.shelves_height;
+		shelf.height = p_size.height;
+		canvas_texture_atlas.shelves_height += p_size.height;
+		best_shelf = canvas_texture_atlas.shelves.size();
+		canvas_texture_atlas.shelves.push_back(shelf);
+	}
+
+	CanvasTextureAtlas::Shelf &shelf = canvas_texture_atlas.shelves[best_shelf];
+	r_rect = Rect2i(shelf.width_used, shelf.y, p_size.width, p_size.height);
+	shelf.width_used += p_size.width;
+	return true;
+}
+
+void TextureStorage::_canvas_texture_atlas_clear() {
+	canvas_texture_atlas.textures.clear();
+	canvas_texture_atlas.pending.clear();
+	canvas_texture_atlas.shelves.clear();
+	canvas_texture_atlas.shelves_height = 0;
+	canvas_texture_atlas.wasted_area = 0;
+	canvas_texture_atlas.clear_requested = true;
+}
+
+bool TextureStorage::canvas_texture_atlas_get_rect(RID p_texture, RS::CanvasItemTextureFilter p_filter, Rect2 &r_uv_rect) {
+	if (canvas_texture_atlas.size == 0) {
+		return false;
+	}
+
+	// Proxies (e.g. AnimatedTexture frames) share the entry of the texture they point to.
+	RID rid = p_texture;
+	Texture *t = texture_owner.get_or_null(rid);
+	if (t && t->is_proxy) {
+		rid = t->proxy_to;
+		t = texture_owner.get_or_null(rid);
+	}
+	if (!t) {
+		return false;
+	}
+
+	if (t->mipmaps > 1 && p_filter != RS::CANVAS_ITEM_TEXTURE_FILTER_NEAREST && p_filter != RS::CANVAS_ITEM_TEXTURE_FILTER_LINEAR) {
+		return false; // The atlas has no mipmaps.
+	}
+
+	CanvasTextureAtlas::Texture *at = canvas_texture_atlas.textures.getptr(rid);
+	if (at) {
+		if (!at->ready) {
+			return false;
+		}
+		r_uv_rect = at->uv_rect;
+		return true;
+	}
+
+	if (t->type != Texture::TYPE_2D || t->is_external || t->is_render_target || t->tex_id == 0) {
+		return false;
+	}
+	if (t->width > canvas_texture_atlas.max_texture_size || t->height > canvas_texture_atlas.max_texture_size) {
+		return false;
+	}
+	if (t->format > Image::FORMAT_RGB565 && !t->compressed) {
+		return false; // Float formats would lose precision in the RGBA8 atlas.
+	}
+
+	Rect2i rect;
+	Size2i padded_size(t->width + 2, t->height + 2);
+	if (!_canvas_texture_atlas_allocate(padded_size, rect)) {
+		if (canvas_texture_atlas.wasted_area * 4 <= canvas_texture_atlas.size * canvas_texture_atlas.size) {
+			return false; // Atlas is full, keep drawing from the texture itself.
+		}
+		// Most of the atlas is taken by stale entries, start over.
+		_canvas_texture_atlas_clear();
+		if (!_canvas_texture_atlas_allocate(padded_size, rect)) {
+			return false;
+		}
+	}
+
+	CanvasTextureAtlas::Texture entry;
+	entry.rect = rect;
+	entry.uv_rect = Rect2(Vector2(rect.position + Vector2i(1, 1)) / canvas_texture_atlas.size, Vector2(t->width, t->height) / canvas_texture_atlas.size);
+	canvas_texture_atlas.textures[rid] = entry;
+	canvas_texture_atlas.pending.push_back(rid);
+
+	// Will be usable once update_canvas_texture_atlas() copied it in.
+	return false;
+}
+
+void TextureStorage::canvas_texture_atlas_mark_dirty_on_texture(RID p_texture) {
+	CanvasTextureAtlas::Texture *at = canvas_texture_atlas.textures.getptr(p_texture);
+	if (!at) {
+		return;
+	}
+
+	Texture *t = texture_owner.get_or_null(p_texture);
+	if (t && t->width + 2 == at->rect.size.width && t->height + 2 == at->rect.size.height) {
+		if (at->ready) {
+			at->ready = false;
+			canvas_texture_atlas.pending.push_back(p_texture);
+		}
+		return;
+	}
+
+	// Size changed, the texture will be allocated again next time it is drawn.
+	canvas_texture_atlas_remove_texture(p_texture);
+}
+
+void TextureStorage::canvas_texture_atlas_remove_texture(RID p_texture) {
+	CanvasTextureAtlas::Texture *at = canvas_texture_atlas.textures.getptr(p_texture);
+	if (!at) {
+		return;
+	}
+	// Space is not reclaimed, it is only accounted for so the atlas can be rebuilt when mostly stale.
+	canvas_texture_atlas.wasted_area += at->rect.get_area();
+	canvas_texture_atlas.textures.erase(p_texture);
+}
+
+void TextureStorage::update_canvas_texture_atlas() {
+	if (canvas_texture_atlas.pending.is_empty() && !canvas_texture_atlas.clear_requested) {
+		return; //nothing to do
+	}
+
+	CopyEffects *copy_effects = CopyEffects::get_singleton();
+	ERR_FAIL_NULL(copy_effects);
+
+	int size = canvas_texture_atlas.size;
+
+	if (canvas_texture_atlas.texture.is_null()) {
+		GLuint tex_id = 0;
+		glGenTextures(1, &tex_id);
+		glActiveTexture(GL_TEXTURE0);
+		glBindTexture(GL_TEXTURE_2D, tex_id);
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, size, size, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+		GLES3::Utilities::get_singleton()->texture_allocated_data(tex_id, size * size * 4, "Canvas texture atlas");
+
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 0);
+
+		glGenFramebuffers(1, &canvas_texture_atlas.framebuffer);
+		glBindFramebuffer(GL_FRAMEBUFFER, canvas_texture_atlas.framebuffer);
+		glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, tex_id, 0);
+
+		GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+		glBindTexture(GL_TEXTURE_2D, 0);
+
+		if (status != GL_FRAMEBUFFER_COMPLETE) {
+			glBindFramebuffer(GL_FRAMEBUFFER, 0);
+			glDeleteFramebuffers(1, &canvas_texture_atlas.framebuffer);
+			canvas_texture_atlas.framebuffer = 0;
+			GLES3::Utilities::get_singleton()->texture_free_data(tex_id);
+			// Disable the atlas, textures are drawn on their own from now on.
+			canvas_texture_atlas.size = 0;
+			_canvas_texture_atlas_clear();
+			WARN_PRINT("Could not create canvas texture atlas, status: " + get_framebuffer_error(status));
+			return;
+		}
+
+		canvas_texture_atlas.texture = texture_create_external(Texture::TYPE_2D, Image::FORMAT_RGBA8, tex_id, size, size, 1, 1);
+		canvas_texture_atlas.clear_requested = true;
+	} else {
+		glBindFramebuffer(GL_FRAMEBUFFER, canvas_texture_atlas.framebuffer);
+	}
+
+	glViewport(0, 0, size, size);
+	glDisable(GL_BLEND);
+	glDisable(GL_SCISSOR_TEST);
+
+	if (canvas_texture_atlas.clear_requested) {
+		glClearColor(0.0, 0.0, 0.0, 0.0);
+		glClear(GL_COLOR_BUFFER_BIT);
+		canvas_texture_atlas.clear_requested = false;
+	}
+
+	glActiveTexture(GL_TEXTURE0);
+	for (const RID &rid : canvas_texture_atlas.pending) {
+		CanvasTextureAtlas::Texture *at = canvas_texture_atlas.textures.getptr(rid);
+		Texture *src_tex = texture_owner.get_or_null(rid);
+		if (!at || at->ready || !src_tex || src_tex->tex_id == 0) {
+			continue; // Removed or replaced since it was queued.
+		}
+
+		glBindTexture(GL_TEXTURE_2D, src_tex->tex_id);
+		src_tex->gl_set_filter(RS::CANVAS_ITEM_TEXTURE_FILTER_NEAREST);
+		src_tex->gl_set_repeat(RS::CANVAS_ITEM_TEXTURE_REPEAT_DISABLED);
+
+		// Copy with a one pixel border on each side, clamping the source extrudes its edge pixels
+		// so that linear filtering at the sprite edges does not bleed in neighboring textures.
+		Vector2 src_pixel = Vector2(1.0 / src_tex->width, 1.0 / src_tex->height);
+		Rect2 source_rect = Rect2(-src_pixel, Vector2(1.0, 1.0) + src_pixel * 2.0);
+		copy_effects->copy_to_rect_from_rect(Rect2(Vector2(at->rect.position) / size, Vector2(at->rect.size) / size), source_rect);
+
+		at->ready = true;
+	}
+	canvas_texture_atlas.pending.clear();
+
+	glBindTexture(GL_TEXTURE_2D, 0);
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
 /* RENDER TARGET API */
 
 GLuint TextureStorage::system_fbo = 0;
@@ -439,6 +439,39 @@ private:
 		Size2i size;
 	} texture_atlas;
 
+	/* CANVAS TEXTURE ATLAS API */
+
+	// Small 2D textures are copied into a shared atlas at runtime so that sprites
+	// using different textures can still be drawn in a single batch.
+	struct CanvasTextureAtlas {
+		struct Texture {
+			Rect2i rect; // Includes the one pixel border on each side.
+			Rect2 uv_rect;
+			bool ready = false;
+		};
+
+		struct Shelf {
+			int y = 0;
+			int height = 0;
+			int width_used = 0;
+		};
+
+		HashMap<RID, Texture> textures;
+		LocalVector<RID> pending;
+		LocalVector<Shelf> shelves;
+		int shelves_height = 0;
+		int wasted_area = 0;
+		bool clear_requested = false;
+
+		RID texture;
+		GLuint framebuffer = 0;
+		int size = 0;
+		int max_texture_size = 0;
+	} canvas_texture_atlas;
+
+	bool _canvas_texture_atlas_allocate(const Size2i &p_size, Rect2i &r_rect);
+	void _canvas_texture_atlas_clear();
+
 	/* Render Target API */
 
 	mutable RID_Owner<RenderTarget> render_target_owner;
@@ -506,6 +539,7 @@ public:
 	RID texture_create_external(Texture::Type p_type, Image::Format p_format, unsigned int p_image, int p_width, int p_height, int p_depth, int p_layers, RS::TextureLayeredType p_layered_type = RS::TEXTURE_LAYERED_2D_ARRAY);
 
 	virtual void texture_2d_update(RID p_texture, const Ref<Image> &p_image, int p_layer = 0) override;
+	virtual void texture_2d_update_region(RID p_texture, const Ref<Image> &p_image, const Vector2i &p_position, int p_mipmap = 0, int p_layer = 0) override;
 	virtual void texture_3d_update(RID p_texture, const Vector<Ref<Image>> &p_data) override{};
 	virtual void texture_proxy_update(RID p_proxy, RID p_base) override;
 
@@ -566,6 +600,17 @@ public:
 	void texture_atlas_mark_dirty_on_texture(RID p_texture);
 	void texture_atlas_remove_texture(RID p_texture);
 
+	/* CANVAS TEXTURE ATLAS API */
+
+	void update_canvas_texture_atlas();
+
+	_FORCE_INLINE_ RID canvas_texture_atlas_get_texture() const {
+		return canvas_texture_atlas.texture;
+	}
+	bool canvas_texture_atlas_get_rect(RID p_texture, RS::CanvasItemTextureFilter p_filter, Rect2 &r_uv_rect);
+	void canvas_texture_atlas_mark_dirty_on_texture(RID p_texture);
+	void canvas_texture_atlas_remove_texture(RID p_texture);
+
 	/* DECAL API */
 
 	virtual void texture_add_to_decal_atlas(RID p_texture, bool p_panorama_to_dp = false) override {}
@@ -81,6 +81,20 @@ public:
 		buffer_allocs_cache[p_id] = resource_allocation;
 	}
 
+	// Records that data was allocated for state tracking purposes, e.g. for immutable buffer storage.
+	_FORCE_INLINE_ void buffer_allocated_data(GLuint p_id, uint32_t p_size, String p_name = "") {
+		buffer_mem_cache += p_size;
+#ifdef DEV_ENABLED
+		ERR_FAIL_COND_MSG(buffer_allocs_cache.has(p_id), "trying to allocate buffer with name " + p_name + " but ID already used by " + buffer_allocs_cache[p_id].name);
+#endif
+		ResourceAllocation resource_allocation;
+		resource_allocation.size = p_size;
+#ifdef DEV_ENABLED
+		resource_allocation.name = p_name + ": " + itos((uint64_t)p_id);
+#endif
+		buffer_allocs_cache[p_id] = resource_allocation;
+	}
+
 	_FORCE_INLINE_ void buffer_free_data(GLuint p_id) {
 		ERR_FAIL_COND(!buffer_allocs_cache.has(p_id));
 		glDeleteBuffers(1, &p_id);
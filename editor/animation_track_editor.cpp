@@ -43,6 +43,7 @@
 #include "editor/gui/scene_tree_editor.h"
 #include "editor/inspector_dock.h"
 #include "editor/plugins/animation_player_editor_plugin.h"
+#include "scene/2d/node_2d.h"
 #include "scene/animation/animation_player.h"
 #include "scene/animation/tween.h"
 #include "scene/gui/check_box.h"
@@ -136,6 +137,9 @@ bool AnimationTrackKeyEdit::_set(const StringName &p_name, const Variant &p_valu
 		case Animation::TYPE_SCALE_3D: {
 		} break;
 		case Animation::TYPE_BLEND_SHAPE:
+		case Animation::TYPE_POSITION_2D:
+		case Animation::TYPE_ROTATION_2D:
+		case Animation::TYPE_SCALE_2D:
 		case Animation::TYPE_VALUE: {
 			if (name == "value") {
 				Variant value = p_value;
@@ -380,6 +384,9 @@ bool AnimationTrackKeyEdit::_get(const StringName &p_name, Variant &r_ret) const
 		case Animation::TYPE_SCALE_3D: {
 		} break;
 		case Animation::TYPE_BLEND_SHAPE:
+		case Animation::TYPE_POSITION_2D:
+		case Animation::TYPE_ROTATION_2D:
+		case Animation::TYPE_SCALE_2D:
 		case Animation::TYPE_VALUE: {
 			if (name == "value") {
 				r_ret = animation->track_get_key_value(track, key);
@@ -491,6 +498,13 @@ void AnimationTrackKeyEdit::_get_property_list(List<PropertyInfo> *p_list) const
 		} break;
 		case Animation::TYPE_BLEND_SHAPE: {
 		} break;
+		case Animation::TYPE_POSITION_2D:
+		case Animation::TYPE_SCALE_2D: {
+			p_list->push_back(PropertyInfo(Variant::VECTOR2, PNAME("value")));
+		} break;
+		case Animation::TYPE_ROTATION_2D: {
+			p_list->push_back(PropertyInfo(Variant::FLOAT, PNAME("value"), PROPERTY_HINT_RANGE, "-360,360,0.1,or_less,or_greater,radians_as_degrees"));
+		} break;
 		case Animation::TYPE_VALUE: {
 			Variant v = animation->track_get_key_value(track, key);
 
@@ -701,6 +715,9 @@ bool AnimationMultiTrackKeyEdit::_set(const StringName &p_name, const Variant &p
 				case Animation::TYPE_SCALE_3D: {
 				} break;
 				case Animation::TYPE_BLEND_SHAPE:
+				case Animation::TYPE_POSITION_2D:
+				case Animation::TYPE_ROTATION_2D:
+				case Animation::TYPE_SCALE_2D:
 				case Animation::TYPE_VALUE: {
 					if (name == "value") {
 						Variant value = p_value;
@@ -925,6 +942,9 @@ bool AnimationMultiTrackKeyEdit::_get(const StringName &p_name, Variant &r_ret)
 				case Animation::TYPE_SCALE_3D: {
 				} break;
 				case Animation::TYPE_BLEND_SHAPE:
+				case Animation::TYPE_POSITION_2D:
+				case Animation::TYPE_ROTATION_2D:
+				case Animation::TYPE_SCALE_2D:
 				case Animation::TYPE_VALUE: {
 					if (name == "value") {
 						r_ret = animation->track_get_key_value(track, key);
@@ -1068,6 +1088,13 @@ void AnimationMultiTrackKeyEdit::_get_property_list(List<PropertyInfo> *p_list)
 			} break;
 			case Animation::TYPE_BLEND_SHAPE: {
 			} break;
+			case Animation::TYPE_POSITION_2D:
+			case Animation::TYPE_SCALE_2D: {
+				p_list->push_back(PropertyInfo(Variant::VECTOR2, "value"));
+			} break;
+			case Animation::TYPE_ROTATION_2D: {
+				p_list->push_back(PropertyInfo(Variant::FLOAT, "value", PROPERTY_HINT_RANGE, "-360,360,0.1,or_less,or_greater,radians_as_degrees"));
+			} break;
 			case Animation::TYPE_VALUE: {
 				if (same_key_type) {
 					Variant v = animation->track_get_key_value(first_track, first_key);
@@ -1280,15 +1307,19 @@ void AnimationTimelineEdit::_notification(int p_what) {
 			time_icon->set_texture(get_editor_theme_icon(SNAME("Time")));
 
 			add_track->get_popup()->clear();
-			add_track->get_popup()->add_icon_item(get_editor_theme_icon(SNAME("KeyValue")), TTR("Property Track"));
-			add_track->get_popup()->add_icon_item(get_editor_theme_icon(SNAME("KeyXPosition")), TTR("3D Position Track"));
-			add_track->get_popup()->add_icon_item(get_editor_theme_icon(SNAME("KeyXRotation")), TTR("3D Rotation Track"));
-			add_track->get_popup()->add_icon_item(get_editor_theme_icon(SNAME("KeyXScale")), TTR("3D Scale Track"));
-			add_track->get_popup()->add_icon_item(get_editor_theme_icon(SNAME("KeyBlendShape")), TTR("Blend Shape Track"));
-			add_track->get_popup()->add_icon_item(get_editor_theme_icon(SNAME("KeyCall")), TTR("Call Method Track"));
-			add_track->get_popup()->add_icon_item(get_editor_theme_icon(SNAME("KeyBezier")), TTR("Bezier Curve Track"));
-			add_track->get_popup()->add_icon_item(get_editor_theme_icon(SNAME("KeyAudio")), TTR("Audio Playback Track"));
-			add_track->get_popup()->add_icon_item(get_editor_theme_icon(SNAME("KeyAnimation")), TTR("Animation Playback Track"));
+			// The item IDs are the track types.
+			add_track->get_popup()->add_icon_item(get_editor_theme_icon(SNAME("KeyValue")), TTR("Property Track"), Animation::TYPE_VALUE);
+			add_track->get_popup()->add_icon_item(get_editor_theme_icon(SNAME("KeyTrackPosition")), TTR("2D Position Track"), Animation::TYPE_POSITION_2D);
+			add_track->get_popup()->add_icon_item(get_editor_theme_icon(SNAME("KeyTrackRotation")), TTR("2D Rotation Track"), Animation::TYPE_ROTATION_2D);
+			add_track->get_popup()->add_icon_item(get_editor_theme_icon(SNAME("KeyTrackScale")), TTR("2D Scale Track"), Animation::TYPE_SCALE_2D);
+			add_track->get_popup()->add_icon_item(get_editor_theme_icon(SNAME("KeyXPosition")), TTR("3D Position Track"), Animation::TYPE_POSITION_3D);
+			add_track->get_popup()->add_icon_item(get_editor_theme_icon(SNAME("KeyXRotation")), TTR("3D Rotation Track"), Animation::TYPE_ROTATION_3D);
+			add_track->get_popup()->add_icon_item(get_editor_theme_icon(SNAME("KeyXScale")), TTR("3D Scale Track"), Animation::TYPE_SCALE_3D);
+			add_track->get_popup()->add_icon_item(get_editor_theme_icon(SNAME("KeyBlendShape")), TTR("Blend Shape Track"), Animation::TYPE_BLEND_SHAPE);
+			add_track->get_popup()->add_icon_item(get_editor_theme_icon(SNAME("KeyCall")), TTR("Call Method Track"), Animation::TYPE_METHOD);
+			add_track->get_popup()->add_icon_item(get_editor_theme_icon(SNAME("KeyBezier")), TTR("Bezier Curve Track"), Animation::TYPE_BEZIER);
+			add_track->get_popup()->add_icon_item(get_editor_theme_icon(SNAME("KeyAudio")), TTR("Audio Playback Track"), Animation::TYPE_AUDIO);
+			add_track->get_popup()->add_icon_item(get_editor_theme_icon(SNAME("KeyAnimation")), TTR("Animation Playback Track"), Animation::TYPE_ANIMATION);
 		} break;
 
 		case EditorSettings::NOTIFICATION_EDITOR_SETTINGS_CHANGED: {
@@ -1736,7 +1767,7 @@ AnimationTimelineEdit::AnimationTimelineEdit() {
 	add_child(len_hb);
 
 	add_track->hide();
-	add_track->get_popup()->connect("index_pressed", callable_mp(this, &AnimationTimelineEdit::_track_added));
+	add_track->get_popup()->connect("id_pressed", callable_mp(this, &AnimationTimelineEdit::_track_added));
 	len_hb->hide();
 
 	panner.instantiate();
@@ -1982,7 +2013,7 @@ void AnimationTrackEdit::_notification(int p_what) {
 					interp_mode_rect.position.y = int(get_size().height - icon->get_height()) / 2;
 					interp_mode_rect.size = icon->get_size();
 
-					if (!animation->track_is_compressed(track) && (animation->track_get_type(track) == Animation::TYPE_VALUE || animation->track_get_type(track) == Animation::TYPE_BLEND_SHAPE || animation->track_get_type(track) == Animation::TYPE_POSITION_3D || animation->track_get_type(track) == Animation::TYPE_SCALE_3D || animation->track_get_type(track) == Animation::TYPE_ROTATION_3D)) {
+					if (!animation->track_is_compressed(track) && (animation->track_get_type(track) == Animation::TYPE_VALUE || animation->track_get_type(track) == Animation::TYPE_BLEND_SHAPE || animation->track_get_type(track) == Animation::TYPE_POSITION_3D || animation->track_get_type(track) == Animation::TYPE_SCALE_3D || animation->track_get_type(track) == Animation::TYPE_ROTATION_3D || animation->track_get_type(track) == Animation::TYPE_POSITION_2D || animation->track_get_type(track) == Animation::TYPE_ROTATION_2D || animation->track_get_type(track) == Animation::TYPE_SCALE_2D)) {
 						draw_texture(icon, interp_mode_rect.position);
 					}
 					// Make it easier to click.
@@ -1992,7 +2023,7 @@ void AnimationTrackEdit::_notification(int p_what) {
 					ofs += icon->get_width() + hsep / 2;
 					interp_mode_rect.size.x += hsep / 2;
 
-					if (!read_only && !animation->track_is_compressed(track) && (animation->track_get_type(track) == Animation::TYPE_VALUE || animation->track_get_type(track) == Animation::TYPE_BLEND_SHAPE || animation->track_get_type(track) == Animation::TYPE_POSITION_3D || animation->track_get_type(track) == Animation::TYPE_SCALE_3D || animation->track_get_type(track) == Animation::TYPE_ROTATION_3D)) {
+					if (!read_only && !animation->track_is_compressed(track) && (animation->track_get_type(track) == Animation::TYPE_VALUE || animation->track_get_type(track) == Animation::TYPE_BLEND_SHAPE || animation->track_get_type(track) == Animation::TYPE_POSITION_3D || animation->track_get_type(track) == Animation::TYPE_SCALE_3D || animation->track_get_type(track) == Animation::TYPE_ROTATION_3D || animation->track_get_type(track) == Animation::TYPE_POSITION_2D || animation->track_get_type(track) == Animation::TYPE_ROTATION_2D || animation->track_get_type(track) == Animation::TYPE_SCALE_2D)) {
 						draw_texture(down_icon, Vector2(ofs, int(get_size().height - down_icon->get_height()) / 2));
 						interp_mode_rect.size.x += down_icon->get_width();
 					} else {
@@ -2015,7 +2046,7 @@ void AnimationTrackEdit::_notification(int p_what) {
 					loop_wrap_rect.position.y = int(get_size().height - icon->get_height()) / 2;
 					loop_wrap_rect.size = icon->get_size();
 
-					if (!animation->track_is_compressed(track) && (animation->track_get_type(track) == Animation::TYPE_VALUE || animation->track_get_type(track) == Animation::TYPE_BLEND_SHAPE || animation->track_get_type(track) == Animation::TYPE_POSITION_3D || animation->track_get_type(track) == Animation::TYPE_SCALE_3D || animation->track_get_type(track) == Animation::TYPE_ROTATION_3D)) {
+					if (!animation->track_is_compressed(track) && (animation->track_get_type(track) == Animation::TYPE_VALUE || animation->track_get_type(track) == Animation::TYPE_BLEND_SHAPE || animation->track_get_type(track) == Animation::TYPE_POSITION_3D || animation->track_get_type(track) == Animation::TYPE_SCALE_3D || animation->track_get_type(track) == Animation::TYPE_ROTATION_3D || animation->track_get_type(track) == Animation::TYPE_POSITION_2D || animation->track_get_type(track) == Animation::TYPE_ROTATION_2D || animation->track_get_type(track) == Animation::TYPE_SCALE_2D)) {
 						draw_texture(icon, loop_wrap_rect.position);
 					}
 
@@ -2025,7 +2056,7 @@ void AnimationTrackEdit::_notification(int p_what) {
 					ofs += icon->get_width() + hsep / 2;
 					loop_wrap_rect.size.x += hsep / 2;
 
-					if (!read_only && !animation->track_is_compressed(track) && (animation->track_get_type(track) == Animation::TYPE_VALUE || animation->track_get_type(track) == Animation::TYPE_BLEND_SHAPE || animation->track_get_type(track) == Animation::TYPE_POSITION_3D || animation->track_get_type(track) == Animation::TYPE_SCALE_3D || animation->track_get_type(track) == Animation::TYPE_ROTATION_3D)) {
+					if (!read_only && !animation->track_is_compressed(track) && (animation->track_get_type(track) == Animation::TYPE_VALUE || animation->track_get_type(track) == Animation::TYPE_BLEND_SHAPE || animation->track_get_type(track) == Animation::TYPE_POSITION_3D || animation->track_get_type(track) == Animation::TYPE_SCALE_3D || animation->track_get_type(track) == Animation::TYPE_ROTATION_3D || animation->track_get_type(track) == Animation::TYPE_POSITION_2D || animation->track_get_type(track) == Animation::TYPE_ROTATION_2D || animation->track_get_type(track) == Animation::TYPE_SCALE_2D)) {
 						draw_texture(down_icon, Vector2(ofs, int(get_size().height - down_icon->get_height()) / 2));
 						loop_wrap_rect.size.x += down_icon->get_width();
 					} else {
@@ -2375,7 +2406,7 @@ bool AnimationTrackEdit::_is_value_key_valid(const Variant &p_key_value, Variant
 }
 
 Ref<Texture2D> AnimationTrackEdit::_get_key_type_icon() const {
-	const Ref<Texture2D> type_icons[9] = {
+	const Ref<Texture2D> type_icons[12] = {
 		get_editor_theme_icon(SNAME("KeyValue")),
 		get_editor_theme_icon(SNAME("KeyTrackPosition")),
 		get_editor_theme_icon(SNAME("KeyTrackRotation")),
@@ -2384,7 +2415,10 @@ Ref<Texture2D> AnimationTrackEdit::_get_key_type_icon() const {
 		get_editor_theme_icon(SNAME("KeyCall")),
 		get_editor_theme_icon(SNAME("KeyBezier")),
 		get_editor_theme_icon(SNAME("KeyAudio")),
-		get_editor_theme_icon(SNAME("KeyAnimation"))
+		get_editor_theme_icon(SNAME("KeyAnimation")),
+		get_editor_theme_icon(SNAME("KeyTrackPosition")),
+		get_editor_theme_icon(SNAME("KeyTrackRotation")),
+		get_editor_theme_icon(SNAME("KeyTrackScale"))
 	};
 	return type_icons[animation->track_get_type(track)];
 }
@@ -2468,6 +2502,18 @@ String AnimationTrackEdit::get_tooltip(const Point2 &p_pos) const {
 					float t = animation->track_get_key_value(track, key_idx);
 					text += TTR("Blend Shape:") + " " + itos(t) + "\n";
 				} break;
+				case Animation::TYPE_POSITION_2D: {
+					Vector2 t = animation->track_get_key_value(track, key_idx);
+					text += TTR("Position:") + " " + String(t) + "\n";
+				} break;
+				case Animation::TYPE_ROTATION_2D: {
+					real_t t = animation->track_get_key_value(track, key_idx);
+					text += TTR("Rotation:") + " " + rtos(Math::rad_to_deg(t)) + "\n";
+				} break;
+				case Animation::TYPE_SCALE_2D: {
+					Vector2 t = animation->track_get_key_value(track, key_idx);
+					text += TTR("Scale:") + " " + String(t) + "\n";
+				} break;
 				case Animation::TYPE_VALUE: {
 					const Variant &v = animation->track_get_key_value(track, key_idx);
 					text += TTR("Type:") + " " + Variant::get_type_name(v.get_type()) + "\n";
@@ -4115,6 +4161,9 @@ AnimationTrackEditor::TrackIndices AnimationTrackEditor::_confirm_insert(InsertD
 		case Animation::TYPE_POSITION_3D:
 		case Animation::TYPE_ROTATION_3D:
 		case Animation::TYPE_SCALE_3D:
+		case Animation::TYPE_POSITION_2D:
+		case Animation::TYPE_ROTATION_2D:
+		case Animation::TYPE_SCALE_2D:
 		case Animation::TYPE_BLEND_SHAPE:
 		case Animation::TYPE_VALUE: {
 			value = p_id.value;
@@ -4605,6 +4654,22 @@ void AnimationTrackEditor::_new_track_node_selected(NodePath p_path) {
 			prop_selector->select_property_from_instance(node);
 		} break;
 		case Animation::TYPE_BLEND_SHAPE: {
+		} break;
+		case Animation::TYPE_POSITION_2D:
+		case Animation::TYPE_ROTATION_2D:
+		case Animation::TYPE_SCALE_2D: {
+			if (!node->is_class("Node2D")) {
+				EditorNode::get_singleton()->show_warning(TTR("2D transform tracks can only point to Node2D-based nodes."));
+				return;
+			}
+
+			EditorUndoRedoManager *undo_redo = EditorUndoRedoManager::get_singleton();
+			undo_redo->create_action(TTR("Add Track"));
+			undo_redo->add_do_method(animation.ptr(), "add_track", adding_track_type);
+			undo_redo->add_do_method(animation.ptr(), "track_set_path", animation->get_track_count(), path_to);
+			undo_redo->add_undo_method(animation.ptr(), "remove_track", animation->get_track_count());
+			undo_redo->commit_action();
+
 		} break;
 		case Animation::TYPE_POSITION_3D:
 		case Animation::TYPE_ROTATION_3D:
@@ -4780,6 +4845,31 @@ void AnimationTrackEditor::_insert_key_from_track(float p_ofs, int p_track) {
 		case Animation::TYPE_ROTATION_3D: {
 		} break;
 		case Animation::TYPE_SCALE_3D: {
+		} break;
+		case Animation::TYPE_POSITION_2D:
+		case Animation::TYPE_ROTATION_2D:
+		case Animation::TYPE_SCALE_2D: {
+			Node2D *base = Object::cast_to<Node2D>(root->get_node_or_null(animation->track_get_path(p_track)));
+			if (!base) {
+				EditorNode::get_singleton()->show_warning(TTR("Track path is invalid, so can't add a key."));
+				return;
+			}
+
+			Variant value;
+			if (animation->track_get_type(p_track) == Animation::TYPE_POSITION_2D) {
+				value = base->get_position();
+			} else if (animation->track_get_type(p_track) == Animation::TYPE_ROTATION_2D) {
+				value = base->get_rotation();
+			} else {
+				value = base->get_scale();
+			}
+
+			undo_redo->create_action(TTR("Add Track Key"));
+			undo_redo->add_do_method(animation.ptr(), "track_insert_key", p_track, p_ofs, value);
+			undo_redo->add_undo_method(this, "_clear_selection_for_anim", animation);
+			undo_redo->add_undo_method(animation.ptr(), "track_remove_key_at_time", p_track, p_ofs);
+			undo_redo->commit_action();
+
 		} break;
 		case Animation::TYPE_BLEND_SHAPE:
 		case Animation::TYPE_VALUE: {
@@ -5467,6 +5557,15 @@ void AnimationTrackEditor::_edit_menu_pressed(int p_option) {
 					case Animation::TYPE_SCALE_3D:
 						track_type = TTR("Scale");
 						break;
+					case Animation::TYPE_POSITION_2D:
+						track_type = TTR("2D Position");
+						break;
+					case Animation::TYPE_ROTATION_2D:
+						track_type = TTR("2D Rotation");
+						break;
+					case Animation::TYPE_SCALE_2D:
+						track_type = TTR("2D Scale");
+						break;
 					case Animation::TYPE_BLEND_SHAPE:
 						track_type = TTR("BlendShape");
 						break;
@@ -5717,6 +5816,9 @@ void AnimationTrackEditor::_edit_menu_pressed(int p_option) {
 					case Animation::TYPE_POSITION_3D:
 					case Animation::TYPE_ROTATION_3D:
 					case Animation::TYPE_SCALE_3D:
+					case Animation::TYPE_POSITION_2D:
+					case Animation::TYPE_ROTATION_2D:
+					case Animation::TYPE_SCALE_2D:
 					case Animation::TYPE_BLEND_SHAPE: {
 						Vector<int> keys;
 						for (const KeyValue<SelectedKey, KeyInfo> &E : selection) {
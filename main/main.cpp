@@ -3452,6 +3452,11 @@ bool Main::iteration() {
 	}
 	message_queue->flush();
 
+	if (SceneTree::get_singleton()) {
+		// Deferred calls may have moved canvas items since the tree last sent their transforms.
+		SceneTree::get_singleton()->flush_canvas_item_transforms();
+	}
+
 	RenderingServer::get_singleton()->sync(); //sync if still drawing from previous frames.
 
 	if (DisplayServer::get_singleton()->can_any_window_draw() &&
@@ -3502,6 +3507,9 @@ bool Main::iteration() {
 		Engine::get_singleton()->_fps = frames;
 		performance->set_process_time(USEC_TO_SEC(process_max));
 		performance->set_physics_process_time(USEC_TO_SEC(physics_process_max));
+		CallQueue::FlushStatistics mq_stats = message_queue->get_flush_statistics();
+		performance->set_message_queue_statistics(mq_stats.max_depth, mq_stats.max_bytes, USEC_TO_SEC(mq_stats.max_flush_usec), mq_stats.coalesced);
+		message_queue->reset_flush_statistics();
 		process_max = 0;
 		physics_process_max = 0;
 
@@ -38,6 +38,7 @@
 #include "servers/audio_server.h"
 #include "servers/physics_server_2d.h"
 #include "servers/rendering_server.h"
+#include "servers/text_server.h"
 
 Performance *Performance::singleton = nullptr;
 
@@ -70,6 +71,15 @@ void Performance::_bind_methods() {
 	BIND_ENUM_CONSTANT(PHYSICS_2D_COLLISION_PAIRS);
 	BIND_ENUM_CONSTANT(PHYSICS_2D_ISLAND_COUNT);
 	BIND_ENUM_CONSTANT(AUDIO_OUTPUT_LATENCY);
+	BIND_ENUM_CONSTANT(RENDER_TOTAL_CANVAS_ITEMS_RESORTED_IN_FRAME);
+	BIND_ENUM_CONSTANT(RENDER_TOTAL_CANVAS_DRAW_CALLS_IN_FRAME);
+	BIND_ENUM_CONSTANT(MESSAGE_QUEUE_DEPTH);
+	BIND_ENUM_CONSTANT(MESSAGE_QUEUE_BYTES);
+	BIND_ENUM_CONSTANT(MESSAGE_QUEUE_FLUSH_TIME);
+	BIND_ENUM_CONSTANT(MESSAGE_QUEUE_COALESCED);
+	BIND_ENUM_CONSTANT(TEXT_SHAPED_CACHE_HITS);
+	BIND_ENUM_CONSTANT(TEXT_SHAPED_CACHE_MISSES);
+	BIND_ENUM_CONSTANT(TEXT_SHAPED_CACHE_MEMORY);
 	BIND_ENUM_CONSTANT(MONITOR_MAX);
 }
 
@@ -105,6 +115,15 @@ String Performance::get_monitor_name(Monitor p_monitor) const {
 		"physics_2d/collision_pairs",
 		"physics_2d/islands",
 		"audio/driver/output_latency",
+		"raster/canvas_items_resorted",
+		"raster/canvas_draw_calls",
+		"message_queue/depth",
+		"message_queue/bytes",
+		"message_queue/flush_time",
+		"message_queue/coalesced",
+		"text/shaped_cache_hits",
+		"text/shaped_cache_misses",
+		"text/shaped_cache_memory",
 	};
 
 	return names[p_monitor];
@@ -152,6 +171,24 @@ double Performance::get_monitor(Monitor p_monitor) const {
 			return PhysicsServer2D::get_singleton()->get_process_info(PhysicsServer2D::INFO_ISLAND_COUNT);
 		case AUDIO_OUTPUT_LATENCY:
 			return AudioServer::get_singleton()->get_output_latency();
+		case RENDER_TOTAL_CANVAS_ITEMS_RESORTED_IN_FRAME:
+			return RS::get_singleton()->get_rendering_info(RS::RENDERING_INFO_TOTAL_CANVAS_ITEMS_RESORTED_IN_FRAME);
+		case RENDER_TOTAL_CANVAS_DRAW_CALLS_IN_FRAME:
+			return RS::get_singleton()->get_rendering_info(RS::RENDERING_INFO_TOTAL_CANVAS_DRAW_CALLS_IN_FRAME);
+		case MESSAGE_QUEUE_DEPTH:
+			return _message_queue_depth;
+		case MESSAGE_QUEUE_BYTES:
+			return _message_queue_bytes;
+		case MESSAGE_QUEUE_FLUSH_TIME:
+			return _message_queue_flush_time;
+		case MESSAGE_QUEUE_COALESCED:
+			return _message_queue_coalesced;
+		case TEXT_SHAPED_CACHE_HITS:
+			return TS.is_valid() ? TS->get_shaped_text_cache_hits() : 0;
+		case TEXT_SHAPED_CACHE_MISSES:
+			return TS.is_valid() ? TS->get_shaped_text_cache_misses() : 0;
+		case TEXT_SHAPED_CACHE_MEMORY:
+			return TS.is_valid() ? TS->get_shaped_text_cache_usage() : 0;
 		default: {
 		}
 	}
@@ -183,6 +220,15 @@ Performance::MonitorType Performance::get_monitor_type(Monitor p_monitor) const
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_MEMORY,
 	};
 
 	return types[p_monitor];
@@ -196,6 +242,13 @@ void Performance::set_physics_process_time(double p_pt) {
 	_physics_process_time = p_pt;
 }
 
+void Performance::set_message_queue_statistics(int p_depth, int p_bytes, double p_flush_time, int p_coalesced) {
+	_message_queue_depth = p_depth;
+	_message_queue_bytes = p_bytes;
+	_message_queue_flush_time = p_flush_time;
+	_message_queue_coalesced = p_coalesced;
+}
+
 void Performance::add_custom_monitor(const StringName &p_id, const Callable &p_callable, const Vector<Variant> &p_args) {
 	ERR_FAIL_COND_MSG(has_custom_monitor(p_id), "Custom monitor with id '" + String(p_id) + "' already exists.");
 	_monitor_map.insert(p_id, MonitorCall(p_callable, p_args));
@@ -242,6 +295,10 @@ uint64_t Performance::get_monitor_modification_time() {
 Performance::Performance() {
 	_process_time = 0;
 	_physics_process_time = 0;
+	_message_queue_depth = 0;
+	_message_queue_bytes = 0;
+	_message_queue_flush_time = 0;
+	_message_queue_coalesced = 0;
 	_monitor_modification_time = 0;
 	singleton = this;
 }
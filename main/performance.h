@@ -51,6 +51,11 @@ class Performance : public Object {
 	double _process_time;
 	double _physics_process_time;
 
+	int _message_queue_depth;
+	int _message_queue_bytes;
+	double _message_queue_flush_time;
+	int _message_queue_coalesced;
+
 	class MonitorCall {
 		Callable _callable;
 		Vector<Variant> _arguments;
@@ -86,6 +91,15 @@ public:
 		PHYSICS_2D_COLLISION_PAIRS,
 		PHYSICS_2D_ISLAND_COUNT,
 		AUDIO_OUTPUT_LATENCY,
+		RENDER_TOTAL_CANVAS_ITEMS_RESORTED_IN_FRAME,
+		RENDER_TOTAL_CANVAS_DRAW_CALLS_IN_FRAME,
+		MESSAGE_QUEUE_DEPTH,
+		MESSAGE_QUEUE_BYTES,
+		MESSAGE_QUEUE_FLUSH_TIME,
+		MESSAGE_QUEUE_COALESCED,
+		TEXT_SHAPED_CACHE_HITS,
+		TEXT_SHAPED_CACHE_MISSES,
+		TEXT_SHAPED_CACHE_MEMORY,
 		MONITOR_MAX
 	};
 
@@ -102,6 +116,7 @@ public:
 
 	void set_process_time(double p_pt);
 	void set_physics_process_time(double p_pt);
+	void set_message_queue_statistics(int p_depth, int p_bytes, double p_flush_time, int p_coalesced);
 
 	void add_custom_monitor(const StringName &p_id, const Callable &p_callable, const Vector<Variant> &p_args);
 	void remove_custom_monitor(const StringName &p_id);
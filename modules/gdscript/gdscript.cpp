@@ -35,6 +35,7 @@
 #include "gdscript_compiler.h"
 #include "gdscript_parser.h"
 #include "gdscript_rpc_callable.h"
+#include "gdscript_tokenizer_buffer.h"
 #include "gdscript_warning.h"
 
 #ifdef TOOLS_ENABLED
@@ -421,10 +422,11 @@ String GDScript::get_source_code() const {
 }
 
 void GDScript::set_source_code(const String &p_code) {
-	if (source == p_code) {
+	if (source == p_code && binary_tokens.is_empty()) {
 		return;
 	}
 	source = p_code;
+	binary_tokens.clear();
 #ifdef TOOLS_ENABLED
 	source_changed_cache = true;
 #endif
@@ -738,7 +740,14 @@ Error GDScript::reload(bool p_keep_state) {
 
 	valid = false;
 	GDScriptParser parser;
-	Error err = parser.parse(source, path, false);
+	Error err;
+	if (!binary_tokens.is_empty()) {
+		GDScriptLanguage::LoadPhaseTimer timer(GDScriptLanguage::LOAD_PHASE_PARSE_BINARY);
+		err = parser.parse_binary(binary_tokens, path);
+	} else {
+		GDScriptLanguage::LoadPhaseTimer timer(GDScriptLanguage::LOAD_PHASE_TOKENIZE_PARSE);
+		err = parser.parse(source, path, false);
+	}
 	if (err) {
 		if (EngineDebugger::is_active()) {
 			GDScriptLanguage::get_singleton()->debug_break_parse(_get_debug_path(), parser.get_errors().front()->get().line, "Parser Error: " + parser.get_errors().front()->get().message);
@@ -750,7 +759,10 @@ Error GDScript::reload(bool p_keep_state) {
 	}
 
 	GDScriptAnalyzer analyzer(&parser);
-	err = analyzer.analyze();
+	{
+		GDScriptLanguage::LoadPhaseTimer timer(GDScriptLanguage::LOAD_PHASE_ANALYZE);
+		err = analyzer.analyze();
+	}
 
 	if (err) {
 		if (EngineDebugger::is_active()) {
@@ -769,7 +781,10 @@ Error GDScript::reload(bool p_keep_state) {
 	can_run = ScriptServer::is_scripting_enabled() || parser.is_tool();
 
 	GDScriptCompiler compiler;
-	err = compiler.compile(&parser, this, p_keep_state);
+	{
+		GDScriptLanguage::LoadPhaseTimer timer(GDScriptLanguage::LOAD_PHASE_COMPILE);
+		err = compiler.compile(&parser, this, p_keep_state);
+	}
 
 	if (err) {
 		_err_print_error("GDScript::reload", path.is_empty() ? "built-in" : (const char *)path.utf8().get_data(), compiler.get_error_line(), ("Compile Error: " + compiler.get_error()).utf8().get_data(), false, ERR_HANDLER_SCRIPT);
@@ -1007,11 +1022,21 @@ String GDScript::get_script_path() const {
 	return path;
 }
 
+void GDScript::set_binary_tokens_source(const Vector<uint8_t> &p_binary_tokens) {
+	binary_tokens = p_binary_tokens;
+	source = String();
+#ifdef TOOLS_ENABLED
+	source_changed_cache = true;
+#endif
+}
+
 Error GDScript::load_source_code(const String &p_path) {
 	if (p_path.is_empty() || p_path.begins_with("gdscript://") || ResourceLoader::get_resource_type(p_path.get_slice("::", 0)) == "PackedScene") {
 		return OK;
 	}
 
+	GDScriptLanguage::LoadPhaseTimer timer(GDScriptLanguage::LOAD_PHASE_READ);
+
 	Vector<uint8_t> sourcef;
 	Error err;
 	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ, &err);
@@ -1032,12 +1057,20 @@ Error GDScript::load_source_code(const String &p_path) {
 	ERR_FAIL_COND_V(r != len, ERR_CANT_OPEN);
 	w[len] = 0;
 
-	String s;
-	if (s.parse_utf8((const char *)w) != OK) {
-		ERR_FAIL_V_MSG(ERR_INVALID_DATA, "Script '" + p_path + "' contains invalid unicode (UTF-8), so it was not loaded. Please ensure that scripts are saved in valid UTF-8 unicode.");
+	if (GDScriptTokenizerBuffer::is_token_buffer(w, len)) {
+		// Exported as tokens, parsed without the text tokenizer.
+		sourcef.resize(len);
+		binary_tokens = sourcef;
+		source = String();
+	} else {
+		String s;
+		if (s.parse_utf8((const char *)w) != OK) {
+			ERR_FAIL_V_MSG(ERR_INVALID_DATA, "Script '" + p_path + "' contains invalid unicode (UTF-8), so it was not loaded. Please ensure that scripts are saved in valid UTF-8 unicode.");
+		}
+		source = s;
+		binary_tokens.clear();
 	}
 
-	source = s;
 	path = p_path;
 	path_valid = true;
 #ifdef TOOLS_ENABLED
@@ -2421,6 +2454,12 @@ void GDScriptLanguage::reload_tool_script(const Ref<Script> &p_script, bool p_so
 void GDScriptLanguage::frame() {
 	calls = 0;
 
+	if (unlikely(!load_timings_reported)) {
+		// Scripts loaded before the first frame are the ones delaying startup.
+		load_timings_reported = true;
+		_report_load_timings();
+	}
+
 #ifdef DEBUG_ENABLED
 	if (profiling) {
 		MutexLock lock(this->mutex);
@@ -2440,6 +2479,46 @@ void GDScriptLanguage::frame() {
 #endif
 }
 
+thread_local GDScriptLanguage::LoadPhaseTimer *GDScriptLanguage::LoadPhaseTimer::current = nullptr;
+
+GDScriptLanguage::LoadPhaseTimer::LoadPhaseTimer(LoadPhase p_phase) {
+	phase = p_phase;
+	parent = current;
+	current = this;
+	start = OS::get_singleton()->get_ticks_usec();
+}
+
+GDScriptLanguage::LoadPhaseTimer::~LoadPhaseTimer() {
+	uint64_t elapsed = OS::get_singleton()->get_ticks_usec() - start;
+	current = parent;
+	if (parent) {
+		parent->nested += elapsed;
+	}
+	if (singleton) {
+		singleton->load_phase_usec[phase].add(elapsed - MIN(nested, elapsed));
+		singleton->load_phase_count[phase].increment();
+	}
+}
+
+void GDScriptLanguage::_report_load_timings() {
+	static const char *phase_names[LOAD_PHASE_MAX] = {
+		"Read files",
+		"Tokenize and parse text",
+		"Parse binary tokens",
+		"Analyze",
+		"Compile",
+	};
+
+	uint64_t total = 0;
+	for (int i = 0; i < LOAD_PHASE_MAX; i++) {
+		total += load_phase_usec[i].get();
+	}
+	print_verbose(vformat("GDScript load time before the first frame: %.2f ms", total / 1000.0));
+	for (int i = 0; i < LOAD_PHASE_MAX; i++) {
+		print_verbose(vformat("  %s: %.2f ms (%d times)", phase_names[i], load_phase_usec[i].get() / 1000.0, load_phase_count[i].get()));
+	}
+}
+
 /* EDITOR FUNCTIONS */
 void GDScriptLanguage::get_reserved_words(List<String> *p_words) const {
 	// Please keep alphabetical order within categories.
@@ -2751,17 +2830,25 @@ String ResourceFormatLoaderGDScript::get_resource_type(const String &p_path) con
 }
 
 void ResourceFormatLoaderGDScript::get_dependencies(const String &p_path, List<String> *p_dependencies, bool p_add_types) {
-	Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::READ);
-	ERR_FAIL_COND_MSG(file.is_null(), "Cannot open file '" + p_path + "'.");
+	GDScriptParser parser;
 
-	String source = file->get_as_utf8_string();
-	if (source.is_empty()) {
-		return;
-	}
+	Vector<uint8_t> binary_tokens;
+	String source;
+	Error err = GDScriptCache::read_script(p_path, binary_tokens, source);
+	ERR_FAIL_COND_MSG(err != OK, "Cannot open file '" + p_path + "'.");
 
-	GDScriptParser parser;
-	if (OK != parser.parse(source, p_path, false)) {
-		return;
+	if (!binary_tokens.is_empty()) {
+		if (OK != parser.parse_binary(binary_tokens, p_path)) {
+			return;
+		}
+	} else {
+		if (source.is_empty()) {
+			return;
+		}
+
+		if (OK != parser.parse(source, p_path, false)) {
+			return;
+		}
 	}
 
 	for (const String &E : parser.get_dependencies()) {
@@ -176,6 +176,7 @@ private:
 	bool clearing = false;
 	//exported members
 	String source;
+	Vector<uint8_t> binary_tokens; // Set instead of source for scripts exported as tokens.
 	String path;
 	bool path_valid = false; // False if using default path.
 	StringName local_name; // Inner class identifier or `class_name`.
@@ -295,6 +296,8 @@ public:
 	virtual void set_path(const String &p_path, bool p_take_over = false) override;
 	String get_script_path() const;
 	Error load_source_code(const String &p_path);
+	void set_binary_tokens_source(const Vector<uint8_t> &p_binary_tokens);
+	const Vector<uint8_t> &get_binary_tokens_source() const { return binary_tokens; }
 
 	bool get_property_default_value(const StringName &p_property, Variant &r_value) const override;
 
@@ -442,6 +445,38 @@ class GDScriptLanguage : public ScriptLanguage {
 
 	HashMap<String, ObjectID> orphan_subclasses;
 
+public:
+	enum LoadPhase {
+		LOAD_PHASE_READ,
+		LOAD_PHASE_TOKENIZE_PARSE,
+		LOAD_PHASE_PARSE_BINARY,
+		LOAD_PHASE_ANALYZE,
+		LOAD_PHASE_COMPILE,
+		LOAD_PHASE_MAX,
+	};
+
+	// Adds the time spent in its scope to a load phase. Time spent in phases nested in it (dependencies
+	// loaded while analyzing or compiling) is only counted for the nested phase.
+	class LoadPhaseTimer {
+		static thread_local LoadPhaseTimer *current;
+
+		LoadPhaseTimer *parent = nullptr;
+		LoadPhase phase;
+		uint64_t start = 0;
+		uint64_t nested = 0;
+
+	public:
+		LoadPhaseTimer(LoadPhase p_phase);
+		~LoadPhaseTimer();
+	};
+
+private:
+	SafeNumeric<uint64_t> load_phase_usec[LOAD_PHASE_MAX];
+	SafeNumeric<uint32_t> load_phase_count[LOAD_PHASE_MAX];
+	bool load_timings_reported = false;
+
+	void _report_load_timings();
+
 public:
 	int calls;
 
@@ -34,6 +34,7 @@
 #include "gdscript_analyzer.h"
 #include "gdscript_compiler.h"
 #include "gdscript_parser.h"
+#include "gdscript_tokenizer_buffer.h"
 
 #include "core/io/file_access.h"
 #include "core/templates/vector.h"
@@ -67,12 +68,25 @@ Error GDScriptParserRef::raise_status(Status p_new_status) {
 
 	while (p_new_status > status) {
 		switch (status) {
-			case EMPTY:
+			case EMPTY: {
 				status = PARSED;
-				result = parser->parse(GDScriptCache::get_source_code(path), path, false);
-				break;
+				Vector<uint8_t> binary_tokens;
+				String source;
+				result = GDScriptCache::read_script(path, binary_tokens, source);
+				if (result != OK) {
+					break;
+				}
+				if (!binary_tokens.is_empty()) {
+					GDScriptLanguage::LoadPhaseTimer timer(GDScriptLanguage::LOAD_PHASE_PARSE_BINARY);
+					result = parser->parse_binary(binary_tokens, path);
+				} else {
+					GDScriptLanguage::LoadPhaseTimer timer(GDScriptLanguage::LOAD_PHASE_TOKENIZE_PARSE);
+					result = parser->parse(source, path, false);
+				}
+			} break;
 			case PARSED: {
 				status = INHERITANCE_SOLVED;
+				GDScriptLanguage::LoadPhaseTimer timer(GDScriptLanguage::LOAD_PHASE_ANALYZE);
 				Error inheritance_result = get_analyzer()->resolve_inheritance();
 				if (result == OK) {
 					result = inheritance_result;
@@ -80,6 +94,7 @@ Error GDScriptParserRef::raise_status(Status p_new_status) {
 			} break;
 			case INHERITANCE_SOLVED: {
 				status = INTERFACE_SOLVED;
+				GDScriptLanguage::LoadPhaseTimer timer(GDScriptLanguage::LOAD_PHASE_ANALYZE);
 				Error interface_result = get_analyzer()->resolve_interface();
 				if (result == OK) {
 					result = interface_result;
@@ -87,6 +102,7 @@ Error GDScriptParserRef::raise_status(Status p_new_status) {
 			} break;
 			case INTERFACE_SOLVED: {
 				status = FULLY_SOLVED;
+				GDScriptLanguage::LoadPhaseTimer timer(GDScriptLanguage::LOAD_PHASE_ANALYZE);
 				Error body_result = get_analyzer()->resolve_body();
 				if (result == OK) {
 					result = body_result;
@@ -221,22 +237,38 @@ Ref<GDScriptParserRef> GDScriptCache::get_parser(const String &p_path, GDScriptP
 }
 
 String GDScriptCache::get_source_code(const String &p_path) {
+	Vector<uint8_t> binary_tokens;
+	String source;
+	read_script(p_path, binary_tokens, source);
+	return source;
+}
+
+Error GDScriptCache::read_script(const String &p_path, Vector<uint8_t> &r_binary_tokens, String &r_source) {
+	GDScriptLanguage::LoadPhaseTimer timer(GDScriptLanguage::LOAD_PHASE_READ);
+
 	Vector<uint8_t> source_file;
 	Error err;
 	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ, &err);
-	ERR_FAIL_COND_V(err, "");
+	ERR_FAIL_COND_V(err, err);
 
 	uint64_t len = f->get_length();
 	source_file.resize(len + 1);
 	uint64_t r = f->get_buffer(source_file.ptrw(), len);
-	ERR_FAIL_COND_V(r != len, "");
+	ERR_FAIL_COND_V(r != len, ERR_CANT_OPEN);
 	source_file.write[len] = 0;
 
-	String source;
-	if (source.parse_utf8((const char *)source_file.ptr()) != OK) {
-		ERR_FAIL_V_MSG("", "Script '" + p_path + "' contains invalid unicode (UTF-8), so it was not loaded. Please ensure that scripts are saved in valid UTF-8 unicode.");
+	// Scripts exported as tokens keep the bytes as read, without a second pass over the file.
+	if (GDScriptTokenizerBuffer::is_token_buffer(source_file.ptr(), len)) {
+		source_file.resize(len);
+		r_binary_tokens = source_file;
+		return OK;
 	}
-	return source;
+
+	if (r_source.parse_utf8((const char *)source_file.ptr()) != OK) {
+		r_source = String();
+		ERR_FAIL_V_MSG(ERR_INVALID_DATA, "Script '" + p_path + "' contains invalid unicode (UTF-8), so it was not loaded. Please ensure that scripts are saved in valid UTF-8 unicode.");
+	}
+	return OK;
 }
 
 Ref<GDScript> GDScriptCache::get_shallow_script(const String &p_path, Error &r_error, const String &p_owner) {
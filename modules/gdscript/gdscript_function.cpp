@@ -32,6 +32,8 @@
 
 #include "gdscript.h"
 
+#include "core/config/engine.h"
+
 Variant GDScriptFunction::get_constant(int p_idx) const {
 	ERR_FAIL_INDEX_V(p_idx, constants.size(), "<errconst>");
 	return constants[p_idx];
@@ -42,6 +44,53 @@ StringName GDScriptFunction::get_global_name(int p_idx) const {
 	return global_names[p_idx];
 }
 
+const GDScriptFunction::NativePropertyBinds GDScriptFunction::megamorphic_binds;
+
+const GDScriptFunction::NativePropertyBinds *GDScriptFunction::_resolve_native_property(NamedCache &p_cache, const Object *p_object, const StringName &p_name) {
+	if (p_cache.entries[0].get() == &megamorphic_binds) {
+		return nullptr;
+	}
+#ifdef TOOLS_ENABLED
+	if (Engine::get_singleton()->is_editor_hint()) {
+		return nullptr; // Object::set() has to flag the object as edited.
+	}
+#endif
+
+	MutexLock lock(named_cache_mutex);
+
+	const void *class_key = p_object->get_class_name().data_unique_pointer();
+	const NativePropertyBinds *cached = p_cache.lookup(class_key);
+	if (cached) {
+		return cached; // Resolved by another thread while waiting for the lock.
+	}
+
+	if (p_cache.misses >= NAMED_CACHE_MAX_MISSES) {
+		// Too many classes seen at this site, stop trying.
+		for (uint32_t i = 0; i < NAMED_CACHE_ENTRIES; i++) {
+			p_cache.entries[i].set(&megamorphic_binds);
+		}
+		return nullptr;
+	}
+	p_cache.misses++;
+
+	NativePropertyBinds *binds = memnew(NativePropertyBinds);
+	binds->class_key = class_key;
+	if (!ClassDB::get_property_binds(p_object->get_class_name(), p_name, &binds->setter, &binds->getter)) {
+		// Remember the class anyway, so the generic path is taken without resolving again.
+		binds->setter = nullptr;
+		binds->getter = nullptr;
+	}
+	named_cache_binds.push_back(binds);
+
+	// The newest class goes first, the least recent one is evicted.
+	for (uint32_t i = NAMED_CACHE_ENTRIES - 1; i > 0; i--) {
+		p_cache.entries[i].set(p_cache.entries[i - 1].get());
+	}
+	p_cache.entries[0].set(binds);
+
+	return binds;
+}
+
 struct _GDFKC {
 	int order = 0;
 	List<int> pos;
@@ -121,6 +170,13 @@ GDScriptFunction::~GDScriptFunction() {
 		memdelete(lambdas[i]);
 	}
 
+	if (_named_caches_ptr) {
+		memdelete_arr(_named_caches_ptr);
+	}
+	for (NativePropertyBinds *binds : named_cache_binds) {
+		memdelete(binds);
+	}
+
 	for (int i = 0; i < argument_types.size(); i++) {
 		argument_types.write[i].script_type_ref = Ref<Script>();
 	}
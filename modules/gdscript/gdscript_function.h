@@ -35,9 +35,12 @@
 
 #include "core/object/ref_counted.h"
 #include "core/object/script_language.h"
+#include "core/os/mutex.h"
 #include "core/os/thread.h"
 #include "core/string/string_name.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/pair.h"
+#include "core/templates/safe_refcount.h"
 #include "core/templates/self_list.h"
 #include "core/variant/variant.h"
 
@@ -412,6 +415,40 @@ private:
 	Vector<MethodBind *> methods;
 	Vector<GDScriptFunction *> lambdas;
 
+	// Inline caches for SET_NAMED/GET_NAMED on native objects. Records are immutable once published
+	// and only freed with the function, so the VM can read them without locking.
+	struct NativePropertyBinds {
+		const void *class_key = nullptr;
+		MethodBind *setter = nullptr;
+		MethodBind *getter = nullptr;
+	};
+
+	static constexpr uint32_t NAMED_CACHE_ENTRIES = 2;
+	static constexpr uint32_t NAMED_CACHE_MAX_MISSES = 4;
+
+	// Keeps the two most recent classes, so sites alternating between two classes keep hitting.
+	struct NamedCache {
+		SafeNumeric<const NativePropertyBinds *> entries[NAMED_CACHE_ENTRIES];
+		uint32_t misses = 0;
+
+		_FORCE_INLINE_ const NativePropertyBinds *lookup(const void *p_class_key) const {
+			for (uint32_t i = 0; i < NAMED_CACHE_ENTRIES; i++) {
+				const NativePropertyBinds *binds = entries[i].get();
+				if (binds && binds->class_key == p_class_key) {
+					return binds;
+				}
+			}
+			return nullptr;
+		}
+	};
+
+	static const NativePropertyBinds megamorphic_binds;
+
+	LocalVector<NativePropertyBinds *> named_cache_binds;
+	BinaryMutex named_cache_mutex;
+
+	const NativePropertyBinds *_resolve_native_property(NamedCache &p_cache, const Object *p_object, const StringName &p_name);
+
 	int _code_size = 0;
 	int _default_arg_count = 0;
 	int _constant_count = 0;
@@ -429,6 +466,7 @@ private:
 	int _gds_utilities_count = 0;
 	int _methods_count = 0;
 	int _lambdas_count = 0;
+	int _named_caches_count = 0;
 
 	int *_code_ptr = nullptr;
 	const int *_default_arg_ptr = nullptr;
@@ -447,6 +485,7 @@ private:
 	const GDScriptUtilityFunctions::FunctionPtr *_gds_utilities_ptr = nullptr;
 	MethodBind **_methods_ptr = nullptr;
 	GDScriptFunction **_lambdas_ptr = nullptr;
+	NamedCache *_named_caches_ptr = nullptr;
 
 #ifdef DEBUG_ENABLED
 	CharString func_cname;
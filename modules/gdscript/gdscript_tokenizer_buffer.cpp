@@ -0,0 +1,356 @@
+/**************************************************************************/
+/*  gdscript_tokenizer_buffer.cpp                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "gdscript_tokenizer_buffer.h"
+
+#include "core/io/marshalls.h"
+
+static const uint8_t TOKEN_BUFFER_MAGIC[4] = { 'G', 'D', 'S', 'C' };
+static constexpr int TOKEN_BUFFER_HEADER_SIZE = 24;
+
+enum {
+	TOKEN_PAYLOAD_NONE,
+	TOKEN_PAYLOAD_IDENTIFIER,
+	TOKEN_PAYLOAD_CONSTANT,
+};
+
+static constexpr uint32_t TOKEN_TYPE_BITS = 8;
+static constexpr uint32_t TOKEN_TYPE_MASK = (1 << TOKEN_TYPE_BITS) - 1;
+static constexpr uint32_t TOKEN_PAYLOAD_MAX = UINT32_MAX >> TOKEN_TYPE_BITS;
+
+static_assert(GDScriptTokenizer::Token::TK_MAX <= TOKEN_TYPE_MASK, "Token types don't fit in the token buffer encoding.");
+
+static void _append_uint32(Vector<uint8_t> &r_buffer, uint32_t p_value) {
+	int64_t pos = r_buffer.size();
+	r_buffer.resize(pos + 4);
+	encode_uint32(p_value, &r_buffer.write[pos]);
+}
+
+uint32_t GDScriptTokenizerBuffer::_token_payload_kind(Token::Type p_type) {
+	if (p_type == Token::LITERAL) {
+		return TOKEN_PAYLOAD_CONSTANT;
+	}
+	// Keywords usable as identifiers or node names need their source text as well.
+	if (p_type == Token::ANNOTATION || Token(p_type).is_node_name()) {
+		return TOKEN_PAYLOAD_IDENTIFIER;
+	}
+	return TOKEN_PAYLOAD_NONE;
+}
+
+bool GDScriptTokenizerBuffer::is_token_buffer(const uint8_t *p_data, int64_t p_size) {
+	return p_size >= TOKEN_BUFFER_HEADER_SIZE && memcmp(p_data, TOKEN_BUFFER_MAGIC, 4) == 0;
+}
+
+Vector<uint8_t> GDScriptTokenizerBuffer::parse_code_string(const String &p_code) {
+	HashMap<String, uint32_t> identifier_map;
+	Vector<String> identifiers;
+	HashMap<Variant, uint32_t, VariantHasher, VariantComparator> constant_map;
+	Vector<Variant> constants;
+	Vector<uint32_t> token_words;
+	Vector<LineStart> starts;
+
+	GDScriptTokenizerText tokenizer;
+	tokenizer.set_source_code(p_code);
+	tokenizer.set_multiline_mode(true); // Whitespace tokens are rebuilt when scanning the buffer.
+	const Vector<int> &continuation_lines = tokenizer.get_continuation_lines();
+
+	int last_line = 0;
+	int last_end_line = 0;
+	int next_continuation = 0;
+
+	for (Token token = tokenizer.scan(); token.type != Token::TK_EOF; token = tokenizer.scan()) {
+		if (token.type == Token::ERROR) {
+			return Vector<uint8_t>(); // Keep the text, so the error is reported when loading it.
+		}
+		if (token.type == Token::NEWLINE || token.type == Token::INDENT || token.type == Token::DEDENT) {
+			continue;
+		}
+
+		bool joined = false;
+		while (next_continuation < continuation_lines.size() && continuation_lines[next_continuation] < token.start_line) {
+			joined = joined || continuation_lines[next_continuation] >= last_end_line;
+			next_continuation++;
+		}
+
+		if (token.start_line != last_line) {
+			LineStart start;
+			start.token = token_words.size();
+			start.line = token.start_line;
+			start.column = token.start_column;
+			start.newline = token.start_line > last_end_line && !joined;
+			starts.push_back(start);
+			last_line = token.start_line;
+		}
+		last_end_line = token.end_line;
+
+		uint32_t payload = 0;
+		switch (_token_payload_kind(token.type)) {
+			case TOKEN_PAYLOAD_IDENTIFIER: {
+				const uint32_t *index = identifier_map.getptr(token.source);
+				if (index) {
+					payload = *index;
+				} else {
+					payload = identifiers.size();
+					identifier_map.insert(token.source, payload);
+					identifiers.push_back(token.source);
+				}
+			} break;
+			case TOKEN_PAYLOAD_CONSTANT: {
+				const uint32_t *index = constant_map.getptr(token.literal);
+				if (index) {
+					payload = *index;
+				} else {
+					payload = constants.size();
+					constant_map.insert(token.literal, payload);
+					constants.push_back(token.literal);
+				}
+			} break;
+		}
+		ERR_FAIL_COND_V_MSG(payload > TOKEN_PAYLOAD_MAX, Vector<uint8_t>(), "Too many distinct identifiers or constants to store script as tokens.");
+		token_words.push_back(uint32_t(token.type) | (payload << TOKEN_TYPE_BITS));
+	}
+
+	Vector<uint8_t> buffer;
+	buffer.resize(4);
+	memcpy(buffer.ptrw(), TOKEN_BUFFER_MAGIC, 4);
+	_append_uint32(buffer, TOKENIZER_VERSION);
+	_append_uint32(buffer, identifiers.size());
+	_append_uint32(buffer, constants.size());
+	_append_uint32(buffer, starts.size());
+	_append_uint32(buffer, token_words.size());
+
+	for (const String &identifier : identifiers) {
+		CharString cs = identifier.utf8();
+		_append_uint32(buffer, cs.length());
+		int64_t pos = buffer.size();
+		buffer.resize(pos + cs.length());
+		memcpy(&buffer.write[pos], cs.get_data(), cs.length());
+	}
+
+	for (const Variant &constant : constants) {
+		int len = 0;
+		Error err = encode_variant(constant, nullptr, len);
+		ERR_FAIL_COND_V(err != OK, Vector<uint8_t>());
+		_append_uint32(buffer, len);
+		int64_t pos = buffer.size();
+		buffer.resize(pos + len);
+		encode_variant(constant, &buffer.write[pos], len);
+	}
+
+	for (const LineStart &start : starts) {
+		_append_uint32(buffer, start.token);
+		_append_uint32(buffer, start.line);
+		_append_uint32(buffer, (start.column << 1) | (start.newline ? 1 : 0));
+	}
+
+	for (uint32_t word : token_words) {
+		_append_uint32(buffer, word);
+	}
+
+	return buffer;
+}
+
+Error GDScriptTokenizerBuffer::set_code_buffer(const Vector<uint8_t> &p_buffer) {
+	const uint8_t *buf = p_buffer.ptr();
+	const int64_t total = p_buffer.size();
+	ERR_FAIL_COND_V_MSG(!is_token_buffer(buf, total), ERR_INVALID_DATA, "Invalid GDScript token buffer.");
+
+	uint32_t version = decode_uint32(&buf[4]);
+	ERR_FAIL_COND_V_MSG(version != TOKENIZER_VERSION, ERR_INVALID_DATA, vformat("GDScript token buffer version %d is not supported, expected %d. Export the project again.", version, TOKENIZER_VERSION));
+
+	uint32_t identifier_count = decode_uint32(&buf[8]);
+	uint32_t constant_count = decode_uint32(&buf[12]);
+	uint32_t line_start_count = decode_uint32(&buf[16]);
+	uint32_t token_count = decode_uint32(&buf[20]);
+
+	int64_t pos = TOKEN_BUFFER_HEADER_SIZE;
+
+	Vector<String> identifiers;
+	identifiers.resize(identifier_count);
+	for (uint32_t i = 0; i < identifier_count; i++) {
+		ERR_FAIL_COND_V(pos + 4 > total, ERR_INVALID_DATA);
+		uint32_t len = decode_uint32(&buf[pos]);
+		pos += 4;
+		ERR_FAIL_COND_V(pos + len > total, ERR_INVALID_DATA);
+		identifiers.write[i].parse_utf8((const char *)&buf[pos], len);
+		pos += len;
+	}
+
+	Vector<Variant> constants;
+	constants.resize(constant_count);
+	for (uint32_t i = 0; i < constant_count; i++) {
+		ERR_FAIL_COND_V(pos + 4 > total, ERR_INVALID_DATA);
+		uint32_t len = decode_uint32(&buf[pos]);
+		pos += 4;
+		ERR_FAIL_COND_V(pos + len > total, ERR_INVALID_DATA);
+		Error err = decode_variant(constants.write[i], &buf[pos], len);
+		ERR_FAIL_COND_V(err != OK, ERR_INVALID_DATA);
+		pos += len;
+	}
+
+	ERR_FAIL_COND_V(pos + int64_t(line_start_count) * 12 + int64_t(token_count) * 4 != total, ERR_INVALID_DATA);
+
+	line_starts.resize(line_start_count);
+	for (uint32_t i = 0; i < line_start_count; i++) {
+		LineStart &start = line_starts.write[i];
+		start.token = decode_uint32(&buf[pos]);
+		start.line = decode_uint32(&buf[pos + 4]);
+		uint32_t column_and_flags = decode_uint32(&buf[pos + 8]);
+		start.column = column_and_flags >> 1;
+		start.newline = column_and_flags & 1;
+		ERR_FAIL_COND_V(start.token >= token_count || (i > 0 && start.token <= line_starts[i - 1].token), ERR_INVALID_DATA);
+		pos += 12;
+	}
+
+	tokens.resize(token_count);
+	for (uint32_t i = 0; i < token_count; i++) {
+		uint32_t word = decode_uint32(&buf[pos]);
+		pos += 4;
+
+		Token &token = tokens.write[i];
+		token.type = Token::Type(word & TOKEN_TYPE_MASK);
+		ERR_FAIL_COND_V(token.type >= Token::TK_MAX, ERR_INVALID_DATA);
+
+		uint32_t payload = word >> TOKEN_TYPE_BITS;
+		switch (_token_payload_kind(token.type)) {
+			case TOKEN_PAYLOAD_IDENTIFIER: {
+				ERR_FAIL_COND_V(payload >= identifier_count, ERR_INVALID_DATA);
+				token.source = identifiers[payload];
+				if (token.type == Token::IDENTIFIER || token.type == Token::ANNOTATION) {
+					token.literal = StringName(token.source);
+				}
+			} break;
+			case TOKEN_PAYLOAD_CONSTANT: {
+				ERR_FAIL_COND_V(payload >= constant_count, ERR_INVALID_DATA);
+				token.literal = constants[payload];
+			} break;
+		}
+	}
+
+	current = 0;
+	current_line_start = 0;
+	current_line = 1;
+	current_column = 1;
+	multiline_mode = false;
+	last_token_was_newline = true;
+	pending_indents = 0;
+	indent_stack.clear();
+	indent_stack_stack.clear();
+
+	return OK;
+}
+
+void GDScriptTokenizerBuffer::set_multiline_mode(bool p_state) {
+	multiline_mode = p_state;
+}
+
+void GDScriptTokenizerBuffer::push_expression_indented_block() {
+	indent_stack_stack.push_back(indent_stack);
+}
+
+void GDScriptTokenizerBuffer::pop_expression_indented_block() {
+	ERR_FAIL_COND(indent_stack_stack.size() == 0);
+	indent_stack = indent_stack_stack.back()->get();
+	indent_stack_stack.pop_back();
+}
+
+GDScriptTokenizer::Token GDScriptTokenizerBuffer::scan() {
+	// Indentation changes are resolved when the NEWLINE before them is given, like the text tokenizer does.
+	if (pending_indents != 0) {
+		Token indent(pending_indents > 0 ? Token::INDENT : Token::DEDENT);
+		pending_indents += pending_indents > 0 ? -1 : 1;
+		indent.start_line = current_line;
+		indent.end_line = current_line;
+		indent.start_column = 1;
+		indent.leftmost_column = 1;
+		return indent;
+	}
+
+	if (current >= tokens.size()) {
+		if (!last_token_was_newline && !multiline_mode) {
+			// Add final newline, as the parser expects one.
+			Token newline(Token::NEWLINE);
+			newline.start_line = current_line;
+			newline.end_line = current_line;
+			last_token_was_newline = true;
+			return newline;
+		}
+		if (!indent_stack.is_empty()) {
+			pending_indents -= indent_stack.size();
+			indent_stack.clear();
+			return scan();
+		}
+		Token eof(Token::TK_EOF);
+		eof.start_line = current_line;
+		eof.end_line = current_line;
+		return eof;
+	}
+
+	if (current_line_start < line_starts.size() && int(line_starts[current_line_start].token) == current) {
+		const LineStart &start = line_starts[current_line_start];
+
+		if (start.newline && !multiline_mode && !last_token_was_newline) {
+			Token newline(Token::NEWLINE);
+			newline.start_line = current_line;
+			newline.end_line = current_line;
+			last_token_was_newline = true;
+			current_line = start.line;
+
+			// Columns are 1-based and count tabs as the tokenizer's tab size, same as indentation levels.
+			int indent = start.column - 1;
+			int previous_indent = indent_stack.is_empty() ? 0 : indent_stack.back()->get();
+			if (indent > previous_indent) {
+				indent_stack.push_back(indent);
+				pending_indents++;
+			} else {
+				while (!indent_stack.is_empty() && indent_stack.back()->get() > indent) {
+					indent_stack.pop_back();
+					pending_indents--;
+				}
+			}
+			return newline;
+		}
+
+		current_line = start.line;
+		current_column = start.column;
+		current_line_start++;
+	}
+
+	last_token_was_newline = false;
+
+	Token token = tokens[current++];
+	token.start_line = current_line;
+	token.end_line = current_line;
+	token.start_column = current_column;
+	token.end_column = current_column;
+	token.leftmost_column = current_column;
+	token.rightmost_column = current_column;
+	return token;
+}
@@ -0,0 +1,96 @@
+/**************************************************************************/
+/*  gdscript_tokenizer_buffer.h                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#ifndef GDSCRIPT_TOKENIZER_BUFFER_H
+#define GDSCRIPT_TOKENIZER_BUFFER_H
+
+#include "gdscript_tokenizer.h"
+
+// Replays a token stream serialized by parse_code_string(), so exported scripts can be parsed without
+// tokenizing their text. Only tokens and the position of line starts are stored, the NEWLINE, INDENT and
+// DEDENT tokens are derived while scanning so they follow the multiline mode requested by the parser.
+class GDScriptTokenizerBuffer : public GDScriptTokenizer {
+public:
+	static constexpr uint32_t TOKENIZER_VERSION = 1;
+
+	struct LineStart {
+		uint32_t token = 0;
+		uint32_t line = 0;
+		uint32_t column = 0;
+		bool newline = false; // False if the line was joined to the previous one with '\'.
+	};
+
+private:
+	Vector<Token> tokens;
+	Vector<LineStart> line_starts;
+
+	int current = 0;
+	int current_line_start = 0;
+	int current_line = 1;
+	int current_column = 1;
+
+	bool multiline_mode = false;
+	bool last_token_was_newline = true;
+	int pending_indents = 0;
+	List<int> indent_stack;
+	List<List<int>> indent_stack_stack; // For lambdas, which require manipulating the indentation point.
+
+#ifdef TOOLS_ENABLED
+	HashMap<int, CommentData> dummy_comments;
+#endif // TOOLS_ENABLED
+
+	static uint32_t _token_payload_kind(Token::Type p_type);
+
+public:
+	static bool is_token_buffer(const uint8_t *p_data, int64_t p_size);
+	static Vector<uint8_t> parse_code_string(const String &p_code);
+
+	Error set_code_buffer(const Vector<uint8_t> &p_buffer);
+
+	virtual int get_cursor_line() const override { return -1; }
+	virtual int get_cursor_column() const override { return -1; }
+	virtual void set_cursor_position(int p_line, int p_column) override {}
+	virtual void set_multiline_mode(bool p_state) override;
+	virtual bool is_past_cursor() const override { return false; }
+	virtual void push_expression_indented_block() override; // For lambdas, or blocks inside expressions.
+	virtual void pop_expression_indented_block() override; // For lambdas, or blocks inside expressions.
+	virtual bool is_text() override { return false; }
+
+#ifdef TOOLS_ENABLED
+	virtual const HashMap<int, CommentData> &get_comments() const override {
+		return dummy_comments;
+	}
+#endif // TOOLS_ENABLED
+
+	virtual Token scan() override;
+};
+
+#endif // GDSCRIPT_TOKENIZER_BUFFER_H
@@ -1042,7 +1042,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			DISPATCH_OPCODE;
 
 			OPCODE(OPCODE_SET_NAMED) {
-				CHECK_SPACE(3);
+				CHECK_SPACE(4);
 
 				GET_VARIANT_PTR(dst, 0);
 				GET_VARIANT_PTR(value, 1);
@@ -1052,8 +1052,30 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
 				const StringName *index = &_global_names_ptr[indexname];
 
+				int cache_index = _code_ptr[ip + 4];
+				GD_ERR_BREAK(cache_index < 0 || cache_index >= _named_caches_count);
+				NamedCache &cache = _named_caches_ptr[cache_index];
+
 				bool valid;
-				dst->set_named(*index, *value, valid);
+				bool cached = false;
+				Object *obj = dst->get_validated_object();
+				if (obj && !obj->get_script_instance()) {
+					// Native object, call the setter bind directly if this class was seen here before.
+					const NativePropertyBinds *binds = cache.lookup(obj->get_class_name().data_unique_pointer());
+					if (unlikely(!binds)) {
+						binds = _resolve_native_property(cache, obj, *index);
+					}
+					if (binds && binds->setter) {
+						Callable::CallError ce;
+						const Variant *args[1] = { value };
+						binds->setter->call(obj, args, 1, ce);
+						valid = ce.error == Callable::CallError::CALL_OK;
+						cached = true;
+					}
+				}
+				if (!cached) {
+					dst->set_named(*index, *value, valid);
+				}
 
 #ifdef DEBUG_ENABLED
 				if (!valid) {
@@ -1070,7 +1092,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					OPCODE_BREAK;
 				}
 #endif
-				ip += 4;
+				ip += 5;
 			}
 			DISPATCH_OPCODE;
 
@@ -1090,7 +1112,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			DISPATCH_OPCODE;
 
 			OPCODE(OPCODE_GET_NAMED) {
-				CHECK_SPACE(4);
+				CHECK_SPACE(5);
 
 				GET_VARIANT_PTR(src, 0);
 				GET_VARIANT_PTR(dst, 1);
@@ -1100,6 +1122,25 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
 				const StringName *index = &_global_names_ptr[indexname];
 
+				int cache_index = _code_ptr[ip + 4];
+				GD_ERR_BREAK(cache_index < 0 || cache_index >= _named_caches_count);
+				NamedCache &cache = _named_caches_ptr[cache_index];
+
+				Object *obj = src->get_validated_object();
+				if (obj && !obj->get_script_instance()) {
+					// Native object, call the getter bind directly if this class was seen here before.
+					const NativePropertyBinds *binds = cache.lookup(obj->get_class_name().data_unique_pointer());
+					if (unlikely(!binds)) {
+						binds = _resolve_native_property(cache, obj, *index);
+					}
+					if (binds && binds->getter) {
+						Callable::CallError ce;
+						*dst = binds->getter->call(obj, nullptr, 0, ce);
+						ip += 5;
+						DISPATCH_OPCODE;
+					}
+				}
+
 				bool valid;
 #ifdef DEBUG_ENABLED
 				//allow better error message in cases where src and dst are the same stack position
@@ -1115,7 +1156,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				}
 				*dst = ret;
 #endif
-				ip += 4;
+				ip += 5;
 			}
 			DISPATCH_OPCODE;
 
@@ -33,7 +33,7 @@
 #include "gdscript.h"
 #include "gdscript_analyzer.h"
 #include "gdscript_cache.h"
-#include "gdscript_tokenizer.h"
+#include "gdscript_tokenizer_buffer.h"
 #include "gdscript_utility_functions.h"
 
 #ifdef TOOLS_ENABLED
@@ -81,21 +81,36 @@ Ref<GDScriptEditorTranslationParserPlugin> gdscript_translation_parser_plugin;
 class EditorExportGDScript : public EditorExportPlugin {
 	GDCLASS(EditorExportGDScript, EditorExportPlugin);
 
+	enum ScriptExportMode {
+		EXPORT_TEXT,
+		EXPORT_BINARY_TOKENS,
+	};
+
+protected:
+	virtual void _get_export_options(const Ref<EditorExportPlatform> &p_platform, List<EditorExportPlatform::ExportOption> *r_options) const override {
+		r_options->push_back(EditorExportPlatform::ExportOption(PropertyInfo(Variant::INT, "gdscript/export_mode", PROPERTY_HINT_ENUM, "Text,Binary Tokens"), EXPORT_TEXT));
+	}
+
 public:
 	virtual void _export_file(const String &p_path, const String &p_type, const HashSet<String> &p_features) override {
-		String script_key;
+		if (!p_path.ends_with(".gd")) {
+			return;
+		}
 
 		const Ref<EditorExportPreset> &preset = get_export_preset();
-
-		if (preset.is_valid()) {
-			script_key = preset->get_script_encryption_key().to_lower();
+		if (preset.is_null() || int(get_option("gdscript/export_mode")) != EXPORT_BINARY_TOKENS) {
+			return;
 		}
 
-		if (!p_path.ends_with(".gd")) {
+		// Stored under the same path, the loader tells tokens from text by their header.
+		Vector<uint8_t> tokens = GDScriptTokenizerBuffer::parse_code_string(FileAccess::get_file_as_string(p_path));
+		if (tokens.is_empty()) {
+			WARN_PRINT(vformat(R"(Script "%s" has syntax errors and was exported as text.)", p_path));
 			return;
 		}
 
-		return;
+		add_file(p_path, tokens, false);
+		skip();
 	}
 
 	virtual String get_name() const override { return "GDScript"; }
@@ -34,6 +34,7 @@
 #include "../gdscript_analyzer.h"
 #include "../gdscript_compiler.h"
 #include "../gdscript_parser.h"
+#include "../gdscript_tokenizer_buffer.h"
 
 #include "core/config/project_settings.h"
 #include "core/core_globals.h"
@@ -131,10 +132,11 @@ void finish_language() {
 
 StringName GDScriptTestRunner::test_function_name;
 
-GDScriptTestRunner::GDScriptTestRunner(const String &p_source_dir, bool p_init_language, bool p_print_filenames) {
+GDScriptTestRunner::GDScriptTestRunner(const String &p_source_dir, bool p_init_language, bool p_print_filenames, bool p_binary_tokens) {
 	test_function_name = StaticCString::create("test");
 	do_init_languages = p_init_language;
 	print_filenames = p_print_filenames;
+	binary_tokens = p_binary_tokens;
 
 	source_dir = p_source_dir;
 	if (!source_dir.ends_with("/")) {
@@ -278,6 +280,11 @@ bool GDScriptTestRunner::make_tests_for_dir(const String &p_dir) {
 				next = dir->get_next();
 				continue;
 			} else if (next.get_extension().to_lower() == "gd") {
+				if (binary_tokens && next.ends_with(".textonly.gd")) {
+					// Errors only the text tokenizer can report, like inconsistent indentation.
+					next = dir->get_next();
+					continue;
+				}
 #ifndef DEBUG_ENABLED
 				// On release builds, skip tests marked as debug only.
 				Error open_err = OK;
@@ -298,7 +305,7 @@ bool GDScriptTestRunner::make_tests_for_dir(const String &p_dir) {
 				if (!is_generating && !dir->file_exists(out_file)) {
 					ERR_FAIL_V_MSG(false, "Could not find output file for " + next);
 				}
-				GDScriptTest test(current_dir.path_join(next), current_dir.path_join(out_file), source_dir);
+				GDScriptTest test(current_dir.path_join(next), current_dir.path_join(out_file), source_dir, binary_tokens);
 				tests.push_back(test);
 			}
 		}
@@ -339,10 +346,11 @@ bool GDScriptTestRunner::generate_class_index() {
 	return true;
 }
 
-GDScriptTest::GDScriptTest(const String &p_source_path, const String &p_output_path, const String &p_base_dir) {
+GDScriptTest::GDScriptTest(const String &p_source_path, const String &p_output_path, const String &p_base_dir, bool p_binary_tokens) {
 	source_file = p_source_path;
 	output_file = p_output_path;
 	base_dir = p_base_dir;
+	binary_tokens = p_binary_tokens;
 	_print_handler.printfunc = print_handler;
 	_error_handler.errfunc = error_handler;
 }
@@ -492,9 +500,21 @@ GDScriptTest::TestResult GDScriptTest::execute_test_code(bool p_is_generating) {
 		ERR_FAIL_V_MSG(result, "\nCould not load source code for: '" + source_file + "'");
 	}
 
+	if (binary_tokens) {
+		// Scripts the tokenizer rejects can't be stored as tokens, they keep reporting from the text.
+		Vector<uint8_t> buffer = GDScriptTokenizerBuffer::parse_code_string(script->get_source_code());
+		if (!buffer.is_empty()) {
+			script->set_binary_tokens_source(buffer);
+		}
+	}
+
 	// Test parsing.
 	GDScriptParser parser;
-	err = parser.parse(script->get_source_code(), source_file, false);
+	if (!script->get_binary_tokens_source().is_empty()) {
+		err = parser.parse_binary(script->get_binary_tokens_source(), source_file);
+	} else {
+		err = parser.parse(script->get_source_code(), source_file, false);
+	}
 	if (err != OK) {
 		enable_stdout();
 		result.status = GDTEST_PARSER_ERROR;
@@ -75,6 +75,7 @@ private:
 	String source_file;
 	String output_file;
 	String base_dir;
+	bool binary_tokens = false; // Parse the script from serialized tokens, as exported projects can.
 
 	PrintHandlerList _print_handler;
 	ErrorHandlerList _error_handler;
@@ -96,7 +97,7 @@ public:
 	const String get_source_relative_filepath() const { return source_file.trim_prefix(base_dir); }
 	const String &get_output_file() const { return output_file; }
 
-	GDScriptTest(const String &p_source_path, const String &p_output_path, const String &p_base_dir);
+	GDScriptTest(const String &p_source_path, const String &p_output_path, const String &p_base_dir, bool p_binary_tokens = false);
 	GDScriptTest() :
 			GDScriptTest(String(), String(), String()) {} // Needed to use in Vector.
 };
@@ -108,6 +109,7 @@ class GDScriptTestRunner {
 	bool is_generating = false;
 	bool do_init_languages = false;
 	bool print_filenames; // Whether filenames should be printed when generated/running tests
+	bool binary_tokens; // Test with serialized tokens instead of source code.
 
 	bool make_tests();
 	bool make_tests_for_dir(const String &p_dir);
@@ -120,7 +122,7 @@ public:
 	int run_tests();
 	bool generate_outputs();
 
-	GDScriptTestRunner(const String &p_source_dir, bool p_init_language, bool p_print_filenames = false);
+	GDScriptTestRunner(const String &p_source_dir, bool p_init_language, bool p_print_filenames = false, bool p_binary_tokens = false);
 	~GDScriptTestRunner();
 };
 
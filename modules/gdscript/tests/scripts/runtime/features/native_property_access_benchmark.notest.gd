@@ -0,0 +1,44 @@
+# Not run by the test runner. Measures untyped native property access:
+# godot --headless --script native_property_access_benchmark.notest.gd
+extends SceneTree
+
+const ITERATIONS = 1000000
+
+func bench(label: String, callable: Callable):
+	var start := Time.get_ticks_usec()
+	callable.call()
+	var elapsed := maxi(Time.get_ticks_usec() - start, 1)
+	print("%s: %d ops/sec" % [label, int(ITERATIONS * 1000000.0 / elapsed)])
+
+func get_mono(object):
+	var value
+	for _i in ITERATIONS:
+		value = object.position
+	return value
+
+func set_mono(object):
+	for i in ITERATIONS:
+		object.position = Vector2(i, i)
+
+func get_poly(objects):
+	var value
+	var count: int = objects.size()
+	for i in ITERATIONS:
+		value = objects[i % count].name
+	return value
+
+func _init():
+	var node_2d := Node2D.new()
+	var sprite := Sprite2D.new()
+	var objects := [Node2D.new(), Sprite2D.new(), Marker2D.new(), Node.new(), Timer.new(), Node2D.new()]
+
+	bench("get position (monomorphic)", get_mono.bind(node_2d))
+	bench("set position (monomorphic)", set_mono.bind(node_2d))
+	bench("get position (other class)", get_mono.bind(sprite))
+	bench("get name (megamorphic)", get_poly.bind(objects))
+
+	node_2d.free()
+	sprite.free()
+	for object in objects:
+		object.free()
+	quit()
@@ -0,0 +1,53 @@
+# Named property access on untyped values must keep working when the
+# object class changes from one call to the next at the same site.
+
+class ScriptedNode2D extends Node2D:
+	var custom := 1
+
+func read_name(object):
+	return object.name
+
+func read_position(object):
+	return object.position
+
+func write_position(object, value):
+	object.position = value
+
+func test():
+	var node := Node.new()
+	node.name = "Plain"
+	var node_2d := Node2D.new()
+	node_2d.name = "Flat"
+	var sprite := Sprite2D.new()
+	sprite.name = "Sprite"
+	var timer := Timer.new()
+	timer.name = "Ticker"
+	var marker := Marker2D.new()
+	marker.name = "Mark"
+	var scripted := ScriptedNode2D.new()
+	scripted.name = "Scripted"
+
+	var nodes := [node, node_2d, sprite, timer, marker, scripted]
+
+	# Same site sees more classes than it caches.
+	for _i in 3:
+		for object in nodes:
+			print(read_name(object))
+
+	for object in [node_2d, sprite, marker, scripted, node_2d]:
+		write_position(object, Vector2(1, 2))
+		print(read_position(object))
+
+	# Non-object bases take the generic path.
+	print(read_position({ position = Vector2(3, 4) }))
+
+	var untyped = scripted
+	untyped.custom = 7
+	print(untyped.custom)
+
+	var resource = Resource.new()
+	resource.resource_name = "Res"
+	print(resource.resource_name)
+
+	for object in nodes:
+		object.free()
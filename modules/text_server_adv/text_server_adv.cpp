@@ -390,9 +390,10 @@ int64_t TextServerAdvanced::_get_features() const {
 void TextServerAdvanced::_free_rid(const RID &p_rid) {
 	_THREAD_SAFE_METHOD_
 	if (font_owner.owns(p_rid)) {
-		MutexLock ftlock(ft_mutex);
-
 		FontAdvanced *fd = font_owner.get_or_null(p_rid);
+		_font_stop_rasterization(fd);
+
+		MutexLock ftlock(ft_mutex);
 		{
 			MutexLock lock(fd->mutex);
 			font_owner.free(p_rid);
@@ -497,6 +498,137 @@ bool TextServerAdvanced::_is_locale_right_to_left(const String &p_locale) const
 	}
 }
 
+thread_local uint64_t TextServerAdvanced::deferred_glyph_draws = 0;
+
+void TextServerAdvanced::_set_async_glyph_rasterization(bool p_enabled) {
+	async_rasterization.set_to(p_enabled);
+}
+
+bool TextServerAdvanced::_is_async_glyph_rasterization() const {
+	return async_rasterization.is_set();
+}
+
+int64_t TextServerAdvanced::_get_deferred_glyph_count() const {
+	return deferred_glyph_draws;
+}
+
+void TextServerAdvanced::_set_shaped_text_cache_limit(int64_t p_bytes) {
+	ERR_FAIL_COND(p_bytes < 0);
+
+	MutexLock lock(shaping_cache_mutex);
+	shaping_cache_limit.set(p_bytes);
+	_shaping_cache_trim();
+}
+
+int64_t TextServerAdvanced::_get_shaped_text_cache_limit() const {
+	return shaping_cache_limit.get();
+}
+
+int64_t TextServerAdvanced::_get_shaped_text_cache_usage() const {
+	MutexLock lock(shaping_cache_mutex);
+	return shaping_cache_usage;
+}
+
+int64_t TextServerAdvanced::_get_shaped_text_cache_hits() const {
+	return shaping_cache_hits.get();
+}
+
+int64_t TextServerAdvanced::_get_shaped_text_cache_misses() const {
+	return shaping_cache_misses.get();
+}
+
+Variant TextServerAdvanced::_shaping_cache_make_key(const ShapedTextDataAdvanced *p_sd) const {
+	// Everything the shaper output depends on, except font properties which are tracked by "font_version".
+	Array key;
+	key.push_back(p_sd->text);
+	key.push_back(p_sd->custom_punct);
+	key.push_back((int)p_sd->direction);
+	key.push_back((int)p_sd->orientation);
+	key.push_back(p_sd->preserve_invalid);
+	key.push_back(p_sd->preserve_control);
+	key.push_back(TranslationServer::get_singleton()->get_tool_locale()); // Used for spans without language.
+
+	PackedInt32Array params;
+	for (int i = 0; i < 4; i++) {
+		params.push_back(p_sd->extra_spacing[i]);
+	}
+	for (const Vector3i &ov : p_sd->bidi_override) {
+		params.push_back(ov.x);
+		params.push_back(ov.y);
+		params.push_back(ov.z);
+	}
+	key.push_back(params);
+
+	for (const ShapedTextDataAdvanced::Span &span : p_sd->spans) {
+		key.push_back(span.start);
+		key.push_back(span.end);
+		key.push_back(span.fonts.duplicate());
+		key.push_back(span.font_size);
+		key.push_back(span.language);
+		key.push_back(span.features.duplicate());
+	}
+	return key;
+}
+
+bool TextServerAdvanced::_shaping_cache_get(const Variant &p_key, uint64_t p_font_version, ShapedTextDataAdvanced *p_sd) {
+	MutexLock lock(shaping_cache_mutex);
+	if (shaping_cache_font_version != p_font_version) {
+		// Fonts were changed, cached glyphs and metrics are no longer valid.
+		shaping_cache.clear();
+		shaping_cache_lru.clear();
+		shaping_cache_usage = 0;
+		shaping_cache_font_version = p_font_version;
+	}
+
+	List<ShapingCacheEntry>::Element **E = shaping_cache.getptr(p_key);
+	if (!E) {
+		shaping_cache_misses.increment();
+		return false;
+	}
+	shaping_cache_lru.move_to_front(*E);
+
+	const ShapingCacheEntry &entry = (*E)->get();
+	p_sd->glyphs = entry.glyphs;
+	p_sd->ascent = entry.ascent;
+	p_sd->descent = entry.descent;
+	p_sd->width = entry.width;
+	p_sd->upos = entry.upos;
+	p_sd->uthk = entry.uthk;
+	shaping_cache_hits.increment();
+	return true;
+}
+
+void TextServerAdvanced::_shaping_cache_put(const Variant &p_key, uint64_t p_font_version, const ShapedTextDataAdvanced *p_sd) {
+	ShapingCacheEntry entry;
+	entry.key = p_key;
+	entry.glyphs = p_sd->glyphs;
+	entry.ascent = p_sd->ascent;
+	entry.descent = p_sd->descent;
+	entry.width = p_sd->width;
+	entry.upos = p_sd->upos;
+	entry.uthk = p_sd->uthk;
+	entry.size = sizeof(ShapingCacheEntry) + p_sd->glyphs.size() * sizeof(Glyph) + p_sd->text.length() * sizeof(char32_t);
+
+	MutexLock lock(shaping_cache_mutex);
+	if (shaping_cache_font_version != p_font_version || entry.size > shaping_cache_limit.get() || shaping_cache.has(p_key)) {
+		return;
+	}
+	shaping_cache_lru.push_front(entry);
+	shaping_cache.insert(p_key, shaping_cache_lru.front());
+	shaping_cache_usage += entry.size;
+	_shaping_cache_trim();
+}
+
+void TextServerAdvanced::_shaping_cache_trim() {
+	// Shaping cache mutex should be locked by the caller.
+	while (shaping_cache_usage > shaping_cache_limit.get() && shaping_cache_lru.back()) {
+		List<ShapingCacheEntry>::Element *E = shaping_cache_lru.back();
+		shaping_cache_usage -= E->get().size;
+		shaping_cache.erase(E->get().key);
+		shaping_cache_lru.erase(E);
+	}
+}
+
 _FORCE_INLINE_ void TextServerAdvanced::_insert_feature(const StringName &p_name, int32_t p_tag, Variant::Type p_vtype, bool p_hidden) {
 	FeatureInfo fi;
 	fi.name = p_name;
@@ -799,6 +931,98 @@ String TextServerAdvanced::_tag_to_name(int64_t p_tag) const {
 /* Font Glyph Rendering                                                  */
 /*************************************************************************/
 
+void TextServerAdvanced::_update_texture_region(const RID &p_texture, Image::Format p_format, const uint8_t *p_data, int p_width, int p_color_size, const Rect2i &p_rect, int p_mipmap) const {
+	PackedByteArray region;
+	region.resize(p_rect.size.x * p_rect.size.y * p_color_size);
+	uint8_t *wr = region.ptrw();
+	int row_size = p_rect.size.x * p_color_size;
+	for (int y = 0; y < p_rect.size.y; y++) {
+		memcpy(wr + y * row_size, p_data + ((p_rect.position.y + y) * p_width + p_rect.position.x) * p_color_size, row_size);
+	}
+	Ref<Image> img = Image::create_from_data(p_rect.size.x, p_rect.size.y, false, p_format, region);
+	RenderingServer::get_singleton()->texture_2d_update_region(p_texture, img, p_rect.position, p_mipmap, 0);
+}
+
+void TextServerAdvanced::_update_texture(ShelfPackTexture &p_tex, bool p_mipmaps) const {
+	if (!p_tex.dirty && p_tex.dirty_rects.is_empty()) {
+		return;
+	}
+
+	// Only upload the glyphs added since the last upload, unless that's most of the texture anyway.
+	// Mipmap regions can only be regenerated for power of 2 sizes, others are resampled as a whole.
+	bool partial = !p_tex.dirty && p_tex.texture.is_valid() && (!p_mipmaps || !p_tex.mipmap_data.is_empty());
+	if (partial) {
+		int64_t area = 0;
+		for (const Rect2i &E : p_tex.dirty_rects) {
+			area += E.get_area();
+		}
+		partial = area * 2 < int64_t(p_tex.texture_w) * p_tex.texture_h;
+	}
+
+	if (partial) {
+		RID rid = p_tex.texture->get_rid();
+		int color_size = p_tex.imgdata.size() / (p_tex.texture_w * p_tex.texture_h);
+		uint8_t *mip_wr = p_mipmaps ? p_tex.mipmap_data.ptrw() : nullptr;
+		for (const Rect2i &E : p_tex.dirty_rects) {
+			_update_texture_region(rid, p_tex.format, p_tex.imgdata.ptr(), p_tex.texture_w, color_size, E, 0);
+			if (!p_mipmaps) {
+				continue;
+			}
+
+			// Same 2x2 box filter as Image::generate_mipmaps() uses for power of 2 sizes, limited to the texels covering the region.
+			const uint8_t *src = p_tex.imgdata.ptr();
+			uint8_t *dst = mip_wr;
+			int src_w = p_tex.texture_w;
+			int src_h = p_tex.texture_h;
+			Rect2i rect = E;
+			for (int mip = 1; src_w > 1 || src_h > 1; mip++) {
+				int dst_w = MAX(src_w >> 1, 1);
+				int dst_h = MAX(src_h >> 1, 1);
+				int right_step = (src_w == 1) ? 0 : color_size;
+				int down_step = (src_h == 1) ? 0 : src_w * color_size;
+
+				Point2i from = Point2i(rect.position.x >> 1, rect.position.y >> 1);
+				Point2i to = Point2i((rect.position.x + rect.size.x - 1) >> 1, (rect.position.y + rect.size.y - 1) >> 1) + Point2i(1, 1);
+				rect = Rect2i(from, to - from);
+
+				for (int y = rect.position.y; y < rect.position.y + rect.size.y; y++) {
+					for (int x = rect.position.x; x < rect.position.x + rect.size.x; x++) {
+						const uint8_t *up = src + y * 2 * down_step + x * 2 * right_step;
+						const uint8_t *down = up + down_step;
+						uint8_t *out = dst + (y * dst_w + x) * color_size;
+						for (int k = 0; k < color_size; k++) {
+							out[k] = uint8_t((up[k] + up[k + right_step] + down[k] + down[k + right_step] + 2) >> 2);
+						}
+					}
+				}
+				_update_texture_region(rid, p_tex.format, dst, dst_w, color_size, rect, mip);
+
+				src = dst;
+				dst += dst_w * dst_h * color_size;
+				src_w = dst_w;
+				src_h = dst_h;
+			}
+		}
+	} else {
+		Ref<Image> img = Image::create_from_data(p_tex.texture_w, p_tex.texture_h, false, p_tex.format, p_tex.imgdata);
+		p_tex.mipmap_data.clear();
+		if (p_mipmaps) {
+			img->generate_mipmaps();
+			if (!(p_tex.texture_w & (p_tex.texture_w - 1)) && !(p_tex.texture_h & (p_tex.texture_h - 1))) {
+				p_tex.mipmap_data = img->get_data().slice(p_tex.imgdata.size());
+			}
+		}
+		if (p_tex.texture.is_null()) {
+			p_tex.texture = ImageTexture::create_from_image(img);
+		} else {
+			p_tex.texture->update(img);
+		}
+	}
+
+	p_tex.dirty = false;
+	p_tex.dirty_rects.clear();
+}
+
 _FORCE_INLINE_ TextServerAdvanced::FontTexturePosition TextServerAdvanced::find_texture_pos_for_glyph(FontForSizeAdvanced *p_data, int p_color_size, Image::Format p_image_format, int p_width, int p_height, bool p_msdf) const {
 	FontTexturePosition ret;
 
@@ -1034,7 +1258,7 @@ _FORCE_INLINE_ TextServerAdvanced::FontGlyph TextServerAdvanced::rasterize_msdf(
 			}
 		}
 
-		tex.dirty = true;
+		tex.mark_dirty(Rect2i(tex_pos.x + p_rect_margin * 2, tex_pos.y + p_rect_margin * 2, w, h));
 
 		chr.texture_idx = tex_pos.index;
 
@@ -1146,7 +1370,7 @@ _FORCE_INLINE_ TextServerAdvanced::FontGlyph TextServerAdvanced::rasterize_bitma
 		}
 	}
 
-	tex.dirty = true;
+	tex.mark_dirty(Rect2i(tex_pos.x + p_rect_margin * 2, tex_pos.y + p_rect_margin * 2, w, h));
 
 	FontGlyph chr;
 	chr.advance = advance * p_data->scale / p_data->oversampling;
@@ -1811,6 +2035,11 @@ _FORCE_INLINE_ bool TextServerAdvanced::_ensure_cache_for_size(FontAdvanced *p_f
 _FORCE_INLINE_ void TextServerAdvanced::_font_clear_cache(FontAdvanced *p_font_data) {
 	MutexLock ftlock(ft_mutex);
 
+	_invalidate_shaping_cache();
+
+	p_font_data->raster_queue.clear();
+	p_font_data->raster_pending.clear();
+
 	for (const KeyValue<Vector2i, FontForSizeAdvanced *> &E : p_font_data->cache) {
 		memdelete(E.value);
 	}
@@ -2261,6 +2490,7 @@ int64_t TextServerAdvanced::_font_get_msdf_size(const RID &p_font_rid) const {
 }
 
 void TextServerAdvanced::_font_set_fixed_size(const RID &p_font_rid, int64_t p_fixed_size) {
+	_invalidate_shaping_cache();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2277,6 +2507,7 @@ int64_t TextServerAdvanced::_font_get_fixed_size(const RID &p_font_rid) const {
 }
 
 void TextServerAdvanced::_font_set_fixed_size_scale_mode(const RID &p_font_rid, TextServer::FixedSizeScaleMode p_fixed_size_scale_mode) {
+	_invalidate_shaping_cache();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2293,6 +2524,7 @@ TextServer::FixedSizeScaleMode TextServerAdvanced::_font_get_fixed_size_scale_mo
 }
 
 void TextServerAdvanced::_font_set_allow_system_fallback(const RID &p_font_rid, bool p_allow_system_fallback) {
+	_invalidate_shaping_cache();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2347,6 +2579,7 @@ TextServer::Hinting TextServerAdvanced::_font_get_hinting(const RID &p_font_rid)
 }
 
 void TextServerAdvanced::_font_set_subpixel_positioning(const RID &p_font_rid, TextServer::SubpixelPositioning p_subpixel) {
+	_invalidate_shaping_cache();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2382,6 +2615,7 @@ double TextServerAdvanced::_font_get_embolden(const RID &p_font_rid) const {
 }
 
 void TextServerAdvanced::_font_set_spacing(const RID &p_font_rid, SpacingType p_spacing, int64_t p_value) {
+	_invalidate_shaping_cache();
 	ERR_FAIL_INDEX((int)p_spacing, 4);
 	FontAdvancedLinkedVariation *fdv = font_var_owner.get_or_null(p_font_rid);
 	if (fdv) {
@@ -2483,11 +2717,14 @@ TypedArray<Vector2i> TextServerAdvanced::_font_get_size_cache_list(const RID &p_
 }
 
 void TextServerAdvanced::_font_clear_size_cache(const RID &p_font_rid) {
+	_invalidate_shaping_cache();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
 	MutexLock lock(fd->mutex);
 	MutexLock ftlock(ft_mutex);
+	fd->raster_queue.clear();
+	fd->raster_pending.clear();
 	for (const KeyValue<Vector2i, FontForSizeAdvanced *> &E : fd->cache) {
 		memdelete(E.value);
 	}
@@ -2495,11 +2732,14 @@ void TextServerAdvanced::_font_clear_size_cache(const RID &p_font_rid) {
 }
 
 void TextServerAdvanced::_font_remove_size_cache(const RID &p_font_rid, const Vector2i &p_size) {
+	_invalidate_shaping_cache();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
 	MutexLock lock(fd->mutex);
 	MutexLock ftlock(ft_mutex);
+	fd->raster_queue.clear();
+	fd->raster_pending.clear();
 	if (fd->cache.has(p_size)) {
 		memdelete(fd->cache[p_size]);
 		fd->cache.erase(p_size);
@@ -2507,6 +2747,7 @@ void TextServerAdvanced::_font_remove_size_cache(const RID &p_font_rid, const Ve
 }
 
 void TextServerAdvanced::_font_set_ascent(const RID &p_font_rid, int64_t p_size, double p_ascent) {
+	_invalidate_shaping_cache();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2540,6 +2781,7 @@ double TextServerAdvanced::_font_get_ascent(const RID &p_font_rid, int64_t p_siz
 }
 
 void TextServerAdvanced::_font_set_descent(const RID &p_font_rid, int64_t p_size, double p_descent) {
+	_invalidate_shaping_cache();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2572,6 +2814,7 @@ double TextServerAdvanced::_font_get_descent(const RID &p_font_rid, int64_t p_si
 }
 
 void TextServerAdvanced::_font_set_underline_position(const RID &p_font_rid, int64_t p_size, double p_underline_position) {
+	_invalidate_shaping_cache();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2605,6 +2848,7 @@ double TextServerAdvanced::_font_get_underline_position(const RID &p_font_rid, i
 }
 
 void TextServerAdvanced::_font_set_underline_thickness(const RID &p_font_rid, int64_t p_size, double p_underline_thickness) {
+	_invalidate_shaping_cache();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2638,6 +2882,7 @@ double TextServerAdvanced::_font_get_underline_thickness(const RID &p_font_rid,
 }
 
 void TextServerAdvanced::_font_set_scale(const RID &p_font_rid, int64_t p_size, double p_scale) {
+	_invalidate_shaping_cache();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2735,7 +2980,9 @@ void TextServerAdvanced::_font_set_texture_image(const RID &p_font_rid, const Ve
 	}
 
 	tex.texture = ImageTexture::create_from_image(img);
+	tex.mipmap_data.clear();
 	tex.dirty = false;
+	tex.dirty_rects.clear();
 }
 
 Ref<Image> TextServerAdvanced::_font_get_texture_image(const RID &p_font_rid, const Vector2i &p_size, int64_t p_texture_index) const {
@@ -2813,6 +3060,7 @@ PackedInt32Array TextServerAdvanced::_font_get_glyph_list(const RID &p_font_rid,
 }
 
 void TextServerAdvanced::_font_clear_glyphs(const RID &p_font_rid, const Vector2i &p_size) {
+	_invalidate_shaping_cache();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2824,6 +3072,7 @@ void TextServerAdvanced::_font_clear_glyphs(const RID &p_font_rid, const Vector2
 }
 
 void TextServerAdvanced::_font_remove_glyph(const RID &p_font_rid, const Vector2i &p_size, int64_t p_glyph) {
+	_invalidate_shaping_cache();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2893,6 +3142,7 @@ Vector2 TextServerAdvanced::_font_get_glyph_advance(const RID &p_font_rid, int64
 }
 
 void TextServerAdvanced::_font_set_glyph_advance(const RID &p_font_rid, int64_t p_size, int64_t p_glyph, const Vector2 &p_advance) {
+	_invalidate_shaping_cache();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2944,6 +3194,7 @@ Vector2 TextServerAdvanced::_font_get_glyph_offset(const RID &p_font_rid, const
 }
 
 void TextServerAdvanced::_font_set_glyph_offset(const RID &p_font_rid, const Vector2i &p_size, int64_t p_glyph, const Vector2 &p_offset) {
+	_invalidate_shaping_cache();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2995,6 +3246,7 @@ Vector2 TextServerAdvanced::_font_get_glyph_size(const RID &p_font_rid, const Ve
 }
 
 void TextServerAdvanced::_font_set_glyph_size(const RID &p_font_rid, const Vector2i &p_size, int64_t p_glyph, const Vector2 &p_gl_size) {
+	_invalidate_shaping_cache();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3115,19 +3367,7 @@ RID TextServerAdvanced::_font_get_glyph_texture_rid(const RID &p_font_rid, const
 
 	if (RenderingServer::get_singleton() != nullptr) {
 		if (gl[p_glyph | mod].texture_idx != -1) {
-			if (fd->cache[size]->textures[gl[p_glyph | mod].texture_idx].dirty) {
-				ShelfPackTexture &tex = fd->cache[size]->textures.write[gl[p_glyph | mod].texture_idx];
-				Ref<Image> img = Image::create_from_data(tex.texture_w, tex.texture_h, false, tex.format, tex.imgdata);
-				if (fd->mipmaps) {
-					img->generate_mipmaps();
-				}
-				if (tex.texture.is_null()) {
-					tex.texture = ImageTexture::create_from_image(img);
-				} else {
-					tex.texture->update(img);
-				}
-				tex.dirty = false;
-			}
+			_update_texture(fd->cache[size]->textures.write[gl[p_glyph | mod].texture_idx], fd->mipmaps);
 			return fd->cache[size]->textures[gl[p_glyph | mod].texture_idx].texture->get_rid();
 		}
 	}
@@ -3161,19 +3401,7 @@ Size2 TextServerAdvanced::_font_get_glyph_texture_size(const RID &p_font_rid, co
 
 	if (RenderingServer::get_singleton() != nullptr) {
 		if (gl[p_glyph | mod].texture_idx != -1) {
-			if (fd->cache[size]->textures[gl[p_glyph | mod].texture_idx].dirty) {
-				ShelfPackTexture &tex = fd->cache[size]->textures.write[gl[p_glyph | mod].texture_idx];
-				Ref<Image> img = Image::create_from_data(tex.texture_w, tex.texture_h, false, tex.format, tex.imgdata);
-				if (fd->mipmaps) {
-					img->generate_mipmaps();
-				}
-				if (tex.texture.is_null()) {
-					tex.texture = ImageTexture::create_from_image(img);
-				} else {
-					tex.texture->update(img);
-				}
-				tex.dirty = false;
-			}
+			_update_texture(fd->cache[size]->textures.write[gl[p_glyph | mod].texture_idx], fd->mipmaps);
 			return fd->cache[size]->textures[gl[p_glyph | mod].texture_idx].texture->get_size();
 		}
 	}
@@ -3254,6 +3482,7 @@ TypedArray<Vector2i> TextServerAdvanced::_font_get_kerning_list(const RID &p_fon
 }
 
 void TextServerAdvanced::_font_clear_kerning_map(const RID &p_font_rid, int64_t p_size) {
+	_invalidate_shaping_cache();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3265,6 +3494,7 @@ void TextServerAdvanced::_font_clear_kerning_map(const RID &p_font_rid, int64_t
 }
 
 void TextServerAdvanced::_font_remove_kerning(const RID &p_font_rid, int64_t p_size, const Vector2i &p_glyph_pair) {
+	_invalidate_shaping_cache();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3276,6 +3506,7 @@ void TextServerAdvanced::_font_remove_kerning(const RID &p_font_rid, int64_t p_s
 }
 
 void TextServerAdvanced::_font_set_kerning(const RID &p_font_rid, int64_t p_size, const Vector2i &p_glyph_pair, const Vector2 &p_kerning) {
+	_invalidate_shaping_cache();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3441,6 +3672,115 @@ String TextServerAdvanced::_font_get_supported_chars(const RID &p_font_rid) cons
 	return chars;
 }
 
+_FORCE_INLINE_ void TextServerAdvanced::_ensure_glyph_variants(FontAdvanced *p_font_data, const Vector2i &p_size, int32_t p_index) const {
+	if (p_font_data->msdf) {
+		_ensure_glyph(p_font_data, p_size, p_index);
+		return;
+	}
+	for (int aa = 0; aa < ((p_font_data->antialiasing == FONT_ANTIALIASING_LCD) ? FONT_LCD_SUBPIXEL_LAYOUT_MAX : 1); aa++) {
+		if ((p_font_data->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_QUARTER) || (p_font_data->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && p_size.x <= SUBPIXEL_POSITIONING_ONE_QUARTER_MAX_SIZE)) {
+			_ensure_glyph(p_font_data, p_size, p_index | (0 << 27) | (aa << 24));
+			_ensure_glyph(p_font_data, p_size, p_index | (1 << 27) | (aa << 24));
+			_ensure_glyph(p_font_data, p_size, p_index | (2 << 27) | (aa << 24));
+			_ensure_glyph(p_font_data, p_size, p_index | (3 << 27) | (aa << 24));
+		} else if ((p_font_data->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_HALF) || (p_font_data->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && p_size.x <= SUBPIXEL_POSITIONING_ONE_HALF_MAX_SIZE)) {
+			_ensure_glyph(p_font_data, p_size, p_index | (1 << 27) | (aa << 24));
+			_ensure_glyph(p_font_data, p_size, p_index | (0 << 27) | (aa << 24));
+		} else {
+			_ensure_glyph(p_font_data, p_size, p_index | (aa << 24));
+		}
+	}
+}
+
+void TextServerAdvanced::_font_start_rasterization(FontAdvanced *p_font_data) const {
+	// Font mutex should be locked by the caller.
+	if (p_font_data->raster_task_running || p_font_data->raster_queue.is_empty()) {
+		return;
+	}
+	if (p_font_data->raster_task != -1) {
+		// Previous task has drained the queue and no longer touches the font, reclaim it.
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(p_font_data->raster_task);
+	}
+	FontRasterTaskData *td = memnew(FontRasterTaskData);
+	td->server = this;
+	td->font_data = p_font_data;
+	p_font_data->raster_task_running = true;
+	p_font_data->raster_task = WorkerThreadPool::get_singleton()->add_native_task(&TextServerAdvanced::_font_rasterization_task, td, false, String("FontRasterizeGlyphs"));
+}
+
+void TextServerAdvanced::_font_stop_rasterization(FontAdvanced *p_font_data) const {
+	int64_t task = -1;
+	{
+		MutexLock lock(p_font_data->mutex);
+		p_font_data->raster_queue.clear();
+		p_font_data->raster_pending.clear();
+		task = p_font_data->raster_task;
+		p_font_data->raster_task = -1;
+	}
+	if (task != -1) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(task);
+	}
+}
+
+bool TextServerAdvanced::_font_defer_glyph(FontAdvanced *p_font_data, const Vector2i &p_size, int32_t p_index) const {
+	// Font mutex should be locked by the caller.
+#ifdef MODULE_FREETYPE_ENABLED
+	if (!async_rasterization.is_set() || (p_index & 0xffffff) == 0) {
+		return false;
+	}
+	const FontForSizeAdvanced *ffsd = p_font_data->cache[p_size];
+	if (!ffsd->face || ffsd->glyph_map.has(p_index)) {
+		return false;
+	}
+	Vector3i key = Vector3i(p_size.x, p_size.y, p_index);
+	if (!p_font_data->raster_pending.has(key)) {
+		p_font_data->raster_pending.insert(key);
+
+		FontRasterRequest rq;
+		rq.size = p_size;
+		rq.value = p_index;
+		p_font_data->raster_queue.push_back(rq);
+		_font_start_rasterization(p_font_data);
+	}
+	deferred_glyph_draws++;
+	return true;
+#else
+	return false;
+#endif
+}
+
+void TextServerAdvanced::_font_rasterization_task(void *p_userdata) {
+	FontRasterTaskData *td = (FontRasterTaskData *)p_userdata;
+	FontAdvanced *fd = td->font_data;
+	while (true) {
+		// Lock for a single glyph at a time, to keep draw calls from other threads responsive.
+		MutexLock lock(fd->mutex);
+		if (fd->raster_queue.is_empty()) {
+			fd->raster_task_running = false;
+			break;
+		}
+		FontRasterRequest rq = fd->raster_queue.front()->get();
+		fd->raster_queue.pop_front();
+		if (!rq.from_char) {
+			fd->raster_pending.erase(Vector3i(rq.size.x, rq.size.y, rq.value));
+		}
+		if (!td->server->_ensure_cache_for_size(fd, rq.size)) {
+			continue;
+		}
+#ifdef MODULE_FREETYPE_ENABLED
+		FontForSizeAdvanced *ffsd = fd->cache[rq.size];
+		if (rq.from_char) {
+			if (ffsd->face) {
+				td->server->_ensure_glyph_variants(fd, rq.size, FT_Get_Char_Index(ffsd->face, rq.value));
+			}
+		} else {
+			td->server->_ensure_glyph(fd, rq.size, rq.value);
+		}
+#endif
+	}
+	memdelete(td);
+}
+
 void TextServerAdvanced::_font_render_range(const RID &p_font_rid, const Vector2i &p_size, int64_t p_start, int64_t p_end) {
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
@@ -3454,23 +3794,7 @@ void TextServerAdvanced::_font_render_range(const RID &p_font_rid, const Vector2
 #ifdef MODULE_FREETYPE_ENABLED
 		int32_t idx = FT_Get_Char_Index(fd->cache[size]->face, i);
 		if (fd->cache[size]->face) {
-			if (fd->msdf) {
-				_ensure_glyph(fd, size, (int32_t)idx);
-			} else {
-				for (int aa = 0; aa < ((fd->antialiasing == FONT_ANTIALIASING_LCD) ? FONT_LCD_SUBPIXEL_LAYOUT_MAX : 1); aa++) {
-					if ((fd->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_QUARTER) || (fd->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && size.x <= SUBPIXEL_POSITIONING_ONE_QUARTER_MAX_SIZE)) {
-						_ensure_glyph(fd, size, (int32_t)idx | (0 << 27) | (aa << 24));
-						_ensure_glyph(fd, size, (int32_t)idx | (1 << 27) | (aa << 24));
-						_ensure_glyph(fd, size, (int32_t)idx | (2 << 27) | (aa << 24));
-						_ensure_glyph(fd, size, (int32_t)idx | (3 << 27) | (aa << 24));
-					} else if ((fd->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_HALF) || (fd->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && size.x <= SUBPIXEL_POSITIONING_ONE_HALF_MAX_SIZE)) {
-						_ensure_glyph(fd, size, (int32_t)idx | (1 << 27) | (aa << 24));
-						_ensure_glyph(fd, size, (int32_t)idx | (0 << 27) | (aa << 24));
-					} else {
-						_ensure_glyph(fd, size, (int32_t)idx | (aa << 24));
-					}
-				}
-			}
+			_ensure_glyph_variants(fd, size, idx);
 		}
 #endif
 	}
@@ -3486,27 +3810,36 @@ void TextServerAdvanced::_font_render_glyph(const RID &p_font_rid, const Vector2
 #ifdef MODULE_FREETYPE_ENABLED
 	int32_t idx = p_index & 0xffffff; // Remove subpixel shifts.
 	if (fd->cache[size]->face) {
-		if (fd->msdf) {
-			_ensure_glyph(fd, size, (int32_t)idx);
-		} else {
-			for (int aa = 0; aa < ((fd->antialiasing == FONT_ANTIALIASING_LCD) ? FONT_LCD_SUBPIXEL_LAYOUT_MAX : 1); aa++) {
-				if ((fd->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_QUARTER) || (fd->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && size.x <= SUBPIXEL_POSITIONING_ONE_QUARTER_MAX_SIZE)) {
-					_ensure_glyph(fd, size, (int32_t)idx | (0 << 27) | (aa << 24));
-					_ensure_glyph(fd, size, (int32_t)idx | (1 << 27) | (aa << 24));
-					_ensure_glyph(fd, size, (int32_t)idx | (2 << 27) | (aa << 24));
-					_ensure_glyph(fd, size, (int32_t)idx | (3 << 27) | (aa << 24));
-				} else if ((fd->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_HALF) || (fd->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && size.x <= SUBPIXEL_POSITIONING_ONE_HALF_MAX_SIZE)) {
-					_ensure_glyph(fd, size, (int32_t)idx | (1 << 27) | (aa << 24));
-					_ensure_glyph(fd, size, (int32_t)idx | (0 << 27) | (aa << 24));
-				} else {
-					_ensure_glyph(fd, size, (int32_t)idx | (aa << 24));
-				}
-			}
-		}
+		_ensure_glyph_variants(fd, size, idx);
 	}
 #endif
 }
 
+void TextServerAdvanced::_font_prerender_characters(const RID &p_font_rid, const Vector2i &p_size, const String &p_characters) {
+	FontAdvanced *fd = _get_font_data(p_font_rid);
+	ERR_FAIL_NULL(fd);
+
+	MutexLock lock(fd->mutex);
+	Vector2i size = _get_size_outline(fd, p_size);
+	ERR_FAIL_COND(size.x <= 0);
+	for (int i = 0; i < p_characters.length(); i++) {
+		FontRasterRequest rq;
+		rq.size = size;
+		rq.value = p_characters[i];
+		rq.from_char = true;
+		fd->raster_queue.push_back(rq);
+	}
+	_font_start_rasterization(fd);
+}
+
+bool TextServerAdvanced::_font_is_prerendering(const RID &p_font_rid) const {
+	FontAdvanced *fd = _get_font_data(p_font_rid);
+	ERR_FAIL_NULL_V(fd, false);
+
+	MutexLock lock(fd->mutex);
+	return fd->raster_task_running;
+}
+
 void TextServerAdvanced::_font_draw_glyph(const RID &p_font_rid, const RID &p_canvas, int64_t p_size, const Vector2 &p_pos, int64_t p_index, const Color &p_color) const {
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
@@ -3539,6 +3872,9 @@ void TextServerAdvanced::_font_draw_glyph(const RID &p_font_rid, const RID &p_ca
 	}
 #endif
 
+	if (_font_defer_glyph(fd, size, index)) {
+		return; // Glyph is rasterized in the background, the canvas item is redrawn later.
+	}
 	if (!_ensure_glyph(fd, size, index)) {
 		return; // Invalid or non-graphical glyph, do not display errors, nothing to draw.
 	}
@@ -3555,19 +3891,7 @@ void TextServerAdvanced::_font_draw_glyph(const RID &p_font_rid, const RID &p_ca
 			}
 #endif
 			if (RenderingServer::get_singleton() != nullptr) {
-				if (fd->cache[size]->textures[gl.texture_idx].dirty) {
-					ShelfPackTexture &tex = fd->cache[size]->textures.write[gl.texture_idx];
-					Ref<Image> img = Image::create_from_data(tex.texture_w, tex.texture_h, false, tex.format, tex.imgdata);
-					if (fd->mipmaps) {
-						img->generate_mipmaps();
-					}
-					if (tex.texture.is_null()) {
-						tex.texture = ImageTexture::create_from_image(img);
-					} else {
-						tex.texture->update(img);
-					}
-					tex.dirty = false;
-				}
+				_update_texture(fd->cache[size]->textures.write[gl.texture_idx], fd->mipmaps);
 				RID texture = fd->cache[size]->textures[gl.texture_idx].texture->get_rid();
 				if (fd->msdf) {
 					Point2 cpos = p_pos;
@@ -3643,6 +3967,9 @@ void TextServerAdvanced::_font_draw_glyph_outline(const RID &p_font_rid, const R
 	}
 #endif
 
+	if (_font_defer_glyph(fd, size, index)) {
+		return; // Glyph is rasterized in the background, the canvas item is redrawn later.
+	}
 	if (!_ensure_glyph(fd, size, index)) {
 		return; // Invalid or non-graphical glyph, do not display errors, nothing to draw.
 	}
@@ -3659,19 +3986,7 @@ void TextServerAdvanced::_font_draw_glyph_outline(const RID &p_font_rid, const R
 			}
 #endif
 			if (RenderingServer::get_singleton() != nullptr) {
-				if (fd->cache[size]->textures[gl.texture_idx].dirty) {
-					ShelfPackTexture &tex = fd->cache[size]->textures.write[gl.texture_idx];
-					Ref<Image> img = Image::create_from_data(tex.texture_w, tex.texture_h, false, tex.format, tex.imgdata);
-					if (fd->mipmaps) {
-						img->generate_mipmaps();
-					}
-					if (tex.texture.is_null()) {
-						tex.texture = ImageTexture::create_from_image(img);
-					} else {
-						tex.texture->update(img);
-					}
-					tex.dirty = false;
-				}
+				_update_texture(fd->cache[size]->textures.write[gl.texture_idx], fd->mipmaps);
 				RID texture = fd->cache[size]->textures[gl.texture_idx].texture->get_rid();
 				if (fd->msdf) {
 					Point2 cpos = p_pos;
@@ -3728,6 +4043,7 @@ bool TextServerAdvanced::_font_is_language_supported(const RID &p_font_rid, cons
 }
 
 void TextServerAdvanced::_font_set_language_support_override(const RID &p_font_rid, const String &p_language, bool p_supported) {
+	_invalidate_shaping_cache();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3744,6 +4060,7 @@ bool TextServerAdvanced::_font_get_language_support_override(const RID &p_font_r
 }
 
 void TextServerAdvanced::_font_remove_language_support_override(const RID &p_font_rid, const String &p_language) {
+	_invalidate_shaping_cache();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3778,6 +4095,7 @@ bool TextServerAdvanced::_font_is_script_supported(const RID &p_font_rid, const
 }
 
 void TextServerAdvanced::_font_set_script_support_override(const RID &p_font_rid, const String &p_script, bool p_supported) {
+	_invalidate_shaping_cache();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3794,6 +4112,7 @@ bool TextServerAdvanced::_font_get_script_support_override(const RID &p_font_rid
 }
 
 void TextServerAdvanced::_font_remove_script_support_override(const RID &p_font_rid, const String &p_script) {
+	_invalidate_shaping_cache();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3814,6 +4133,7 @@ PackedStringArray TextServerAdvanced::_font_get_script_support_overrides(const R
 }
 
 void TextServerAdvanced::_font_set_opentype_feature_overrides(const RID &p_font_rid, const Dictionary &p_overrides) {
+	_invalidate_shaping_cache();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -6041,6 +6361,15 @@ bool TextServerAdvanced::_shaped_text_shape(const RID &p_shaped) {
 		sd->bidi_override.push_back(Vector3i(sd->start, sd->end, DIRECTION_INHERITED));
 	}
 
+	// Reuse glyphs of an identical buffer shaped earlier. Embedded object sizes are not part of the key, skip buffers with objects.
+	Variant cache_key;
+	uint64_t cache_font_version = font_version.get();
+	bool cached = false;
+	if (shaping_cache_limit.get() > 0 && sd->objects.is_empty()) {
+		cache_key = _shaping_cache_make_key(sd);
+		cached = _shaping_cache_get(cache_key, cache_font_version, sd);
+	}
+
 	for (int ov = 0; ov < sd->bidi_override.size(); ov++) {
 		// Create BiDi iterator.
 		int start = _convert_pos_inv(sd, sd->bidi_override[ov].x - sd->start);
@@ -6083,6 +6412,10 @@ bool TextServerAdvanced::_shaped_text_shape(const RID &p_shaped) {
 		}
 		sd->bidi_iter.push_back(bidi_iter);
 
+		if (cached) {
+			continue; // Glyphs are already set, BiDi iterators are still required for line breaking and substrings.
+		}
+
 		err = U_ZERO_ERROR;
 		int bidi_run_count = 1;
 		if (bidi_iter) {
@@ -6192,6 +6525,9 @@ bool TextServerAdvanced::_shaped_text_shape(const RID &p_shaped) {
 	}
 
 	_realign(sd);
+	if (!cached && cache_key.get_type() != Variant::NIL) {
+		_shaping_cache_put(cache_key, cache_font_version, sd);
+	}
 	sd->valid = true;
 	return sd->valid;
 }
@@ -7073,6 +7409,7 @@ bool TextServerAdvanced::_is_valid_identifier(const String &p_string) const {
 }
 
 TextServerAdvanced::TextServerAdvanced() {
+	shaping_cache_limit.set(1024 * 1024);
 	_insert_num_systems_lang();
 	_insert_feature_sets();
 	_bmp_create_font_funcs();
@@ -7091,6 +7428,13 @@ void TextServerAdvanced::_cleanup() {
 }
 
 TextServerAdvanced::~TextServerAdvanced() {
+	// Background rasterization tasks use the fonts and the FreeType library, wait for them first.
+	List<RID> fonts;
+	font_owner.get_owned_list(&fonts);
+	for (const RID &font : fonts) {
+		_font_stop_rasterization(font_owner.get_or_null(font));
+	}
+
 	_bmp_free_font_funcs();
 #ifdef MODULE_FREETYPE_ENABLED
 	if (ft_library != nullptr) {
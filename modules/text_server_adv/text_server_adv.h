@@ -53,6 +53,7 @@
 #include <godot_cpp/variant/packed_string_array.hpp>
 #include <godot_cpp/variant/packed_vector2_array.hpp>
 #include <godot_cpp/variant/rect2.hpp>
+#include <godot_cpp/variant/rect2i.hpp>
 #include <godot_cpp/variant/rid.hpp>
 #include <godot_cpp/variant/string.hpp>
 #include <godot_cpp/variant/typed_array.hpp>
@@ -73,7 +74,9 @@
 
 #include <godot_cpp/templates/hash_map.hpp>
 #include <godot_cpp/templates/hash_set.hpp>
+#include <godot_cpp/templates/list.hpp>
 #include <godot_cpp/templates/rid_owner.hpp>
+#include <godot_cpp/templates/safe_refcount.hpp>
 #include <godot_cpp/templates/vector.hpp>
 
 using namespace godot;
@@ -85,6 +88,7 @@ using namespace godot;
 #include "core/object/worker_thread_pool.h"
 #include "core/templates/hash_map.h"
 #include "core/templates/rid_owner.h"
+#include "core/templates/safe_refcount.h"
 #include "scene/resources/image_texture.h"
 #include "servers/text/text_server_extension.h"
 
@@ -208,11 +212,37 @@ class TextServerAdvanced : public TextServerExtension {
 
 		Image::Format format;
 		PackedByteArray imgdata;
+		PackedByteArray mipmap_data; // Mipmaps past the base level, kept to regenerate them per region.
 		Ref<ImageTexture> texture;
-		bool dirty = true;
+		bool dirty = true; // The whole texture must be uploaded.
+		Vector<Rect2i> dirty_rects; // Regions changed since the last upload.
 
 		List<Shelf> shelves;
 
+		void mark_dirty(const Rect2i &p_rect) {
+			if (!p_rect.has_area()) {
+				return;
+			}
+			// Glyphs are packed next to each other on shelves, so neighbors can usually be merged without uploading much unchanged area.
+			for (int i = 0; i < dirty_rects.size(); i++) {
+				Rect2i merged = dirty_rects[i].merge(p_rect);
+				if (merged.get_area() <= (dirty_rects[i].get_area() + p_rect.get_area()) * 2) {
+					dirty_rects.write[i] = merged;
+					return;
+				}
+			}
+			if (dirty_rects.size() < 16) {
+				dirty_rects.push_back(p_rect);
+			} else {
+				Rect2i merged = p_rect;
+				for (const Rect2i &E : dirty_rects) {
+					merged = merged.merge(E);
+				}
+				dirty_rects.clear();
+				dirty_rects.push_back(merged);
+			}
+		}
+
 		FontTexturePosition pack_rect(int32_t p_id, int32_t p_h, int32_t p_w) {
 			int32_t y = 0;
 			int32_t waste = 0;
@@ -299,6 +329,12 @@ class TextServerAdvanced : public TextServerExtension {
 		int extra_spacing[4] = { 0, 0, 0, 0 };
 	};
 
+	struct FontRasterRequest {
+		Vector2i size;
+		int32_t value = 0; // Glyph index, or character code if "from_char" is set.
+		bool from_char = false;
+	};
+
 	struct FontAdvanced {
 		Mutex mutex;
 
@@ -327,6 +363,12 @@ class TextServerAdvanced : public TextServerExtension {
 
 		HashMap<Vector2i, FontForSizeAdvanced *, VariantHasher, VariantComparator> cache;
 
+		// Background rasterization state, guarded by "mutex".
+		List<FontRasterRequest> raster_queue;
+		HashSet<Vector3i> raster_pending; // Glyphs deferred by draw calls, as (size, outline, index).
+		int64_t raster_task = -1;
+		bool raster_task_running = false;
+
 		bool face_init = false;
 		HashSet<uint32_t> supported_scripts;
 		Dictionary supported_features;
@@ -350,6 +392,8 @@ class TextServerAdvanced : public TextServerExtension {
 		}
 	};
 
+	void _update_texture(ShelfPackTexture &p_tex, bool p_mipmaps) const;
+	void _update_texture_region(const RID &p_texture, Image::Format p_format, const uint8_t *p_data, int p_width, int p_color_size, const Rect2i &p_rect, int p_mipmap) const;
 	_FORCE_INLINE_ FontTexturePosition find_texture_pos_for_glyph(FontForSizeAdvanced *p_data, int p_color_size, Image::Format p_image_format, int p_width, int p_height, bool p_msdf) const;
 #ifdef MODULE_MSDFGEN_ENABLED
 	_FORCE_INLINE_ FontGlyph rasterize_msdf(FontAdvanced *p_font_data, FontForSizeAdvanced *p_data, int p_pixel_range, int p_rect_margin, FT_Outline *outline, const Vector2 &advance) const;
@@ -360,6 +404,17 @@ class TextServerAdvanced : public TextServerExtension {
 	_FORCE_INLINE_ bool _ensure_glyph(FontAdvanced *p_font_data, const Vector2i &p_size, int32_t p_glyph) const;
 	_FORCE_INLINE_ bool _ensure_cache_for_size(FontAdvanced *p_font_data, const Vector2i &p_size) const;
 	_FORCE_INLINE_ void _font_clear_cache(FontAdvanced *p_font_data);
+	_FORCE_INLINE_ void _ensure_glyph_variants(FontAdvanced *p_font_data, const Vector2i &p_size, int32_t p_index) const;
+
+	struct FontRasterTaskData {
+		const TextServerAdvanced *server = nullptr;
+		FontAdvanced *font_data = nullptr;
+	};
+
+	void _font_start_rasterization(FontAdvanced *p_font_data) const;
+	void _font_stop_rasterization(FontAdvanced *p_font_data) const;
+	bool _font_defer_glyph(FontAdvanced *p_font_data, const Vector2i &p_size, int32_t p_index) const;
+	static void _font_rasterization_task(void *p_userdata);
 	static void _generateMTSDF_threaded(void *p_td, uint32_t p_y);
 
 	_FORCE_INLINE_ Vector2i _get_size(const FontAdvanced *p_font_data, int p_size) const {
@@ -652,6 +707,39 @@ class TextServerAdvanced : public TextServerExtension {
 
 	Mutex ft_mutex;
 
+	SafeFlag async_rasterization;
+	// Counted per thread, so a drawing thread only sees the glyphs it skipped itself.
+	static thread_local uint64_t deferred_glyph_draws;
+
+	// Shaped text cache, guarded by "shaping_cache_mutex".
+
+	struct ShapingCacheEntry {
+		Variant key;
+		Vector<Glyph> glyphs;
+		double ascent = 0.0;
+		double descent = 0.0;
+		double width = 0.0;
+		double upos = 0.0;
+		double uthk = 0.0;
+		int64_t size = 0;
+	};
+
+	Mutex shaping_cache_mutex;
+	List<ShapingCacheEntry> shaping_cache_lru; // Most recently used entry first.
+	HashMap<Variant, List<ShapingCacheEntry>::Element *, VariantHasher, VariantComparator> shaping_cache;
+	int64_t shaping_cache_usage = 0;
+	uint64_t shaping_cache_font_version = 0; // Value of "font_version" cached entries are valid for.
+	SafeNumeric<int64_t> shaping_cache_limit;
+	SafeNumeric<uint64_t> shaping_cache_hits;
+	SafeNumeric<uint64_t> shaping_cache_misses;
+	SafeNumeric<uint64_t> font_version; // Incremented when font properties affecting shaping change.
+
+	_FORCE_INLINE_ void _invalidate_shaping_cache() { font_version.increment(); }
+	Variant _shaping_cache_make_key(const ShapedTextDataAdvanced *p_sd) const;
+	bool _shaping_cache_get(const Variant &p_key, uint64_t p_font_version, ShapedTextDataAdvanced *p_sd);
+	void _shaping_cache_put(const Variant &p_key, uint64_t p_font_version, const ShapedTextDataAdvanced *p_sd);
+	void _shaping_cache_trim();
+
 	// HarfBuzz bitmap font interface.
 
 	static hb_font_funcs_t *funcs;
@@ -711,6 +799,16 @@ public:
 
 	MODBIND1RC(bool, is_locale_right_to_left, const String &);
 
+	MODBIND1(set_async_glyph_rasterization, bool);
+	MODBIND0RC(bool, is_async_glyph_rasterization);
+	MODBIND0RC(int64_t, get_deferred_glyph_count);
+
+	MODBIND1(set_shaped_text_cache_limit, int64_t);
+	MODBIND0RC(int64_t, get_shaped_text_cache_limit);
+	MODBIND0RC(int64_t, get_shaped_text_cache_usage);
+	MODBIND0RC(int64_t, get_shaped_text_cache_hits);
+	MODBIND0RC(int64_t, get_shaped_text_cache_misses);
+
 	MODBIND1RC(int64_t, name_to_tag, const String &);
 	MODBIND1RC(String, tag_to_name, int64_t);
 
@@ -860,6 +958,9 @@ public:
 	MODBIND4(font_render_range, const RID &, const Vector2i &, int64_t, int64_t);
 	MODBIND3(font_render_glyph, const RID &, const Vector2i &, int64_t);
 
+	MODBIND3(font_prerender_characters, const RID &, const Vector2i &, const String &);
+	MODBIND1RC(bool, font_is_prerendering, const RID &);
+
 	MODBIND6C(font_draw_glyph, const RID &, const RID &, int64_t, const Vector2 &, int64_t, const Color &);
 	MODBIND7C(font_draw_glyph_outline, const RID &, const RID &, int64_t, int64_t, const Vector2 &, int64_t, const Color &);
 
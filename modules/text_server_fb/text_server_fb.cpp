@@ -115,9 +115,10 @@ int64_t TextServerFallback::_get_features() const {
 void TextServerFallback::_free_rid(const RID &p_rid) {
 	_THREAD_SAFE_METHOD_
 	if (font_owner.owns(p_rid)) {
-		MutexLock ftlock(ft_mutex);
-
 		FontFallback *fd = font_owner.get_or_null(p_rid);
+		_font_stop_rasterization(fd);
+
+		MutexLock ftlock(ft_mutex);
 		{
 			MutexLock lock(fd->mutex);
 			font_owner.free(p_rid);
@@ -166,6 +167,20 @@ bool TextServerFallback::_is_locale_right_to_left(const String &p_locale) const
 	return false; // No RTL support.
 }
 
+thread_local uint64_t TextServerFallback::deferred_glyph_draws = 0;
+
+void TextServerFallback::_set_async_glyph_rasterization(bool p_enabled) {
+	async_rasterization.set_to(p_enabled);
+}
+
+bool TextServerFallback::_is_async_glyph_rasterization() const {
+	return async_rasterization.is_set();
+}
+
+int64_t TextServerFallback::_get_deferred_glyph_count() const {
+	return deferred_glyph_draws;
+}
+
 _FORCE_INLINE_ void TextServerFallback::_insert_feature(const StringName &p_name, int32_t p_tag) {
 	feature_sets.insert(p_name, p_tag);
 	feature_sets_inv.insert(p_tag, p_name);
@@ -234,6 +249,98 @@ String TextServerFallback::_tag_to_name(int64_t p_tag) const {
 /* Font Glyph Rendering                                                  */
 /*************************************************************************/
 
+void TextServerFallback::_update_texture_region(const RID &p_texture, Image::Format p_format, const uint8_t *p_data, int p_width, int p_color_size, const Rect2i &p_rect, int p_mipmap) const {
+	PackedByteArray region;
+	region.resize(p_rect.size.x * p_rect.size.y * p_color_size);
+	uint8_t *wr = region.ptrw();
+	int row_size = p_rect.size.x * p_color_size;
+	for (int y = 0; y < p_rect.size.y; y++) {
+		memcpy(wr + y * row_size, p_data + ((p_rect.position.y + y) * p_width + p_rect.position.x) * p_color_size, row_size);
+	}
+	Ref<Image> img = Image::create_from_data(p_rect.size.x, p_rect.size.y, false, p_format, region);
+	RenderingServer::get_singleton()->texture_2d_update_region(p_texture, img, p_rect.position, p_mipmap, 0);
+}
+
+void TextServerFallback::_update_texture(ShelfPackTexture &p_tex, bool p_mipmaps) const {
+	if (!p_tex.dirty && p_tex.dirty_rects.is_empty()) {
+		return;
+	}
+
+	// Only upload the glyphs added since the last upload, unless that's most of the texture anyway.
+	// Mipmap regions can only be regenerated for power of 2 sizes, others are resampled as a whole.
+	bool partial = !p_tex.dirty && p_tex.texture.is_valid() && (!p_mipmaps || !p_tex.mipmap_data.is_empty());
+	if (partial) {
+		int64_t area = 0;
+		for (const Rect2i &E : p_tex.dirty_rects) {
+			area += E.get_area();
+		}
+		partial = area * 2 < int64_t(p_tex.texture_w) * p_tex.texture_h;
+	}
+
+	if (partial) {
+		RID rid = p_tex.texture->get_rid();
+		int color_size = p_tex.imgdata.size() / (p_tex.texture_w * p_tex.texture_h);
+		uint8_t *mip_wr = p_mipmaps ? p_tex.mipmap_data.ptrw() : nullptr;
+		for (const Rect2i &E : p_tex.dirty_rects) {
+			_update_texture_region(rid, p_tex.format, p_tex.imgdata.ptr(), p_tex.texture_w, color_size, E, 0);
+			if (!p_mipmaps) {
+				continue;
+			}
+
+			// Same 2x2 box filter as Image::generate_mipmaps() uses for power of 2 sizes, limited to the texels covering the region.
+			const uint8_t *src = p_tex.imgdata.ptr();
+			uint8_t *dst = mip_wr;
+			int src_w = p_tex.texture_w;
+			int src_h = p_tex.texture_h;
+			Rect2i rect = E;
+			for (int mip = 1; src_w > 1 || src_h > 1; mip++) {
+				int dst_w = MAX(src_w >> 1, 1);
+				int dst_h = MAX(src_h >> 1, 1);
+				int right_step = (src_w == 1) ? 0 : color_size;
+				int down_step = (src_h == 1) ? 0 : src_w * color_size;
+
+				Point2i from = Point2i(rect.position.x >> 1, rect.position.y >> 1);
+				Point2i to = Point2i((rect.position.x + rect.size.x - 1) >> 1, (rect.position.y + rect.size.y - 1) >> 1) + Point2i(1, 1);
+				rect = Rect2i(from, to - from);
+
+				for (int y = rect.position.y; y < rect.position.y + rect.size.y; y++) {
+					for (int x = rect.position.x; x < rect.position.x + rect.size.x; x++) {
+						const uint8_t *up = src + y * 2 * down_step + x * 2 * right_step;
+						const uint8_t *down = up + down_step;
+						uint8_t *out = dst + (y * dst_w + x) * color_size;
+						for (int k = 0; k < color_size; k++) {
+							out[k] = uint8_t((up[k] + up[k + right_step] + down[k] + down[k + right_step] + 2) >> 2);
+						}
+					}
+				}
+				_update_texture_region(rid, p_tex.format, dst, dst_w, color_size, rect, mip);
+
+				src = dst;
+				dst += dst_w * dst_h * color_size;
+				src_w = dst_w;
+				src_h = dst_h;
+			}
+		}
+	} else {
+		Ref<Image> img = Image::create_from_data(p_tex.texture_w, p_tex.texture_h, false, p_tex.format, p_tex.imgdata);
+		p_tex.mipmap_data.clear();
+		if (p_mipmaps) {
+			img->generate_mipmaps();
+			if (!(p_tex.texture_w & (p_tex.texture_w - 1)) && !(p_tex.texture_h & (p_tex.texture_h - 1))) {
+				p_tex.mipmap_data = img->get_data().slice(p_tex.imgdata.size());
+			}
+		}
+		if (p_tex.texture.is_null()) {
+			p_tex.texture = ImageTexture::create_from_image(img);
+		} else {
+			p_tex.texture->update(img);
+		}
+	}
+
+	p_tex.dirty = false;
+	p_tex.dirty_rects.clear();
+}
+
 _FORCE_INLINE_ TextServerFallback::FontTexturePosition TextServerFallback::find_texture_pos_for_glyph(FontForSizeFallback *p_data, int p_color_size, Image::Format p_image_format, int p_width, int p_height, bool p_msdf) const {
 	FontTexturePosition ret;
 
@@ -470,7 +577,7 @@ _FORCE_INLINE_ TextServerFallback::FontGlyph TextServerFallback::rasterize_msdf(
 			}
 		}
 
-		tex.dirty = true;
+		tex.mark_dirty(Rect2i(tex_pos.x + p_rect_margin * 2, tex_pos.y + p_rect_margin * 2, w, h));
 
 		chr.texture_idx = tex_pos.index;
 
@@ -581,7 +688,7 @@ _FORCE_INLINE_ TextServerFallback::FontGlyph TextServerFallback::rasterize_bitma
 		}
 	}
 
-	tex.dirty = true;
+	tex.mark_dirty(Rect2i(tex_pos.x + p_rect_margin * 2, tex_pos.y + p_rect_margin * 2, w, h));
 
 	FontGlyph chr;
 	chr.advance = advance * p_data->scale / p_data->oversampling;
@@ -930,6 +1037,9 @@ _FORCE_INLINE_ bool TextServerFallback::_ensure_cache_for_size(FontFallback *p_f
 _FORCE_INLINE_ void TextServerFallback::_font_clear_cache(FontFallback *p_font_data) {
 	MutexLock ftlock(ft_mutex);
 
+	p_font_data->raster_queue.clear();
+	p_font_data->raster_pending.clear();
+
 	for (const KeyValue<Vector2i, FontForSizeFallback *> &E : p_font_data->cache) {
 		memdelete(E.value);
 	}
@@ -1482,6 +1592,8 @@ void TextServerFallback::_font_clear_size_cache(const RID &p_font_rid) {
 
 	MutexLock lock(fd->mutex);
 	MutexLock ftlock(ft_mutex);
+	fd->raster_queue.clear();
+	fd->raster_pending.clear();
 	for (const KeyValue<Vector2i, FontForSizeFallback *> &E : fd->cache) {
 		memdelete(E.value);
 	}
@@ -1494,6 +1606,8 @@ void TextServerFallback::_font_remove_size_cache(const RID &p_font_rid, const Ve
 
 	MutexLock lock(fd->mutex);
 	MutexLock ftlock(ft_mutex);
+	fd->raster_queue.clear();
+	fd->raster_pending.clear();
 	if (fd->cache.has(p_size)) {
 		memdelete(fd->cache[p_size]);
 		fd->cache.erase(p_size);
@@ -1729,7 +1843,9 @@ void TextServerFallback::_font_set_texture_image(const RID &p_font_rid, const Ve
 	}
 
 	tex.texture = ImageTexture::create_from_image(img);
+	tex.mipmap_data.clear();
 	tex.dirty = false;
+	tex.dirty_rects.clear();
 }
 
 Ref<Image> TextServerFallback::_font_get_texture_image(const RID &p_font_rid, const Vector2i &p_size, int64_t p_texture_index) const {
@@ -2095,19 +2211,7 @@ RID TextServerFallback::_font_get_glyph_texture_rid(const RID &p_font_rid, const
 
 	if (RenderingServer::get_singleton() != nullptr) {
 		if (gl[p_glyph | mod].texture_idx != -1) {
-			if (fd->cache[size]->textures[gl[p_glyph | mod].texture_idx].dirty) {
-				ShelfPackTexture &tex = fd->cache[size]->textures.write[gl[p_glyph | mod].texture_idx];
-				Ref<Image> img = Image::create_from_data(tex.texture_w, tex.texture_h, false, tex.format, tex.imgdata);
-				if (fd->mipmaps) {
-					img->generate_mipmaps();
-				}
-				if (tex.texture.is_null()) {
-					tex.texture = ImageTexture::create_from_image(img);
-				} else {
-					tex.texture->update(img);
-				}
-				tex.dirty = false;
-			}
+			_update_texture(fd->cache[size]->textures.write[gl[p_glyph | mod].texture_idx], fd->mipmaps);
 			return fd->cache[size]->textures[gl[p_glyph | mod].texture_idx].texture->get_rid();
 		}
 	}
@@ -2141,19 +2245,7 @@ Size2 TextServerFallback::_font_get_glyph_texture_size(const RID &p_font_rid, co
 
 	if (RenderingServer::get_singleton() != nullptr) {
 		if (gl[p_glyph | mod].texture_idx != -1) {
-			if (fd->cache[size]->textures[gl[p_glyph | mod].texture_idx].dirty) {
-				ShelfPackTexture &tex = fd->cache[size]->textures.write[gl[p_glyph | mod].texture_idx];
-				Ref<Image> img = Image::create_from_data(tex.texture_w, tex.texture_h, false, tex.format, tex.imgdata);
-				if (fd->mipmaps) {
-					img->generate_mipmaps();
-				}
-				if (tex.texture.is_null()) {
-					tex.texture = ImageTexture::create_from_image(img);
-				} else {
-					tex.texture->update(img);
-				}
-				tex.dirty = false;
-			}
+			_update_texture(fd->cache[size]->textures.write[gl[p_glyph | mod].texture_idx], fd->mipmaps);
 			return fd->cache[size]->textures[gl[p_glyph | mod].texture_idx].texture->get_size();
 		}
 	}
@@ -2376,6 +2468,115 @@ String TextServerFallback::_font_get_supported_chars(const RID &p_font_rid) cons
 	return chars;
 }
 
+_FORCE_INLINE_ void TextServerFallback::_ensure_glyph_variants(FontFallback *p_font_data, const Vector2i &p_size, int32_t p_index) const {
+	if (p_font_data->msdf) {
+		_ensure_glyph(p_font_data, p_size, p_index);
+		return;
+	}
+	for (int aa = 0; aa < ((p_font_data->antialiasing == FONT_ANTIALIASING_LCD) ? FONT_LCD_SUBPIXEL_LAYOUT_MAX : 1); aa++) {
+		if ((p_font_data->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_QUARTER) || (p_font_data->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && p_size.x <= SUBPIXEL_POSITIONING_ONE_QUARTER_MAX_SIZE)) {
+			_ensure_glyph(p_font_data, p_size, p_index | (0 << 27) | (aa << 24));
+			_ensure_glyph(p_font_data, p_size, p_index | (1 << 27) | (aa << 24));
+			_ensure_glyph(p_font_data, p_size, p_index | (2 << 27) | (aa << 24));
+			_ensure_glyph(p_font_data, p_size, p_index | (3 << 27) | (aa << 24));
+		} else if ((p_font_data->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_HALF) || (p_font_data->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && p_size.x <= SUBPIXEL_POSITIONING_ONE_HALF_MAX_SIZE)) {
+			_ensure_glyph(p_font_data, p_size, p_index | (1 << 27) | (aa << 24));
+			_ensure_glyph(p_font_data, p_size, p_index | (0 << 27) | (aa << 24));
+		} else {
+			_ensure_glyph(p_font_data, p_size, p_index | (aa << 24));
+		}
+	}
+}
+
+void TextServerFallback::_font_start_rasterization(FontFallback *p_font_data) const {
+	// Font mutex should be locked by the caller.
+	if (p_font_data->raster_task_running || p_font_data->raster_queue.is_empty()) {
+		return;
+	}
+	if (p_font_data->raster_task != -1) {
+		// Previous task has drained the queue and no longer touches the font, reclaim it.
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(p_font_data->raster_task);
+	}
+	FontRasterTaskData *td = memnew(FontRasterTaskData);
+	td->server = this;
+	td->font_data = p_font_data;
+	p_font_data->raster_task_running = true;
+	p_font_data->raster_task = WorkerThreadPool::get_singleton()->add_native_task(&TextServerFallback::_font_rasterization_task, td, false, String("FontRasterizeGlyphs"));
+}
+
+void TextServerFallback::_font_stop_rasterization(FontFallback *p_font_data) const {
+	int64_t task = -1;
+	{
+		MutexLock lock(p_font_data->mutex);
+		p_font_data->raster_queue.clear();
+		p_font_data->raster_pending.clear();
+		task = p_font_data->raster_task;
+		p_font_data->raster_task = -1;
+	}
+	if (task != -1) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(task);
+	}
+}
+
+bool TextServerFallback::_font_defer_glyph(FontFallback *p_font_data, const Vector2i &p_size, int32_t p_index) const {
+	// Font mutex should be locked by the caller.
+#ifdef MODULE_FREETYPE_ENABLED
+	if (!async_rasterization.is_set() || (p_index & 0xffffff) == 0) {
+		return false;
+	}
+	const FontForSizeFallback *ffsd = p_font_data->cache[p_size];
+	if (!ffsd->face || ffsd->glyph_map.has(p_index)) {
+		return false;
+	}
+	Vector3i key = Vector3i(p_size.x, p_size.y, p_index);
+	if (!p_font_data->raster_pending.has(key)) {
+		p_font_data->raster_pending.insert(key);
+
+		FontRasterRequest rq;
+		rq.size = p_size;
+		rq.value = p_index;
+		p_font_data->raster_queue.push_back(rq);
+		_font_start_rasterization(p_font_data);
+	}
+	deferred_glyph_draws++;
+	return true;
+#else
+	return false;
+#endif
+}
+
+void TextServerFallback::_font_rasterization_task(void *p_userdata) {
+	FontRasterTaskData *td = (FontRasterTaskData *)p_userdata;
+	FontFallback *fd = td->font_data;
+	while (true) {
+		// Lock for a single glyph at a time, to keep draw calls from other threads responsive.
+		MutexLock lock(fd->mutex);
+		if (fd->raster_queue.is_empty()) {
+			fd->raster_task_running = false;
+			break;
+		}
+		FontRasterRequest rq = fd->raster_queue.front()->get();
+		fd->raster_queue.pop_front();
+		if (!rq.from_char) {
+			fd->raster_pending.erase(Vector3i(rq.size.x, rq.size.y, rq.value));
+		}
+		if (!td->server->_ensure_cache_for_size(fd, rq.size)) {
+			continue;
+		}
+#ifdef MODULE_FREETYPE_ENABLED
+		FontForSizeFallback *ffsd = fd->cache[rq.size];
+		if (rq.from_char) {
+			if (ffsd->face) {
+				td->server->_ensure_glyph_variants(fd, rq.size, rq.value);
+			}
+		} else {
+			td->server->_ensure_glyph(fd, rq.size, rq.value);
+		}
+#endif
+	}
+	memdelete(td);
+}
+
 void TextServerFallback::_font_render_range(const RID &p_font_rid, const Vector2i &p_size, int64_t p_start, int64_t p_end) {
 	FontFallback *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
@@ -2389,23 +2590,7 @@ void TextServerFallback::_font_render_range(const RID &p_font_rid, const Vector2
 #ifdef MODULE_FREETYPE_ENABLED
 		int32_t idx = i;
 		if (fd->cache[size]->face) {
-			if (fd->msdf) {
-				_ensure_glyph(fd, size, (int32_t)idx);
-			} else {
-				for (int aa = 0; aa < ((fd->antialiasing == FONT_ANTIALIASING_LCD) ? FONT_LCD_SUBPIXEL_LAYOUT_MAX : 1); aa++) {
-					if ((fd->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_QUARTER) || (fd->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && size.x <= SUBPIXEL_POSITIONING_ONE_QUARTER_MAX_SIZE)) {
-						_ensure_glyph(fd, size, (int32_t)idx | (0 << 27) | (aa << 24));
-						_ensure_glyph(fd, size, (int32_t)idx | (1 << 27) | (aa << 24));
-						_ensure_glyph(fd, size, (int32_t)idx | (2 << 27) | (aa << 24));
-						_ensure_glyph(fd, size, (int32_t)idx | (3 << 27) | (aa << 24));
-					} else if ((fd->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_HALF) || (fd->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && size.x <= SUBPIXEL_POSITIONING_ONE_HALF_MAX_SIZE)) {
-						_ensure_glyph(fd, size, (int32_t)idx | (1 << 27) | (aa << 24));
-						_ensure_glyph(fd, size, (int32_t)idx | (0 << 27) | (aa << 24));
-					} else {
-						_ensure_glyph(fd, size, (int32_t)idx | (aa << 24));
-					}
-				}
-			}
+			_ensure_glyph_variants(fd, size, idx);
 		}
 #endif
 	}
@@ -2421,27 +2606,36 @@ void TextServerFallback::_font_render_glyph(const RID &p_font_rid, const Vector2
 #ifdef MODULE_FREETYPE_ENABLED
 	int32_t idx = p_index & 0xffffff; // Remove subpixel shifts.
 	if (fd->cache[size]->face) {
-		if (fd->msdf) {
-			_ensure_glyph(fd, size, (int32_t)idx);
-		} else {
-			for (int aa = 0; aa < ((fd->antialiasing == FONT_ANTIALIASING_LCD) ? FONT_LCD_SUBPIXEL_LAYOUT_MAX : 1); aa++) {
-				if ((fd->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_QUARTER) || (fd->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && size.x <= SUBPIXEL_POSITIONING_ONE_QUARTER_MAX_SIZE)) {
-					_ensure_glyph(fd, size, (int32_t)idx | (0 << 27) | (aa << 24));
-					_ensure_glyph(fd, size, (int32_t)idx | (1 << 27) | (aa << 24));
-					_ensure_glyph(fd, size, (int32_t)idx | (2 << 27) | (aa << 24));
-					_ensure_glyph(fd, size, (int32_t)idx | (3 << 27) | (aa << 24));
-				} else if ((fd->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_HALF) || (fd->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && size.x <= SUBPIXEL_POSITIONING_ONE_HALF_MAX_SIZE)) {
-					_ensure_glyph(fd, size, (int32_t)idx | (1 << 27) | (aa << 24));
-					_ensure_glyph(fd, size, (int32_t)idx | (0 << 27) | (aa << 24));
-				} else {
-					_ensure_glyph(fd, size, (int32_t)idx | (aa << 24));
-				}
-			}
-		}
+		_ensure_glyph_variants(fd, size, idx);
 	}
 #endif
 }
 
+void TextServerFallback::_font_prerender_characters(const RID &p_font_rid, const Vector2i &p_size, const String &p_characters) {
+	FontFallback *fd = _get_font_data(p_font_rid);
+	ERR_FAIL_NULL(fd);
+
+	MutexLock lock(fd->mutex);
+	Vector2i size = _get_size_outline(fd, p_size);
+	ERR_FAIL_COND(size.x <= 0);
+	for (int i = 0; i < p_characters.length(); i++) {
+		FontRasterRequest rq;
+		rq.size = size;
+		rq.value = p_characters[i];
+		rq.from_char = true;
+		fd->raster_queue.push_back(rq);
+	}
+	_font_start_rasterization(fd);
+}
+
+bool TextServerFallback::_font_is_prerendering(const RID &p_font_rid) const {
+	FontFallback *fd = _get_font_data(p_font_rid);
+	ERR_FAIL_NULL_V(fd, false);
+
+	MutexLock lock(fd->mutex);
+	return fd->raster_task_running;
+}
+
 void TextServerFallback::_font_draw_glyph(const RID &p_font_rid, const RID &p_canvas, int64_t p_size, const Vector2 &p_pos, int64_t p_index, const Color &p_color) const {
 	FontFallback *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
@@ -2474,6 +2668,9 @@ void TextServerFallback::_font_draw_glyph(const RID &p_font_rid, const RID &p_ca
 	}
 #endif
 
+	if (_font_defer_glyph(fd, size, index)) {
+		return; // Glyph is rasterized in the background, the canvas item is redrawn later.
+	}
 	if (!_ensure_glyph(fd, size, index)) {
 		return; // Invalid or non-graphical glyph, do not display errors, nothing to draw.
 	}
@@ -2490,19 +2687,7 @@ void TextServerFallback::_font_draw_glyph(const RID &p_font_rid, const RID &p_ca
 			}
 #endif
 			if (RenderingServer::get_singleton() != nullptr) {
-				if (fd->cache[size]->textures[gl.texture_idx].dirty) {
-					ShelfPackTexture &tex = fd->cache[size]->textures.write[gl.texture_idx];
-					Ref<Image> img = Image::create_from_data(tex.texture_w, tex.texture_h, false, tex.format, tex.imgdata);
-					if (fd->mipmaps) {
-						img->generate_mipmaps();
-					}
-					if (tex.texture.is_null()) {
-						tex.texture = ImageTexture::create_from_image(img);
-					} else {
-						tex.texture->update(img);
-					}
-					tex.dirty = false;
-				}
+				_update_texture(fd->cache[size]->textures.write[gl.texture_idx], fd->mipmaps);
 				RID texture = fd->cache[size]->textures[gl.texture_idx].texture->get_rid();
 				if (fd->msdf) {
 					Point2 cpos = p_pos;
@@ -2578,6 +2763,9 @@ void TextServerFallback::_font_draw_glyph_outline(const RID &p_font_rid, const R
 	}
 #endif
 
+	if (_font_defer_glyph(fd, size, index)) {
+		return; // Glyph is rasterized in the background, the canvas item is redrawn later.
+	}
 	if (!_ensure_glyph(fd, size, index)) {
 		return; // Invalid or non-graphical glyph, do not display errors, nothing to draw.
 	}
@@ -2594,19 +2782,7 @@ void TextServerFallback::_font_draw_glyph_outline(const RID &p_font_rid, const R
 			}
 #endif
 			if (RenderingServer::get_singleton() != nullptr) {
-				if (fd->cache[size]->textures[gl.texture_idx].dirty) {
-					ShelfPackTexture &tex = fd->cache[size]->textures.write[gl.texture_idx];
-					Ref<Image> img = Image::create_from_data(tex.texture_w, tex.texture_h, false, tex.format, tex.imgdata);
-					if (fd->mipmaps) {
-						img->generate_mipmaps();
-					}
-					if (tex.texture.is_null()) {
-						tex.texture = ImageTexture::create_from_image(img);
-					} else {
-						tex.texture->update(img);
-					}
-					tex.dirty = false;
-				}
+				_update_texture(fd->cache[size]->textures.write[gl.texture_idx], fd->mipmaps);
 				RID texture = fd->cache[size]->textures[gl.texture_idx].texture->get_rid();
 				if (fd->msdf) {
 					Point2 cpos = p_pos;
@@ -4360,6 +4536,13 @@ void TextServerFallback::_cleanup() {
 }
 
 TextServerFallback::~TextServerFallback() {
+	// Background rasterization tasks use the fonts and the FreeType library, wait for them first.
+	List<RID> fonts;
+	font_owner.get_owned_list(&fonts);
+	for (const RID &font : fonts) {
+		_font_stop_rasterization(font_owner.get_or_null(font));
+	}
+
 #ifdef MODULE_FREETYPE_ENABLED
 	if (ft_library != nullptr) {
 		FT_Done_FreeType(ft_library);
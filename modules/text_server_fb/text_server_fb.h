@@ -51,6 +51,7 @@
 #include <godot_cpp/variant/packed_string_array.hpp>
 #include <godot_cpp/variant/packed_vector2_array.hpp>
 #include <godot_cpp/variant/rect2.hpp>
+#include <godot_cpp/variant/rect2i.hpp>
 #include <godot_cpp/variant/rid.hpp>
 #include <godot_cpp/variant/string.hpp>
 #include <godot_cpp/variant/typed_array.hpp>
@@ -71,7 +72,9 @@
 
 #include <godot_cpp/templates/hash_map.hpp>
 #include <godot_cpp/templates/hash_set.hpp>
+#include <godot_cpp/templates/list.hpp>
 #include <godot_cpp/templates/rid_owner.hpp>
+#include <godot_cpp/templates/safe_refcount.hpp>
 #include <godot_cpp/templates/vector.hpp>
 
 using namespace godot;
@@ -83,6 +86,7 @@ using namespace godot;
 #include "core/object/worker_thread_pool.h"
 #include "core/templates/hash_map.h"
 #include "core/templates/rid_owner.h"
+#include "core/templates/safe_refcount.h"
 #include "scene/resources/image_texture.h"
 #include "servers/text/text_server_extension.h"
 
@@ -164,11 +168,37 @@ class TextServerFallback : public TextServerExtension {
 
 		Image::Format format;
 		PackedByteArray imgdata;
+		PackedByteArray mipmap_data; // Mipmaps past the base level, kept to regenerate them per region.
 		Ref<ImageTexture> texture;
-		bool dirty = true;
+		bool dirty = true; // The whole texture must be uploaded.
+		Vector<Rect2i> dirty_rects; // Regions changed since the last upload.
 
 		List<Shelf> shelves;
 
+		void mark_dirty(const Rect2i &p_rect) {
+			if (!p_rect.has_area()) {
+				return;
+			}
+			// Glyphs are packed next to each other on shelves, so neighbors can usually be merged without uploading much unchanged area.
+			for (int i = 0; i < dirty_rects.size(); i++) {
+				Rect2i merged = dirty_rects[i].merge(p_rect);
+				if (merged.get_area() <= (dirty_rects[i].get_area() + p_rect.get_area()) * 2) {
+					dirty_rects.write[i] = merged;
+					return;
+				}
+			}
+			if (dirty_rects.size() < 16) {
+				dirty_rects.push_back(p_rect);
+			} else {
+				Rect2i merged = p_rect;
+				for (const Rect2i &E : dirty_rects) {
+					merged = merged.merge(E);
+				}
+				dirty_rects.clear();
+				dirty_rects.push_back(merged);
+			}
+		}
+
 		FontTexturePosition pack_rect(int32_t p_id, int32_t p_h, int32_t p_w) {
 			int32_t y = 0;
 			int32_t waste = 0;
@@ -250,6 +280,12 @@ class TextServerFallback : public TextServerExtension {
 		int extra_spacing[4] = { 0, 0, 0, 0 };
 	};
 
+	struct FontRasterRequest {
+		Vector2i size;
+		int32_t value = 0; // Glyph index, or character code if "from_char" is set.
+		bool from_char = false;
+	};
+
 	struct FontFallback {
 		Mutex mutex;
 
@@ -278,6 +314,12 @@ class TextServerFallback : public TextServerExtension {
 
 		HashMap<Vector2i, FontForSizeFallback *, VariantHasher, VariantComparator> cache;
 
+		// Background rasterization state, guarded by "mutex".
+		List<FontRasterRequest> raster_queue;
+		HashSet<Vector3i> raster_pending; // Glyphs deferred by draw calls, as (size, outline, index).
+		int64_t raster_task = -1;
+		bool raster_task_running = false;
+
 		bool face_init = false;
 		Dictionary supported_varaitions;
 		Dictionary feature_overrides;
@@ -299,6 +341,8 @@ class TextServerFallback : public TextServerExtension {
 		}
 	};
 
+	void _update_texture(ShelfPackTexture &p_tex, bool p_mipmaps) const;
+	void _update_texture_region(const RID &p_texture, Image::Format p_format, const uint8_t *p_data, int p_width, int p_color_size, const Rect2i &p_rect, int p_mipmap) const;
 	_FORCE_INLINE_ FontTexturePosition find_texture_pos_for_glyph(FontForSizeFallback *p_data, int p_color_size, Image::Format p_image_format, int p_width, int p_height, bool p_msdf) const;
 #ifdef MODULE_MSDFGEN_ENABLED
 	_FORCE_INLINE_ FontGlyph rasterize_msdf(FontFallback *p_font_data, FontForSizeFallback *p_data, int p_pixel_range, int p_rect_margin, FT_Outline *outline, const Vector2 &advance) const;
@@ -309,6 +353,17 @@ class TextServerFallback : public TextServerExtension {
 	_FORCE_INLINE_ bool _ensure_glyph(FontFallback *p_font_data, const Vector2i &p_size, int32_t p_glyph) const;
 	_FORCE_INLINE_ bool _ensure_cache_for_size(FontFallback *p_font_data, const Vector2i &p_size) const;
 	_FORCE_INLINE_ void _font_clear_cache(FontFallback *p_font_data);
+	_FORCE_INLINE_ void _ensure_glyph_variants(FontFallback *p_font_data, const Vector2i &p_size, int32_t p_index) const;
+
+	struct FontRasterTaskData {
+		const TextServerFallback *server = nullptr;
+		FontFallback *font_data = nullptr;
+	};
+
+	void _font_start_rasterization(FontFallback *p_font_data) const;
+	void _font_stop_rasterization(FontFallback *p_font_data) const;
+	bool _font_defer_glyph(FontFallback *p_font_data, const Vector2i &p_size, int32_t p_index) const;
+	static void _font_rasterization_task(void *p_userdata);
 	static void _generateMTSDF_threaded(void *p_td, uint32_t p_y);
 
 	_FORCE_INLINE_ Vector2i _get_size(const FontFallback *p_font_data, int p_size) const {
@@ -558,6 +613,10 @@ class TextServerFallback : public TextServerExtension {
 
 	Mutex ft_mutex;
 
+	SafeFlag async_rasterization;
+	// Counted per thread, so a drawing thread only sees the glyphs it skipped itself.
+	static thread_local uint64_t deferred_glyph_draws;
+
 protected:
 	static void _bind_methods(){};
 
@@ -579,6 +638,10 @@ public:
 
 	MODBIND1RC(bool, is_locale_right_to_left, const String &);
 
+	MODBIND1(set_async_glyph_rasterization, bool);
+	MODBIND0RC(bool, is_async_glyph_rasterization);
+	MODBIND0RC(int64_t, get_deferred_glyph_count);
+
 	MODBIND1RC(int64_t, name_to_tag, const String &);
 	MODBIND1RC(String, tag_to_name, int64_t);
 
@@ -727,6 +790,9 @@ public:
 	MODBIND4(font_render_range, const RID &, const Vector2i &, int64_t, int64_t);
 	MODBIND3(font_render_glyph, const RID &, const Vector2i &, int64_t);
 
+	MODBIND3(font_prerender_characters, const RID &, const Vector2i &, const String &);
+	MODBIND1RC(bool, font_is_prerendering, const RID &);
+
 	MODBIND6C(font_draw_glyph, const RID &, const RID &, int64_t, const Vector2 &, int64_t, const Color &);
 	MODBIND7C(font_draw_glyph_outline, const RID &, const RID &, int64_t, int64_t, const Vector2 &, int64_t, const Color &);
 
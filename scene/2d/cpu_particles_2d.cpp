@@ -30,6 +30,7 @@
 
 #include "cpu_particles_2d.h"
 
+#include "core/object/worker_thread_pool.h"
 #include "scene/2d/gpu_particles_2d.h"
 #include "scene/resources/atlas_texture.h"
 #include "scene/resources/curve_texture.h"
@@ -339,8 +340,17 @@ static void _adjust_curve_range(const Ref<Curve> &p_curve, real_t p_min, real_t
 void CPUParticles2D::set_param_curve(Parameter p_param, const Ref<Curve> &p_curve) {
 	ERR_FAIL_INDEX(p_param, PARAM_MAX);
 
+	if (curve_parameters[p_param].is_valid()) {
+		curve_parameters[p_param]->disconnect_changed(callable_mp(this, &CPUParticles2D::_lut_source_changed));
+	}
+
 	curve_parameters[p_param] = p_curve;
 
+	if (p_curve.is_valid()) {
+		p_curve->connect_changed(callable_mp(this, &CPUParticles2D::_lut_source_changed), CONNECT_REFERENCE_COUNTED);
+	}
+	luts_dirty = true;
+
 	switch (p_param) {
 		case PARAM_INITIAL_LINEAR_VELOCITY: {
 			//do none for this one
@@ -398,7 +408,16 @@ Color CPUParticles2D::get_color() const {
 }
 
 void CPUParticles2D::set_color_ramp(const Ref<Gradient> &p_ramp) {
+	if (color_ramp.is_valid()) {
+		color_ramp->disconnect_changed(callable_mp(this, &CPUParticles2D::_lut_source_changed));
+	}
+
 	color_ramp = p_ramp;
+
+	if (color_ramp.is_valid()) {
+		color_ramp->connect_changed(callable_mp(this, &CPUParticles2D::_lut_source_changed), CONNECT_REFERENCE_COUNTED);
+	}
+	luts_dirty = true;
 }
 
 Ref<Gradient> CPUParticles2D::get_color_ramp() const {
@@ -482,11 +501,29 @@ Vector2 CPUParticles2D::get_gravity() const {
 }
 
 void CPUParticles2D::set_scale_curve_x(Ref<Curve> p_scale_curve) {
+	if (scale_curve_x.is_valid()) {
+		scale_curve_x->disconnect_changed(callable_mp(this, &CPUParticles2D::_lut_source_changed));
+	}
+
 	scale_curve_x = p_scale_curve;
+
+	if (scale_curve_x.is_valid()) {
+		scale_curve_x->connect_changed(callable_mp(this, &CPUParticles2D::_lut_source_changed), CONNECT_REFERENCE_COUNTED);
+	}
+	luts_dirty = true;
 }
 
 void CPUParticles2D::set_scale_curve_y(Ref<Curve> p_scale_curve) {
+	if (scale_curve_y.is_valid()) {
+		scale_curve_y->disconnect_changed(callable_mp(this, &CPUParticles2D::_lut_source_changed));
+	}
+
 	scale_curve_y = p_scale_curve;
+
+	if (scale_curve_y.is_valid()) {
+		scale_curve_y->connect_changed(callable_mp(this, &CPUParticles2D::_lut_source_changed), CONNECT_REFERENCE_COUNTED);
+	}
+	luts_dirty = true;
 }
 
 void CPUParticles2D::set_split_scale(bool p_split_scale) {
@@ -645,11 +682,20 @@ void CPUParticles2D::_particles_process(double p_delta) {
 		velocity_xform[2] = Vector2();
 	}
 
+	if (luts_dirty) {
+		_update_luts();
+	}
+
 	double system_phase = time / lifetime;
 
+	particle_steps.resize(pcount);
+	ParticleStep *steps = particle_steps.ptr();
+
 	bool should_be_active = false;
 	for (int i = 0; i < pcount; i++) {
 		Particle &p = parray[i];
+		ParticleStep &step = steps[i];
+		step.state = STEP_SKIP;
 
 		if (!emitting && !p.active) {
 			continue;
@@ -716,18 +762,18 @@ void CPUParticles2D::_particles_process(double p_delta) {
 			p.active = true;
 
 			/*real_t tex_linear_velocity = 0;
-			if (curve_parameters[PARAM_INITIAL_LINEAR_VELOCITY].is_valid()) {
-				tex_linear_velocity = curve_parameters[PARAM_INITIAL_LINEAR_VELOCITY]->sample(0);
+			if (curve_luts[PARAM_INITIAL_LINEAR_VELOCITY].is_valid()) {
+				tex_linear_velocity = curve_luts[PARAM_INITIAL_LINEAR_VELOCITY].sample(0);
 			}*/
 
 			real_t tex_angle = 1.0;
-			if (curve_parameters[PARAM_ANGLE].is_valid()) {
-				tex_angle = curve_parameters[PARAM_ANGLE]->sample(tv);
+			if (curve_luts[PARAM_ANGLE].is_valid()) {
+				tex_angle = curve_luts[PARAM_ANGLE].sample(tv);
 			}
 
 			real_t tex_anim_offset = 1.0;
-			if (curve_parameters[PARAM_ANGLE].is_valid()) {
-				tex_anim_offset = curve_parameters[PARAM_ANGLE]->sample(tv);
+			if (curve_luts[PARAM_ANGLE].is_valid()) {
+				tex_anim_offset = curve_luts[PARAM_ANGLE].sample(tv);
 			}
 
 			p.seed = Math::rand();
@@ -809,12 +855,61 @@ void CPUParticles2D::_particles_process(double p_delta) {
 				p.transform = emission_xform * p.transform;
 			}
 
+			step.state = STEP_FINISH;
 		} else if (!p.active) {
 			continue;
 		} else if (p.time > p.lifetime) {
 			p.active = false;
 			tv = 1.0;
+			step.state = STEP_FINISH;
+		} else {
+			step.state = STEP_SIMULATE;
+		}
+
+		step.delta = local_delta;
+		step.tv = tv;
+		should_be_active = true;
+	}
+
+	if (should_be_active) {
+		ProcessChunkData chunk_data;
+		chunk_data.particles = parray;
+		chunk_data.emission_origin = emission_xform[2];
+		int chunk_count = (pcount + PARALLEL_CHUNK_SIZE - 1) / PARALLEL_CHUNK_SIZE;
+		if (_use_threads(pcount)) {
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &CPUParticles2D::_particles_process_chunk, chunk_data, chunk_count, -1, true, SNAME("CPUParticles2DProcess"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 		} else {
+			for (int i = 0; i < chunk_count; i++) {
+				_particles_process_chunk(i, chunk_data);
+			}
+		}
+	}
+
+	if (!Math::is_equal_approx(time, 0.0) && active && !should_be_active) {
+		active = false;
+		emit_signal(SceneStringNames::get_singleton()->finished);
+	}
+}
+
+void CPUParticles2D::_particles_process_chunk(uint32_t p_chunk, ProcessChunkData p_data) {
+	int from = p_chunk * PARALLEL_CHUNK_SIZE;
+	int to = MIN(from + PARALLEL_CHUNK_SIZE, particles.size());
+
+	Particle *parray = p_data.particles;
+	const ParticleStep *steps = particle_steps.ptr();
+
+	for (int i = from; i < to; i++) {
+		const ParticleStep &step = steps[i];
+		if (step.state == STEP_SKIP) {
+			continue;
+		}
+
+		Particle &p = parray[i];
+		double local_delta = step.delta;
+		float tv = step.tv;
+
+		if (step.state == STEP_SIMULATE) {
 			uint32_t alt_seed = p.seed;
 
 			p.time += local_delta;
@@ -822,52 +917,52 @@ void CPUParticles2D::_particles_process(double p_delta) {
 			tv = p.time / p.lifetime;
 
 			real_t tex_linear_velocity = 1.0;
-			if (curve_parameters[PARAM_INITIAL_LINEAR_VELOCITY].is_valid()) {
-				tex_linear_velocity = curve_parameters[PARAM_INITIAL_LINEAR_VELOCITY]->sample(tv);
+			if (curve_luts[PARAM_INITIAL_LINEAR_VELOCITY].is_valid()) {
+				tex_linear_velocity = curve_luts[PARAM_INITIAL_LINEAR_VELOCITY].sample(tv);
 			}
 
 			real_t tex_orbit_velocity = 1.0;
-			if (curve_parameters[PARAM_ORBIT_VELOCITY].is_valid()) {
-				tex_orbit_velocity = curve_parameters[PARAM_ORBIT_VELOCITY]->sample(tv);
+			if (curve_luts[PARAM_ORBIT_VELOCITY].is_valid()) {
+				tex_orbit_velocity = curve_luts[PARAM_ORBIT_VELOCITY].sample(tv);
 			}
 
 			real_t tex_angular_velocity = 1.0;
-			if (curve_parameters[PARAM_ANGULAR_VELOCITY].is_valid()) {
-				tex_angular_velocity = curve_parameters[PARAM_ANGULAR_VELOCITY]->sample(tv);
+			if (curve_luts[PARAM_ANGULAR_VELOCITY].is_valid()) {
+				tex_angular_velocity = curve_luts[PARAM_ANGULAR_VELOCITY].sample(tv);
 			}
 
 			real_t tex_linear_accel = 1.0;
-			if (curve_parameters[PARAM_LINEAR_ACCEL].is_valid()) {
-				tex_linear_accel = curve_parameters[PARAM_LINEAR_ACCEL]->sample(tv);
+			if (curve_luts[PARAM_LINEAR_ACCEL].is_valid()) {
+				tex_linear_accel = curve_luts[PARAM_LINEAR_ACCEL].sample(tv);
 			}
 
 			real_t tex_tangential_accel = 1.0;
-			if (curve_parameters[PARAM_TANGENTIAL_ACCEL].is_valid()) {
-				tex_tangential_accel = curve_parameters[PARAM_TANGENTIAL_ACCEL]->sample(tv);
+			if (curve_luts[PARAM_TANGENTIAL_ACCEL].is_valid()) {
+				tex_tangential_accel = curve_luts[PARAM_TANGENTIAL_ACCEL].sample(tv);
 			}
 
 			real_t tex_radial_accel = 1.0;
-			if (curve_parameters[PARAM_RADIAL_ACCEL].is_valid()) {
-				tex_radial_accel = curve_parameters[PARAM_RADIAL_ACCEL]->sample(tv);
+			if (curve_luts[PARAM_RADIAL_ACCEL].is_valid()) {
+				tex_radial_accel = curve_luts[PARAM_RADIAL_ACCEL].sample(tv);
 			}
 
 			real_t tex_damping = 1.0;
-			if (curve_parameters[PARAM_DAMPING].is_valid()) {
-				tex_damping = curve_parameters[PARAM_DAMPING]->sample(tv);
+			if (curve_luts[PARAM_DAMPING].is_valid()) {
+				tex_damping = curve_luts[PARAM_DAMPING].sample(tv);
 			}
 
 			real_t tex_angle = 1.0;
-			if (curve_parameters[PARAM_ANGLE].is_valid()) {
-				tex_angle = curve_parameters[PARAM_ANGLE]->sample(tv);
+			if (curve_luts[PARAM_ANGLE].is_valid()) {
+				tex_angle = curve_luts[PARAM_ANGLE].sample(tv);
 			}
 			real_t tex_anim_speed = 1.0;
-			if (curve_parameters[PARAM_ANIM_SPEED].is_valid()) {
-				tex_anim_speed = curve_parameters[PARAM_ANIM_SPEED]->sample(tv);
+			if (curve_luts[PARAM_ANIM_SPEED].is_valid()) {
+				tex_anim_speed = curve_luts[PARAM_ANIM_SPEED].sample(tv);
 			}
 
 			real_t tex_anim_offset = 1.0;
-			if (curve_parameters[PARAM_ANIM_OFFSET].is_valid()) {
-				tex_anim_offset = curve_parameters[PARAM_ANIM_OFFSET]->sample(tv);
+			if (curve_luts[PARAM_ANIM_OFFSET].is_valid()) {
+				tex_anim_offset = curve_luts[PARAM_ANIM_OFFSET].sample(tv);
 			}
 
 			Vector2 force = gravity;
@@ -876,7 +971,7 @@ void CPUParticles2D::_particles_process(double p_delta) {
 			//apply linear acceleration
 			force += p.velocity.length() > 0.0 ? p.velocity.normalized() * tex_linear_accel * Math::lerp(parameters_min[PARAM_LINEAR_ACCEL], parameters_max[PARAM_LINEAR_ACCEL], rand_from_seed(alt_seed)) : Vector2();
 			//apply radial acceleration
-			Vector2 org = emission_xform[2];
+			Vector2 org = p_data.emission_origin;
 			Vector2 diff = pos - org;
 			force += diff.length() > 0.0 ? diff.normalized() * (tex_radial_accel)*Math::lerp(parameters_min[PARAM_RADIAL_ACCEL], parameters_max[PARAM_RADIAL_ACCEL], rand_from_seed(alt_seed)) : Vector2();
 			//apply tangential acceleration;
@@ -894,7 +989,7 @@ void CPUParticles2D::_particles_process(double p_delta) {
 				p.transform[2] -= diff;
 				p.transform[2] += rot.basis_xform(diff);
 			}
-			if (curve_parameters[PARAM_INITIAL_LINEAR_VELOCITY].is_valid()) {
+			if (curve_luts[PARAM_INITIAL_LINEAR_VELOCITY].is_valid()) {
 				p.velocity = p.velocity.normalized() * tex_linear_velocity;
 			}
 
@@ -918,27 +1013,27 @@ void CPUParticles2D::_particles_process(double p_delta) {
 
 		Vector2 tex_scale = Vector2(1.0, 1.0);
 		if (split_scale) {
-			if (scale_curve_x.is_valid()) {
-				tex_scale.x = scale_curve_x->sample(tv);
+			if (scale_x_lut.is_valid()) {
+				tex_scale.x = scale_x_lut.sample(tv);
 			} else {
 				tex_scale.x = 1.0;
 			}
-			if (scale_curve_y.is_valid()) {
-				tex_scale.y = scale_curve_y->sample(tv);
+			if (scale_y_lut.is_valid()) {
+				tex_scale.y = scale_y_lut.sample(tv);
 			} else {
 				tex_scale.y = 1.0;
 			}
 		} else {
-			if (curve_parameters[PARAM_SCALE].is_valid()) {
-				real_t tmp_scale = curve_parameters[PARAM_SCALE]->sample(tv);
+			if (curve_luts[PARAM_SCALE].is_valid()) {
+				real_t tmp_scale = curve_luts[PARAM_SCALE].sample(tv);
 				tex_scale.x = tmp_scale;
 				tex_scale.y = tmp_scale;
 			}
 		}
 
 		real_t tex_hue_variation = 0.0;
-		if (curve_parameters[PARAM_HUE_VARIATION].is_valid()) {
-			tex_hue_variation = curve_parameters[PARAM_HUE_VARIATION]->sample(tv);
+		if (curve_luts[PARAM_HUE_VARIATION].is_valid()) {
+			tex_hue_variation = curve_luts[PARAM_HUE_VARIATION].sample(tv);
 		}
 
 		real_t hue_rot_angle = (tex_hue_variation)*Math_TAU * Math::lerp(parameters_min[PARAM_HUE_VARIATION], parameters_max[PARAM_HUE_VARIATION], p.hue_rot_rand);
@@ -956,8 +1051,8 @@ void CPUParticles2D::_particles_process(double p_delta) {
 			}
 		}
 
-		if (color_ramp.is_valid()) {
-			p.color = color_ramp->get_color_at_offset(tv) * color;
+		if (color_ramp_lut.is_valid()) {
+			p.color = color_ramp_lut.sample(tv) * color;
 		} else {
 			p.color = color;
 		}
@@ -992,15 +1087,14 @@ void CPUParticles2D::_particles_process(double p_delta) {
 		p.transform.columns[1] *= base_scale.y;
 
 		p.transform[2] += p.velocity * local_delta;
-
-		should_be_active = true;
-	}
-	if (!Math::is_equal_approx(time, 0.0) && active && !should_be_active) {
-		active = false;
-		emit_signal(SceneStringNames::get_singleton()->finished);
 	}
 }
 
+bool CPUParticles2D::_use_threads(int p_particle_count) const {
+	// Nested group tasks could starve the pool when this node is processed from a worker thread (threaded process groups).
+	return p_particle_count >= PARALLEL_MIN_PARTICLES && Thread::is_main_thread();
+}
+
 void CPUParticles2D::_update_particle_data_buffer() {
 	MutexLock lock(update_mutex);
 
@@ -1009,9 +1103,7 @@ void CPUParticles2D::_update_particle_data_buffer() {
 	int *ow;
 	int *order = nullptr;
 
-	float *w = particle_data.ptrw();
 	const Particle *r = particles.ptr();
-	float *ptr = w;
 
 	if (draw_order != DRAW_ORDER_INDEX) {
 		ow = particle_order.ptrw();
@@ -1027,8 +1119,32 @@ void CPUParticles2D::_update_particle_data_buffer() {
 		}
 	}
 
-	for (int i = 0; i < pc; i++) {
-		int idx = order ? order[i] : i;
+	// The buffer is shared with the rendering server, so writing may copy it. Do it once here.
+	BufferChunkData chunk_data;
+	chunk_data.order = order;
+	chunk_data.data = particle_data.ptrw();
+
+	int chunk_count = (pc + PARALLEL_CHUNK_SIZE - 1) / PARALLEL_CHUNK_SIZE;
+	if (_use_threads(pc)) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &CPUParticles2D::_update_particle_data_chunk, chunk_data, chunk_count, -1, true, SNAME("CPUParticles2DUpdateBuffer"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (int i = 0; i < chunk_count; i++) {
+			_update_particle_data_chunk(i, chunk_data);
+		}
+	}
+}
+
+void CPUParticles2D::_update_particle_data_chunk(uint32_t p_chunk, BufferChunkData p_data) {
+	int from = p_chunk * PARALLEL_CHUNK_SIZE;
+	int to = MIN(from + PARALLEL_CHUNK_SIZE, particles.size());
+
+	const Particle *r = particles.ptr();
+	// Each chunk owns its own range of the buffer, so threads never write the same instance.
+	float *ptr = p_data.data + from * 16;
+
+	for (int i = from; i < to; i++) {
+		int idx = p_data.order ? p_data.order[i] : i;
 
 		Transform2D t = r[idx].transform;
 
@@ -1066,6 +1182,87 @@ void CPUParticles2D::_update_particle_data_buffer() {
 	}
 }
 
+void CPUParticles2D::CurveLUT::bake(const Ref<Curve> &p_curve) {
+	if (p_curve.is_null()) {
+		values.clear();
+		return;
+	}
+	// Copy the curve's own baked points, so sampling matches Curve::sample_baked().
+	int resolution = p_curve->get_bake_resolution();
+	values.resize(resolution);
+	for (int i = 0; i < resolution; i++) {
+		values[i] = p_curve->sample_baked(resolution > 1 ? real_t(i) / (resolution - 1) : 0.0);
+	}
+}
+
+void CPUParticles2D::GradientLUT::bake(const Ref<Gradient> &p_gradient) {
+	if (p_gradient.is_null()) {
+		colors.clear();
+		return;
+	}
+	offsets.clear();
+	if (p_gradient->get_interpolation_mode() == Gradient::GRADIENT_INTERPOLATE_CONSTANT && p_gradient->get_point_count() > 0) {
+		struct SortPoint {
+			float offset = 0.0;
+			Color color;
+
+			bool operator<(const SortPoint &p_other) const {
+				return offset < p_other.offset;
+			}
+		};
+
+		LocalVector<SortPoint> points;
+		points.resize(p_gradient->get_point_count());
+		for (uint32_t i = 0; i < points.size(); i++) {
+			points[i].offset = p_gradient->get_offset(i);
+			points[i].color = p_gradient->get_color(i);
+		}
+		points.sort();
+
+		offsets.resize(points.size());
+		colors.resize(points.size());
+		for (uint32_t i = 0; i < points.size(); i++) {
+			offsets[i] = points[i].offset;
+			colors[i] = points[i].color;
+		}
+		return;
+	}
+
+	colors.resize(SIZE);
+	for (int i = 0; i < SIZE; i++) {
+		colors[i] = p_gradient->get_color_at_offset(float(i) / (SIZE - 1));
+	}
+}
+
+Color CPUParticles2D::GradientLUT::_sample_constant(real_t p_offset) const {
+	// Color of the last point at or before the offset, as in Gradient::get_color_at_offset().
+	int low = 0;
+	int high = offsets.size();
+	while (low < high) {
+		int middle = (low + high) / 2;
+		if (offsets[middle] > p_offset) {
+			high = middle;
+		} else {
+			low = middle + 1;
+		}
+	}
+	return colors[MAX(low - 1, 0)];
+}
+
+void CPUParticles2D::_lut_source_changed() {
+	luts_dirty = true;
+}
+
+void CPUParticles2D::_update_luts() {
+	for (int i = 0; i < PARAM_MAX; i++) {
+		curve_luts[i].bake(curve_parameters[i]);
+	}
+	scale_x_lut.bake(scale_curve_x);
+	scale_y_lut.bake(scale_curve_y);
+	color_ramp_lut.bake(color_ramp);
+	luts_dirty = false;
+}
+
 void CPUParticles2D::_set_do_redraw(bool p_do_redraw) {
 	if (do_redraw == p_do_redraw) {
 		return;
@@ -76,6 +76,55 @@ public:
 		EMISSION_SHAPE_MAX
 	};
 
+public:
+	// Curves and gradients baked for the simulation pass, so worker threads never touch the resources
+	// (Gradient sorts its points lazily when sampled).
+	struct CurveLUT {
+		LocalVector<real_t> values; // Empty when there is no curve.
+
+		void bake(const Ref<Curve> &p_curve);
+		_FORCE_INLINE_ bool is_valid() const { return !values.is_empty(); }
+		// Same lookup as Curve::sample_baked(), over a copy of the curve's baked points.
+		_FORCE_INLINE_ real_t sample(real_t p_offset) const {
+			if (values.size() == 1) {
+				return values[0];
+			}
+			real_t fi = p_offset * (values.size() - 1);
+			int i = Math::floor(fi);
+			if (i < 0) {
+				return values[0];
+			} else if (i >= (int)values.size() - 1) {
+				return values[values.size() - 1];
+			}
+			return Math::lerp(values[i], values[i + 1], fi - i);
+		}
+	};
+
+	struct GradientLUT {
+		enum {
+			SIZE = 256,
+		};
+
+		LocalVector<Color> colors; // Empty when there is no gradient.
+		// Gradients with constant interpolation keep their sorted points instead, and are sampled
+		// exactly, as interpolating between table entries would blur their steps.
+		LocalVector<float> offsets;
+
+		void bake(const Ref<Gradient> &p_gradient);
+		_FORCE_INLINE_ bool is_valid() const { return !colors.is_empty(); }
+		_FORCE_INLINE_ Color sample(real_t p_offset) const {
+			if (!offsets.is_empty()) {
+				return _sample_constant(p_offset);
+			}
+			real_t pos = CLAMP(p_offset, (real_t)0.0, (real_t)1.0) * (SIZE - 1);
+			int idx = MIN(int(pos), SIZE - 2);
+			return colors[idx].lerp(colors[idx + 1], pos - idx);
+		}
+
+	private:
+		Color _sample_constant(real_t p_offset) const;
+	};
+
 private:
 	bool emitting = false;
 	bool active = false;
@@ -111,6 +160,45 @@ private:
 	Vector<float> particle_data;
 	Vector<int> particle_order;
 
+	// What the simulation pass has to do with each particle, decided on the calling thread
+	// (emission draws from the global random generator, which isn't thread-safe).
+	enum StepState : uint8_t {
+		STEP_SKIP,
+		STEP_SIMULATE,
+		STEP_FINISH, // Just emitted or just expired, only color and transform are updated.
+	};
+
+	struct ParticleStep {
+		double delta = 0.0;
+		float tv = 0.0;
+		StepState state = STEP_SKIP;
+	};
+
+	LocalVector<ParticleStep> particle_steps;
+
+	enum {
+		PARALLEL_CHUNK_SIZE = 256, // Particles processed by each group task element.
+		PARALLEL_MIN_PARTICLES = 1024, // Below this, dispatching to the thread pool costs more than it saves.
+	};
+
+	// Passed to the chunk tasks, so the shared buffers are made writable once on the calling thread
+	// rather than by each worker, which could copy them on write.
+	struct ProcessChunkData {
+		Particle *particles = nullptr;
+		Vector2 emission_origin;
+	};
+
+	struct BufferChunkData {
+		const int *order = nullptr;
+		float *data = nullptr;
+	};
+
+	CurveLUT curve_luts[PARAM_MAX];
+	CurveLUT scale_x_lut;
+	CurveLUT scale_y_lut;
+	GradientLUT color_ramp_lut;
+	bool luts_dirty = true;
+
 	struct SortLifetime {
 		const Particle *particles = nullptr;
 
@@ -178,7 +266,13 @@ private:
 
 	void _update_internal();
 	void _particles_process(double p_delta);
+	void _particles_process_chunk(uint32_t p_chunk, ProcessChunkData p_data);
 	void _update_particle_data_buffer();
+	void _update_particle_data_chunk(uint32_t p_chunk, BufferChunkData p_data);
+	bool _use_threads(int p_particle_count) const;
+
+	void _lut_source_changed();
+	void _update_luts();
 
 	Mutex update_mutex;
 
@@ -136,7 +136,7 @@ void Node2D::_update_transform() {
 	transform.set_rotation_scale_and_skew(rotation, scale, skew);
 	transform.columns[2] = position;
 
-	RenderingServer::get_singleton()->canvas_item_set_transform(get_canvas_item(), transform);
+	_queue_canvas_item_transform();
 
 	_notify_transform();
 }
@@ -372,7 +372,7 @@ void Node2D::set_transform(const Transform2D &p_transform) {
 	transform = p_transform;
 	_set_xform_dirty(true);
 
-	RenderingServer::get_singleton()->canvas_item_set_transform(get_canvas_item(), transform);
+	_queue_canvas_item_transform();
 
 	_notify_transform();
 }
@@ -33,6 +33,7 @@
 
 #include "core/core_string_names.h"
 #include "core/io/marshalls.h"
+#include "core/math/geometry_2d.h"
 #include "scene/resources/world_2d.h"
 #ifdef DEBUG_ENABLED
 /////////////////////////////// Debug //////////////////////////////////////////
@@ -229,8 +230,7 @@ void TileMapLayer::_rendering_update() {
 	// Free all quadrants.
 	if (forced_cleanup || quandrant_shape_changed) {
 		for (const KeyValue<Vector2i, Ref<RenderingQuadrant>> &kv : rendering_quadrant_map) {
-			for (int i = 0; i < kv.value->canvas_items.size(); i++) {
-				const RID &ci = kv.value->canvas_items[i];
+			for (const RID &ci : kv.value->canvas_items) {
 				if (ci.is_valid()) {
 					rs->free(ci);
 				}
@@ -238,10 +238,21 @@ void TileMapLayer::_rendering_update() {
 			kv.value->cells.clear();
 		}
 		rendering_quadrant_map.clear();
+		rendering_quadrant_order.clear();
 		_rendering_was_cleaned_up = true;
 	}
 
 	if (!forced_cleanup) {
+		// The tile shape might have changed, and with it the quadrants local coords.
+		if (dirty.flags[DIRTY_FLAGS_TILE_MAP_TILE_SET]) {
+			rendering_quadrant_order.clear();
+			for (KeyValue<Vector2i, Ref<RenderingQuadrant>> &kv : rendering_quadrant_map) {
+				kv.value->local_coords = tile_map_node->map_to_local(kv.value->quadrant_coords);
+				rendering_quadrant_order[kv.value->local_coords] = kv.value;
+			}
+			_rendering_quadrant_order_dirty = true;
+		}
+
 		// List all quadrants to update, recreating them if needed.
 		if (dirty.flags[DIRTY_FLAGS_TILE_MAP_TILE_SET] || _rendering_was_cleaned_up) {
 			// Update all cells.
@@ -276,11 +287,11 @@ void TileMapLayer::_rendering_update() {
 			if (has_a_tile) {
 				// Process the quadrant.
 
-				// First, clear the quadrant's canvas items.
-				for (RID &ci : rendering_quadrant->canvas_items) {
-					rs->free(ci);
+				// First, clear the quadrant's canvas items. They are reused in order, so that they keep their draw index.
+				for (const RID &ci : rendering_quadrant->canvas_items) {
+					rs->canvas_item_clear(ci);
 				}
-				rendering_quadrant->canvas_items.clear();
+				uint32_t used_canvas_items = 0;
 
 				// Sort the quadrant cells.
 				if (tile_map_node->is_y_sort_enabled() && is_y_sort_enabled()) {
@@ -318,25 +329,32 @@ void TileMapLayer::_rendering_update() {
 
 					// Check if the material or the z_index changed.
 					if (prev_ci == RID() || prev_material != mat || prev_z_index != tile_z_index) {
-						// If so, create a new CanvasItem.
-						ci = rs->canvas_item_create();
-						if (mat.is_valid()) {
-							rs->canvas_item_set_material(ci, mat->get_rid());
-						}
-						rs->canvas_item_set_parent(ci, canvas_item);
-						rs->canvas_item_set_use_parent_material(ci, tile_map_node->get_use_parent_material() || tile_map_node->get_material().is_valid());
+						// If so, switch to the next CanvasItem, creating it if needed.
+						if (used_canvas_items < rendering_quadrant->canvas_items.size()) {
+							ci = rendering_quadrant->canvas_items[used_canvas_items];
+						} else {
+							ci = rs->canvas_item_create();
+							rs->canvas_item_set_parent(ci, canvas_item);
+							rs->canvas_item_set_use_parent_material(ci, tile_map_node->get_use_parent_material() || tile_map_node->get_material().is_valid());
 
-						Transform2D xform(0, rendering_quadrant->canvas_items_position);
-						rs->canvas_item_set_transform(ci, xform);
+							Transform2D xform(0, rendering_quadrant->canvas_items_position);
+							rs->canvas_item_set_transform(ci, xform);
 
-						rs->canvas_item_set_light_mask(ci, tile_map_node->get_light_mask());
-						rs->canvas_item_set_z_as_relative_to_parent(ci, true);
-						rs->canvas_item_set_z_index(ci, tile_z_index);
+							rs->canvas_item_set_light_mask(ci, tile_map_node->get_light_mask());
+							rs->canvas_item_set_z_as_relative_to_parent(ci, true);
 
-						rs->canvas_item_set_default_texture_filter(ci, RS::CanvasItemTextureFilter(tile_map_node->get_texture_filter_in_tree()));
-						rs->canvas_item_set_default_texture_repeat(ci, RS::CanvasItemTextureRepeat(tile_map_node->get_texture_repeat_in_tree()));
+							rs->canvas_item_set_default_texture_filter(ci, RS::CanvasItemTextureFilter(tile_map_node->get_texture_filter_in_tree()));
+							rs->canvas_item_set_default_texture_repeat(ci, RS::CanvasItemTextureRepeat(tile_map_node->get_texture_repeat_in_tree()));
 
-						rendering_quadrant->canvas_items.push_back(ci);
+							rendering_quadrant->canvas_items.push_back(ci);
+
+							// New canvas items need a draw index.
+							_rendering_quadrant_order_dirty = true;
+						}
+						used_canvas_items++;
+
+						rs->canvas_item_set_material(ci, mat.is_valid() ? mat->get_rid() : RID());
+						rs->canvas_item_set_z_index(ci, tile_z_index);
 
 						prev_ci = ci;
 						prev_material = mat;
@@ -361,16 +379,23 @@ void TileMapLayer::_rendering_update() {
 					// Drawing the tile in the canvas item.
 					tile_map_node->draw_tile(ci, local_tile_pos - rendering_quadrant->canvas_items_position, tile_set, cell_data.cell.source_id, cell_data.cell.get_atlas_coords(), cell_data.cell.alternative_tile, -1, tile_map_node->get_self_modulate(), tile_data, random_animation_offset);
 				}
+
+				// Free the canvas items that are not needed anymore.
+				for (uint32_t i = used_canvas_items; i < rendering_quadrant->canvas_items.size(); i++) {
+					rs->free(rendering_quadrant->canvas_items[i]);
+				}
+				rendering_quadrant->canvas_items.resize(used_canvas_items);
 			} else {
 				// Free the quadrant.
-				for (int i = 0; i < rendering_quadrant->canvas_items.size(); i++) {
-					const RID &ci = rendering_quadrant->canvas_items[i];
+				for (const RID &ci : rendering_quadrant->canvas_items) {
 					if (ci.is_valid()) {
 						rs->free(ci);
 					}
 				}
 				rendering_quadrant->cells.clear();
+				rendering_quadrant_order.erase(rendering_quadrant->local_coords);
 				rendering_quadrant_map.erase(rendering_quadrant->quadrant_coords);
+				_rendering_quadrant_order_dirty = true;
 			}
 
 			quadrant_list_element = next_quadrant_list_element;
@@ -378,23 +403,17 @@ void TileMapLayer::_rendering_update() {
 
 		dirty_rendering_quadrant_list.clear();
 
-		// Reset the drawing indices.
-		{
+		// Reset the drawing indices, only needed if quadrants or canvas items were added or removed.
+		if (_rendering_quadrant_order_dirty) {
 			int index = -(int64_t)0x80000000; // Always must be drawn below children.
 
-			// Sort the quadrants coords per local coordinates.
-			RBMap<Vector2, Ref<RenderingQuadrant>, RenderingQuadrant::CoordsWorldComparator> local_to_map;
-			for (KeyValue<Vector2i, Ref<RenderingQuadrant>> &kv : rendering_quadrant_map) {
-				Ref<RenderingQuadrant> &rendering_quadrant = kv.value;
-				local_to_map[tile_map_node->map_to_local(rendering_quadrant->quadrant_coords)] = rendering_quadrant;
-			}
-
-			// Sort the quadrants.
-			for (const KeyValue<Vector2, Ref<RenderingQuadrant>> &E : local_to_map) {
+			// The quadrants are kept sorted per local coordinates.
+			for (const KeyValue<Vector2, Ref<RenderingQuadrant>> &E : rendering_quadrant_order) {
 				for (const RID &ci : E.value->canvas_items) {
 					RS::get_singleton()->canvas_item_set_draw_index(ci, index++);
 				}
 			}
+			_rendering_quadrant_order_dirty = false;
 		}
 
 		// Updates on TileMap changes.
@@ -504,7 +523,10 @@ void TileMapLayer::_rendering_quadrants_update_cell(CellData &r_cell_data, SelfL
 			rendering_quadrant.instantiate();
 			rendering_quadrant->quadrant_coords = quadrant_coords;
 			rendering_quadrant->canvas_items_position = canvas_items_position;
+			rendering_quadrant->local_coords = tile_map_node->map_to_local(quadrant_coords);
 			rendering_quadrant_map[quadrant_coords] = rendering_quadrant;
+			rendering_quadrant_order[rendering_quadrant->local_coords] = rendering_quadrant;
+			_rendering_quadrant_order_dirty = true;
 		}
 
 		// Mark the old quadrant as dirty (if it exists).
@@ -680,17 +702,57 @@ void TileMapLayer::_physics_update() {
 		for (KeyValue<Vector2i, CellData> &kv : tile_map) {
 			_physics_clear_cell(kv.value);
 		}
+		_physics_clear_all_quadrants();
 	} else {
-		if (_physics_was_cleaned_up || dirty.flags[DIRTY_FLAGS_TILE_MAP_TILE_SET] || dirty.flags[DIRTY_FLAGS_TILE_MAP_COLLISION_ANIMATABLE]) {
-			// Update all cells.
-			for (KeyValue<Vector2i, CellData> &kv : tile_map) {
-				_physics_update_cell(kv.value);
+		bool update_all = _physics_was_cleaned_up || dirty.flags[DIRTY_FLAGS_TILE_MAP_TILE_SET] || dirty.flags[DIRTY_FLAGS_TILE_MAP_COLLISION_ANIMATABLE] || dirty.flags[DIRTY_FLAGS_LAYER_PHYSICS_QUADRANT_SIZE];
+		if (update_all) {
+			// The quadrants are always rebuilt from scratch.
+			_physics_clear_all_quadrants();
+		}
+
+		if (physics_quadrant_size > 0) {
+			// List all physics quadrants to update, creating new ones if needed.
+			SelfList<PhysicsQuadrant>::List dirty_physics_quadrant_list;
+			if (update_all) {
+				// Update all cells.
+				for (KeyValue<Vector2i, CellData> &kv : tile_map) {
+					_physics_clear_cell(kv.value);
+					_physics_quadrants_update_cell(kv.value, dirty_physics_quadrant_list);
+				}
+			} else {
+				// Update dirty cells.
+				for (SelfList<CellData> *cell_data_list_element = dirty.cell_list.first(); cell_data_list_element; cell_data_list_element = cell_data_list_element->next()) {
+					CellData &cell_data = *cell_data_list_element->self();
+					_physics_quadrants_update_cell(cell_data, dirty_physics_quadrant_list);
+				}
 			}
+
+			// Rebuild the dirty quadrants only.
+			for (SelfList<PhysicsQuadrant> *quadrant_list_element = dirty_physics_quadrant_list.first(); quadrant_list_element;) {
+				SelfList<PhysicsQuadrant> *next_quadrant_list_element = quadrant_list_element->next(); // "Hack" to clear the list while iterating.
+
+				Ref<PhysicsQuadrant> physics_quadrant = quadrant_list_element->self();
+				_physics_update_quadrant(physics_quadrant);
+				if (physics_quadrant->cells.first() == nullptr) {
+					physics_quadrant_map.erase(physics_quadrant->quadrant_coords);
+				}
+
+				quadrant_list_element->remove_from_list();
+				quadrant_list_element = next_quadrant_list_element;
+			}
+			dirty_physics_quadrant_list.clear();
 		} else {
-			// Update dirty cells.
-			for (SelfList<CellData> *cell_data_list_element = dirty.cell_list.first(); cell_data_list_element; cell_data_list_element = cell_data_list_element->next()) {
-				CellData &cell_data = *cell_data_list_element->self();
-				_physics_update_cell(cell_data);
+			if (update_all) {
+				// Update all cells.
+				for (KeyValue<Vector2i, CellData> &kv : tile_map) {
+					_physics_update_cell(kv.value);
+				}
+			} else {
+				// Update dirty cells.
+				for (SelfList<CellData> *cell_data_list_element = dirty.cell_list.first(); cell_data_list_element; cell_data_list_element = cell_data_list_element->next()) {
+					CellData &cell_data = *cell_data_list_element->self();
+					_physics_update_cell(cell_data);
+				}
 			}
 		}
 	}
@@ -709,34 +771,23 @@ void TileMapLayer::_physics_notify_tilemap_change(TileMapLayer::DirtyFlags p_wha
 	in_editor = Engine::get_singleton()->is_editor_hint();
 #endif
 
+	// Both per-cell and per-quadrant bodies are referenced in bodies_coords.
 	if (p_what == DIRTY_FLAGS_TILE_MAP_XFORM) {
 		if (tile_map_node->is_inside_tree() && (!tile_map_node->is_collision_animatable() || in_editor)) {
 			// Move the collisison shapes along with the TileMap.
-			for (KeyValue<Vector2i, CellData> &kv : tile_map) {
-				const CellData &cell_data = kv.value;
-
-				for (RID body : cell_data.bodies) {
-					if (body.is_valid()) {
-						Transform2D xform(0, tile_map_node->map_to_local(bodies_coords[body]));
-						xform = gl_transform * xform;
-						ps->body_set_state(body, PhysicsServer2D::BODY_STATE_TRANSFORM, xform);
-					}
-				}
+			for (const KeyValue<RID, Vector2i> &kv : bodies_coords) {
+				Transform2D xform(0, tile_map_node->map_to_local(kv.value));
+				xform = gl_transform * xform;
+				ps->body_set_state(kv.key, PhysicsServer2D::BODY_STATE_TRANSFORM, xform);
 			}
 		}
 	} else if (p_what == DIRTY_FLAGS_TILE_MAP_LOCAL_XFORM) {
 		// With collisions animatable, move the collisison shapes along with the TileMap only on local xform change (they are synchornized on physics tick instead).
 		if (tile_map_node->is_inside_tree() && tile_map_node->is_collision_animatable() && !in_editor) {
-			for (KeyValue<Vector2i, CellData> &kv : tile_map) {
-				const CellData &cell_data = kv.value;
-
-				for (RID body : cell_data.bodies) {
-					if (body.is_valid()) {
-						Transform2D xform(0, tile_map_node->map_to_local(bodies_coords[body]));
-						xform = gl_transform * xform;
-						ps->body_set_state(body, PhysicsServer2D::BODY_STATE_TRANSFORM, xform);
-					}
-				}
+			for (const KeyValue<RID, Vector2i> &kv : bodies_coords) {
+				Transform2D xform(0, tile_map_node->map_to_local(kv.value));
+				xform = gl_transform * xform;
+				ps->body_set_state(kv.key, PhysicsServer2D::BODY_STATE_TRANSFORM, xform);
 			}
 		}
 	} else if (p_what == DIRTY_FLAGS_TILE_MAP_IN_TREE) {
@@ -744,19 +795,46 @@ void TileMapLayer::_physics_notify_tilemap_change(TileMapLayer::DirtyFlags p_wha
 		if (tile_map_node->is_inside_tree()) {
 			RID space = tile_map_node->get_world_2d()->get_space();
 
-			for (KeyValue<Vector2i, CellData> &kv : tile_map) {
-				const CellData &cell_data = kv.value;
-
-				for (RID body : cell_data.bodies) {
-					if (body.is_valid()) {
-						ps->body_set_space(body, space);
-					}
-				}
+			for (const KeyValue<RID, Vector2i> &kv : bodies_coords) {
+				ps->body_set_space(kv.key, space);
 			}
 		}
 	}
 }
 
+void TileMapLayer::_physics_setup_body(RID p_body, const Vector2i &p_coords, int p_tile_set_physics_layer, const Vector2 &p_linear_velocity, real_t p_angular_velocity) {
+	const Ref<TileSet> &tile_set = tile_map_node->get_tileset();
+	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
+
+	Ref<PhysicsMaterial> physics_material = tile_set->get_physics_layer_physics_material(p_tile_set_physics_layer);
+	uint32_t physics_layer = tile_set->get_physics_layer_collision_layer(p_tile_set_physics_layer);
+	uint32_t physics_mask = tile_set->get_physics_layer_collision_mask(p_tile_set_physics_layer);
+
+	bodies_coords[p_body] = p_coords;
+	ps->body_set_mode(p_body, tile_map_node->is_collision_animatable() ? PhysicsServer2D::BODY_MODE_KINEMATIC : PhysicsServer2D::BODY_MODE_STATIC);
+	ps->body_set_space(p_body, tile_map_node->get_world_2d()->get_space());
+
+	Transform2D xform;
+	xform.set_origin(tile_map_node->map_to_local(p_coords));
+	xform = tile_map_node->get_global_transform() * xform;
+	ps->body_set_state(p_body, PhysicsServer2D::BODY_STATE_TRANSFORM, xform);
+
+	ps->body_attach_object_instance_id(p_body, tile_map_node->get_instance_id());
+	ps->body_set_collision_layer(p_body, physics_layer);
+	ps->body_set_collision_mask(p_body, physics_mask);
+	ps->body_set_pickable(p_body, false);
+	ps->body_set_state(p_body, PhysicsServer2D::BODY_STATE_LINEAR_VELOCITY, p_linear_velocity);
+	ps->body_set_state(p_body, PhysicsServer2D::BODY_STATE_ANGULAR_VELOCITY, p_angular_velocity);
+
+	if (!physics_material.is_valid()) {
+		ps->body_set_param(p_body, PhysicsServer2D::BODY_PARAM_BOUNCE, 0);
+		ps->body_set_param(p_body, PhysicsServer2D::BODY_PARAM_FRICTION, 1);
+	} else {
+		ps->body_set_param(p_body, PhysicsServer2D::BODY_PARAM_BOUNCE, physics_material->computed_bounce());
+		ps->body_set_param(p_body, PhysicsServer2D::BODY_PARAM_FRICTION, physics_material->computed_friction());
+	}
+}
+
 void TileMapLayer::_physics_clear_cell(CellData &r_cell_data) {
 	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
 
@@ -772,8 +850,6 @@ void TileMapLayer::_physics_clear_cell(CellData &r_cell_data) {
 
 void TileMapLayer::_physics_update_cell(CellData &r_cell_data) {
 	const Ref<TileSet> &tile_set = tile_map_node->get_tileset();
-	Transform2D gl_transform = tile_map_node->get_global_transform();
-	RID space = tile_map_node->get_world_2d()->get_space();
 	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
 
 	// Recreate bodies and shapes.
@@ -804,10 +880,6 @@ void TileMapLayer::_physics_update_cell(CellData &r_cell_data) {
 				r_cell_data.bodies.resize(tile_set->get_physics_layers_count());
 
 				for (uint32_t tile_set_physics_layer = 0; tile_set_physics_layer < (uint32_t)tile_set->get_physics_layers_count(); tile_set_physics_layer++) {
-					Ref<PhysicsMaterial> physics_material = tile_set->get_physics_layer_physics_material(tile_set_physics_layer);
-					uint32_t physics_layer = tile_set->get_physics_layer_collision_layer(tile_set_physics_layer);
-					uint32_t physics_mask = tile_set->get_physics_layer_collision_mask(tile_set_physics_layer);
-
 					RID body = r_cell_data.bodies[tile_set_physics_layer];
 					if (tile_data->get_collision_polygons_count(tile_set_physics_layer) == 0) {
 						// No body needed, free it if it exists.
@@ -821,29 +893,7 @@ void TileMapLayer::_physics_update_cell(CellData &r_cell_data) {
 						if (!body.is_valid()) {
 							body = ps->body_create();
 						}
-						bodies_coords[body] = r_cell_data.coords;
-						ps->body_set_mode(body, tile_map_node->is_collision_animatable() ? PhysicsServer2D::BODY_MODE_KINEMATIC : PhysicsServer2D::BODY_MODE_STATIC);
-						ps->body_set_space(body, space);
-
-						Transform2D xform;
-						xform.set_origin(tile_map_node->map_to_local(r_cell_data.coords));
-						xform = gl_transform * xform;
-						ps->body_set_state(body, PhysicsServer2D::BODY_STATE_TRANSFORM, xform);
-
-						ps->body_attach_object_instance_id(body, tile_map_node->get_instance_id());
-						ps->body_set_collision_layer(body, physics_layer);
-						ps->body_set_collision_mask(body, physics_mask);
-						ps->body_set_pickable(body, false);
-						ps->body_set_state(body, PhysicsServer2D::BODY_STATE_LINEAR_VELOCITY, tile_data->get_constant_linear_velocity(tile_set_physics_layer));
-						ps->body_set_state(body, PhysicsServer2D::BODY_STATE_ANGULAR_VELOCITY, tile_data->get_constant_angular_velocity(tile_set_physics_layer));
-
-						if (!physics_material.is_valid()) {
-							ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_BOUNCE, 0);
-							ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_FRICTION, 1);
-						} else {
-							ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_BOUNCE, physics_material->computed_bounce());
-							ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_FRICTION, physics_material->computed_friction());
-						}
+						_physics_setup_body(body, r_cell_data.coords, tile_set_physics_layer, tile_data->get_constant_linear_velocity(tile_set_physics_layer), tile_data->get_constant_angular_velocity(tile_set_physics_layer));
 
 						// Clear body's shape if needed.
 						ps->body_clear_shapes(body);
@@ -880,6 +930,272 @@ void TileMapLayer::_physics_update_cell(CellData &r_cell_data) {
 	_physics_clear_cell(r_cell_data);
 }
 
+void TileMapLayer::_physics_quadrants_update_cell(CellData &r_cell_data, SelfList<PhysicsQuadrant>::List &r_dirty_physics_quadrant_list) {
+	// Mark the old quadrant as dirty (if it exists) and remove the cell from it.
+	Ref<PhysicsQuadrant> old_physics_quadrant = r_cell_data.physics_quadrant;
+	if (old_physics_quadrant.is_valid()) {
+		if (r_cell_data.physics_quadrant_list_element.in_list()) {
+			old_physics_quadrant->cells.remove(&r_cell_data.physics_quadrant_list_element);
+		}
+		if (!old_physics_quadrant->dirty_quadrant_list_element.in_list()) {
+			r_dirty_physics_quadrant_list.add(&old_physics_quadrant->dirty_quadrant_list_element);
+		}
+	}
+	r_cell_data.physics_quadrant = Ref<PhysicsQuadrant>();
+
+	if (r_cell_data.cell.source_id == TileSet::INVALID_SOURCE) {
+		return;
+	}
+
+	// Rounding down, instead of simply rounding towards zero (truncating).
+	const Vector2i &coords = r_cell_data.coords;
+	int quad_size = physics_quadrant_size;
+	Vector2i quadrant_coords = Vector2i(
+			coords.x > 0 ? coords.x / quad_size : (coords.x - (quad_size - 1)) / quad_size,
+			coords.y > 0 ? coords.y / quad_size : (coords.y - (quad_size - 1)) / quad_size);
+
+	Ref<PhysicsQuadrant> physics_quadrant;
+	if (physics_quadrant_map.has(quadrant_coords)) {
+		// Reuse existing physics quadrant.
+		physics_quadrant = physics_quadrant_map[quadrant_coords];
+	} else {
+		// Create a new physics quadrant.
+		physics_quadrant.instantiate();
+		physics_quadrant->quadrant_coords = quadrant_coords;
+		physics_quadrant->origin_coords = quadrant_coords * quad_size;
+		physics_quadrant_map[quadrant_coords] = physics_quadrant;
+	}
+
+	// Add the cell to its new quadrant, and mark the quadrant as dirty.
+	r_cell_data.physics_quadrant = physics_quadrant;
+	physics_quadrant->cells.add(&r_cell_data.physics_quadrant_list_element);
+	if (!physics_quadrant->dirty_quadrant_list_element.in_list()) {
+		r_dirty_physics_quadrant_list.add(&physics_quadrant->dirty_quadrant_list_element);
+	}
+}
+
+void TileMapLayer::_physics_clear_quadrant(const Ref<PhysicsQuadrant> &p_physics_quadrant) {
+	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
+
+	for (RID body : p_physics_quadrant->bodies) {
+		bodies_coords.erase(body);
+		ps->free(body);
+	}
+	p_physics_quadrant->bodies.clear();
+	p_physics_quadrant->bodies_cells.clear();
+
+	for (RID shape : p_physics_quadrant->shapes) {
+		ps->free(shape);
+	}
+	p_physics_quadrant->shapes.clear();
+}
+
+void TileMapLayer::_physics_clear_all_quadrants() {
+	for (KeyValue<Vector2i, Ref<PhysicsQuadrant>> &kv : physics_quadrant_map) {
+		_physics_clear_quadrant(kv.value);
+		for (SelfList<CellData> *cell_data_list_element = kv.value->cells.first(); cell_data_list_element; cell_data_list_element = cell_data_list_element->next()) {
+			cell_data_list_element->self()->physics_quadrant = Ref<PhysicsQuadrant>();
+		}
+		kv.value->cells.clear();
+	}
+	physics_quadrant_map.clear();
+}
+
+void TileMapLayer::_physics_update_quadrant(const Ref<PhysicsQuadrant> &p_physics_quadrant) {
+	const Ref<TileSet> &tile_set = tile_map_node->get_tileset();
+	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
+
+	// Quadrants are always rebuilt from scratch.
+	_physics_clear_quadrant(p_physics_quadrant);
+
+	// Edges and vertices are compared on a fixed grid, to avoid floating point errors.
+	const real_t snap = 100.0;
+
+	// Cells are grouped into a single body per physics layer and per constant velocity.
+	struct OneWayShape {
+		RID shape;
+		Vector2 offset;
+		float margin = 0.0;
+	};
+	struct BodyGroup {
+		Vector2 linear_velocity;
+		real_t angular_velocity = 0.0;
+		LocalVector<Vector2> edges; // Pairs of points, with the polygons wound counter-clockwise.
+		LocalVector<OneWayShape> one_way_shapes;
+		LocalVector<Vector2i> cells;
+	};
+
+	Vector2 origin = tile_map_node->map_to_local(p_physics_quadrant->origin_coords);
+	for (int tile_set_physics_layer = 0; tile_set_physics_layer < tile_set->get_physics_layers_count(); tile_set_physics_layer++) {
+		LocalVector<BodyGroup> groups;
+
+		for (SelfList<CellData> *cell_data_list_element = p_physics_quadrant->cells.first(); cell_data_list_element; cell_data_list_element = cell_data_list_element->next()) {
+			const CellData &cell_data = *cell_data_list_element->self();
+			const TileMapCell &c = cell_data.cell;
+
+			if (!tile_set->has_source(c.source_id)) {
+				continue;
+			}
+			TileSetAtlasSource *atlas_source = Object::cast_to<TileSetAtlasSource>(*tile_set->get_source(c.source_id));
+			if (!atlas_source || !atlas_source->has_tile(c.get_atlas_coords()) || !atlas_source->has_alternative_tile(c.get_atlas_coords(), c.alternative_tile)) {
+				continue;
+			}
+			const TileData *tile_data;
+			if (cell_data.runtime_tile_data_cache) {
+				tile_data = cell_data.runtime_tile_data_cache;
+			} else {
+				tile_data = atlas_source->get_tile_data(c.get_atlas_coords(), c.alternative_tile);
+			}
+			if (tile_data->get_collision_polygons_count(tile_set_physics_layer) == 0) {
+				continue;
+			}
+
+			// Find the group matching the tile's velocity.
+			Vector2 linear_velocity = tile_data->get_constant_linear_velocity(tile_set_physics_layer);
+			real_t angular_velocity = tile_data->get_constant_angular_velocity(tile_set_physics_layer);
+			BodyGroup *group = nullptr;
+			for (BodyGroup &g : groups) {
+				if (g.linear_velocity == linear_velocity && g.angular_velocity == angular_velocity) {
+					group = &g;
+					break;
+				}
+			}
+			if (!group) {
+				groups.push_back(BodyGroup());
+				group = &groups[groups.size() - 1];
+				group->linear_velocity = linear_velocity;
+				group->angular_velocity = angular_velocity;
+			}
+			group->cells.push_back(cell_data.coords);
+
+			Vector2 offset = tile_map_node->map_to_local(cell_data.coords) - origin;
+			for (int polygon_index = 0; polygon_index < tile_data->get_collision_polygons_count(tile_set_physics_layer); polygon_index++) {
+				bool one_way_collision = tile_data->is_collision_polygon_one_way(tile_set_physics_layer, polygon_index);
+				float one_way_collision_margin = tile_data->get_collision_polygon_one_way_margin(tile_set_physics_layer, polygon_index);
+				int shapes_count = tile_data->get_collision_polygon_shapes_count(tile_set_physics_layer, polygon_index);
+				for (int shape_index = 0; shape_index < shapes_count; shape_index++) {
+					Ref<ConvexPolygonShape2D> shape = tile_data->get_collision_polygon_shape(tile_set_physics_layer, polygon_index, shape_index);
+					shape = tile_map_node->get_transformed_polygon(Ref<Resource>(shape), c.alternative_tile);
+
+					if (one_way_collision) {
+						// One-way shapes depend on their own orientation, so they cannot be merged.
+						OneWayShape one_way_shape;
+						one_way_shape.shape = shape->get_rid();
+						one_way_shape.offset = offset;
+						one_way_shape.margin = one_way_collision_margin;
+						group->one_way_shapes.push_back(one_way_shape);
+						continue;
+					}
+
+					// Keep the edges with a common winding, so that the edges shared by two pieces run in opposite directions.
+					Vector<Vector2> points = shape->get_points();
+					bool reversed = Geometry2D::is_polygon_clockwise(points);
+					for (int i = 0; i < points.size(); i++) {
+						Vector2 a = points[i] + offset;
+						Vector2 b = points[(i + 1) % points.size()] + offset;
+						if ((a * snap).round() == (b * snap).round()) {
+							continue;
+						}
+						if (reversed) {
+							SWAP(a, b);
+						}
+						group->edges.push_back(a);
+						group->edges.push_back(b);
+					}
+				}
+			}
+		}
+
+		for (BodyGroup &group : groups) {
+			RID body = ps->body_create();
+			_physics_setup_body(body, p_physics_quadrant->origin_coords, tile_set_physics_layer, group.linear_velocity, group.angular_velocity);
+			p_physics_quadrant->bodies.push_back(body);
+			p_physics_quadrant->bodies_cells.push_back(group.cells);
+
+			// Gather the edges by line. Along a line, the parts covered by as many edges in both directions are
+			// shared by two pieces (even partially, like the side of a half tile against a full one), the others
+			// are part of the outline. Touching outline parts are joined (e.g: the top edges of a row of tiles).
+			struct EdgeEnd {
+				real_t position = 0.0;
+				int winding = 0;
+				bool operator<(const EdgeEnd &p_other) const { return position < p_other.position; }
+			};
+			struct Line {
+				Vector2 direction;
+				real_t distance = 0.0;
+				LocalVector<EdgeEnd> ends;
+			};
+			HashMap<Vector3i, Line> lines;
+			for (uint32_t i = 0; i < group.edges.size(); i += 2) {
+				Vector2 a = group.edges[i];
+				Vector2 b = group.edges[i + 1];
+
+				Vector2 direction = (b - a).normalized();
+				int winding = 1;
+				if (direction.x < -CMP_EPSILON || (direction.x <= CMP_EPSILON && direction.y < 0.0)) {
+					direction = -direction;
+					winding = -1;
+				}
+				real_t distance = direction.cross(a);
+				Vector3i line_key = Vector3i(Math::round(direction.x * 1000.0), Math::round(direction.y * 1000.0), Math::round(distance * snap));
+
+				HashMap<Vector3i, Line>::Iterator E = lines.find(line_key);
+				if (!E) {
+					Line line;
+					line.direction = direction;
+					line.distance = distance;
+					E = lines.insert(line_key, line);
+				}
+				// Snapped, so that ends meeting on the grid fall on the same position.
+				real_t from = Math::round(direction.dot(a) * snap) / snap;
+				real_t to = Math::round(direction.dot(b) * snap) / snap;
+				E->value.ends.push_back({ MIN(from, to), winding });
+				E->value.ends.push_back({ MAX(from, to), -winding });
+			}
+
+			Vector<Vector2> segments;
+			for (KeyValue<Vector3i, Line> &kv : lines) {
+				Line &line = kv.value;
+				line.ends.sort();
+				Vector2 normal = Vector2(-line.direction.y, line.direction.x);
+
+				int winding = 0;
+				bool in_segment = false;
+				real_t segment_from = 0.0;
+				for (uint32_t i = 0; i < line.ends.size(); i++) {
+					winding += line.ends[i].winding;
+					if (i + 1 < line.ends.size() && line.ends[i + 1].position == line.ends[i].position) {
+						continue; // Wait for all the ends at this position.
+					}
+					if (winding != 0 && !in_segment) {
+						segment_from = line.ends[i].position;
+						in_segment = true;
+					} else if (winding == 0 && in_segment) {
+						segments.push_back(line.direction * segment_from + normal * line.distance);
+						segments.push_back(line.direction * line.ends[i].position + normal * line.distance);
+						in_segment = false;
+					}
+				}
+			}
+
+			int body_shape_index = 0;
+			if (!segments.is_empty()) {
+				RID shape = ps->concave_polygon_shape_create();
+				ps->shape_set_data(shape, segments);
+				ps->body_add_shape(body, shape);
+				p_physics_quadrant->shapes.push_back(shape);
+				body_shape_index++;
+			}
+
+			for (const OneWayShape &one_way_shape : group.one_way_shapes) {
+				ps->body_add_shape(body, one_way_shape.shape, Transform2D(0, one_way_shape.offset));
+				ps->body_set_shape_as_one_way_collision(body, body_shape_index, true, one_way_shape.margin);
+				body_shape_index++;
+			}
+		}
+	}
+}
+
 #ifdef DEBUG_ENABLED
 void TileMapLayer::_physics_draw_cell_debug(const RID &p_canvas_item, const Vector2i &p_quadrant_pos, const CellData &r_cell_data) {
 	// Draw the debug collision shapes.
@@ -913,6 +1229,34 @@ void TileMapLayer::_physics_draw_cell_debug(const RID &p_canvas_item, const Vect
 	Vector<Color> color;
 	color.push_back(debug_collision_color);
 
+	if (r_cell_data.physics_quadrant.is_valid()) {
+		// Merged bodies are shared between cells, so draw the cell's own collision polygons instead.
+		const TileMapCell &c = r_cell_data.cell;
+		TileSetAtlasSource *atlas_source = tile_set->has_source(c.source_id) ? Object::cast_to<TileSetAtlasSource>(*tile_set->get_source(c.source_id)) : nullptr;
+		if (!atlas_source || !atlas_source->has_tile(c.get_atlas_coords()) || !atlas_source->has_alternative_tile(c.get_atlas_coords(), c.alternative_tile)) {
+			return;
+		}
+		const TileData *tile_data;
+		if (r_cell_data.runtime_tile_data_cache) {
+			tile_data = r_cell_data.runtime_tile_data_cache;
+		} else {
+			tile_data = atlas_source->get_tile_data(c.get_atlas_coords(), c.alternative_tile);
+		}
+
+		rs->canvas_item_add_set_transform(p_canvas_item, Transform2D(0, tile_map_node->map_to_local(r_cell_data.coords) - p_quadrant_pos));
+		for (int tile_set_physics_layer = 0; tile_set_physics_layer < tile_set->get_physics_layers_count(); tile_set_physics_layer++) {
+			for (int polygon_index = 0; polygon_index < tile_data->get_collision_polygons_count(tile_set_physics_layer); polygon_index++) {
+				for (int shape_index = 0; shape_index < tile_data->get_collision_polygon_shapes_count(tile_set_physics_layer, polygon_index); shape_index++) {
+					Ref<ConvexPolygonShape2D> shape = tile_data->get_collision_polygon_shape(tile_set_physics_layer, polygon_index, shape_index);
+					shape = tile_map_node->get_transformed_polygon(Ref<Resource>(shape), c.alternative_tile);
+					rs->canvas_item_add_polygon(p_canvas_item, shape->get_points(), color);
+				}
+			}
+		}
+		rs->canvas_item_add_set_transform(p_canvas_item, Transform2D());
+		return;
+	}
+
 	Transform2D quadrant_to_local(0, p_quadrant_pos);
 	Transform2D global_to_quadrant = (tile_map_node->get_global_transform() * quadrant_to_local).affine_inverse();
 
@@ -2214,6 +2558,21 @@ int TileMapLayer::get_z_index() const {
 	return z_index;
 }
 
+void TileMapLayer::set_physics_quadrant_size(int p_size) {
+	ERR_FAIL_COND_MSG(p_size < 0, "Physics quadrant size cannot be negative.");
+	if (physics_quadrant_size == p_size) {
+		return;
+	}
+	physics_quadrant_size = p_size;
+	dirty.flags[DIRTY_FLAGS_LAYER_PHYSICS_QUADRANT_SIZE] = true;
+	tile_map_node->queue_internal_update();
+	tile_map_node->emit_signal(CoreStringNames::get_singleton()->changed);
+}
+
+int TileMapLayer::get_physics_quadrant_size() const {
+	return physics_quadrant_size;
+}
+
 void TileMapLayer::fix_invalid_tiles() {
 	Ref<TileSet> tileset = tile_map_node->get_tileset();
 	ERR_FAIL_COND_MSG(tileset.is_null(), "Cannot call fix_invalid_tiles() on a TileMap without a valid TileSet.");
@@ -2238,6 +2597,37 @@ Vector2i TileMapLayer::get_coords_for_body_rid(RID p_physics_body) const {
 	return bodies_coords[p_physics_body];
 }
 
+Vector2i TileMapLayer::get_coords_for_body_contact(RID p_physics_body, const Vector2 &p_global_position) const {
+	const Vector2i &coords = bodies_coords[p_physics_body];
+	if (physics_quadrant_size <= 0) {
+		return coords;
+	}
+	const Ref<PhysicsQuadrant> *physics_quadrant = physics_quadrant_map.getptr(coords / physics_quadrant_size);
+	if (!physics_quadrant) {
+		return coords;
+	}
+
+	// Contacts lie on the edge of the cells, so pick the body's cell whose center is the closest.
+	Vector2 local_position = tile_map_node->get_global_transform().affine_inverse().xform(p_global_position);
+	const Ref<PhysicsQuadrant> &quadrant = *physics_quadrant;
+	for (uint32_t i = 0; i < quadrant->bodies.size(); i++) {
+		if (quadrant->bodies[i] != p_physics_body) {
+			continue;
+		}
+		Vector2i closest = coords;
+		real_t closest_distance = 1e20;
+		for (const Vector2i &cell : quadrant->bodies_cells[i]) {
+			real_t distance = tile_map_node->map_to_local(cell).distance_squared_to(local_position);
+			if (distance < closest_distance) {
+				closest = cell;
+				closest_distance = distance;
+			}
+		}
+		return closest;
+	}
+	return coords;
+}
+
 TileMapLayer::~TileMapLayer() {
 	if (!tile_map_node) {
 		// Temporary layer.
@@ -3075,6 +3465,14 @@ int TileMap::get_layer_z_index(int p_layer) const {
 	TILEMAP_CALL_FOR_LAYER_V(p_layer, 0, get_z_index);
 }
 
+void TileMap::set_layer_physics_quadrant_size(int p_layer, int p_size) {
+	TILEMAP_CALL_FOR_LAYER(p_layer, set_physics_quadrant_size, p_size);
+}
+
+int TileMap::get_layer_physics_quadrant_size(int p_layer) const {
+	TILEMAP_CALL_FOR_LAYER_V(p_layer, 0, get_physics_quadrant_size);
+}
+
 void TileMap::set_collision_animatable(bool p_enabled) {
 	if (collision_animatable == p_enabled) {
 		return;
@@ -3216,6 +3614,15 @@ Vector2i TileMap::get_coords_for_body_rid(RID p_physics_body) {
 	ERR_FAIL_V_MSG(Vector2i(), vformat("No tiles for the given body RID %d.", p_physics_body.get_id()));
 }
 
+Vector2i TileMap::get_coords_for_body_contact(RID p_physics_body, const Vector2 &p_global_position) {
+	for (const Ref<TileMapLayer> &layer : layers) {
+		if (layer->has_body_rid(p_physics_body)) {
+			return layer->get_coords_for_body_contact(p_physics_body, p_global_position);
+		}
+	}
+	ERR_FAIL_V_MSG(Vector2i(), vformat("No tiles for the given body RID %d.", p_physics_body.get_id()));
+}
+
 int TileMap::get_layer_for_body_rid(RID p_physics_body) {
 	for (uint32_t i = 0; i < layers.size(); i++) {
 		if (layers[i]->has_body_rid(p_physics_body)) {
@@ -3373,6 +3780,9 @@ bool TileMap::_set(const StringName &p_name, const Variant &p_value) {
 		} else if (components[1] == "z_index") {
 			set_layer_z_index(index, p_value);
 			return true;
+		} else if (components[1] == "physics_quadrant_size") {
+			set_layer_physics_quadrant_size(index, p_value);
+			return true;
 		} else if (components[1] == "tile_data") {
 			layers[index]->set_tile_data(format, p_value);
 			emit_signal(CoreStringNames::get_singleton()->changed);
@@ -3420,6 +3830,9 @@ bool TileMap::_get(const StringName &p_name, Variant &r_ret) const {
 		} else if (components[1] == "z_index") {
 			r_ret = get_layer_z_index(index);
 			return true;
+		} else if (components[1] == "physics_quadrant_size") {
+			r_ret = get_layer_physics_quadrant_size(index);
+			return true;
 		} else if (components[1] == "tile_data") {
 			r_ret = layers[index]->get_tile_data();
 			return true;
@@ -3447,6 +3860,7 @@ void TileMap::_get_property_list(List<PropertyInfo> *p_list) const {
 		MAKE_LAYER_PROPERTY(Variant::BOOL, "y_sort_enabled", "");
 		MAKE_LAYER_PROPERTY(Variant::INT, "y_sort_origin", "suffix:px");
 		MAKE_LAYER_PROPERTY(Variant::INT, "z_index", "");
+		MAKE_LAYER_PROPERTY(Variant::INT, "physics_quadrant_size", "");
 		MAKE_LAYER_PROPERTY(Variant::BOOL, "navigation_enabled", "");
 		p_list->push_back(PropertyInfo(Variant::OBJECT, vformat("layer_%d/tile_data", i), PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NO_EDITOR));
 	}
@@ -3474,6 +3888,8 @@ bool TileMap::_property_can_revert(const StringName &p_name) const {
 			return layers[index]->get_y_sort_origin() != default_layer->get_y_sort_origin();
 		} else if (components[1] == "z_index") {
 			return layers[index]->get_z_index() != default_layer->get_z_index();
+		} else if (components[1] == "physics_quadrant_size") {
+			return layers[index]->get_physics_quadrant_size() != default_layer->get_physics_quadrant_size();
 		}
 	}
 
@@ -3506,6 +3922,9 @@ bool TileMap::_property_get_revert(const StringName &p_name, Variant &r_property
 		} else if (components[1] == "z_index") {
 			r_property = default_layer->get_z_index();
 			return true;
+		} else if (components[1] == "physics_quadrant_size") {
+			r_property = default_layer->get_physics_quadrant_size();
+			return true;
 		}
 	}
 
@@ -4415,6 +4834,8 @@ void TileMap::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_layer_y_sort_origin", "layer"), &TileMap::get_layer_y_sort_origin);
 	ClassDB::bind_method(D_METHOD("set_layer_z_index", "layer", "z_index"), &TileMap::set_layer_z_index);
 	ClassDB::bind_method(D_METHOD("get_layer_z_index", "layer"), &TileMap::get_layer_z_index);
+	ClassDB::bind_method(D_METHOD("set_layer_physics_quadrant_size", "layer", "size"), &TileMap::set_layer_physics_quadrant_size);
+	ClassDB::bind_method(D_METHOD("get_layer_physics_quadrant_size", "layer"), &TileMap::get_layer_physics_quadrant_size);
 
 	ClassDB::bind_method(D_METHOD("set_collision_animatable", "enabled"), &TileMap::set_collision_animatable);
 	ClassDB::bind_method(D_METHOD("is_collision_animatable"), &TileMap::is_collision_animatable);
@@ -4429,6 +4850,7 @@ void TileMap::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_cell_tile_data", "layer", "coords", "use_proxies"), &TileMap::get_cell_tile_data, DEFVAL(false));
 
 	ClassDB::bind_method(D_METHOD("get_coords_for_body_rid", "body"), &TileMap::get_coords_for_body_rid);
+	ClassDB::bind_method(D_METHOD("get_coords_for_body_contact", "body", "position"), &TileMap::get_coords_for_body_contact);
 	ClassDB::bind_method(D_METHOD("get_layer_for_body_rid", "body"), &TileMap::get_layer_for_body_rid);
 
 	ClassDB::bind_method(D_METHOD("get_pattern", "layer", "coords_array"), &TileMap::get_pattern);
@@ -93,6 +93,7 @@ public:
 class DebugQuadrant;
 #endif // DEBUG_ENABLED
 class RenderingQuadrant;
+class PhysicsQuadrant;
 
 struct CellData {
 	Vector2i coords;
@@ -108,6 +109,8 @@ struct CellData {
 
 	// Physics.
 	LocalVector<RID> bodies;
+	Ref<PhysicsQuadrant> physics_quadrant;
+	SelfList<CellData> physics_quadrant_list_element;
 
 	// Scenes.
 	String scene;
@@ -135,6 +138,7 @@ struct CellData {
 	CellData(const CellData &p_other) :
 			debug_quadrant_list_element(this),
 			rendering_quadrant_list_element(this),
+			physics_quadrant_list_element(this),
 			dirty_list_element(this) {
 		coords = p_other.coords;
 		cell = p_other.cell;
@@ -147,6 +151,7 @@ struct CellData {
 	CellData() :
 			debug_quadrant_list_element(this),
 			rendering_quadrant_list_element(this),
+			physics_quadrant_list_element(this),
 			dirty_list_element(this) {
 	}
 };
@@ -204,8 +209,9 @@ public:
 
 	Vector2i quadrant_coords;
 	SelfList<CellData>::List cells;
-	List<RID> canvas_items;
+	LocalVector<RID> canvas_items;
 	Vector2 canvas_items_position;
+	Vector2 local_coords; // Key in the layer's quadrant drawing order.
 
 	SelfList<RenderingQuadrant> dirty_quadrant_list_element;
 
@@ -215,6 +221,7 @@ public:
 		quadrant_coords = p_other.quadrant_coords;
 		cells = p_other.cells;
 		canvas_items = p_other.canvas_items;
+		local_coords = p_other.local_coords;
 	}
 
 	RenderingQuadrant() :
@@ -226,6 +233,39 @@ public:
 	}
 };
 
+class PhysicsQuadrant : public RefCounted {
+	GDCLASS(PhysicsQuadrant, RefCounted);
+
+public:
+	Vector2i quadrant_coords;
+	Vector2i origin_coords; // The cell the quadrant's bodies are positioned on.
+	SelfList<CellData>::List cells;
+	LocalVector<RID> bodies;
+	LocalVector<LocalVector<Vector2i>> bodies_cells; // For each body, the cells it holds the collision of.
+	LocalVector<RID> shapes; // Merged shapes, owned by the quadrant.
+
+	SelfList<PhysicsQuadrant> dirty_quadrant_list_element;
+
+	// For those, copy everything but SelfList elements.
+	PhysicsQuadrant(const PhysicsQuadrant &p_other) :
+			dirty_quadrant_list_element(this) {
+		quadrant_coords = p_other.quadrant_coords;
+		origin_coords = p_other.origin_coords;
+		cells = p_other.cells;
+		bodies = p_other.bodies;
+		bodies_cells = p_other.bodies_cells;
+		shapes = p_other.shapes;
+	}
+
+	PhysicsQuadrant() :
+			dirty_quadrant_list_element(this) {
+	}
+
+	~PhysicsQuadrant() {
+		cells.clear();
+	}
+};
+
 class TileMapLayer : public RefCounted {
 	GDCLASS(TileMapLayer, RefCounted);
 
@@ -243,6 +283,7 @@ public:
 		DIRTY_FLAGS_LAYER_Y_SORT_ENABLED,
 		DIRTY_FLAGS_LAYER_Y_SORT_ORIGIN,
 		DIRTY_FLAGS_LAYER_Z_INDEX,
+		DIRTY_FLAGS_LAYER_PHYSICS_QUADRANT_SIZE,
 		DIRTY_FLAGS_LAYER_INDEX_IN_TILE_MAP_NODE,
 		DIRTY_FLAGS_TILE_MAP_IN_TREE,
 		DIRTY_FLAGS_TILE_MAP_IN_CANVAS,
@@ -272,6 +313,7 @@ private:
 	bool y_sort_enabled = false;
 	int y_sort_origin = 0;
 	int z_index = 0;
+	int physics_quadrant_size = 0;
 
 	// Internal.
 	TileMap *tile_map_node = nullptr;
@@ -308,6 +350,9 @@ private:
 #endif // DEBUG_ENABLED
 
 	HashMap<Vector2i, Ref<RenderingQuadrant>> rendering_quadrant_map;
+	// Quadrants sorted by local coords, only reordered when quadrants are added or removed.
+	RBMap<Vector2, Ref<RenderingQuadrant>, RenderingQuadrant::CoordsWorldComparator> rendering_quadrant_order;
+	bool _rendering_quadrant_order_dirty = false;
 	bool _rendering_was_cleaned_up = false;
 	void _rendering_update();
 	void _rendering_quadrants_update_cell(CellData &r_cell_data, SelfList<RenderingQuadrant>::List &r_dirty_rendering_quadrant_list);
@@ -318,11 +363,17 @@ private:
 #endif // DEBUG_ENABLED
 
 	HashMap<RID, Vector2i> bodies_coords; // Mapping for RID to coords.
+	HashMap<Vector2i, Ref<PhysicsQuadrant>> physics_quadrant_map;
 	bool _physics_was_cleaned_up = false;
 	void _physics_update();
 	void _physics_notify_tilemap_change(DirtyFlags p_what);
+	void _physics_setup_body(RID p_body, const Vector2i &p_coords, int p_tile_set_physics_layer, const Vector2 &p_linear_velocity, real_t p_angular_velocity);
 	void _physics_clear_cell(CellData &r_cell_data);
 	void _physics_update_cell(CellData &r_cell_data);
+	void _physics_quadrants_update_cell(CellData &r_cell_data, SelfList<PhysicsQuadrant>::List &r_dirty_physics_quadrant_list);
+	void _physics_clear_quadrant(const Ref<PhysicsQuadrant> &p_physics_quadrant);
+	void _physics_clear_all_quadrants();
+	void _physics_update_quadrant(const Ref<PhysicsQuadrant> &p_physics_quadrant);
 #ifdef DEBUG_ENABLED
 	void _physics_draw_cell_debug(const RID &p_canvas_item, const Vector2i &p_quadrant_pos, const CellData &r_cell_data);
 #endif // DEBUG_ENABLED
@@ -401,13 +452,16 @@ public:
 	int get_y_sort_origin() const;
 	void set_z_index(int p_z_index);
 	int get_z_index() const;
+	void set_physics_quadrant_size(int p_size);
+	int get_physics_quadrant_size() const;
 
 	// Fixing and clearing methods.
 	void fix_invalid_tiles();
 
 	// Find coords for body.
 	bool has_body_rid(RID p_physics_body) const;
-	Vector2i get_coords_for_body_rid(RID p_physics_body) const; // For finding tiles from collision.
+	Vector2i get_coords_for_body_rid(RID p_physics_body) const; // For finding tiles from collision. Returns the quadrant origin for merged bodies.
+	Vector2i get_coords_for_body_contact(RID p_physics_body, const Vector2 &p_global_position) const; // Also resolves merged bodies.
 
 	~TileMapLayer();
 };
@@ -512,6 +566,8 @@ public:
 	int get_layer_y_sort_origin(int p_layer) const;
 	void set_layer_z_index(int p_layer, int p_z_index);
 	int get_layer_z_index(int p_layer) const;
+	void set_layer_physics_quadrant_size(int p_layer, int p_size);
+	int get_layer_physics_quadrant_size(int p_layer) const;
 	void set_selected_layer(int p_layer_id); // For editor use.
 	int get_selected_layer() const;
 
@@ -571,6 +627,7 @@ public:
 
 	// For finding tiles from collision.
 	Vector2i get_coords_for_body_rid(RID p_physics_body);
+	Vector2i get_coords_for_body_contact(RID p_physics_body, const Vector2 &p_global_position);
 	// For getting their layers as well.
 	int get_layer_for_body_rid(RID p_physics_body);
 
@@ -31,6 +31,7 @@
 #include "animation_mixer.h"
 
 #include "core/config/engine.h"
+#include "scene/2d/node_2d.h"
 #include "scene/animation/animation_player.h"
 #include "scene/resources/animation.h"
 #include "scene/scene_string_names.h"
@@ -611,6 +612,8 @@ bool AnimationMixer::_update_caches() {
 			Animation::TrackType track_cache_type = track_type;
 			if (track_cache_type == Animation::TYPE_POSITION_3D || track_cache_type == Animation::TYPE_ROTATION_3D || track_cache_type == Animation::TYPE_SCALE_3D) {
 				track_cache_type = Animation::TYPE_POSITION_3D; // Reference them as position3D tracks, even if they modify rotation or scale.
+			} else if (track_cache_type == Animation::TYPE_ROTATION_2D || track_cache_type == Animation::TYPE_SCALE_2D) {
+				track_cache_type = Animation::TYPE_POSITION_2D; // Same for 2D, a single cache holds the whole transform of the node.
 			}
 
 			TrackCache *track = nullptr;
@@ -656,6 +659,17 @@ bool AnimationMixer::_update_caches() {
 						track_value->subpath = leftover_path;
 						track_value->object_id = track_value->object->get_instance_id();
 
+						bool cache_setter = leftover_path.size() == 1;
+#ifdef TOOLS_ENABLED
+						cache_setter = cache_setter && !Engine::get_singleton()->is_editor_hint(); // Object::set() has to flag the object as edited.
+#endif // TOOLS_ENABLED
+						if (cache_setter) {
+							MethodBind *getter = nullptr;
+							if (!ClassDB::get_property_binds(track_value->object->get_class_name(), leftover_path[0], &track_value->setter, &getter)) {
+								track_value->setter = nullptr;
+							}
+						}
+
 						track = track_value;
 
 						track_value->init_value = anim->track_get_key_value(i, 0);
@@ -675,6 +689,54 @@ bool AnimationMixer::_update_caches() {
 					case Animation::TYPE_SCALE_3D: {
 					} break;
 					case Animation::TYPE_BLEND_SHAPE: {
+					} break;
+					case Animation::TYPE_POSITION_2D:
+					case Animation::TYPE_ROTATION_2D:
+					case Animation::TYPE_SCALE_2D: {
+						Node2D *node_2d = Object::cast_to<Node2D>(child);
+
+						if (!node_2d) {
+							ERR_PRINT("AnimationMixer: '" + String(E) + "', 2D transform track does not point to Node2D:  '" + String(path) + "'.");
+							continue;
+						}
+
+						TrackCacheTransform2D *track_xform = memnew(TrackCacheTransform2D);
+						track_xform->node_2d = node_2d;
+						track_xform->object = node_2d;
+						track_xform->object_id = node_2d->get_instance_id();
+
+						track = track_xform;
+
+						switch (track_type) {
+							case Animation::TYPE_POSITION_2D: {
+								track_xform->loc_used = true;
+							} break;
+							case Animation::TYPE_ROTATION_2D: {
+								track_xform->rot_used = true;
+							} break;
+							case Animation::TYPE_SCALE_2D: {
+								track_xform->scale_used = true;
+							} break;
+							default: {
+							}
+						}
+
+						// Blending is relative to the RESET animation pose, when there is one.
+						if (has_reset_anim) {
+							int rt = reset_anim->find_track(path, Animation::TYPE_POSITION_2D);
+							if (rt >= 0 && reset_anim->track_get_key_count(rt) > 0) {
+								reset_anim->position_2d_track_get_key(rt, 0, &track_xform->init_loc);
+							}
+							rt = reset_anim->find_track(path, Animation::TYPE_ROTATION_2D);
+							if (rt >= 0 && reset_anim->track_get_key_count(rt) > 0) {
+								reset_anim->rotation_2d_track_get_key(rt, 0, &track_xform->init_rot);
+							}
+							rt = reset_anim->find_track(path, Animation::TYPE_SCALE_2D);
+							if (rt >= 0 && reset_anim->track_get_key_count(rt) > 0) {
+								reset_anim->scale_2d_track_get_key(rt, 0, &track_xform->init_scale);
+							}
+						}
+
 					} break;
 					case Animation::TYPE_METHOD: {
 						TrackCacheMethod *track_method = memnew(TrackCacheMethod);
@@ -759,6 +821,26 @@ bool AnimationMixer::_update_caches() {
 					default: {
 					}
 				}
+			} else if (track_cache_type == Animation::TYPE_POSITION_2D) {
+				TrackCacheTransform2D *track_xform = static_cast<TrackCacheTransform2D *>(track);
+				if (track->setup_pass != setup_pass) {
+					track_xform->loc_used = false;
+					track_xform->rot_used = false;
+					track_xform->scale_used = false;
+				}
+				switch (track_type) {
+					case Animation::TYPE_POSITION_2D: {
+						track_xform->loc_used = true;
+					} break;
+					case Animation::TYPE_ROTATION_2D: {
+						track_xform->rot_used = true;
+					} break;
+					case Animation::TYPE_SCALE_2D: {
+						track_xform->scale_used = true;
+					} break;
+					default: {
+					}
+				}
 			} else if (track_cache_type == Animation::TYPE_VALUE) {
 				// If it has at least one angle interpolation, it also uses angle interpolation for blending.
 				TrackCacheValue *track_value = static_cast<TrackCacheValue *>(track);
@@ -825,6 +907,20 @@ bool AnimationMixer::_update_caches() {
 	return true;
 }
 
+void AnimationMixer::TrackCacheValue::apply_value(Object *p_object, const Variant &p_value) const {
+	if (setter && !p_object->get_script_instance()) {
+		// Same call Object::set() ends up doing, without looking the property up again.
+		Callable::CallError ce;
+		const Variant *args[1] = { &p_value };
+		setter->call(p_object, args, 1, ce);
+		if (ce.error == Callable::CallError::CALL_OK) {
+			return;
+		}
+		// Let the regular path convert the value or report the error.
+	}
+	p_object->set_indexed(subpath, p_value);
+}
+
 /* -------------------------------------------- */
 /* -- Blending processor ---------------------- */
 /* -------------------------------------------- */
@@ -867,6 +963,8 @@ void AnimationMixer::_blend_init() {
 		}
 	}
 
+	bool can_blend_typed = !GDVIRTUAL_IS_OVERRIDDEN(_post_process_key_value);
+
 	// Init all value/transform/blend/bezier tracks that track_cache has.
 	for (const KeyValue<NodePath, TrackCache *> &K : track_cache) {
 		TrackCache *track = K.value;
@@ -889,10 +987,37 @@ void AnimationMixer::_blend_init() {
 				TrackCacheBlendShape *t = static_cast<TrackCacheBlendShape *>(track);
 				t->value = t->init_value;
 			} break;
+			case Animation::TYPE_POSITION_2D: {
+				TrackCacheTransform2D *t = static_cast<TrackCacheTransform2D *>(track);
+				t->loc = t->init_loc;
+				t->rot = t->init_rot;
+				t->scale = t->init_scale;
+			} break;
 			case Animation::TYPE_VALUE: {
 				TrackCacheValue *t = static_cast<TrackCacheValue *>(track);
 				t->value = Animation::cast_to_blendwise(t->init_value);
 				t->element_size = t->init_value.is_string() ? (real_t)(t->init_value.operator String()).length() : 0;
+
+				// The typed path doesn't go through post_process_key_value(), so scripts overriding it keep the Variant path.
+				t->typed_type = Variant::NIL;
+				if (t->is_continuous && !t->is_using_angle && can_blend_typed) {
+					switch (t->init_value.get_type()) {
+						case Variant::FLOAT: {
+							t->typed_type = Variant::FLOAT;
+							t->typed_float = t->init_value;
+						} break;
+						case Variant::VECTOR2: {
+							t->typed_type = Variant::VECTOR2;
+							t->typed_vector2 = t->init_value;
+						} break;
+						case Variant::COLOR: {
+							t->typed_type = Variant::COLOR;
+							t->typed_color = t->init_value;
+						} break;
+						default: {
+						} break;
+					}
+				}
 			} break;
 			case Animation::TYPE_BEZIER: {
 				TrackCacheBezier *t = static_cast<TrackCacheBezier *>(track);
@@ -951,6 +1076,7 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 #ifdef TOOLS_ENABLED
 	bool can_call = is_inside_tree() && !Engine::get_singleton()->is_editor_hint();
 #endif // TOOLS_ENABLED
+	bool post_process_transform_2d = GDVIRTUAL_IS_OVERRIDDEN(_post_process_key_value);
 	for (const AnimationInstance &ai : animation_instances) {
 		Ref<Animation> a = ai.animation_data.animation;
 		double time = ai.playback_info.time;
@@ -984,7 +1110,8 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 				blend = blend / track->total_weight;
 			}
 			Animation::TrackType ttype = a->track_get_type(i);
-			if (ttype != Animation::TYPE_POSITION_3D && ttype != Animation::TYPE_ROTATION_3D && ttype != Animation::TYPE_SCALE_3D && track->type != ttype) {
+			Animation::TrackType tcache_type = (ttype == Animation::TYPE_ROTATION_2D || ttype == Animation::TYPE_SCALE_2D) ? Animation::TYPE_POSITION_2D : ttype;
+			if (ttype != Animation::TYPE_POSITION_3D && ttype != Animation::TYPE_ROTATION_3D && ttype != Animation::TYPE_SCALE_3D && track->type != tcache_type) {
 				// Broken animation, but avoid error spamming.
 				continue;
 			}
@@ -998,13 +1125,83 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 				} break;
 				case Animation::TYPE_BLEND_SHAPE: {
 				} break;
+				case Animation::TYPE_POSITION_2D: {
+					if (Math::is_zero_approx(blend)) {
+						continue; // Nothing to blend.
+					}
+					TrackCacheTransform2D *t = static_cast<TrackCacheTransform2D *>(track);
+					Vector2 loc;
+					if (a->try_position_2d_track_interpolate(i, time, &loc, &t->loc_cursors.get(a->get_instance_id())) != OK) {
+						continue;
+					}
+					if (post_process_transform_2d) {
+						loc = post_process_key_value(a, i, loc, t->object);
+					}
+					t->loc += (loc - t->init_loc) * blend;
+				} break;
+				case Animation::TYPE_ROTATION_2D: {
+					if (Math::is_zero_approx(blend)) {
+						continue; // Nothing to blend.
+					}
+					TrackCacheTransform2D *t = static_cast<TrackCacheTransform2D *>(track);
+					real_t rot = 0.0;
+					if (a->try_rotation_2d_track_interpolate(i, time, &rot, &t->rot_cursors.get(a->get_instance_id())) != OK) {
+						continue;
+					}
+					if (post_process_transform_2d) {
+						rot = post_process_key_value(a, i, rot, t->object);
+					}
+					// Take the shortest path from the initial angle, as Quaternion blending does in 3D.
+					t->rot += Math::angle_difference(t->init_rot, rot) * blend;
+				} break;
+				case Animation::TYPE_SCALE_2D: {
+					if (Math::is_zero_approx(blend)) {
+						continue; // Nothing to blend.
+					}
+					TrackCacheTransform2D *t = static_cast<TrackCacheTransform2D *>(track);
+					Vector2 scale;
+					if (a->try_scale_2d_track_interpolate(i, time, &scale, &t->scale_cursors.get(a->get_instance_id())) != OK) {
+						continue;
+					}
+					if (post_process_transform_2d) {
+						scale = post_process_key_value(a, i, scale, t->object);
+					}
+					t->scale += (scale - t->init_scale) * blend;
+				} break;
 				case Animation::TYPE_VALUE: {
 					if (Math::is_zero_approx(blend)) {
 						continue; // Nothing to blend.
 					}
 					TrackCacheValue *t = static_cast<TrackCacheValue *>(track);
 					if (t->is_continuous) {
-						Variant value = a->value_track_interpolate(i, time);
+						int &cursor = t->get_key_cursor(a->get_instance_id());
+						if (t->typed_type != Variant::NIL) {
+							switch (t->typed_type) {
+								case Variant::FLOAT: {
+									real_t value = 0.0;
+									if (a->value_track_interpolate_cursor(i, time, cursor, value)) {
+										t->typed_float += (value - t->init_value.operator double()) * (float)blend;
+									}
+								} break;
+								case Variant::VECTOR2: {
+									Vector2 value;
+									if (a->value_track_interpolate_cursor(i, time, cursor, value)) {
+										t->typed_vector2 += (value - t->init_value.operator Vector2()) * (float)blend;
+									}
+								} break;
+								case Variant::COLOR: {
+									Color value;
+									if (a->value_track_interpolate_cursor(i, time, cursor, value)) {
+										t->typed_color += (value - t->init_value.operator Color()) * (float)blend;
+									}
+								} break;
+								default: {
+								} break;
+							}
+							continue;
+						}
+						Variant value;
+						a->value_track_interpolate_cursor(i, time, cursor, value);
 						value = post_process_key_value(a, i, value, t->object);
 						if (value == Variant()) {
 							continue;
@@ -1046,14 +1243,14 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 							}
 							Variant value = a->track_get_key_value(i, idx);
 							value = post_process_key_value(a, i, value, t->object);
-							t->object->set_indexed(t->subpath, value);
+							t->apply_value(t->object, value);
 						} else {
 							List<int> indices;
 							a->track_get_key_indices_in_range(i, time, delta, &indices, looped_flag);
 							for (int &F : indices) {
 								Variant value = a->track_get_key_value(i, F);
 								value = post_process_key_value(a, i, value, t->object);
-								t->object->set_indexed(t->subpath, value);
+								t->apply_value(t->object, value);
 							}
 						}
 					}
@@ -1259,6 +1456,24 @@ void AnimationMixer::_blend_apply() {
 			} break;
 			case Animation::TYPE_BLEND_SHAPE: {
 			} break;
+			case Animation::TYPE_POSITION_2D: {
+				TrackCacheTransform2D *t = static_cast<TrackCacheTransform2D *>(track);
+
+				// t->node_2d isn't safe here, get instance from id (GH-85365).
+				Node2D *node_2d = Object::cast_to<Node2D>(ObjectDB::get_instance(t->object_id));
+				if (!node_2d) {
+					break;
+				}
+				if (t->loc_used) {
+					node_2d->set_position(t->loc);
+				}
+				if (t->rot_used) {
+					node_2d->set_rotation(t->rot);
+				}
+				if (t->scale_used) {
+					node_2d->set_scale(t->scale);
+				}
+			} break;
 			case Animation::TYPE_VALUE: {
 				TrackCacheValue *t = static_cast<TrackCacheValue *>(track);
 
@@ -1282,7 +1497,20 @@ void AnimationMixer::_blend_apply() {
 				// t->object isn't safe here, get instance from id (GH-85365).
 				Object *obj = ObjectDB::get_instance(t->object_id);
 				if (obj) {
-					obj->set_indexed(t->subpath, Animation::cast_from_blendwise(t->value, t->init_value.get_type()));
+					switch (t->typed_type) {
+						case Variant::FLOAT: {
+							t->apply_value(obj, t->typed_float);
+						} break;
+						case Variant::VECTOR2: {
+							t->apply_value(obj, t->typed_vector2);
+						} break;
+						case Variant::COLOR: {
+							t->apply_value(obj, t->typed_color);
+						} break;
+						default: {
+							t->apply_value(obj, Animation::cast_from_blendwise(t->value, t->init_value.get_type()));
+						} break;
+					}
 				}
 
 			} break;
@@ -1456,10 +1684,17 @@ void AnimationMixer::_build_backup_track_cache() {
 			} break;
 			case Animation::TYPE_BLEND_SHAPE: {
 			} break;
+			case Animation::TYPE_POSITION_2D: {
+				TrackCacheTransform2D *t = static_cast<TrackCacheTransform2D *>(track);
+				t->loc = t->node_2d->get_position();
+				t->rot = t->node_2d->get_rotation();
+				t->scale = t->node_2d->get_scale();
+			} break;
 			case Animation::TYPE_VALUE: {
 				TrackCacheValue *t = static_cast<TrackCacheValue *>(track);
 				t->value = t->object->get_indexed(t->subpath);
 				t->is_continuous = true;
+				t->typed_type = Variant::NIL;
 			} break;
 			case Animation::TYPE_BEZIER: {
 				TrackCacheBezier *t = static_cast<TrackCacheBezier *>(track);
@@ -1730,6 +1965,14 @@ AnimationMixer::TrackCache *AnimatedValuesBackup::get_cache_copy(AnimationMixer:
 			return tc;
 		}
 
+		case Animation::TYPE_POSITION_2D:
+		case Animation::TYPE_ROTATION_2D:
+		case Animation::TYPE_SCALE_2D: {
+			AnimationMixer::TrackCacheTransform2D *src = static_cast<AnimationMixer::TrackCacheTransform2D *>(p_cache);
+			AnimationMixer::TrackCacheTransform2D *tc = memnew(AnimationMixer::TrackCacheTransform2D(*src));
+			return tc;
+		}
+
 		case Animation::TYPE_BLEND_SHAPE: {
 			AnimationMixer::TrackCacheBlendShape *src = static_cast<AnimationMixer::TrackCacheBlendShape *>(p_cache);
 			AnimationMixer::TrackCacheBlendShape *tc = memnew(AnimationMixer::TrackCacheBlendShape(*src));
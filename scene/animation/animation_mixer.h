@@ -37,6 +37,7 @@
 #include "scene/resources/audio_stream_polyphonic.h"
 
 class AnimatedValuesBackup;
+class Node2D;
 
 class AnimationMixer : public Node {
 	GDCLASS(AnimationMixer, Node);
@@ -132,6 +133,27 @@ protected:
 	uint64_t setup_pass = 1;
 	uint64_t process_pass = 1;
 
+	// Last key found in each animation, so sequential playback doesn't have to search the keys again.
+	struct KeyCursors {
+		struct Cursor {
+			ObjectID animation;
+			int key = -1;
+		};
+		LocalVector<Cursor> cursors;
+
+		int &get(ObjectID p_animation) {
+			for (Cursor &E : cursors) {
+				if (E.animation == p_animation) {
+					return E.key;
+				}
+			}
+			Cursor cursor;
+			cursor.animation = p_animation;
+			cursors.push_back(cursor);
+			return cursors[cursors.size() - 1].key;
+		}
+	};
+
 	struct TrackCache {
 		bool root_motion = false;
 		uint64_t setup_pass = 0;
@@ -184,6 +206,42 @@ protected:
 		~TrackCacheTransform() {}
 	};
 
+	struct TrackCacheTransform2D : public TrackCache {
+		Node2D *node_2d = nullptr;
+		bool loc_used = false;
+		bool rot_used = false;
+		bool scale_used = false;
+		Vector2 init_loc = Vector2(0, 0);
+		real_t init_rot = 0.0;
+		Vector2 init_scale = Vector2(1, 1);
+		Vector2 loc;
+		real_t rot = 0.0;
+		Vector2 scale;
+
+		KeyCursors loc_cursors;
+		KeyCursors rot_cursors;
+		KeyCursors scale_cursors;
+
+		TrackCacheTransform2D(const TrackCacheTransform2D &p_other) :
+				TrackCache(p_other),
+				node_2d(p_other.node_2d),
+				loc_used(p_other.loc_used),
+				rot_used(p_other.rot_used),
+				scale_used(p_other.scale_used),
+				init_loc(p_other.init_loc),
+				init_rot(p_other.init_rot),
+				init_scale(p_other.init_scale),
+				loc(p_other.loc),
+				rot(p_other.rot),
+				scale(p_other.scale) {
+		}
+
+		TrackCacheTransform2D() {
+			type = Animation::TYPE_POSITION_2D;
+		}
+		~TrackCacheTransform2D() {}
+	};
+
 	struct RootMotionCache {
 		Vector3 loc = Vector3(0, 0, 0);
 		Quaternion rot = Quaternion(0, 0, 0, 1);
@@ -213,6 +271,22 @@ protected:
 		bool is_using_angle = false;
 		Variant element_size;
 
+		// FLOAT, VECTOR2 or COLOR while the track is blended without Variant arithmetic, NIL otherwise.
+		Variant::Type typed_type = Variant::NIL;
+		double typed_float = 0.0;
+		Vector2 typed_vector2;
+		Color typed_color;
+
+		MethodBind *setter = nullptr; // Native setter of a single property subpath, used instead of Object::set_indexed().
+
+		KeyCursors key_cursors;
+
+		int &get_key_cursor(ObjectID p_animation) {
+			return key_cursors.get(p_animation);
+		}
+
+		void apply_value(Object *p_object, const Variant &p_value) const;
+
 		TrackCacheValue(const TrackCacheValue &p_other) :
 				TrackCache(p_other),
 				init_value(p_other.init_value),
@@ -220,7 +294,12 @@ protected:
 				subpath(p_other.subpath),
 				is_continuous(p_other.is_continuous),
 				is_using_angle(p_other.is_using_angle),
-				element_size(p_other.element_size) {}
+				element_size(p_other.element_size),
+				typed_type(p_other.typed_type),
+				typed_float(p_other.typed_float),
+				typed_vector2(p_other.typed_vector2),
+				typed_color(p_other.typed_color),
+				setter(p_other.setter) {}
 
 		TrackCacheValue() { type = Animation::TYPE_VALUE; }
 		~TrackCacheValue() {
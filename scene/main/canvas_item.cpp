@@ -135,6 +135,12 @@ void CanvasItem::_redraw_callback() {
 	RenderingServer::get_singleton()->canvas_item_clear(get_canvas_item());
 	//todo updating = true - only allow drawing here
 	if (is_visible_in_tree()) {
+		// Glyphs can only be skipped with asynchronous rasterization. The count is per thread, so it
+		// only changes for glyphs skipped while drawing this item.
+		Ref<TextServer> ts = TS;
+		bool track_deferred_glyphs = ts.is_valid() && ts->is_async_glyph_rasterization();
+		int64_t deferred_glyphs = track_deferred_glyphs ? ts->get_deferred_glyph_count() : 0;
+
 		drawing = true;
 		current_item_drawn = this;
 		notification(NOTIFICATION_DRAW);
@@ -142,11 +148,31 @@ void CanvasItem::_redraw_callback() {
 		GDVIRTUAL_CALL(_draw);
 		current_item_drawn = nullptr;
 		drawing = false;
+
+		if (track_deferred_glyphs && !deferred_glyph_redraw && ts->get_deferred_glyph_count() != deferred_glyphs) {
+			// Some glyphs are still being rasterized in the background, draw again on the next frame.
+			// Drawing may happen on another thread, so the redraw is scheduled from the main one.
+			deferred_glyph_redraw = true;
+			callable_mp(this, &CanvasItem::_schedule_deferred_glyph_redraw).call_deferred();
+		}
 	}
 	//todo updating = false
 	pending_update = false; // don't change to false until finished drawing (avoid recursive update)
 }
 
+void CanvasItem::_schedule_deferred_glyph_redraw() {
+	if (!is_inside_tree()) {
+		deferred_glyph_redraw = false;
+		return;
+	}
+	get_tree()->connect(SNAME("process_frame"), callable_mp(this, &CanvasItem::_redraw_deferred_glyphs), CONNECT_ONE_SHOT);
+}
+
+void CanvasItem::_redraw_deferred_glyphs() {
+	deferred_glyph_redraw = false;
+	queue_redraw();
+}
+
 Transform2D CanvasItem::get_global_transform_with_canvas() const {
 	ERR_READ_THREAD_GUARD_V(Transform2D());
 	if (canvas_layer) {
@@ -341,6 +367,12 @@ void CanvasItem::_notification(int p_what) {
 			if (xform_change.in_list()) {
 				get_tree()->xform_change_list.remove(&xform_change);
 			}
+			if (xform_batch.in_list()) {
+				get_tree()->canvas_item_xform_batch_list.remove(&xform_batch);
+				if (!get_tree()->canvas_item_xform_direct_sets.erase(canvas_item)) {
+					RenderingServer::get_singleton()->canvas_item_set_transform(canvas_item, get_transform());
+				}
+			}
 			_exit_canvas();
 			if (C) {
 				Object::cast_to<CanvasItem>(get_parent())->children_items.erase(C);
@@ -879,6 +911,24 @@ void CanvasItem::draw_char_outline(const Ref<Font> &p_font, const Point2 &p_pos,
 	p_font->draw_char_outline(canvas_item, p_pos, p_char[0], p_font_size, p_size, p_modulate);
 }
 
+void CanvasItem::_queue_canvas_item_transform() {
+	// Transforms set on the main thread while inside the tree are sent to the
+	// RenderingServer in bulk by SceneTree::flush_canvas_item_transforms(),
+	// which also runs before each frame is drawn.
+	if (is_inside_tree() && Thread::is_main_thread()) {
+		SceneTree *tree = get_tree();
+		if (!tree->canvas_item_xform_direct_sets.is_empty()) {
+			// Moved again after a direct set, the node's transform is the newest one.
+			tree->canvas_item_xform_direct_sets.erase(canvas_item);
+		}
+		if (!xform_batch.in_list()) {
+			tree->canvas_item_xform_batch_list.add(&xform_batch);
+		}
+	} else {
+		RenderingServer::get_singleton()->canvas_item_set_transform(canvas_item, get_transform());
+	}
+}
+
 void CanvasItem::_notify_transform_deferred() {
 	if (is_inside_tree() && notify_transform && !xform_change.in_list()) {
 		get_tree()->xform_change_list.add(&xform_change);
@@ -1488,7 +1538,8 @@ CanvasItem::TextureRepeat CanvasItem::get_texture_repeat_in_tree() const {
 }
 
 CanvasItem::CanvasItem() :
-		xform_change(this) {
+		xform_change(this),
+		xform_batch(this) {
 	canvas_item = RenderingServer::get_singleton()->canvas_item_create();
 }
 
@@ -76,6 +76,7 @@ public:
 private:
 	mutable SelfList<Node>
 			xform_change;
+	SelfList<CanvasItem> xform_batch;
 
 	RID canvas_item;
 	StringName canvas_group;
@@ -99,6 +100,7 @@ private:
 	bool visible = true;
 	bool parent_visible_in_tree = false;
 	bool pending_update = false;
+	bool deferred_glyph_redraw = false; // A redraw is scheduled for glyphs rasterized in the background.
 	bool top_level = false;
 	bool drawing = false;
 	bool block_transform_notify = false;
@@ -132,6 +134,8 @@ private:
 	virtual void _top_level_changed_on_parent();
 
 	void _redraw_callback();
+	void _schedule_deferred_glyph_redraw();
+	void _redraw_deferred_glyphs();
 
 	void _enter_canvas();
 	void _exit_canvas();
@@ -159,6 +163,8 @@ protected:
 
 	void item_rect_changed(bool p_size_changed = true);
 
+	void _queue_canvas_item_transform();
+
 	void _notification(int p_what);
 	static void _bind_methods();
 	void _validate_property(PropertyInfo &p_property) const;
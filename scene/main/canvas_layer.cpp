@@ -293,6 +293,15 @@ float CanvasLayer::get_follow_viewport_scale() const {
 	return follow_viewport_scale;
 }
 
+void CanvasLayer::set_use_spatial_index(bool p_enable) {
+	use_spatial_index = p_enable;
+	RS::get_singleton()->canvas_set_use_spatial_index(canvas, use_spatial_index);
+}
+
+bool CanvasLayer::is_using_spatial_index() const {
+	return use_spatial_index;
+}
+
 void CanvasLayer::_update_follow_viewport(bool p_force_exit) {
 	if (!is_inside_tree()) {
 		return;
@@ -338,6 +347,9 @@ void CanvasLayer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_follow_viewport_scale", "scale"), &CanvasLayer::set_follow_viewport_scale);
 	ClassDB::bind_method(D_METHOD("get_follow_viewport_scale"), &CanvasLayer::get_follow_viewport_scale);
 
+	ClassDB::bind_method(D_METHOD("set_use_spatial_index", "enable"), &CanvasLayer::set_use_spatial_index);
+	ClassDB::bind_method(D_METHOD("is_using_spatial_index"), &CanvasLayer::is_using_spatial_index);
+
 	ClassDB::bind_method(D_METHOD("set_custom_viewport", "viewport"), &CanvasLayer::set_custom_viewport);
 	ClassDB::bind_method(D_METHOD("get_custom_viewport"), &CanvasLayer::get_custom_viewport);
 
@@ -346,6 +358,7 @@ void CanvasLayer::_bind_methods() {
 	ADD_GROUP("Layer", "");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "layer", PROPERTY_HINT_RANGE, "-128,128,1"), "set_layer", "get_layer");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "visible"), "set_visible", "is_visible");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "use_spatial_index"), "set_use_spatial_index", "is_using_spatial_index");
 	ADD_GROUP("Transform", "");
 	ADD_PROPERTY(PropertyInfo(Variant::VECTOR2, "offset", PROPERTY_HINT_NONE, "suffix:px"), "set_offset", "get_offset");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "rotation", PROPERTY_HINT_RANGE, "-1080,1080,0.1,or_less,or_greater,radians_as_degrees"), "set_rotation", "get_rotation");
@@ -57,6 +57,8 @@ class CanvasLayer : public Node {
 	bool follow_viewport = false;
 	float follow_viewport_scale = 1.0;
 
+	bool use_spatial_index = false;
+
 	void _update_xform();
 	void _update_locrotscale();
 	void _update_follow_viewport(bool p_force_exit = false);
@@ -106,6 +108,9 @@ public:
 	void set_follow_viewport_scale(float p_ratio);
 	float get_follow_viewport_scale() const;
 
+	void set_use_spatial_index(bool p_enable);
+	bool is_using_spatial_index() const;
+
 	RID get_canvas() const;
 
 	CanvasLayer();
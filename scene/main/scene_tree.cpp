@@ -70,16 +70,110 @@ void SceneTreeTimer::_bind_methods() {
 	ADD_SIGNAL(MethodInfo("timeout"));
 }
 
+bool SceneTreeTimerQueue::_is_before(uint32_t p_a, uint32_t p_b) const {
+	const SceneTreeTimer *a = heap[p_a].ptr();
+	const SceneTreeTimer *b = heap[p_b].ptr();
+	// Timers expiring at the same time fire in creation order.
+	return a->expiry_time < b->expiry_time || (a->expiry_time == b->expiry_time && a->serial < b->serial);
+}
+
+void SceneTreeTimerQueue::_set(uint32_t p_index, const Ref<SceneTreeTimer> &p_timer) {
+	heap[p_index] = p_timer;
+	p_timer->heap_index = p_index;
+}
+
+void SceneTreeTimerQueue::_sift_up(uint32_t p_index) {
+	while (p_index > 0) {
+		uint32_t parent = (p_index - 1) / 2;
+		if (!_is_before(p_index, parent)) {
+			break;
+		}
+		Ref<SceneTreeTimer> timer = heap[p_index];
+		_set(p_index, heap[parent]);
+		_set(parent, timer);
+		p_index = parent;
+	}
+}
+
+void SceneTreeTimerQueue::_sift_down(uint32_t p_index) {
+	uint32_t size = heap.size();
+	while (true) {
+		uint32_t smallest = p_index;
+		uint32_t left = p_index * 2 + 1;
+		uint32_t right = left + 1;
+		if (left < size && _is_before(left, smallest)) {
+			smallest = left;
+		}
+		if (right < size && _is_before(right, smallest)) {
+			smallest = right;
+		}
+		if (smallest == p_index) {
+			break;
+		}
+		Ref<SceneTreeTimer> timer = heap[p_index];
+		_set(p_index, heap[smallest]);
+		_set(smallest, timer);
+		p_index = smallest;
+	}
+}
+
+void SceneTreeTimerQueue::push(const Ref<SceneTreeTimer> &p_timer) {
+	p_timer->queue = this;
+	p_timer->expiry_time = time + p_timer->time_left;
+	heap.push_back(p_timer);
+	p_timer->heap_index = heap.size() - 1;
+	_sift_up(heap.size() - 1);
+}
+
+Ref<SceneTreeTimer> SceneTreeTimerQueue::pop() {
+	Ref<SceneTreeTimer> timer = heap[0];
+	remove(0);
+	return timer;
+}
+
+void SceneTreeTimerQueue::update(uint32_t p_index) {
+	Ref<SceneTreeTimer> timer = heap[p_index];
+	_sift_up(p_index);
+	_sift_down(timer->heap_index);
+}
+
+void SceneTreeTimerQueue::remove(uint32_t p_index) {
+	Ref<SceneTreeTimer> timer = heap[p_index];
+	uint32_t last = heap.size() - 1;
+	if (p_index != last) {
+		_set(p_index, heap[last]);
+	}
+	heap.resize(last);
+	if (p_index < last) {
+		update(p_index);
+	}
+
+	timer->time_left = timer->expiry_time - time;
+	timer->queue = nullptr;
+}
+
 void SceneTreeTimer::set_time_left(double p_time) {
-	time_left = p_time;
+	if (queue) {
+		expiry_time = queue->time + p_time;
+		queue->update(heap_index);
+	} else {
+		time_left = p_time;
+	}
 }
 
 double SceneTreeTimer::get_time_left() const {
+	if (queue) {
+		return MAX(expiry_time - queue->time, 0.0);
+	}
 	return MAX(time_left, 0.0);
 }
 
 void SceneTreeTimer::set_process_always(bool p_process_always) {
+	if (process_always == p_process_always) {
+		return;
+	}
 	process_always = p_process_always;
+	_reschedule();
 }
 
 bool SceneTreeTimer::is_process_always() {
@@ -87,7 +181,11 @@ bool SceneTreeTimer::is_process_always() {
 }
 
 void SceneTreeTimer::set_process_in_physics(bool p_process_in_physics) {
+	if (process_in_physics == p_process_in_physics) {
+		return;
+	}
 	process_in_physics = p_process_in_physics;
+	_reschedule();
 }
 
 bool SceneTreeTimer::is_process_in_physics() {
@@ -95,13 +193,24 @@ bool SceneTreeTimer::is_process_in_physics() {
 }
 
 void SceneTreeTimer::set_ignore_time_scale(bool p_ignore) {
+	if (ignore_time_scale == p_ignore) {
+		return;
+	}
 	ignore_time_scale = p_ignore;
+	_reschedule();
 }
 
 bool SceneTreeTimer::is_ignore_time_scale() {
 	return ignore_time_scale;
 }
 
+void SceneTreeTimer::_reschedule() {
+	// The flags select the queue, so a scheduled timer has to move to the one matching them.
+	if (queue && SceneTree::get_singleton()) {
+		SceneTree::get_singleton()->_reschedule_timer(this);
+	}
+}
+
 void SceneTreeTimer::release_connections() {
 	List<Connection> signal_connections;
 	get_all_signal_connections(&signal_connections);
@@ -183,6 +292,66 @@ void SceneTree::flush_transform_notifications() {
 		n = nx;
 		node->notification(NOTIFICATION_TRANSFORM_CHANGED);
 	}
+
+	flush_canvas_item_transforms();
+}
+
+void SceneTree::flush_canvas_item_transforms() {
+	SelfList<CanvasItem> *first = canvas_item_xform_batch_list.first();
+	if (!first) {
+		canvas_item_xform_direct_sets.clear();
+		return;
+	}
+
+	if (!first->next()) {
+		CanvasItem *ci = first->self();
+		canvas_item_xform_batch_list.remove(first);
+		if (canvas_item_xform_direct_sets.is_empty() || !canvas_item_xform_direct_sets.has(ci->get_canvas_item())) {
+			RenderingServer::get_singleton()->canvas_item_set_transform(ci->get_canvas_item(), ci->get_transform());
+		}
+		canvas_item_xform_direct_sets.clear();
+		return;
+	}
+
+	int count = 0;
+	for (SelfList<CanvasItem> *n = first; n; n = n->next()) {
+		count++;
+	}
+
+	Vector<RID> items;
+	Vector<Transform2D> transforms;
+	items.resize(count);
+	transforms.resize(count);
+	RID *items_ptrw = items.ptrw();
+	Transform2D *transforms_ptrw = transforms.ptrw();
+
+	int idx = 0;
+	while (SelfList<CanvasItem> *n = canvas_item_xform_batch_list.first()) {
+		CanvasItem *ci = n->self();
+		canvas_item_xform_batch_list.remove(n);
+		if (!canvas_item_xform_direct_sets.is_empty() && canvas_item_xform_direct_sets.has(ci->get_canvas_item())) {
+			continue;
+		}
+		items_ptrw[idx] = ci->get_canvas_item();
+		transforms_ptrw[idx] = ci->get_transform();
+		idx++;
+	}
+	canvas_item_xform_direct_sets.clear();
+
+	if (idx < count) {
+		items.resize(idx);
+		transforms.resize(idx);
+	}
+	RenderingServer::get_singleton()->canvas_items_set_transforms(items, transforms);
+}
+
+void SceneTree::_canvas_item_transform_set(RID p_item) {
+	// A transform set directly is newer than the one batched for the item, so the batched one is skipped.
+	// Only the RID is recorded here; the flush checks it in constant time.
+	if (!singleton || !Thread::is_main_thread() || singleton->canvas_item_xform_batch_list.first() == nullptr) {
+		return;
+	}
+	singleton->canvas_item_xform_direct_sets.insert(p_item);
 }
 
 void SceneTree::_flush_ugc() {
@@ -519,6 +688,10 @@ bool SceneTree::process(double p_time) {
 
 	process_tweens(p_time, false);
 
+	if (low_priority_call_queue.has_messages()) {
+		low_priority_call_queue.flush(low_priority_calls_budget_usec);
+	}
+
 	flush_transform_notifications(); //additional transforms after timers update
 
 	_call_idle_callbacks();
@@ -526,63 +699,92 @@ bool SceneTree::process(double p_time) {
 	return _quit;
 }
 
+void SceneTree::_schedule_timer(const Ref<SceneTreeTimer> &p_timer) {
+	int queue_index = 0;
+	if (p_timer->is_process_in_physics()) {
+		queue_index |= TIMER_QUEUE_PHYSICS;
+	}
+	if (p_timer->is_process_always()) {
+		queue_index |= TIMER_QUEUE_PROCESS_ALWAYS;
+	}
+	if (p_timer->is_ignore_time_scale()) {
+		queue_index |= TIMER_QUEUE_IGNORE_TIME_SCALE;
+	}
+	timer_queues[queue_index].push(p_timer);
+}
+
+void SceneTree::_reschedule_timer(const Ref<SceneTreeTimer> &p_timer) {
+	_THREAD_SAFE_METHOD_
+	p_timer->queue->remove(p_timer->heap_index);
+	if (processing_timers) {
+		pending_timers.push_back(p_timer);
+	} else {
+		_schedule_timer(p_timer);
+	}
+}
+
 void SceneTree::process_timers(double p_delta, bool p_physics_frame) {
 	_THREAD_SAFE_METHOD_
-	List<Ref<SceneTreeTimer>>::Element *L = timers.back(); //last element
+	processing_timers = true;
 
-	for (List<Ref<SceneTreeTimer>>::Element *E = timers.front(); E;) {
-		List<Ref<SceneTreeTimer>>::Element *N = E->next();
-		if ((paused && !E->get()->is_process_always()) || (E->get()->is_process_in_physics() != p_physics_frame)) {
-			if (E == L) {
-				break; //break on last, so if new timers were added during list traversal, ignore them.
-			}
-			E = N;
+	for (int queue_index = 0; queue_index < TIMER_QUEUE_MAX; queue_index++) {
+		if (bool(queue_index & TIMER_QUEUE_PHYSICS) != p_physics_frame) {
 			continue;
 		}
-
-		double time_left = E->get()->get_time_left();
-		if (E->get()->is_ignore_time_scale()) {
-			time_left -= Engine::get_singleton()->get_process_step();
-		} else {
-			time_left -= p_delta;
+		if (paused && !(queue_index & TIMER_QUEUE_PROCESS_ALWAYS)) {
+			continue;
 		}
-		E->get()->set_time_left(time_left);
 
-		if (time_left <= 0) {
-			E->get()->emit_signal(SNAME("timeout"));
-			timers.erase(E);
+		// Only the timers that expire are touched.
+		SceneTreeTimerQueue &queue = timer_queues[queue_index];
+		queue.time += (queue_index & TIMER_QUEUE_IGNORE_TIME_SCALE) ? Engine::get_singleton()->get_process_step() : p_delta;
+		while (!queue.heap.is_empty() && queue.heap[0]->expiry_time <= queue.time) {
+			Ref<SceneTreeTimer> timer = queue.pop();
+			timer->emit_signal(SNAME("timeout"));
 		}
-		if (E == L) {
-			break; //break on last, so if new timers were added during list traversal, ignore them.
-		}
-		E = N;
 	}
+
+	processing_timers = false;
+
+	// Timers created during traversal are ignored until the next frame.
+	for (const Ref<SceneTreeTimer> &timer : pending_timers) {
+		_schedule_timer(timer);
+	}
+	pending_timers.clear();
 }
 
 void SceneTree::process_tweens(double p_delta, bool p_physics) {
 	_THREAD_SAFE_METHOD_
-	// This methods works similarly to how SceneTreeTimers are handled.
-	List<Ref<Tween>>::Element *L = tweens.back();
+	// Tweens created while processing are appended, and ignored until the next frame.
+	uint32_t tween_count = tweens.size();
+	bool removed = false;
 
-	for (List<Ref<Tween>>::Element *E = tweens.front(); E;) {
-		List<Ref<Tween>>::Element *N = E->next();
+	for (uint32_t i = 0; i < tween_count; i++) {
+		Ref<Tween> tween = tweens[i];
 		// Don't process if paused or process mode doesn't match.
-		if (!E->get()->can_process(paused) || (p_physics == (E->get()->get_process_mode() == Tween::TWEEN_PROCESS_IDLE))) {
-			if (E == L) {
-				break;
-			}
-			E = N;
+		if (tween.is_null() || !tween->can_process(paused) || (p_physics == (tween->get_process_mode() == Tween::TWEEN_PROCESS_IDLE))) {
 			continue;
 		}
 
-		if (!E->get()->step(p_delta)) {
-			E->get()->clear();
-			tweens.erase(E);
+		if (!tween->step(p_delta)) {
+			tween->clear();
+			tweens[i] = Ref<Tween>();
+			removed = true;
 		}
-		if (E == L) {
-			break;
+	}
+
+	if (removed) {
+		// Remove finished tweens, keeping the processing order.
+		uint32_t valid_count = 0;
+		for (uint32_t i = 0; i < tweens.size(); i++) {
+			if (tweens[i].is_valid()) {
+				if (i != valid_count) {
+					tweens[valid_count] = tweens[i];
+				}
+				valid_count++;
+			}
 		}
-		E = N;
+		tweens.resize(valid_count);
 	}
 }
 
@@ -605,14 +807,25 @@ void SceneTree::finalize() {
 	MainLoop::finalize();
 
 	// Cleanup timers.
-	for (Ref<SceneTreeTimer> &timer : timers) {
+	for (SceneTreeTimerQueue &queue : timer_queues) {
+		for (Ref<SceneTreeTimer> &timer : queue.heap) {
+			timer->release_connections();
+			timer->queue = nullptr;
+		}
+		queue.heap.clear();
+	}
+	for (Ref<SceneTreeTimer> &timer : pending_timers) {
 		timer->release_connections();
 	}
-	timers.clear();
+	pending_timers.clear();
+
+	low_priority_call_queue.clear();
 
 	// Cleanup tweens.
 	for (Ref<Tween> &tween : tweens) {
-		tween->clear();
+		if (tween.is_valid()) {
+			tween->clear();
+		}
 	}
 	tweens.clear();
 }
@@ -1306,6 +1519,11 @@ void SceneTree::_flush_delete_queue() {
 	}
 }
 
+void SceneTree::queue_low_priority_call(const Callable &p_callable) {
+	ERR_FAIL_COND(!p_callable.is_valid());
+	low_priority_call_queue.push_callable(p_callable);
+}
+
 void SceneTree::queue_delete(Object *p_object) {
 	_THREAD_SAFE_METHOD_
 	ERR_FAIL_NULL(p_object);
@@ -1417,7 +1635,12 @@ Ref<SceneTreeTimer> SceneTree::create_timer(double p_delay_sec, bool p_process_a
 	stt->set_time_left(p_delay_sec);
 	stt->set_process_in_physics(p_process_in_physics);
 	stt->set_ignore_time_scale(p_ignore_time_scale);
-	timers.push_back(stt);
+	stt->serial = timer_serial++;
+	if (processing_timers) {
+		pending_timers.push_back(stt);
+	} else {
+		_schedule_timer(stt);
+	}
 	return stt;
 }
 
@@ -1431,12 +1654,11 @@ Ref<Tween> SceneTree::create_tween() {
 TypedArray<Tween> SceneTree::get_processed_tweens() {
 	_THREAD_SAFE_METHOD_
 	TypedArray<Tween> ret;
-	ret.resize(tweens.size());
 
-	int i = 0;
 	for (const Ref<Tween> &tween : tweens) {
-		ret[i] = tween;
-		i++;
+		if (tween.is_valid()) {
+			ret.push_back(tween);
+		}
 	}
 
 	return ret;
@@ -1549,6 +1771,7 @@ void SceneTree::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("quit", "exit_code"), &SceneTree::quit, DEFVAL(EXIT_SUCCESS));
 
 	ClassDB::bind_method(D_METHOD("queue_delete", "obj"), &SceneTree::queue_delete);
+	ClassDB::bind_method(D_METHOD("queue_low_priority_call", "callable"), &SceneTree::queue_low_priority_call);
 
 	MethodInfo mi;
 	mi.name = "call_group_flags";
@@ -1669,6 +1892,7 @@ void SceneTree::set_disable_node_threading(bool p_disable) {
 SceneTree::SceneTree() {
 	if (singleton == nullptr) {
 		singleton = this;
+		RenderingServer::canvas_item_transform_set_callback = &SceneTree::_canvas_item_transform_set;
 	}
 	debug_collisions_color = GLOBAL_DEF("debug/shapes/collision/shape_color", Color(0.0, 0.6, 0.7, 0.42));
 	debug_collision_contact_color = GLOBAL_DEF("debug/shapes/collision/contact_color", Color(1.0, 0.2, 0.1, 0.8));
@@ -1678,6 +1902,8 @@ SceneTree::SceneTree() {
 
 	GLOBAL_DEF("debug/shapes/collision/draw_2d_outlines", true);
 
+	low_priority_calls_budget_usec = GLOBAL_DEF(PropertyInfo(Variant::INT, "application/run/low_priority_calls_budget_usec", PROPERTY_HINT_RANGE, "0,100000,1,or_greater"), 2000);
+
 	process_group_call_queue_allocator = memnew(CallQueue::Allocator(64));
 	Math::randomize();
 
@@ -1755,5 +1981,6 @@ SceneTree::~SceneTree() {
 
 	if (singleton == this) {
 		singleton = nullptr;
+		RenderingServer::canvas_item_transform_set_callback = nullptr;
 	}
 }
@@ -33,6 +33,8 @@
 
 #include "core/os/main_loop.h"
 #include "core/os/thread_safe.h"
+#include "core/templates/hash_set.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/paged_allocator.h"
 #include "core/templates/self_list.h"
 #include "scene/resources/mesh.h"
@@ -42,6 +44,7 @@
 class PackedScene;
 class Node;
 class Window;
+class CanvasItem;
 class Material;
 class Mesh;
 class MultiplayerAPI;
@@ -49,6 +52,25 @@ class SceneDebugger;
 class Tween;
 class Viewport;
 
+class SceneTreeTimer;
+
+// Timers advancing on the same clock, kept in a min-heap on their expiry time.
+struct SceneTreeTimerQueue {
+	double time = 0.0;
+	LocalVector<Ref<SceneTreeTimer>> heap;
+
+	void push(const Ref<SceneTreeTimer> &p_timer);
+	Ref<SceneTreeTimer> pop();
+	void update(uint32_t p_index);
+	void remove(uint32_t p_index);
+
+private:
+	_FORCE_INLINE_ bool _is_before(uint32_t p_a, uint32_t p_b) const;
+	_FORCE_INLINE_ void _set(uint32_t p_index, const Ref<SceneTreeTimer> &p_timer);
+	void _sift_up(uint32_t p_index);
+	void _sift_down(uint32_t p_index);
+};
+
 class SceneTreeTimer : public RefCounted {
 	GDCLASS(SceneTreeTimer, RefCounted);
 
@@ -57,6 +79,16 @@ class SceneTreeTimer : public RefCounted {
 	bool process_in_physics = false;
 	bool ignore_time_scale = false;
 
+	// While scheduled, the time left is computed from the queue's clock.
+	friend struct SceneTreeTimerQueue;
+	friend class SceneTree;
+	SceneTreeTimerQueue *queue = nullptr;
+	uint32_t heap_index = 0;
+	double expiry_time = 0.0;
+	uint64_t serial = 0;
+
+	void _reschedule();
+
 protected:
 	static void _bind_methods();
 
@@ -168,6 +200,10 @@ private:
 
 	List<ObjectID> delete_queue;
 
+	// Calls that can wait, flushed a time budget at a time at the end of each process frame.
+	CallQueue low_priority_call_queue;
+	uint64_t low_priority_calls_budget_usec = 0;
+
 	HashMap<UGCall, Vector<Variant>, UGCall> unique_group_calls;
 	bool ugc_locked = false;
 	void _flush_ugc();
@@ -191,8 +227,22 @@ private:
 
 	void _flush_scene_change();
 
-	List<Ref<SceneTreeTimer>> timers;
-	List<Ref<Tween>> tweens;
+	// One queue per combination of processing frame, pause mode and time scale handling.
+	enum {
+		TIMER_QUEUE_PHYSICS = 1,
+		TIMER_QUEUE_PROCESS_ALWAYS = 2,
+		TIMER_QUEUE_IGNORE_TIME_SCALE = 4,
+		TIMER_QUEUE_MAX = 8,
+	};
+	SceneTreeTimerQueue timer_queues[TIMER_QUEUE_MAX];
+	LocalVector<Ref<SceneTreeTimer>> pending_timers; // Created or moved to another queue while processing timers.
+	uint64_t timer_serial = 0;
+	bool processing_timers = false;
+	friend class SceneTreeTimer;
+	void _schedule_timer(const Ref<SceneTreeTimer> &p_timer);
+	void _reschedule_timer(const Ref<SceneTreeTimer> &p_timer);
+
+	LocalVector<Ref<Tween>> tweens; // Finished tweens are set to null while processing, then removed.
 
 	///network///
 
@@ -232,6 +282,14 @@ private:
 	friend class Viewport;
 
 	SelfList<Node>::List xform_change_list;
+	// Canvas items whose transform changed since the last flush; sent to the
+	// RenderingServer as a single bulk update.
+	SelfList<CanvasItem>::List canvas_item_xform_batch_list;
+	// Batched canvas items whose transform was set directly on the server
+	// since they were queued; the flush skips them.
+	HashSet<RID> canvas_item_xform_direct_sets;
+
+	static void _canvas_item_transform_set(RID p_item);
 
 #ifdef DEBUG_ENABLED // No live editor in release build.
 	friend class LiveEditor;
@@ -308,6 +366,7 @@ public:
 	}
 
 	void flush_transform_notifications();
+	void flush_canvas_item_transforms();
 
 	virtual void initialize() override;
 
@@ -375,6 +434,7 @@ public:
 	int get_node_count() const;
 
 	void queue_delete(Object *p_object);
+	void queue_low_priority_call(const Callable &p_callable);
 
 	void get_nodes_in_group(const StringName &p_group, List<Node *> *p_list);
 	Node *get_first_node_in_group(const StringName &p_group);
@@ -78,6 +78,12 @@ bool Animation::_set(const StringName &p_name, const Variant &p_value) {
 				add_track(TYPE_SCALE_3D);
 			} else if (type == "blend_shape") {
 				add_track(TYPE_BLEND_SHAPE);
+			} else if (type == "position_2d") {
+				add_track(TYPE_POSITION_2D);
+			} else if (type == "rotation_2d") {
+				add_track(TYPE_ROTATION_2D);
+			} else if (type == "scale_2d") {
+				add_track(TYPE_SCALE_2D);
 			} else if (type == "value") {
 				add_track(TYPE_VALUE);
 			} else if (type == "method") {
@@ -118,6 +124,18 @@ bool Animation::_set(const StringName &p_name, const Variant &p_value) {
 					ScaleTrack *st = static_cast<ScaleTrack *>(t);
 					st->compressed_track = index;
 				} break;
+				case TYPE_POSITION_2D: {
+					Position2DTrack *tt = static_cast<Position2DTrack *>(t);
+					tt->compressed_track = index;
+				} break;
+				case TYPE_ROTATION_2D: {
+					Rotation2DTrack *tt = static_cast<Rotation2DTrack *>(t);
+					tt->compressed_track = index;
+				} break;
+				case TYPE_SCALE_2D: {
+					Scale2DTrack *tt = static_cast<Scale2DTrack *>(t);
+					tt->compressed_track = index;
+				} break;
 				case TYPE_BLEND_SHAPE: {
 					BlendShapeTrack *bst = static_cast<BlendShapeTrack *>(t);
 					bst->compressed_track = index;
@@ -227,6 +245,67 @@ bool Animation::_set(const StringName &p_name, const Variant &p_value) {
 					sk.value = ofs[2];
 				}
 
+			} else if (track_get_type(track) == TYPE_POSITION_2D) {
+				Position2DTrack *tt = static_cast<Position2DTrack *>(tracks[track]);
+				Vector<real_t> values = p_value;
+				int vcount = values.size();
+				ERR_FAIL_COND_V(vcount % POSITION_2D_TRACK_SIZE, false);
+
+				const real_t *r = values.ptr();
+
+				int64_t count = vcount / POSITION_2D_TRACK_SIZE;
+				tt->positions.resize(count);
+
+				TKey<Vector2> *tw = tt->positions.ptrw();
+				for (int i = 0; i < count; i++) {
+					TKey<Vector2> &tk = tw[i];
+					const real_t *ofs = &r[i * POSITION_2D_TRACK_SIZE];
+					tk.time = ofs[0];
+					tk.transition = ofs[1];
+
+					tk.value.x = ofs[2];
+					tk.value.y = ofs[3];
+				}
+			} else if (track_get_type(track) == TYPE_ROTATION_2D) {
+				Rotation2DTrack *rt = static_cast<Rotation2DTrack *>(tracks[track]);
+				Vector<real_t> values = p_value;
+				int vcount = values.size();
+				ERR_FAIL_COND_V(vcount % ROTATION_2D_TRACK_SIZE, false);
+
+				const real_t *r = values.ptr();
+
+				int64_t count = vcount / ROTATION_2D_TRACK_SIZE;
+				rt->rotations.resize(count);
+
+				TKey<real_t> *rw = rt->rotations.ptrw();
+				for (int i = 0; i < count; i++) {
+					TKey<real_t> &rk = rw[i];
+					const real_t *ofs = &r[i * ROTATION_2D_TRACK_SIZE];
+					rk.time = ofs[0];
+					rk.transition = ofs[1];
+					rk.value = ofs[2];
+				}
+			} else if (track_get_type(track) == TYPE_SCALE_2D) {
+				Scale2DTrack *st = static_cast<Scale2DTrack *>(tracks[track]);
+				Vector<real_t> values = p_value;
+				int vcount = values.size();
+				ERR_FAIL_COND_V(vcount % SCALE_2D_TRACK_SIZE, false);
+
+				const real_t *r = values.ptr();
+
+				int64_t count = vcount / SCALE_2D_TRACK_SIZE;
+				st->scales.resize(count);
+
+				TKey<Vector2> *sw = st->scales.ptrw();
+				for (int i = 0; i < count; i++) {
+					TKey<Vector2> &sk = sw[i];
+					const real_t *ofs = &r[i * SCALE_2D_TRACK_SIZE];
+					sk.time = ofs[0];
+					sk.transition = ofs[1];
+
+					sk.value.x = ofs[2];
+					sk.value.y = ofs[3];
+				}
 			} else if (track_get_type(track) == TYPE_VALUE) {
 				ValueTrack *vt = static_cast<ValueTrack *>(tracks[track]);
 				Dictionary d = p_value;
@@ -489,6 +568,15 @@ bool Animation::_get(const StringName &p_name, Variant &r_ret) const {
 				case TYPE_BLEND_SHAPE:
 					r_ret = "blend_shape";
 					break;
+				case TYPE_POSITION_2D:
+					r_ret = "position_2d";
+					break;
+				case TYPE_ROTATION_2D:
+					r_ret = "rotation_2d";
+					break;
+				case TYPE_SCALE_2D:
+					r_ret = "scale_2d";
+					break;
 				case TYPE_VALUE:
 					r_ret = "value";
 					break;
@@ -526,6 +614,18 @@ bool Animation::_get(const StringName &p_name, Variant &r_ret) const {
 					ScaleTrack *st = static_cast<ScaleTrack *>(t);
 					r_ret = st->compressed_track;
 				} break;
+				case TYPE_POSITION_2D: {
+					Position2DTrack *tt = static_cast<Position2DTrack *>(t);
+					r_ret = tt->compressed_track;
+				} break;
+				case TYPE_ROTATION_2D: {
+					Rotation2DTrack *tt = static_cast<Rotation2DTrack *>(t);
+					r_ret = tt->compressed_track;
+				} break;
+				case TYPE_SCALE_2D: {
+					Scale2DTrack *tt = static_cast<Scale2DTrack *>(t);
+					r_ret = tt->compressed_track;
+				} break;
 				case TYPE_BLEND_SHAPE: {
 					BlendShapeTrack *bst = static_cast<BlendShapeTrack *>(t);
 					r_ret = bst->compressed_track;
@@ -632,6 +732,65 @@ bool Animation::_get(const StringName &p_name, Variant &r_ret) const {
 					w[idx++] = bs;
 				}
 
+				r_ret = keys;
+				return true;
+			} else if (track_get_type(track) == TYPE_POSITION_2D) {
+				Vector<real_t> keys;
+				int kk = track_get_key_count(track);
+				keys.resize(kk * POSITION_2D_TRACK_SIZE);
+
+				real_t *w = keys.ptrw();
+
+				int idx = 0;
+				for (int i = 0; i < track_get_key_count(track); i++) {
+					Vector2 pos;
+					position_2d_track_get_key(track, i, &pos);
+
+					w[idx++] = track_get_key_time(track, i);
+					w[idx++] = track_get_key_transition(track, i);
+					w[idx++] = pos.x;
+					w[idx++] = pos.y;
+				}
+
+				r_ret = keys;
+				return true;
+			} else if (track_get_type(track) == TYPE_ROTATION_2D) {
+				Vector<real_t> keys;
+				int kk = track_get_key_count(track);
+				keys.resize(kk * ROTATION_2D_TRACK_SIZE);
+
+				real_t *w = keys.ptrw();
+
+				int idx = 0;
+				for (int i = 0; i < track_get_key_count(track); i++) {
+					real_t rot;
+					rotation_2d_track_get_key(track, i, &rot);
+
+					w[idx++] = track_get_key_time(track, i);
+					w[idx++] = track_get_key_transition(track, i);
+					w[idx++] = rot;
+				}
+
+				r_ret = keys;
+				return true;
+			} else if (track_get_type(track) == TYPE_SCALE_2D) {
+				Vector<real_t> keys;
+				int kk = track_get_key_count(track);
+				keys.resize(kk * SCALE_2D_TRACK_SIZE);
+
+				real_t *w = keys.ptrw();
+
+				int idx = 0;
+				for (int i = 0; i < track_get_key_count(track); i++) {
+					Vector2 scale;
+					scale_2d_track_get_key(track, i, &scale);
+
+					w[idx++] = track_get_key_time(track, i);
+					w[idx++] = track_get_key_transition(track, i);
+					w[idx++] = scale.x;
+					w[idx++] = scale.y;
+				}
+
 				r_ret = keys;
 				return true;
 			} else if (track_get_type(track) == TYPE_VALUE) {
@@ -874,6 +1033,18 @@ int Animation::add_track(TrackType p_type, int p_at_pos) {
 			ScaleTrack *st = memnew(ScaleTrack);
 			tracks.insert(p_at_pos, st);
 		} break;
+		case TYPE_POSITION_2D: {
+			Position2DTrack *tt = memnew(Position2DTrack);
+			tracks.insert(p_at_pos, tt);
+		} break;
+		case TYPE_ROTATION_2D: {
+			Rotation2DTrack *tt = memnew(Rotation2DTrack);
+			tracks.insert(p_at_pos, tt);
+		} break;
+		case TYPE_SCALE_2D: {
+			Scale2DTrack *tt = memnew(Scale2DTrack);
+			tracks.insert(p_at_pos, tt);
+		} break;
 		case TYPE_BLEND_SHAPE: {
 			BlendShapeTrack *bst = memnew(BlendShapeTrack);
 			tracks.insert(p_at_pos, bst);
@@ -928,6 +1099,24 @@ void Animation::remove_track(int p_track) {
 			ERR_FAIL_COND_MSG(st->compressed_track >= 0, "Compressed tracks can't be manually removed. Call clear() to get rid of compression first.");
 			_clear(st->scales);
 
+		} break;
+		case TYPE_POSITION_2D: {
+			Position2DTrack *tt = static_cast<Position2DTrack *>(t);
+			ERR_FAIL_COND_MSG(tt->compressed_track >= 0, "Compressed tracks can't be manually removed. Call clear() to get rid of compression first.");
+			_clear(tt->positions);
+
+		} break;
+		case TYPE_ROTATION_2D: {
+			Rotation2DTrack *tt = static_cast<Rotation2DTrack *>(t);
+			ERR_FAIL_COND_MSG(tt->compressed_track >= 0, "Compressed tracks can't be manually removed. Call clear() to get rid of compression first.");
+			_clear(tt->rotations);
+
+		} break;
+		case TYPE_SCALE_2D: {
+			Scale2DTrack *tt = static_cast<Scale2DTrack *>(t);
+			ERR_FAIL_COND_MSG(tt->compressed_track >= 0, "Compressed tracks can't be manually removed. Call clear() to get rid of compression first.");
+			_clear(tt->scales);
+
 		} break;
 		case TYPE_BLEND_SHAPE: {
 			BlendShapeTrack *bst = static_cast<BlendShapeTrack *>(t);
@@ -1369,6 +1558,289 @@ float Animation::blend_shape_track_interpolate(int p_track, double p_time) const
 
 ////
 
+int Animation::position_2d_track_insert_key(int p_track, double p_time, const Vector2 &p_position) {
+	ERR_FAIL_INDEX_V(p_track, tracks.size(), -1);
+	Track *t = tracks[p_track];
+	ERR_FAIL_COND_V(t->type != TYPE_POSITION_2D, -1);
+
+	Position2DTrack *tt = static_cast<Position2DTrack *>(t);
+
+	ERR_FAIL_COND_V(tt->compressed_track >= 0, -1);
+
+	TKey<Vector2> tkey;
+	tkey.time = p_time;
+	tkey.value = p_position;
+
+	int ret = _insert(p_time, tt->positions, tkey);
+	emit_changed();
+	return ret;
+}
+
+Error Animation::position_2d_track_get_key(int p_track, int p_key, Vector2 *r_position) const {
+	ERR_FAIL_INDEX_V(p_track, tracks.size(), ERR_INVALID_PARAMETER);
+	Track *t = tracks[p_track];
+
+	Position2DTrack *tt = static_cast<Position2DTrack *>(t);
+	ERR_FAIL_COND_V(t->type != TYPE_POSITION_2D, ERR_INVALID_PARAMETER);
+
+	if (tt->compressed_track >= 0) {
+		Vector3i key;
+		double time;
+		bool fetch_success = _fetch_compressed_by_index<3>(tt->compressed_track, p_key, key, time);
+		if (!fetch_success) {
+			return ERR_INVALID_PARAMETER;
+		}
+
+		Vector3 v = _uncompress_pos_scale(tt->compressed_track, key);
+		*r_position = Vector2(v.x, v.y);
+		return OK;
+	}
+
+	ERR_FAIL_INDEX_V(p_key, tt->positions.size(), ERR_INVALID_PARAMETER);
+
+	*r_position = tt->positions[p_key].value;
+
+	return OK;
+}
+
+Error Animation::try_position_2d_track_interpolate(int p_track, double p_time, Vector2 *r_interpolation, int *r_cursor) const {
+	ERR_FAIL_INDEX_V(p_track, tracks.size(), ERR_INVALID_PARAMETER);
+	Track *t = tracks[p_track];
+	ERR_FAIL_COND_V(t->type != TYPE_POSITION_2D, ERR_INVALID_PARAMETER);
+
+	Position2DTrack *tt = static_cast<Position2DTrack *>(t);
+
+	if (tt->compressed_track >= 0) {
+		Vector3 v;
+		if (_pos_scale_interpolate_compressed(tt->compressed_track, p_time, v)) {
+			*r_interpolation = Vector2(v.x, v.y);
+			return OK;
+		} else {
+			return ERR_UNAVAILABLE;
+		}
+	}
+
+	bool ok = false;
+
+	Vector2 tk = _interpolate(tt->positions, p_time, tt->interpolation, tt->loop_wrap, &ok, false, r_cursor);
+
+	if (!ok) {
+		return ERR_UNAVAILABLE;
+	}
+	*r_interpolation = tk;
+	return OK;
+}
+
+Vector2 Animation::position_2d_track_interpolate(int p_track, double p_time) const {
+	Vector2 ret = Vector2(0, 0);
+	ERR_FAIL_INDEX_V(p_track, tracks.size(), ret);
+	bool err = try_position_2d_track_interpolate(p_track, p_time, &ret);
+	ERR_FAIL_COND_V_MSG(err, ret, "2D Position Track: '" + tracks[p_track]->path + "' is unavailable.");
+	return ret;
+}
+
+////
+
+int Animation::rotation_2d_track_insert_key(int p_track, double p_time, real_t p_rotation) {
+	ERR_FAIL_INDEX_V(p_track, tracks.size(), -1);
+	Track *t = tracks[p_track];
+	ERR_FAIL_COND_V(t->type != TYPE_ROTATION_2D, -1);
+
+	Rotation2DTrack *rt = static_cast<Rotation2DTrack *>(t);
+
+	ERR_FAIL_COND_V(rt->compressed_track >= 0, -1);
+
+	TKey<real_t> tkey;
+	tkey.time = p_time;
+	tkey.value = p_rotation;
+
+	int ret = _insert(p_time, rt->rotations, tkey);
+	emit_changed();
+	return ret;
+}
+
+Error Animation::rotation_2d_track_get_key(int p_track, int p_key, real_t *r_rotation) const {
+	ERR_FAIL_INDEX_V(p_track, tracks.size(), ERR_INVALID_PARAMETER);
+	Track *t = tracks[p_track];
+
+	Rotation2DTrack *rt = static_cast<Rotation2DTrack *>(t);
+	ERR_FAIL_COND_V(t->type != TYPE_ROTATION_2D, ERR_INVALID_PARAMETER);
+
+	if (rt->compressed_track >= 0) {
+		Vector3i key;
+		double time;
+		bool fetch_success = _fetch_compressed_by_index<3>(rt->compressed_track, p_key, key, time);
+		if (!fetch_success) {
+			return ERR_INVALID_PARAMETER;
+		}
+
+		*r_rotation = _uncompress_pos_scale(rt->compressed_track, key).x;
+		return OK;
+	}
+
+	ERR_FAIL_INDEX_V(p_key, rt->rotations.size(), ERR_INVALID_PARAMETER);
+
+	*r_rotation = rt->rotations[p_key].value;
+
+	return OK;
+}
+
+Error Animation::try_rotation_2d_track_interpolate(int p_track, double p_time, real_t *r_interpolation, int *r_cursor) const {
+	ERR_FAIL_INDEX_V(p_track, tracks.size(), ERR_INVALID_PARAMETER);
+	Track *t = tracks[p_track];
+	ERR_FAIL_COND_V(t->type != TYPE_ROTATION_2D, ERR_INVALID_PARAMETER);
+
+	Rotation2DTrack *rt = static_cast<Rotation2DTrack *>(t);
+
+	if (rt->compressed_track >= 0) {
+		Vector3 v;
+		if (_pos_scale_interpolate_compressed(rt->compressed_track, p_time, v)) {
+			*r_interpolation = v.x;
+			return OK;
+		} else {
+			return ERR_UNAVAILABLE;
+		}
+	}
+
+	bool ok = false;
+
+	real_t tk = _interpolate(rt->rotations, p_time, rt->interpolation, rt->loop_wrap, &ok, false, r_cursor);
+
+	if (!ok) {
+		return ERR_UNAVAILABLE;
+	}
+	*r_interpolation = tk;
+	return OK;
+}
+
+real_t Animation::rotation_2d_track_interpolate(int p_track, double p_time) const {
+	real_t ret = 0;
+	ERR_FAIL_INDEX_V(p_track, tracks.size(), ret);
+	bool err = try_rotation_2d_track_interpolate(p_track, p_time, &ret);
+	ERR_FAIL_COND_V_MSG(err, ret, "2D Rotation Track: '" + tracks[p_track]->path + "' is unavailable.");
+	return ret;
+}
+
+////
+
+int Animation::scale_2d_track_insert_key(int p_track, double p_time, const Vector2 &p_scale) {
+	ERR_FAIL_INDEX_V(p_track, tracks.size(), -1);
+	Track *t = tracks[p_track];
+	ERR_FAIL_COND_V(t->type != TYPE_SCALE_2D, -1);
+
+	Scale2DTrack *st = static_cast<Scale2DTrack *>(t);
+
+	ERR_FAIL_COND_V(st->compressed_track >= 0, -1);
+
+	TKey<Vector2> tkey;
+	tkey.time = p_time;
+	tkey.value = p_scale;
+
+	int ret = _insert(p_time, st->scales, tkey);
+	emit_changed();
+	return ret;
+}
+
+Error Animation::scale_2d_track_get_key(int p_track, int p_key, Vector2 *r_scale) const {
+	ERR_FAIL_INDEX_V(p_track, tracks.size(), ERR_INVALID_PARAMETER);
+	Track *t = tracks[p_track];
+
+	Scale2DTrack *st = static_cast<Scale2DTrack *>(t);
+	ERR_FAIL_COND_V(t->type != TYPE_SCALE_2D, ERR_INVALID_PARAMETER);
+
+	if (st->compressed_track >= 0) {
+		Vector3i key;
+		double time;
+		bool fetch_success = _fetch_compressed_by_index<3>(st->compressed_track, p_key, key, time);
+		if (!fetch_success) {
+			return ERR_INVALID_PARAMETER;
+		}
+
+		Vector3 v = _uncompress_pos_scale(st->compressed_track, key);
+		*r_scale = Vector2(v.x, v.y);
+		return OK;
+	}
+
+	ERR_FAIL_INDEX_V(p_key, st->scales.size(), ERR_INVALID_PARAMETER);
+
+	*r_scale = st->scales[p_key].value;
+
+	return OK;
+}
+
+Error Animation::try_scale_2d_track_interpolate(int p_track, double p_time, Vector2 *r_interpolation, int *r_cursor) const {
+	ERR_FAIL_INDEX_V(p_track, tracks.size(), ERR_INVALID_PARAMETER);
+	Track *t = tracks[p_track];
+	ERR_FAIL_COND_V(t->type != TYPE_SCALE_2D, ERR_INVALID_PARAMETER);
+
+	Scale2DTrack *st = static_cast<Scale2DTrack *>(t);
+
+	if (st->compressed_track >= 0) {
+		Vector3 v;
+		if (_pos_scale_interpolate_compressed(st->compressed_track, p_time, v)) {
+			*r_interpolation = Vector2(v.x, v.y);
+			return OK;
+		} else {
+			return ERR_UNAVAILABLE;
+		}
+	}
+
+	bool ok = false;
+
+	Vector2 tk = _interpolate(st->scales, p_time, st->interpolation, st->loop_wrap, &ok, false, r_cursor);
+
+	if (!ok) {
+		return ERR_UNAVAILABLE;
+	}
+	*r_interpolation = tk;
+	return OK;
+}
+
+Vector2 Animation::scale_2d_track_interpolate(int p_track, double p_time) const {
+	Vector2 ret = Vector2(1, 1);
+	ERR_FAIL_INDEX_V(p_track, tracks.size(), ret);
+	bool err = try_scale_2d_track_interpolate(p_track, p_time, &ret);
+	ERR_FAIL_COND_V_MSG(err, ret, "2D Scale Track: '" + tracks[p_track]->path + "' is unavailable.");
+	return ret;
+}
+
+////
+
+Vector3 Animation::_track_2d_get_vector3(int p_track, int32_t p_key, double p_time) const {
+	switch (tracks[p_track]->type) {
+		case TYPE_POSITION_2D: {
+			Vector2 pos;
+			if (p_key >= 0) {
+				position_2d_track_get_key(p_track, p_key, &pos);
+			} else {
+				try_position_2d_track_interpolate(p_track, p_time, &pos);
+			}
+			return Vector3(pos.x, pos.y, 0);
+		}
+		case TYPE_ROTATION_2D: {
+			real_t rot = 0;
+			if (p_key >= 0) {
+				rotation_2d_track_get_key(p_track, p_key, &rot);
+			} else {
+				try_rotation_2d_track_interpolate(p_track, p_time, &rot);
+			}
+			return Vector3(rot, 0, 0);
+		}
+		case TYPE_SCALE_2D: {
+			Vector2 scale;
+			if (p_key >= 0) {
+				scale_2d_track_get_key(p_track, p_key, &scale);
+			} else {
+				try_scale_2d_track_interpolate(p_track, p_time, &scale);
+			}
+			return Vector3(scale.x, scale.y, 0);
+		}
+		default: {
+			ERR_FAIL_V(Vector3());
+		}
+	}
+}
+
 void Animation::track_remove_key_at_time(int p_track, double p_time) {
 	int idx = track_find_key(p_track, p_time, FIND_MODE_APPROX);
 	ERR_FAIL_COND(idx < 0);
@@ -1406,6 +1878,33 @@ void Animation::track_remove_key(int p_track, int p_idx) {
 			ERR_FAIL_INDEX(p_idx, st->scales.size());
 			st->scales.remove_at(p_idx);
 
+		} break;
+		case TYPE_POSITION_2D: {
+			Position2DTrack *tt = static_cast<Position2DTrack *>(t);
+
+			ERR_FAIL_COND(tt->compressed_track >= 0);
+
+			ERR_FAIL_INDEX(p_idx, tt->positions.size());
+			tt->positions.remove_at(p_idx);
+
+		} break;
+		case TYPE_ROTATION_2D: {
+			Rotation2DTrack *tt = static_cast<Rotation2DTrack *>(t);
+
+			ERR_FAIL_COND(tt->compressed_track >= 0);
+
+			ERR_FAIL_INDEX(p_idx, tt->rotations.size());
+			tt->rotations.remove_at(p_idx);
+
+		} break;
+		case TYPE_SCALE_2D: {
+			Scale2DTrack *tt = static_cast<Scale2DTrack *>(t);
+
+			ERR_FAIL_COND(tt->compressed_track >= 0);
+
+			ERR_FAIL_INDEX(p_idx, tt->scales.size());
+			tt->scales.remove_at(p_idx);
+
 		} break;
 		case TYPE_BLEND_SHAPE: {
 			BlendShapeTrack *bst = static_cast<BlendShapeTrack *>(t);
@@ -1536,6 +2035,87 @@ int Animation::track_find_key(int p_track, double p_time, FindMode p_find_mode)
 			}
 			return k;
 
+		} break;
+		case TYPE_POSITION_2D: {
+			Position2DTrack *tt = static_cast<Position2DTrack *>(t);
+
+			if (tt->compressed_track >= 0) {
+				double time;
+				double time_next;
+				Vector3i key;
+				Vector3i key_next;
+				uint32_t key_index;
+				bool fetch_compressed_success = _fetch_compressed<3>(tt->compressed_track, p_time, key, time, key_next, time_next, &key_index);
+				ERR_FAIL_COND_V(!fetch_compressed_success, -1);
+				if ((p_find_mode == FIND_MODE_APPROX && !Math::is_equal_approx(time, p_time)) || (p_find_mode == FIND_MODE_EXACT && time != p_time)) {
+					return -1;
+				}
+				return key_index;
+			}
+
+			int k = _find(tt->positions, p_time);
+			if (k < 0 || k >= tt->positions.size()) {
+				return -1;
+			}
+			if ((p_find_mode == FIND_MODE_APPROX && !Math::is_equal_approx(tt->positions[k].time, p_time)) || (p_find_mode == FIND_MODE_EXACT && tt->positions[k].time != p_time)) {
+				return -1;
+			}
+			return k;
+
+		} break;
+		case TYPE_ROTATION_2D: {
+			Rotation2DTrack *tt = static_cast<Rotation2DTrack *>(t);
+
+			if (tt->compressed_track >= 0) {
+				double time;
+				double time_next;
+				Vector3i key;
+				Vector3i key_next;
+				uint32_t key_index;
+				bool fetch_compressed_success = _fetch_compressed<3>(tt->compressed_track, p_time, key, time, key_next, time_next, &key_index);
+				ERR_FAIL_COND_V(!fetch_compressed_success, -1);
+				if ((p_find_mode == FIND_MODE_APPROX && !Math::is_equal_approx(time, p_time)) || (p_find_mode == FIND_MODE_EXACT && time != p_time)) {
+					return -1;
+				}
+				return key_index;
+			}
+
+			int k = _find(tt->rotations, p_time);
+			if (k < 0 || k >= tt->rotations.size()) {
+				return -1;
+			}
+			if ((p_find_mode == FIND_MODE_APPROX && !Math::is_equal_approx(tt->rotations[k].time, p_time)) || (p_find_mode == FIND_MODE_EXACT && tt->rotations[k].time != p_time)) {
+				return -1;
+			}
+			return k;
+
+		} break;
+		case TYPE_SCALE_2D: {
+			Scale2DTrack *tt = static_cast<Scale2DTrack *>(t);
+
+			if (tt->compressed_track >= 0) {
+				double time;
+				double time_next;
+				Vector3i key;
+				Vector3i key_next;
+				uint32_t key_index;
+				bool fetch_compressed_success = _fetch_compressed<3>(tt->compressed_track, p_time, key, time, key_next, time_next, &key_index);
+				ERR_FAIL_COND_V(!fetch_compressed_success, -1);
+				if ((p_find_mode == FIND_MODE_APPROX && !Math::is_equal_approx(time, p_time)) || (p_find_mode == FIND_MODE_EXACT && time != p_time)) {
+					return -1;
+				}
+				return key_index;
+			}
+
+			int k = _find(tt->scales, p_time);
+			if (k < 0 || k >= tt->scales.size()) {
+				return -1;
+			}
+			if ((p_find_mode == FIND_MODE_APPROX && !Math::is_equal_approx(tt->scales[k].time, p_time)) || (p_find_mode == FIND_MODE_EXACT && tt->scales[k].time != p_time)) {
+				return -1;
+			}
+			return k;
+
 		} break;
 		case TYPE_BLEND_SHAPE: {
 			BlendShapeTrack *bst = static_cast<BlendShapeTrack *>(t);
@@ -1653,6 +2233,24 @@ int Animation::track_insert_key(int p_track, double p_time, const Variant &p_key
 			ret = scale_track_insert_key(p_track, p_time, p_key);
 			track_set_key_transition(p_track, ret, p_transition);
 
+		} break;
+		case TYPE_POSITION_2D: {
+			ERR_FAIL_COND_V((p_key.get_type() != Variant::VECTOR2) && (p_key.get_type() != Variant::VECTOR2I), -1);
+			ret = position_2d_track_insert_key(p_track, p_time, p_key);
+			track_set_key_transition(p_track, ret, p_transition);
+
+		} break;
+		case TYPE_ROTATION_2D: {
+			ERR_FAIL_COND_V((p_key.get_type() != Variant::FLOAT) && (p_key.get_type() != Variant::INT), -1);
+			ret = rotation_2d_track_insert_key(p_track, p_time, p_key);
+			track_set_key_transition(p_track, ret, p_transition);
+
+		} break;
+		case TYPE_SCALE_2D: {
+			ERR_FAIL_COND_V((p_key.get_type() != Variant::VECTOR2) && (p_key.get_type() != Variant::VECTOR2I), -1);
+			ret = scale_2d_track_insert_key(p_track, p_time, p_key);
+			track_set_key_transition(p_track, ret, p_transition);
+
 		} break;
 		case TYPE_BLEND_SHAPE: {
 			ERR_FAIL_COND_V((p_key.get_type() != Variant::FLOAT) && (p_key.get_type() != Variant::INT), -1);
@@ -1772,6 +2370,27 @@ int Animation::track_get_key_count(int p_track) const {
 			}
 			return st->scales.size();
 		} break;
+		case TYPE_POSITION_2D: {
+			Position2DTrack *tt = static_cast<Position2DTrack *>(t);
+			if (tt->compressed_track >= 0) {
+				return _get_compressed_key_count(tt->compressed_track);
+			}
+			return tt->positions.size();
+		} break;
+		case TYPE_ROTATION_2D: {
+			Rotation2DTrack *tt = static_cast<Rotation2DTrack *>(t);
+			if (tt->compressed_track >= 0) {
+				return _get_compressed_key_count(tt->compressed_track);
+			}
+			return tt->rotations.size();
+		} break;
+		case TYPE_SCALE_2D: {
+			Scale2DTrack *tt = static_cast<Scale2DTrack *>(t);
+			if (tt->compressed_track >= 0) {
+				return _get_compressed_key_count(tt->compressed_track);
+			}
+			return tt->scales.size();
+		} break;
 		case TYPE_BLEND_SHAPE: {
 			BlendShapeTrack *bst = static_cast<BlendShapeTrack *>(t);
 			if (bst->compressed_track >= 0) {
@@ -1825,6 +2444,21 @@ Variant Animation::track_get_key_value(int p_track, int p_key_idx) const {
 			scale_track_get_key(p_track, p_key_idx, &value);
 			return value;
 		} break;
+		case TYPE_POSITION_2D: {
+			Vector2 value;
+			position_2d_track_get_key(p_track, p_key_idx, &value);
+			return value;
+		} break;
+		case TYPE_ROTATION_2D: {
+			real_t value;
+			rotation_2d_track_get_key(p_track, p_key_idx, &value);
+			return value;
+		} break;
+		case TYPE_SCALE_2D: {
+			Vector2 value;
+			scale_2d_track_get_key(p_track, p_key_idx, &value);
+			return value;
+		} break;
 		case TYPE_BLEND_SHAPE: {
 			float value;
 			blend_shape_track_get_key(p_track, p_key_idx, &value);
@@ -1923,6 +2557,42 @@ double Animation::track_get_key_time(int p_track, int p_key_idx) const {
 			ERR_FAIL_INDEX_V(p_key_idx, st->scales.size(), -1);
 			return st->scales[p_key_idx].time;
 		} break;
+		case TYPE_POSITION_2D: {
+			Position2DTrack *tt = static_cast<Position2DTrack *>(t);
+			if (tt->compressed_track >= 0) {
+				Vector3i value;
+				double time;
+				bool fetch_compressed_success = _fetch_compressed_by_index<3>(tt->compressed_track, p_key_idx, value, time);
+				ERR_FAIL_COND_V(!fetch_compressed_success, false);
+				return time;
+			}
+			ERR_FAIL_INDEX_V(p_key_idx, tt->positions.size(), -1);
+			return tt->positions[p_key_idx].time;
+		} break;
+		case TYPE_ROTATION_2D: {
+			Rotation2DTrack *tt = static_cast<Rotation2DTrack *>(t);
+			if (tt->compressed_track >= 0) {
+				Vector3i value;
+				double time;
+				bool fetch_compressed_success = _fetch_compressed_by_index<3>(tt->compressed_track, p_key_idx, value, time);
+				ERR_FAIL_COND_V(!fetch_compressed_success, false);
+				return time;
+			}
+			ERR_FAIL_INDEX_V(p_key_idx, tt->rotations.size(), -1);
+			return tt->rotations[p_key_idx].time;
+		} break;
+		case TYPE_SCALE_2D: {
+			Scale2DTrack *tt = static_cast<Scale2DTrack *>(t);
+			if (tt->compressed_track >= 0) {
+				Vector3i value;
+				double time;
+				bool fetch_compressed_success = _fetch_compressed_by_index<3>(tt->compressed_track, p_key_idx, value, time);
+				ERR_FAIL_COND_V(!fetch_compressed_success, false);
+				return time;
+			}
+			ERR_FAIL_INDEX_V(p_key_idx, tt->scales.size(), -1);
+			return tt->scales[p_key_idx].time;
+		} break;
 		case TYPE_BLEND_SHAPE: {
 			BlendShapeTrack *bst = static_cast<BlendShapeTrack *>(t);
 			if (bst->compressed_track >= 0) {
@@ -2005,6 +2675,36 @@ void Animation::track_set_key_time(int p_track, int p_key_idx, double p_time) {
 			_insert(p_time, tt->scales, key);
 			return;
 		}
+		case TYPE_POSITION_2D: {
+			Position2DTrack *tt = static_cast<Position2DTrack *>(t);
+			ERR_FAIL_COND(tt->compressed_track >= 0);
+			ERR_FAIL_INDEX(p_key_idx, tt->positions.size());
+			TKey<Vector2> key = tt->positions[p_key_idx];
+			key.time = p_time;
+			tt->positions.remove_at(p_key_idx);
+			_insert(p_time, tt->positions, key);
+			return;
+		}
+		case TYPE_ROTATION_2D: {
+			Rotation2DTrack *tt = static_cast<Rotation2DTrack *>(t);
+			ERR_FAIL_COND(tt->compressed_track >= 0);
+			ERR_FAIL_INDEX(p_key_idx, tt->rotations.size());
+			TKey<real_t> key = tt->rotations[p_key_idx];
+			key.time = p_time;
+			tt->rotations.remove_at(p_key_idx);
+			_insert(p_time, tt->rotations, key);
+			return;
+		}
+		case TYPE_SCALE_2D: {
+			Scale2DTrack *tt = static_cast<Scale2DTrack *>(t);
+			ERR_FAIL_COND(tt->compressed_track >= 0);
+			ERR_FAIL_INDEX(p_key_idx, tt->scales.size());
+			TKey<Vector2> key = tt->scales[p_key_idx];
+			key.time = p_time;
+			tt->scales.remove_at(p_key_idx);
+			_insert(p_time, tt->scales, key);
+			return;
+		}
 		case TYPE_BLEND_SHAPE: {
 			BlendShapeTrack *tt = static_cast<BlendShapeTrack *>(t);
 			ERR_FAIL_COND(tt->compressed_track >= 0);
@@ -2091,8 +2791,32 @@ real_t Animation::track_get_key_transition(int p_track, int p_key_idx) const {
 			if (st->compressed_track >= 0) {
 				return 1.0;
 			}
-			ERR_FAIL_INDEX_V(p_key_idx, st->scales.size(), -1);
-			return st->scales[p_key_idx].transition;
+			ERR_FAIL_INDEX_V(p_key_idx, st->scales.size(), -1);
+			return st->scales[p_key_idx].transition;
+		} break;
+		case TYPE_POSITION_2D: {
+			Position2DTrack *tt = static_cast<Position2DTrack *>(t);
+			if (tt->compressed_track >= 0) {
+				return 1.0;
+			}
+			ERR_FAIL_INDEX_V(p_key_idx, tt->positions.size(), -1);
+			return tt->positions[p_key_idx].transition;
+		} break;
+		case TYPE_ROTATION_2D: {
+			Rotation2DTrack *tt = static_cast<Rotation2DTrack *>(t);
+			if (tt->compressed_track >= 0) {
+				return 1.0;
+			}
+			ERR_FAIL_INDEX_V(p_key_idx, tt->rotations.size(), -1);
+			return tt->rotations[p_key_idx].transition;
+		} break;
+		case TYPE_SCALE_2D: {
+			Scale2DTrack *tt = static_cast<Scale2DTrack *>(t);
+			if (tt->compressed_track >= 0) {
+				return 1.0;
+			}
+			ERR_FAIL_INDEX_V(p_key_idx, tt->scales.size(), -1);
+			return tt->scales[p_key_idx].transition;
 		} break;
 		case TYPE_BLEND_SHAPE: {
 			BlendShapeTrack *bst = static_cast<BlendShapeTrack *>(t);
@@ -2145,6 +2869,18 @@ bool Animation::track_is_compressed(int p_track) const {
 			ScaleTrack *st = static_cast<ScaleTrack *>(t);
 			return st->compressed_track >= 0;
 		} break;
+		case TYPE_POSITION_2D: {
+			Position2DTrack *tt = static_cast<Position2DTrack *>(t);
+			return tt->compressed_track >= 0;
+		} break;
+		case TYPE_ROTATION_2D: {
+			Rotation2DTrack *tt = static_cast<Rotation2DTrack *>(t);
+			return tt->compressed_track >= 0;
+		} break;
+		case TYPE_SCALE_2D: {
+			Scale2DTrack *tt = static_cast<Scale2DTrack *>(t);
+			return tt->compressed_track >= 0;
+		} break;
 		case TYPE_BLEND_SHAPE: {
 			BlendShapeTrack *bst = static_cast<BlendShapeTrack *>(t);
 			return bst->compressed_track >= 0;
@@ -2186,6 +2922,33 @@ void Animation::track_set_key_value(int p_track, int p_key_idx, const Variant &p
 
 			st->scales.write[p_key_idx].value = p_value;
 
+		} break;
+		case TYPE_POSITION_2D: {
+			ERR_FAIL_COND((p_value.get_type() != Variant::VECTOR2) && (p_value.get_type() != Variant::VECTOR2I));
+			Position2DTrack *tt = static_cast<Position2DTrack *>(t);
+			ERR_FAIL_COND(tt->compressed_track >= 0);
+			ERR_FAIL_INDEX(p_key_idx, tt->positions.size());
+
+			tt->positions.write[p_key_idx].value = p_value;
+
+		} break;
+		case TYPE_ROTATION_2D: {
+			ERR_FAIL_COND((p_value.get_type() != Variant::FLOAT) && (p_value.get_type() != Variant::INT));
+			Rotation2DTrack *tt = static_cast<Rotation2DTrack *>(t);
+			ERR_FAIL_COND(tt->compressed_track >= 0);
+			ERR_FAIL_INDEX(p_key_idx, tt->rotations.size());
+
+			tt->rotations.write[p_key_idx].value = p_value;
+
+		} break;
+		case TYPE_SCALE_2D: {
+			ERR_FAIL_COND((p_value.get_type() != Variant::VECTOR2) && (p_value.get_type() != Variant::VECTOR2I));
+			Scale2DTrack *tt = static_cast<Scale2DTrack *>(t);
+			ERR_FAIL_COND(tt->compressed_track >= 0);
+			ERR_FAIL_INDEX(p_key_idx, tt->scales.size());
+
+			tt->scales.write[p_key_idx].value = p_value;
+
 		} break;
 		case TYPE_BLEND_SHAPE: {
 			ERR_FAIL_COND((p_value.get_type() != Variant::FLOAT) && (p_value.get_type() != Variant::INT));
@@ -2280,6 +3043,24 @@ void Animation::track_set_key_transition(int p_track, int p_key_idx, real_t p_tr
 			ERR_FAIL_INDEX(p_key_idx, st->scales.size());
 			st->scales.write[p_key_idx].transition = p_transition;
 		} break;
+		case TYPE_POSITION_2D: {
+			Position2DTrack *tt = static_cast<Position2DTrack *>(t);
+			ERR_FAIL_COND(tt->compressed_track >= 0);
+			ERR_FAIL_INDEX(p_key_idx, tt->positions.size());
+			tt->positions.write[p_key_idx].transition = p_transition;
+		} break;
+		case TYPE_ROTATION_2D: {
+			Rotation2DTrack *tt = static_cast<Rotation2DTrack *>(t);
+			ERR_FAIL_COND(tt->compressed_track >= 0);
+			ERR_FAIL_INDEX(p_key_idx, tt->rotations.size());
+			tt->rotations.write[p_key_idx].transition = p_transition;
+		} break;
+		case TYPE_SCALE_2D: {
+			Scale2DTrack *tt = static_cast<Scale2DTrack *>(t);
+			ERR_FAIL_COND(tt->compressed_track >= 0);
+			ERR_FAIL_INDEX(p_key_idx, tt->scales.size());
+			tt->scales.write[p_key_idx].transition = p_transition;
+		} break;
 		case TYPE_BLEND_SHAPE: {
 			BlendShapeTrack *bst = static_cast<BlendShapeTrack *>(t);
 			ERR_FAIL_COND(bst->compressed_track >= 0);
@@ -2309,12 +3090,29 @@ void Animation::track_set_key_transition(int p_track, int p_key_idx, real_t p_tr
 }
 
 template <class K>
-int Animation::_find(const Vector<K> &p_keys, double p_time, bool p_backward) const {
+int Animation::_find(const Vector<K> &p_keys, double p_time, bool p_backward, int *r_cursor) const {
 	int len = p_keys.size();
 	if (len == 0) {
 		return -2;
 	}
 
+	const K *keys = &p_keys[0];
+
+	if (r_cursor && !p_backward) {
+		// Sequential playback mostly stays on the key found last time or moves to the next one.
+		for (int k = *r_cursor; k <= *r_cursor + 1; k++) {
+			if (k < -1 || k >= len) {
+				continue;
+			}
+			bool after_key = k == -1 || keys[k].time < p_time || Math::is_equal_approx(p_time, (double)keys[k].time);
+			bool before_next = k == len - 1 || (p_time < keys[k + 1].time && !Math::is_equal_approx(p_time, (double)keys[k + 1].time));
+			if (after_key && before_next) {
+				*r_cursor = k;
+				return k;
+			}
+		}
+	}
+
 	int low = 0;
 	int high = len - 1;
 	int middle = 0;
@@ -2325,12 +3123,13 @@ int Animation::_find(const Vector<K> &p_keys, double p_time, bool p_backward) co
 	}
 #endif
 
-	const K *keys = &p_keys[0];
-
 	while (low <= high) {
 		middle = (low + high) / 2;
 
 		if (Math::is_equal_approx(p_time, (double)keys[middle].time)) { //match
+			if (r_cursor) {
+				*r_cursor = middle;
+			}
 			return middle;
 		} else if (p_time < keys[middle].time) {
 			high = middle - 1; //search low end of array
@@ -2349,6 +3148,10 @@ int Animation::_find(const Vector<K> &p_keys, double p_time, bool p_backward) co
 		}
 	}
 
+	if (r_cursor) {
+		*r_cursor = middle;
+	}
+
 	return middle;
 }
 
@@ -2370,6 +3173,14 @@ real_t Animation::_interpolate(const real_t &p_a, const real_t &p_b, real_t p_c)
 	return Math::lerp(p_a, p_b, p_c);
 }
 
+Vector2 Animation::_interpolate(const Vector2 &p_a, const Vector2 &p_b, real_t p_c) const {
+	return p_a.lerp(p_b, p_c);
+}
+
+Color Animation::_interpolate(const Color &p_a, const Color &p_b, real_t p_c) const {
+	return p_a.lerp(p_b, p_c);
+}
+
 Variant Animation::_interpolate_angle(const Variant &p_a, const Variant &p_b, real_t p_c) const {
 	Variant::Type type_a = p_a.get_type();
 	Variant::Type type_b = p_b.get_type();
@@ -2473,6 +3284,14 @@ real_t Animation::_cubic_interpolate_in_time(const real_t &p_pre_a, const real_t
 	return Math::cubic_interpolate_in_time(p_a, p_b, p_pre_a, p_post_b, p_c, p_b_t, p_pre_a_t, p_post_b_t);
 }
 
+Vector2 Animation::_cubic_interpolate_in_time(const Vector2 &p_pre_a, const Vector2 &p_a, const Vector2 &p_b, const Vector2 &p_post_b, real_t p_c, real_t p_pre_a_t, real_t p_b_t, real_t p_post_b_t) const {
+	return p_a.cubic_interpolate_in_time(p_b, p_pre_a, p_post_b, p_c, p_b_t, p_pre_a_t, p_post_b_t);
+}
+
+Color Animation::_cubic_interpolate_in_time(const Color &p_pre_a, const Color &p_a, const Color &p_b, const Color &p_post_b, real_t p_c, real_t p_pre_a_t, real_t p_b_t, real_t p_post_b_t) const {
+	return p_a.lerp(p_b, p_c); // Same as the Variant version, which has no cubic interpolation for colors.
+}
+
 Variant Animation::_cubic_interpolate_angle_in_time(const Variant &p_pre_a, const Variant &p_a, const Variant &p_b, const Variant &p_post_b, real_t p_c, real_t p_pre_a_t, real_t p_b_t, real_t p_post_b_t) const {
 	Variant::Type type_a = p_a.get_type();
 	Variant::Type type_b = p_b.get_type();
@@ -2492,9 +3311,23 @@ Variant Animation::_cubic_interpolate_angle_in_time(const Variant &p_pre_a, cons
 	return _interpolate(p_a, p_b, p_c);
 }
 
+// Converts key values to the type _interpolate() computes in. Keys are only copied when a conversion is needed.
+template <class T, class R>
+struct KeyValueCast {
+	static _FORCE_INLINE_ R get(const T &p_value) { return p_value; }
+};
+
 template <class T>
-T Animation::_interpolate(const Vector<TKey<T>> &p_keys, double p_time, InterpolationType p_interp, bool p_loop_wrap, bool *p_ok, bool p_backward) const {
-	int len = _find(p_keys, length) + 1; // try to find last key (there may be more past the end)
+struct KeyValueCast<T, T> {
+	static _FORCE_INLINE_ const T &get(const T &p_value) { return p_value; }
+};
+
+template <class T, class R>
+R Animation::_interpolate(const Vector<TKey<T>> &p_keys, double p_time, InterpolationType p_interp, bool p_loop_wrap, bool *p_ok, bool p_backward, int *r_cursor) const {
+	int len = p_keys.size();
+	if (len > 0 && p_keys[len - 1].time > length && !Math::is_equal_approx((double)p_keys[len - 1].time, length)) {
+		len = _find(p_keys, length) + 1; // try to find last key (there may be more past the end)
+	}
 
 	if (len <= 0) {
 		// (-1 or -2 returned originally) (plus one above)
@@ -2502,18 +3335,18 @@ T Animation::_interpolate(const Vector<TKey<T>> &p_keys, double p_time, Interpol
 		if (p_ok) {
 			*p_ok = false;
 		}
-		return T();
+		return R();
 	} else if (len == 1) { // one key found (0+1), return it
 
 		if (p_ok) {
 			*p_ok = true;
 		}
-		return p_keys[0].value;
+		return KeyValueCast<T, R>::get(p_keys[0].value);
 	}
 
-	int idx = _find(p_keys, p_time, p_backward);
+	int idx = _find(p_keys, p_time, p_backward, r_cursor);
 
-	ERR_FAIL_COND_V(idx == -2, T());
+	ERR_FAIL_COND_V(idx == -2, R());
 	int maxi = len - 1;
 	bool is_start_edge = idx == -1;
 	bool is_end_edge = p_backward ? idx == 0 : idx >= maxi;
@@ -2635,7 +3468,7 @@ T Animation::_interpolate(const Vector<TKey<T>> &p_keys, double p_time, Interpol
 	real_t tr = p_keys[idx].transition;
 	if (tr == 0) {
 		// Don't interpolate if not needed.
-		return p_keys[idx].value;
+		return KeyValueCast<T, R>::get(p_keys[idx].value);
 	}
 
 	if (tr != 1.0) {
@@ -2644,13 +3477,13 @@ T Animation::_interpolate(const Vector<TKey<T>> &p_keys, double p_time, Interpol
 
 	switch (p_interp) {
 		case INTERPOLATION_NEAREST: {
-			return p_keys[idx].value;
+			return KeyValueCast<T, R>::get(p_keys[idx].value);
 		} break;
 		case INTERPOLATION_LINEAR: {
-			return _interpolate(p_keys[idx].value, p_keys[next].value, c);
+			return _interpolate(KeyValueCast<T, R>::get(p_keys[idx].value), KeyValueCast<T, R>::get(p_keys[next].value), c);
 		} break;
 		case INTERPOLATION_LINEAR_ANGLE: {
-			return _interpolate_angle(p_keys[idx].value, p_keys[next].value, c);
+			return _interpolate_angle(KeyValueCast<T, R>::get(p_keys[idx].value), KeyValueCast<T, R>::get(p_keys[next].value), c);
 		} break;
 		case INTERPOLATION_CUBIC:
 		case INTERPOLATION_CUBIC_ANGLE: {
@@ -2683,15 +3516,15 @@ T Animation::_interpolate(const Vector<TKey<T>> &p_keys, double p_time, Interpol
 
 			if (p_interp == INTERPOLATION_CUBIC_ANGLE) {
 				return _cubic_interpolate_angle_in_time(
-						p_keys[pre].value, p_keys[idx].value, p_keys[next].value, p_keys[post].value, c,
+						KeyValueCast<T, R>::get(p_keys[pre].value), KeyValueCast<T, R>::get(p_keys[idx].value), KeyValueCast<T, R>::get(p_keys[next].value), KeyValueCast<T, R>::get(p_keys[post].value), c,
 						pre_t, to_t, post_t);
 			}
 			return _cubic_interpolate_in_time(
-					p_keys[pre].value, p_keys[idx].value, p_keys[next].value, p_keys[post].value, c,
+					KeyValueCast<T, R>::get(p_keys[pre].value), KeyValueCast<T, R>::get(p_keys[idx].value), KeyValueCast<T, R>::get(p_keys[next].value), KeyValueCast<T, R>::get(p_keys[post].value), c,
 					pre_t, to_t, post_t);
 		} break;
 		default:
-			return p_keys[idx].value;
+			return KeyValueCast<T, R>::get(p_keys[idx].value);
 	}
 
 	// do a barrel roll
@@ -2714,6 +3547,39 @@ Variant Animation::value_track_interpolate(int p_track, double p_time) const {
 	return Variant();
 }
 
+template <class R>
+bool Animation::_value_track_interpolate(int p_track, double p_time, int &r_cursor, R &r_value) const {
+	ERR_FAIL_INDEX_V(p_track, tracks.size(), false);
+	Track *t = tracks[p_track];
+	ERR_FAIL_COND_V(t->type != TYPE_VALUE, false);
+	ValueTrack *vt = static_cast<ValueTrack *>(t);
+
+	bool ok = false;
+
+	R res = _interpolate<Variant, R>(vt->values, p_time, (vt->update_mode == UPDATE_CONTINUOUS || vt->update_mode == UPDATE_CAPTURE) ? vt->interpolation : INTERPOLATION_NEAREST, vt->loop_wrap, &ok, false, &r_cursor);
+
+	if (ok) {
+		r_value = res;
+	}
+	return ok;
+}
+
+bool Animation::value_track_interpolate_cursor(int p_track, double p_time, int &r_cursor, Variant &r_value) const {
+	return _value_track_interpolate(p_track, p_time, r_cursor, r_value);
+}
+
+bool Animation::value_track_interpolate_cursor(int p_track, double p_time, int &r_cursor, real_t &r_value) const {
+	return _value_track_interpolate(p_track, p_time, r_cursor, r_value);
+}
+
+bool Animation::value_track_interpolate_cursor(int p_track, double p_time, int &r_cursor, Vector2 &r_value) const {
+	return _value_track_interpolate(p_track, p_time, r_cursor, r_value);
+}
+
+bool Animation::value_track_interpolate_cursor(int p_track, double p_time, int &r_cursor, Color &r_value) const {
+	return _value_track_interpolate(p_track, p_time, r_cursor, r_value);
+}
+
 void Animation::value_track_set_update_mode(int p_track, UpdateMode p_mode) {
 	ERR_FAIL_INDEX(p_track, tracks.size());
 	Track *t = tracks[p_track];
@@ -2881,6 +3747,51 @@ void Animation::track_get_key_indices_in_range(int p_track, double p_time, doubl
 							}
 						}
 					} break;
+					case TYPE_POSITION_2D: {
+						const Position2DTrack *tt = static_cast<const Position2DTrack *>(t);
+						if (tt->compressed_track >= 0) {
+							_get_compressed_key_indices_in_range<3>(tt->compressed_track, from_time, length, p_indices);
+							_get_compressed_key_indices_in_range<3>(tt->compressed_track, 0, to_time, p_indices);
+						} else {
+							if (!is_backward) {
+								_track_get_key_indices_in_range(tt->positions, from_time, anim_end, p_indices, is_backward);
+								_track_get_key_indices_in_range(tt->positions, anim_start, to_time, p_indices, is_backward);
+							} else {
+								_track_get_key_indices_in_range(tt->positions, anim_start, to_time, p_indices, is_backward);
+								_track_get_key_indices_in_range(tt->positions, from_time, anim_end, p_indices, is_backward);
+							}
+						}
+					} break;
+					case TYPE_ROTATION_2D: {
+						const Rotation2DTrack *tt = static_cast<const Rotation2DTrack *>(t);
+						if (tt->compressed_track >= 0) {
+							_get_compressed_key_indices_in_range<3>(tt->compressed_track, from_time, length, p_indices);
+							_get_compressed_key_indices_in_range<3>(tt->compressed_track, 0, to_time, p_indices);
+						} else {
+							if (!is_backward) {
+								_track_get_key_indices_in_range(tt->rotations, from_time, anim_end, p_indices, is_backward);
+								_track_get_key_indices_in_range(tt->rotations, anim_start, to_time, p_indices, is_backward);
+							} else {
+								_track_get_key_indices_in_range(tt->rotations, anim_start, to_time, p_indices, is_backward);
+								_track_get_key_indices_in_range(tt->rotations, from_time, anim_end, p_indices, is_backward);
+							}
+						}
+					} break;
+					case TYPE_SCALE_2D: {
+						const Scale2DTrack *tt = static_cast<const Scale2DTrack *>(t);
+						if (tt->compressed_track >= 0) {
+							_get_compressed_key_indices_in_range<3>(tt->compressed_track, from_time, length, p_indices);
+							_get_compressed_key_indices_in_range<3>(tt->compressed_track, 0, to_time, p_indices);
+						} else {
+							if (!is_backward) {
+								_track_get_key_indices_in_range(tt->scales, from_time, anim_end, p_indices, is_backward);
+								_track_get_key_indices_in_range(tt->scales, anim_start, to_time, p_indices, is_backward);
+							} else {
+								_track_get_key_indices_in_range(tt->scales, anim_start, to_time, p_indices, is_backward);
+								_track_get_key_indices_in_range(tt->scales, from_time, anim_end, p_indices, is_backward);
+							}
+						}
+					} break;
 					case TYPE_BLEND_SHAPE: {
 						const BlendShapeTrack *bst = static_cast<const BlendShapeTrack *>(t);
 						if (bst->compressed_track >= 0) {
@@ -3006,6 +3917,36 @@ void Animation::track_get_key_indices_in_range(int p_track, double p_time, doubl
 							_track_get_key_indices_in_range(st->scales, 0, to_time, p_indices, false);
 						}
 					} break;
+					case TYPE_POSITION_2D: {
+						const Position2DTrack *tt = static_cast<const Position2DTrack *>(t);
+						if (tt->compressed_track >= 0) {
+							_get_compressed_key_indices_in_range<3>(tt->compressed_track, 0, from_time, p_indices);
+							_get_compressed_key_indices_in_range<3>(tt->compressed_track, 0, to_time, p_indices);
+						} else {
+							_track_get_key_indices_in_range(tt->positions, 0, from_time, p_indices, true);
+							_track_get_key_indices_in_range(tt->positions, 0, to_time, p_indices, false);
+						}
+					} break;
+					case TYPE_ROTATION_2D: {
+						const Rotation2DTrack *tt = static_cast<const Rotation2DTrack *>(t);
+						if (tt->compressed_track >= 0) {
+							_get_compressed_key_indices_in_range<3>(tt->compressed_track, 0, from_time, p_indices);
+							_get_compressed_key_indices_in_range<3>(tt->compressed_track, 0, to_time, p_indices);
+						} else {
+							_track_get_key_indices_in_range(tt->rotations, 0, from_time, p_indices, true);
+							_track_get_key_indices_in_range(tt->rotations, 0, to_time, p_indices, false);
+						}
+					} break;
+					case TYPE_SCALE_2D: {
+						const Scale2DTrack *tt = static_cast<const Scale2DTrack *>(t);
+						if (tt->compressed_track >= 0) {
+							_get_compressed_key_indices_in_range<3>(tt->compressed_track, 0, from_time, p_indices);
+							_get_compressed_key_indices_in_range<3>(tt->compressed_track, 0, to_time, p_indices);
+						} else {
+							_track_get_key_indices_in_range(tt->scales, 0, from_time, p_indices, true);
+							_track_get_key_indices_in_range(tt->scales, 0, to_time, p_indices, false);
+						}
+					} break;
 					case TYPE_BLEND_SHAPE: {
 						const BlendShapeTrack *bst = static_cast<const BlendShapeTrack *>(t);
 						if (bst->compressed_track >= 0) {
@@ -3077,6 +4018,36 @@ void Animation::track_get_key_indices_in_range(int p_track, double p_time, doubl
 							_track_get_key_indices_in_range(st->scales, to_time, length, p_indices, true);
 						}
 					} break;
+					case TYPE_POSITION_2D: {
+						const Position2DTrack *tt = static_cast<const Position2DTrack *>(t);
+						if (tt->compressed_track >= 0) {
+							_get_compressed_key_indices_in_range<3>(tt->compressed_track, from_time, length, p_indices);
+							_get_compressed_key_indices_in_range<3>(tt->compressed_track, to_time, length, p_indices);
+						} else {
+							_track_get_key_indices_in_range(tt->positions, from_time, length, p_indices, false);
+							_track_get_key_indices_in_range(tt->positions, to_time, length, p_indices, true);
+						}
+					} break;
+					case TYPE_ROTATION_2D: {
+						const Rotation2DTrack *tt = static_cast<const Rotation2DTrack *>(t);
+						if (tt->compressed_track >= 0) {
+							_get_compressed_key_indices_in_range<3>(tt->compressed_track, from_time, length, p_indices);
+							_get_compressed_key_indices_in_range<3>(tt->compressed_track, to_time, length, p_indices);
+						} else {
+							_track_get_key_indices_in_range(tt->rotations, from_time, length, p_indices, false);
+							_track_get_key_indices_in_range(tt->rotations, to_time, length, p_indices, true);
+						}
+					} break;
+					case TYPE_SCALE_2D: {
+						const Scale2DTrack *tt = static_cast<const Scale2DTrack *>(t);
+						if (tt->compressed_track >= 0) {
+							_get_compressed_key_indices_in_range<3>(tt->compressed_track, from_time, length, p_indices);
+							_get_compressed_key_indices_in_range<3>(tt->compressed_track, to_time, length, p_indices);
+						} else {
+							_track_get_key_indices_in_range(tt->scales, from_time, length, p_indices, false);
+							_track_get_key_indices_in_range(tt->scales, to_time, length, p_indices, true);
+						}
+					} break;
 					case TYPE_BLEND_SHAPE: {
 						const BlendShapeTrack *bst = static_cast<const BlendShapeTrack *>(t);
 						if (bst->compressed_track >= 0) {
@@ -3149,6 +4120,30 @@ void Animation::track_get_key_indices_in_range(int p_track, double p_time, doubl
 				_track_get_key_indices_in_range(st->scales, from_time, to_time, p_indices, is_backward);
 			}
 		} break;
+		case TYPE_POSITION_2D: {
+			const Position2DTrack *tt = static_cast<const Position2DTrack *>(t);
+			if (tt->compressed_track >= 0) {
+				_get_compressed_key_indices_in_range<3>(tt->compressed_track, from_time, to_time - from_time, p_indices);
+			} else {
+				_track_get_key_indices_in_range(tt->positions, from_time, to_time, p_indices, is_backward);
+			}
+		} break;
+		case TYPE_ROTATION_2D: {
+			const Rotation2DTrack *tt = static_cast<const Rotation2DTrack *>(t);
+			if (tt->compressed_track >= 0) {
+				_get_compressed_key_indices_in_range<3>(tt->compressed_track, from_time, to_time - from_time, p_indices);
+			} else {
+				_track_get_key_indices_in_range(tt->rotations, from_time, to_time, p_indices, is_backward);
+			}
+		} break;
+		case TYPE_SCALE_2D: {
+			const Scale2DTrack *tt = static_cast<const Scale2DTrack *>(t);
+			if (tt->compressed_track >= 0) {
+				_get_compressed_key_indices_in_range<3>(tt->compressed_track, from_time, to_time - from_time, p_indices);
+			} else {
+				_track_get_key_indices_in_range(tt->scales, from_time, to_time, p_indices, is_backward);
+			}
+		} break;
 		case TYPE_BLEND_SHAPE: {
 			const BlendShapeTrack *bst = static_cast<const BlendShapeTrack *>(t);
 			if (bst->compressed_track >= 0) {
@@ -3842,6 +4837,14 @@ void Animation::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("scale_track_interpolate", "track_idx", "time_sec"), &Animation::scale_track_interpolate);
 	ClassDB::bind_method(D_METHOD("blend_shape_track_interpolate", "track_idx", "time_sec"), &Animation::blend_shape_track_interpolate);
 
+	ClassDB::bind_method(D_METHOD("position_2d_track_insert_key", "track_idx", "time", "position"), &Animation::position_2d_track_insert_key);
+	ClassDB::bind_method(D_METHOD("rotation_2d_track_insert_key", "track_idx", "time", "rotation"), &Animation::rotation_2d_track_insert_key);
+	ClassDB::bind_method(D_METHOD("scale_2d_track_insert_key", "track_idx", "time", "scale"), &Animation::scale_2d_track_insert_key);
+
+	ClassDB::bind_method(D_METHOD("position_2d_track_interpolate", "track_idx", "time_sec"), &Animation::position_2d_track_interpolate);
+	ClassDB::bind_method(D_METHOD("rotation_2d_track_interpolate", "track_idx", "time_sec"), &Animation::rotation_2d_track_interpolate);
+	ClassDB::bind_method(D_METHOD("scale_2d_track_interpolate", "track_idx", "time_sec"), &Animation::scale_2d_track_interpolate);
+
 	ClassDB::bind_method(D_METHOD("track_insert_key", "track_idx", "time", "key", "transition"), &Animation::track_insert_key, DEFVAL(1));
 	ClassDB::bind_method(D_METHOD("track_remove_key", "track_idx", "key_idx"), &Animation::track_remove_key);
 	ClassDB::bind_method(D_METHOD("track_remove_key_at_time", "track_idx", "time"), &Animation::track_remove_key_at_time);
@@ -3924,6 +4927,9 @@ void Animation::_bind_methods() {
 	BIND_ENUM_CONSTANT(TYPE_BEZIER);
 	BIND_ENUM_CONSTANT(TYPE_AUDIO);
 	BIND_ENUM_CONSTANT(TYPE_ANIMATION);
+	BIND_ENUM_CONSTANT(TYPE_POSITION_2D);
+	BIND_ENUM_CONSTANT(TYPE_ROTATION_2D);
+	BIND_ENUM_CONSTANT(TYPE_SCALE_2D);
 
 	BIND_ENUM_CONSTANT(INTERPOLATION_NEAREST);
 	BIND_ENUM_CONSTANT(INTERPOLATION_LINEAR);
@@ -4190,6 +5196,87 @@ void Animation::_blend_shape_track_optimize(int p_idx, real_t p_allowed_velocity
 	}
 }
 
+void Animation::_position_2d_track_optimize(int p_idx, real_t p_allowed_velocity_err, real_t p_allowed_angular_err, real_t p_allowed_precision_error) {
+	ERR_FAIL_INDEX(p_idx, tracks.size());
+	ERR_FAIL_COND(tracks[p_idx]->type != TYPE_POSITION_2D);
+	Position2DTrack *tt = static_cast<Position2DTrack *>(tracks[p_idx]);
+
+	int i = 0;
+	while (i < tt->positions.size() - 2) {
+		TKey<Vector2> t0 = tt->positions[i];
+		TKey<Vector2> t1 = tt->positions[i + 1];
+		TKey<Vector2> t2 = tt->positions[i + 2];
+
+		bool erase = _vector2_track_optimize_key(t0, t1, t2, p_allowed_velocity_err, p_allowed_angular_err, p_allowed_precision_error);
+		if (erase) {
+			tt->positions.remove_at(i + 1);
+		} else {
+			i++;
+		}
+	}
+
+	if (tt->positions.size() == 2) {
+		if ((tt->positions[0].value - tt->positions[1].value).length() < p_allowed_precision_error) {
+			tt->positions.remove_at(1);
+		}
+	}
+}
+
+void Animation::_rotation_2d_track_optimize(int p_idx, real_t p_allowed_velocity_err, real_t p_allowed_precision_error) {
+	ERR_FAIL_INDEX(p_idx, tracks.size());
+	ERR_FAIL_COND(tracks[p_idx]->type != TYPE_ROTATION_2D);
+	Rotation2DTrack *rt = static_cast<Rotation2DTrack *>(tracks[p_idx]);
+
+	int i = 0;
+	while (i < rt->rotations.size() - 2) {
+		TKey<float> t[3];
+		for (int j = 0; j < 3; j++) {
+			t[j].time = rt->rotations[i + j].time;
+			t[j].transition = rt->rotations[i + j].transition;
+			t[j].value = rt->rotations[i + j].value;
+		}
+
+		bool erase = _float_track_optimize_key(t[0], t[1], t[2], p_allowed_velocity_err, p_allowed_precision_error);
+		if (erase) {
+			rt->rotations.remove_at(i + 1);
+		} else {
+			i++;
+		}
+	}
+
+	if (rt->rotations.size() == 2) {
+		if (abs(rt->rotations[0].value - rt->rotations[1].value) < p_allowed_precision_error) {
+			rt->rotations.remove_at(1);
+		}
+	}
+}
+
+void Animation::_scale_2d_track_optimize(int p_idx, real_t p_allowed_velocity_err, real_t p_allowed_angular_err, real_t p_allowed_precision_error) {
+	ERR_FAIL_INDEX(p_idx, tracks.size());
+	ERR_FAIL_COND(tracks[p_idx]->type != TYPE_SCALE_2D);
+	Scale2DTrack *st = static_cast<Scale2DTrack *>(tracks[p_idx]);
+
+	int i = 0;
+	while (i < st->scales.size() - 2) {
+		TKey<Vector2> t0 = st->scales[i];
+		TKey<Vector2> t1 = st->scales[i + 1];
+		TKey<Vector2> t2 = st->scales[i + 2];
+
+		bool erase = _vector2_track_optimize_key(t0, t1, t2, p_allowed_velocity_err, p_allowed_angular_err, p_allowed_precision_error);
+		if (erase) {
+			st->scales.remove_at(i + 1);
+		} else {
+			i++;
+		}
+	}
+
+	if (st->scales.size() == 2) {
+		if ((st->scales[0].value - st->scales[1].value).length() < p_allowed_precision_error) {
+			st->scales.remove_at(1);
+		}
+	}
+}
+
 void Animation::_value_track_optimize(int p_idx, real_t p_allowed_velocity_err, real_t p_allowed_angular_err, real_t p_allowed_precision_error) {
 	ERR_FAIL_INDEX(p_idx, tracks.size());
 	ERR_FAIL_COND(tracks[p_idx]->type != TYPE_VALUE);
@@ -4323,6 +5410,12 @@ void Animation::optimize(real_t p_allowed_velocity_err, real_t p_allowed_angular
 			_scale_track_optimize(i, p_allowed_velocity_err, p_allowed_angular_err, precision);
 		} else if (tracks[i]->type == TYPE_BLEND_SHAPE) {
 			_blend_shape_track_optimize(i, p_allowed_velocity_err, precision);
+		} else if (tracks[i]->type == TYPE_POSITION_2D) {
+			_position_2d_track_optimize(i, p_allowed_velocity_err, p_allowed_angular_err, precision);
+		} else if (tracks[i]->type == TYPE_ROTATION_2D) {
+			_rotation_2d_track_optimize(i, p_allowed_velocity_err, precision);
+		} else if (tracks[i]->type == TYPE_SCALE_2D) {
+			_scale_2d_track_optimize(i, p_allowed_velocity_err, p_allowed_angular_err, precision);
 		} else if (tracks[i]->type == TYPE_VALUE) {
 			_value_track_optimize(i, p_allowed_velocity_err, p_allowed_angular_err, precision);
 		}
@@ -4633,6 +5726,15 @@ Vector3i Animation::_compress_key(uint32_t p_track, const AABB &p_bounds, int32_
 				values[j] = CLAMP(int32_t(scale[j] * 65535.0), 0, 65535);
 			}
 		} break;
+		case TYPE_POSITION_2D:
+		case TYPE_ROTATION_2D:
+		case TYPE_SCALE_2D: {
+			Vector3 v = _track_2d_get_vector3(p_track, p_key, p_time);
+			v = (v - p_bounds.position) / p_bounds.size;
+			for (int j = 0; j < 3; j++) {
+				values[j] = CLAMP(int32_t(v[j] * 65535.0), 0, 65535);
+			}
+		} break;
 		case TYPE_BLEND_SHAPE: {
 			float blend;
 			if (p_key >= 0) {
@@ -4692,7 +5794,8 @@ void Animation::compress(uint32_t p_page_size, uint32_t p_fps, float p_split_tol
 
 	for (int i = 0; i < get_track_count(); i++) {
 		TrackType type = track_get_type(i);
-		if (type != TYPE_POSITION_3D && type != TYPE_ROTATION_3D && type != TYPE_SCALE_3D && type != TYPE_BLEND_SHAPE) {
+		bool is_2d = type == TYPE_POSITION_2D || type == TYPE_ROTATION_2D || type == TYPE_SCALE_2D;
+		if (type != TYPE_POSITION_3D && type != TYPE_ROTATION_3D && type != TYPE_SCALE_3D && type != TYPE_BLEND_SHAPE && !is_2d) {
 			continue;
 		}
 		if (track_get_key_count(i) == 0) {
@@ -4745,6 +5848,26 @@ void Animation::compress(uint32_t p_page_size, uint32_t p_fps, float p_split_tol
 			}
 			bounds = aabb;
 		}
+		if (is_2d) {
+			// 2D tracks are stored as (x, y, 0) or (angle, 0, 0) and reuse the position/scale encoding.
+			AABB aabb;
+			int kcount = track_get_key_count(i);
+			for (int j = 0; j < kcount; j++) {
+				Vector3 v = _track_2d_get_vector3(i, j, 0);
+				if (j == 0) {
+					aabb.position = v;
+				} else {
+					aabb.expand_to(v);
+				}
+			}
+			for (int j = 0; j < 3; j++) {
+				// Can't have zero.
+				if (aabb.size[j] < CMP_EPSILON) {
+					aabb.size[j] = CMP_EPSILON;
+				}
+			}
+			bounds = aabb;
+		}
 
 		track_bounds.push_back(bounds);
 	}
@@ -5032,6 +6155,21 @@ void Animation::compress(uint32_t p_page_size, uint32_t p_fps, float p_split_tol
 				st->compressed_track = i;
 				print_line("Scale Bounds " + itos(i) + ": " + track_bounds[i]);
 			} break;
+			case TYPE_POSITION_2D: {
+				Position2DTrack *tt = static_cast<Position2DTrack *>(t);
+				tt->positions.clear();
+				tt->compressed_track = i;
+			} break;
+			case TYPE_ROTATION_2D: {
+				Rotation2DTrack *tt = static_cast<Rotation2DTrack *>(t);
+				tt->rotations.clear();
+				tt->compressed_track = i;
+			} break;
+			case TYPE_SCALE_2D: {
+				Scale2DTrack *tt = static_cast<Scale2DTrack *>(t);
+				tt->scales.clear();
+				tt->compressed_track = i;
+			} break;
 			case TYPE_BLEND_SHAPE: {
 				BlendShapeTrack *bst = static_cast<BlendShapeTrack *>(t);
 				bst->blend_shapes.clear();
@@ -5052,6 +6190,13 @@ void Animation::compress(uint32_t p_page_size, uint32_t p_fps, float p_split_tol
 			case TYPE_ROTATION_3D: {
 				orig_size += sizeof(TKey<Quaternion>) * track_get_key_count(i);
 			} break;
+			case TYPE_POSITION_2D:
+			case TYPE_SCALE_2D: {
+				orig_size += sizeof(TKey<Vector2>) * track_get_key_count(i);
+			} break;
+			case TYPE_ROTATION_2D: {
+				orig_size += sizeof(TKey<real_t>) * track_get_key_count(i);
+			} break;
 			case TYPE_BLEND_SHAPE: {
 				orig_size += sizeof(TKey<float>) * track_get_key_count(i);
 			} break;
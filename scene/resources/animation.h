@@ -51,6 +51,9 @@ public:
 		TYPE_BEZIER, ///< Bezier curve
 		TYPE_AUDIO,
 		TYPE_ANIMATION,
+		TYPE_POSITION_2D, ///< Position 2D track
+		TYPE_ROTATION_2D, ///< Rotation 2D track
+		TYPE_SCALE_2D, ///< Scale 2D track
 	};
 
 	enum InterpolationType {
@@ -126,6 +129,9 @@ private:
 	const int32_t ROTATION_TRACK_SIZE = 6;
 	const int32_t SCALE_TRACK_SIZE = 5;
 	const int32_t BLEND_SHAPE_TRACK_SIZE = 3;
+	const int32_t POSITION_2D_TRACK_SIZE = 4;
+	const int32_t ROTATION_2D_TRACK_SIZE = 3;
+	const int32_t SCALE_2D_TRACK_SIZE = 4;
 
 	/* POSITION TRACK */
 
@@ -159,6 +165,30 @@ private:
 		BlendShapeTrack() { type = TYPE_BLEND_SHAPE; }
 	};
 
+	/* POSITION 2D TRACK */
+
+	struct Position2DTrack : public Track {
+		Vector<TKey<Vector2>> positions;
+		int32_t compressed_track = -1;
+		Position2DTrack() { type = TYPE_POSITION_2D; }
+	};
+
+	/* ROTATION 2D TRACK */
+
+	struct Rotation2DTrack : public Track {
+		Vector<TKey<real_t>> rotations;
+		int32_t compressed_track = -1;
+		Rotation2DTrack() { type = TYPE_ROTATION_2D; }
+	};
+
+	/* SCALE 2D TRACK */
+
+	struct Scale2DTrack : public Track {
+		Vector<TKey<Vector2>> scales;
+		int32_t compressed_track = -1;
+		Scale2DTrack() { type = TYPE_SCALE_2D; }
+	};
+
 	/* PROPERTY VALUE TRACK */
 
 	struct ValueTrack : public Track {
@@ -244,22 +274,30 @@ private:
 
 	template <class K>
 
-	inline int _find(const Vector<K> &p_keys, double p_time, bool p_backward = false) const;
+	inline int _find(const Vector<K> &p_keys, double p_time, bool p_backward = false, int *r_cursor = nullptr) const;
 
 	_FORCE_INLINE_ Vector3 _interpolate(const Vector3 &p_a, const Vector3 &p_b, real_t p_c) const;
 	_FORCE_INLINE_ Quaternion _interpolate(const Quaternion &p_a, const Quaternion &p_b, real_t p_c) const;
 	_FORCE_INLINE_ Variant _interpolate(const Variant &p_a, const Variant &p_b, real_t p_c) const;
 	_FORCE_INLINE_ real_t _interpolate(const real_t &p_a, const real_t &p_b, real_t p_c) const;
+	_FORCE_INLINE_ Vector2 _interpolate(const Vector2 &p_a, const Vector2 &p_b, real_t p_c) const;
+	_FORCE_INLINE_ Color _interpolate(const Color &p_a, const Color &p_b, real_t p_c) const;
 	_FORCE_INLINE_ Variant _interpolate_angle(const Variant &p_a, const Variant &p_b, real_t p_c) const;
 
 	_FORCE_INLINE_ Vector3 _cubic_interpolate_in_time(const Vector3 &p_pre_a, const Vector3 &p_a, const Vector3 &p_b, const Vector3 &p_post_b, real_t p_c, real_t p_pre_a_t, real_t p_b_t, real_t p_post_b_t) const;
 	_FORCE_INLINE_ Quaternion _cubic_interpolate_in_time(const Quaternion &p_pre_a, const Quaternion &p_a, const Quaternion &p_b, const Quaternion &p_post_b, real_t p_c, real_t p_pre_a_t, real_t p_b_t, real_t p_post_b_t) const;
 	_FORCE_INLINE_ Variant _cubic_interpolate_in_time(const Variant &p_pre_a, const Variant &p_a, const Variant &p_b, const Variant &p_post_b, real_t p_c, real_t p_pre_a_t, real_t p_b_t, real_t p_post_b_t) const;
 	_FORCE_INLINE_ real_t _cubic_interpolate_in_time(const real_t &p_pre_a, const real_t &p_a, const real_t &p_b, const real_t &p_post_b, real_t p_c, real_t p_pre_a_t, real_t p_b_t, real_t p_post_b_t) const;
+	_FORCE_INLINE_ Vector2 _cubic_interpolate_in_time(const Vector2 &p_pre_a, const Vector2 &p_a, const Vector2 &p_b, const Vector2 &p_post_b, real_t p_c, real_t p_pre_a_t, real_t p_b_t, real_t p_post_b_t) const;
+	_FORCE_INLINE_ Color _cubic_interpolate_in_time(const Color &p_pre_a, const Color &p_a, const Color &p_b, const Color &p_post_b, real_t p_c, real_t p_pre_a_t, real_t p_b_t, real_t p_post_b_t) const;
 	_FORCE_INLINE_ Variant _cubic_interpolate_angle_in_time(const Variant &p_pre_a, const Variant &p_a, const Variant &p_b, const Variant &p_post_b, real_t p_c, real_t p_pre_a_t, real_t p_b_t, real_t p_post_b_t) const;
 
-	template <class T>
-	_FORCE_INLINE_ T _interpolate(const Vector<TKey<T>> &p_keys, double p_time, InterpolationType p_interp, bool p_loop_wrap, bool *p_ok, bool p_backward = false) const;
+	// R is the type the result is computed in, keys are converted to it as they are read.
+	template <class T, class R = T>
+	_FORCE_INLINE_ R _interpolate(const Vector<TKey<T>> &p_keys, double p_time, InterpolationType p_interp, bool p_loop_wrap, bool *p_ok, bool p_backward = false, int *r_cursor = nullptr) const;
+
+	template <class R>
+	_FORCE_INLINE_ bool _value_track_interpolate(int p_track, double p_time, int &r_cursor, R &r_value) const;
 
 	template <class T>
 	_FORCE_INLINE_ void _track_get_key_indices_in_range(const Vector<T> &p_array, double from_time, double to_time, List<int> *p_indices, bool p_is_backward) const;
@@ -332,11 +370,12 @@ private:
 
 		uint32_t fps = 120;
 		LocalVector<Page> pages;
-		LocalVector<AABB> bounds; //used by position and scale tracks (which contain index to track and index to bounds).
+		LocalVector<AABB> bounds; //used by position and scale tracks (which contain index to track and index to bounds), and by all 2D transform tracks.
 		bool enabled = false;
 	} compression;
 
 	Vector3i _compress_key(uint32_t p_track, const AABB &p_bounds, int32_t p_key = -1, float p_time = 0.0);
+	Vector3 _track_2d_get_vector3(int p_track, int32_t p_key, double p_time) const; // 2D tracks are compressed with the position/scale bounds encoding.
 	bool _rotation_interpolate_compressed(uint32_t p_compressed_track, double p_time, Quaternion &r_ret) const;
 	bool _pos_scale_interpolate_compressed(uint32_t p_compressed_track, double p_time, Vector3 &r_ret) const;
 	bool _blend_shape_interpolate_compressed(uint32_t p_compressed_track, double p_time, float &r_ret) const;
@@ -362,6 +401,9 @@ private:
 	void _rotation_track_optimize(int p_idx, real_t p_allowed_velocity_err, real_t p_allowed_angular_error, real_t p_allowed_precision_error);
 	void _scale_track_optimize(int p_idx, real_t p_allowed_velocity_err, real_t p_allowed_angular_err, real_t p_allowed_precision_error);
 	void _blend_shape_track_optimize(int p_idx, real_t p_allowed_velocity_err, real_t p_allowed_precision_error);
+	void _position_2d_track_optimize(int p_idx, real_t p_allowed_velocity_err, real_t p_allowed_angular_err, real_t p_allowed_precision_error);
+	void _rotation_2d_track_optimize(int p_idx, real_t p_allowed_velocity_err, real_t p_allowed_precision_error);
+	void _scale_2d_track_optimize(int p_idx, real_t p_allowed_velocity_err, real_t p_allowed_angular_err, real_t p_allowed_precision_error);
 	void _value_track_optimize(int p_idx, real_t p_allowed_velocity_err, real_t p_allowed_angular_err, real_t p_allowed_precision_error);
 
 protected:
@@ -430,6 +472,21 @@ public:
 	Error try_blend_shape_track_interpolate(int p_track, double p_time, float *r_blend) const;
 	float blend_shape_track_interpolate(int p_track, double p_time) const;
 
+	int position_2d_track_insert_key(int p_track, double p_time, const Vector2 &p_position);
+	Error position_2d_track_get_key(int p_track, int p_key, Vector2 *r_position) const;
+	Error try_position_2d_track_interpolate(int p_track, double p_time, Vector2 *r_interpolation, int *r_cursor = nullptr) const;
+	Vector2 position_2d_track_interpolate(int p_track, double p_time) const;
+
+	int rotation_2d_track_insert_key(int p_track, double p_time, real_t p_rotation);
+	Error rotation_2d_track_get_key(int p_track, int p_key, real_t *r_rotation) const;
+	Error try_rotation_2d_track_interpolate(int p_track, double p_time, real_t *r_interpolation, int *r_cursor = nullptr) const;
+	real_t rotation_2d_track_interpolate(int p_track, double p_time) const;
+
+	int scale_2d_track_insert_key(int p_track, double p_time, const Vector2 &p_scale);
+	Error scale_2d_track_get_key(int p_track, int p_key, Vector2 *r_scale) const;
+	Error try_scale_2d_track_interpolate(int p_track, double p_time, Vector2 *r_interpolation, int *r_cursor = nullptr) const;
+	Vector2 scale_2d_track_interpolate(int p_track, double p_time) const;
+
 	void track_set_interpolation_type(int p_track, InterpolationType p_interp);
 	InterpolationType track_get_interpolation_type(int p_track) const;
 
@@ -465,6 +522,12 @@ public:
 	bool track_get_interpolation_loop_wrap(int p_track) const;
 
 	Variant value_track_interpolate(int p_track, double p_time) const;
+	// For sequential playback. r_cursor keeps the key found by the previous call, so the next one
+	// usually doesn't need to search. Start it at -1. Typed versions convert keys instead of blending Variants.
+	bool value_track_interpolate_cursor(int p_track, double p_time, int &r_cursor, Variant &r_value) const;
+	bool value_track_interpolate_cursor(int p_track, double p_time, int &r_cursor, real_t &r_value) const;
+	bool value_track_interpolate_cursor(int p_track, double p_time, int &r_cursor, Vector2 &r_value) const;
+	bool value_track_interpolate_cursor(int p_track, double p_time, int &r_cursor, Color &r_value) const;
 	void value_track_set_update_mode(int p_track, UpdateMode p_mode);
 	UpdateMode value_track_get_update_mode(int p_track) const;
 
@@ -122,6 +122,242 @@ Ref<Resource> SceneState::get_remap_resource(const Ref<Resource> &p_resource, Ha
 	return remap_resource;
 }
 
+void SceneState::_build_instantiation_plan() const {
+	MutexLock lock(instantiation_plan_mutex);
+	if (instantiation_plan_valid.is_set()) {
+		return;
+	}
+
+	instantiation_plan.clear();
+	instantiation_plan.resize(nodes.size());
+
+	for (int i = 0; i < nodes.size(); i++) {
+		const NodeData &n = nodes[i];
+		if ((i == 0 && base_scene_idx >= 0) || n.instance >= 0 || n.type == TYPE_INSTANTIATED) {
+			continue; // Created by another scene, the class is only known once instantiated.
+		}
+		ERR_CONTINUE(n.type < 0 || n.type >= names.size());
+
+		InstantiationNodePlan &plan = instantiation_plan[i];
+		plan.creation_func = ClassDB::get_native_creation_func(names[n.type]);
+		if (!plan.creation_func) {
+			continue;
+		}
+
+		plan.setters.resize(n.properties.size());
+		for (int j = 0; j < n.properties.size(); j++) {
+			plan.setters[j] = nullptr;
+
+			int name_idx = n.properties[j].name;
+			if ((name_idx & FLAG_PATH_PROPERTY_IS_NODE) || name_idx < 0 || name_idx >= names.size()) {
+				continue;
+			}
+
+			MethodBind *setter = nullptr;
+			MethodBind *getter = nullptr;
+			if (ClassDB::get_property_binds(names[n.type], names[name_idx], &setter, &getter) && setter && !setter->is_vararg() && !setter->has_return() && setter->get_argument_count() == 1) {
+				plan.setters[j] = setter;
+			}
+		}
+	}
+
+	instantiation_plan_valid.set();
+}
+
+void SceneState::_build_reset_plan() const {
+	MutexLock lock(instantiation_plan_mutex);
+	if (reset_plan_valid.is_set()) {
+		return;
+	}
+
+	reset_plan.clear();
+
+	// Only scenes made entirely of their own nodes can be matched against an instance.
+	reset_supported = base_scene_idx < 0 && !nodes.is_empty();
+	for (int i = 0; i < nodes.size() && reset_supported; i++) {
+		const NodeData &n = nodes[i];
+		if (n.instance >= 0 || n.type < 0 || n.type >= names.size() || n.name < 0 || n.name >= names.size() || (i > 0 && (n.parent < 0 || n.parent >= i))) {
+			reset_supported = false;
+		}
+	}
+
+	if (reset_supported) {
+		reset_plan.resize(nodes.size());
+
+		for (int i = 0; i < nodes.size(); i++) {
+			const NodeData &n = nodes[i];
+			const StringName &type = names[n.type];
+			LocalVector<ResetProperty> &properties = reset_plan[i];
+
+			// Values stored in the scene, in their original order.
+			LocalVector<ResetProperty> stored;
+			HashMap<StringName, int> stored_indices;
+			HashSet<StringName> kept;
+			for (const NodeData::Property &prop : n.properties) {
+				int name_idx = prop.name & FLAG_PROP_NAME_MASK;
+				ERR_CONTINUE(name_idx >= names.size() || prop.value < 0 || prop.value >= variants.size());
+
+				const StringName &name = names[name_idx];
+				const Variant &value = variants[prop.value];
+				if (name == CoreStringNames::get_singleton()->_script) {
+					continue; // The script is never swapped on a pooled instance.
+				}
+				Ref<Resource> res = value;
+				if (res.is_valid() && res->is_local_to_scene()) {
+					kept.insert(name); // Keep the copy made for this instance.
+					continue;
+				}
+
+				ResetProperty rp;
+				rp.name = name;
+				rp.value = value;
+				rp.is_node_path = prop.name & FLAG_PATH_PROPERTY_IS_NODE;
+				stored_indices[name] = stored.size();
+				stored.push_back(rp);
+			}
+
+			List<PropertyInfo> plist;
+			ClassDB::get_property_list(type, &plist);
+			for (const PropertyInfo &pi : plist) {
+				if (!(pi.usage & PROPERTY_USAGE_STORAGE) || pi.name == CoreStringNames::get_singleton()->_script || kept.has(pi.name)) {
+					continue;
+				}
+
+				ResetProperty rp;
+				HashMap<StringName, int>::Iterator E = stored_indices.find(pi.name);
+				if (E) {
+					rp = stored[E->value];
+					stored[E->value].name = StringName(); // Consumed.
+				} else {
+					bool valid = false;
+					rp.name = pi.name;
+					rp.value = ClassDB::class_get_default_property_value(type, pi.name, &valid);
+					if (!valid) {
+						continue;
+					}
+				}
+
+				if (!rp.is_node_path && !ClassDB::get_property_binds(type, rp.name, &rp.setter, &rp.getter)) {
+					rp.setter = nullptr;
+					rp.getter = nullptr;
+				}
+				properties.push_back(rp);
+			}
+
+			// Properties unknown to the class (script variables, dynamic properties) are applied last.
+			for (const ResetProperty &rp : stored) {
+				if (rp.name != StringName()) {
+					properties.push_back(rp);
+				}
+			}
+		}
+	}
+
+	reset_plan_valid.set();
+}
+
+void SceneState::_invalidate_instantiation_plan() {
+	MutexLock lock(instantiation_plan_mutex);
+	instantiation_plan_valid.clear();
+	instantiation_plan.clear();
+	reset_plan_valid.clear();
+	reset_plan.clear();
+}
+
+// Restores an instance of this scene to the state it had right after instantiation, without reconstructing it.
+// Fails without modifying anything when the scene uses sub-scenes or inheritance, or when the nodes of the
+// instance no longer match the scene (renamed, retyped, added or removed nodes).
+bool SceneState::reset_instance(Node *p_node) const {
+	ERR_FAIL_NULL_V(p_node, false);
+
+	if (!reset_plan_valid.is_set()) {
+		_build_reset_plan();
+	}
+
+	int nc = nodes.size();
+	if (!reset_supported || reset_plan.size() != (uint32_t)nc) {
+		return false;
+	}
+
+	Node **ret_nodes = (Node **)alloca(sizeof(Node *) * nc);
+	int *child_counts = (int *)alloca(sizeof(int) * nc);
+
+	for (int i = 0; i < nc; i++) {
+		const NodeData &n = nodes[i];
+		Node *node = i == 0 ? p_node : ret_nodes[n.parent]->_get_child_by_name(names[n.name]);
+		if (!node || node->get_class_name() != names[n.type]) {
+			return false;
+		}
+		ret_nodes[i] = node;
+		child_counts[i] = 0;
+		if (i > 0) {
+			child_counts[n.parent]++;
+		}
+	}
+	for (int i = 0; i < nc; i++) {
+		if (ret_nodes[i]->get_child_count(false) != child_counts[i]) {
+			return false;
+		}
+	}
+
+	for (int i = 0; i < nc; i++) {
+		Node *node = ret_nodes[i];
+		// A script may override native properties, so cached binds are only used without one.
+		bool use_binds = !node->get_script_instance();
+
+		for (const ResetProperty &rp : reset_plan[i]) {
+			Variant value = rp.value;
+			if (rp.is_node_path) {
+				if (value.get_type() == Variant::ARRAY) {
+					Array paths = value;
+					Array array;
+					array.resize(paths.size());
+					for (int j = 0; j < paths.size(); j++) {
+						array.set(j, node->get_node_or_null(paths[j]));
+					}
+					value = array;
+				} else {
+					value = node->get_node_or_null(value);
+				}
+			}
+
+			Variant current;
+			if (use_binds && rp.getter) {
+				Callable::CallError ce;
+				current = rp.getter->call(node, nullptr, 0, ce);
+			} else {
+				current = node->get(rp.name);
+			}
+			if (current.get_type() == value.get_type() && current == value) {
+				continue;
+			}
+
+			if (value.get_type() == Variant::ARRAY || value.get_type() == Variant::DICTIONARY) {
+				value = value.duplicate(true); // Don't share the containers stored in the scene with the instance.
+			}
+			if (value.get_type() == Variant::ARRAY && current.get_type() == Variant::ARRAY) {
+				Array set_array = value;
+				Array get_array = current;
+				if (!set_array.is_same_typed(get_array)) {
+					value = Array(set_array, get_array.get_typed_builtin(), get_array.get_typed_class_name(), get_array.get_typed_script());
+				}
+			}
+
+			if (use_binds && rp.setter) {
+				const Variant *argptr = &value;
+				Callable::CallError ce;
+				rp.setter->call(node, &argptr, 1, ce);
+			} else {
+				node->set(rp.name, value);
+			}
+		}
+
+		node->request_ready();
+	}
+
+	return true;
+}
+
 Node *SceneState::instantiate(GenEditState p_edit_state) const {
 	// Nodes where instantiation failed (because something is missing.)
 	List<Node *> stray_instances;
@@ -163,6 +399,18 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 
 	LocalVector<DeferredNodePathProperties> deferred_node_paths;
 
+	// Plain runtime instantiation replays pre-resolved constructors and setters.
+	// The editor goes through Object::set(), which also marks objects as edited.
+	const InstantiationNodePlan *plan = nullptr;
+	if (p_edit_state == GEN_EDIT_STATE_DISABLED && !Engine::get_singleton()->is_editor_hint()) {
+		if (!instantiation_plan_valid.is_set()) {
+			_build_instantiation_plan();
+		}
+		if (instantiation_plan.size() == (uint32_t)nc) {
+			plan = instantiation_plan.ptr();
+		}
+	}
+
 	for (int i = 0; i < nc; i++) {
 		const NodeData &n = nd[i];
 
@@ -233,7 +481,7 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 			}
 		} else {
 			//node belongs to this scene and must be created
-			Object *obj = ClassDB::instantiate(snames[n.type]);
+			Object *obj = (plan && plan[i].creation_func) ? plan[i].creation_func() : ClassDB::instantiate(snames[n.type]);
 
 			node = Object::cast_to<Node>(obj);
 
@@ -372,7 +620,24 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 						}
 
 						if (set_valid) {
-							node->set(snames[nprops[j].name], value, &valid);
+							// A script may override native properties, so cached setters are only used without one.
+							MethodBind *setter = (plan && (uint32_t)j < plan[i].setters.size() && !node->get_script_instance()) ? plan[i].setters[j] : nullptr;
+							if (setter) {
+								const Variant *argptr = &value;
+								Variant::Type arg_type = setter->get_argument_type(0);
+								if (arg_type == Variant::NIL || (arg_type == value.get_type() && arg_type != Variant::OBJECT)) {
+									setter->validated_call(node, &argptr, nullptr);
+								} else {
+									Callable::CallError ce;
+									setter->call(node, &argptr, 1, ce);
+									if (ce.error != Callable::CallError::CALL_OK) {
+										// Let the regular path convert the value or report the error.
+										node->set(snames[nprops[j].name], value, &valid);
+									}
+								}
+							} else {
+								node->set(snames[nprops[j].name], value, &valid);
+							}
 						}
 					}
 				}
@@ -1123,6 +1388,7 @@ void SceneState::clear() {
 	node_paths.clear();
 	editable_instances.clear();
 	base_scene_idx = -1;
+	_invalidate_instantiation_plan();
 }
 
 Error SceneState::copy_from(const Ref<SceneState> &p_scene_state) {
@@ -1323,6 +1589,8 @@ void SceneState::set_bundled_scene(const Dictionary &p_dictionary) {
 	ERR_FAIL_COND(!p_dictionary.has("conns"));
 	//ERR_FAIL_COND( !p_dictionary.has("path"));
 
+	_invalidate_instantiation_plan();
+
 	int version = 1;
 	if (p_dictionary.has("version")) {
 		version = p_dictionary["version"];
@@ -1793,6 +2061,7 @@ int SceneState::add_node(int p_parent, int p_owner, int p_type, int p_name, int
 	nd.index = p_index;
 
 	nodes.push_back(nd);
+	_invalidate_instantiation_plan();
 
 	return nodes.size() - 1;
 }
@@ -1809,6 +2078,7 @@ void SceneState::add_node_property(int p_node, int p_name, int p_value, bool p_d
 	}
 	prop.value = p_value;
 	nodes.write[p_node].properties.push_back(prop);
+	_invalidate_instantiation_plan();
 }
 
 void SceneState::add_node_group(int p_node, int p_group) {
@@ -1820,6 +2090,7 @@ void SceneState::add_node_group(int p_node, int p_group) {
 void SceneState::set_base_scene(int p_idx) {
 	ERR_FAIL_INDEX(p_idx, variants.size());
 	base_scene_idx = p_idx;
+	_invalidate_instantiation_plan();
 }
 
 void SceneState::add_connection(int p_from, int p_to, int p_signal, int p_method, int p_flags, int p_unbinds, const Vector<int> &p_binds) {
@@ -1892,6 +2163,7 @@ SceneState::SceneState() {
 ////////////////
 
 void PackedScene::_set_bundled_scene(const Dictionary &p_scene) {
+	clear_pool();
 	state->set_bundled_scene(p_scene);
 }
 
@@ -1900,10 +2172,12 @@ Dictionary PackedScene::_get_bundled_scene() const {
 }
 
 Error PackedScene::pack(Node *p_scene) {
+	clear_pool();
 	return state->pack(p_scene);
 }
 
 void PackedScene::clear() {
+	clear_pool();
 	state->clear();
 }
 
@@ -1927,6 +2201,7 @@ void PackedScene::reload_from_file() {
 	copy_from(s);
 	// Then, we copy the backed-up loaded_state to state
 	state->copy_from(loaded_state);
+	clear_pool();
 }
 
 bool PackedScene::can_instantiate() const {
@@ -1957,6 +2232,7 @@ Node *PackedScene::instantiate(GenEditState p_edit_state) const {
 }
 
 void PackedScene::replace_state(Ref<SceneState> p_by) {
+	clear_pool();
 	state = p_by;
 	state->set_path(get_path());
 #ifdef TOOLS_ENABLED
@@ -1965,6 +2241,7 @@ void PackedScene::replace_state(Ref<SceneState> p_by) {
 }
 
 void PackedScene::recreate_state() {
+	clear_pool();
 	state = Ref<SceneState>(memnew(SceneState));
 	state->set_path(get_path());
 #ifdef TOOLS_ENABLED
@@ -1976,6 +2253,120 @@ Ref<SceneState> PackedScene::get_state() const {
 	return state;
 }
 
+Node *PackedScene::acquire_instance() {
+	{
+		MutexLock lock(pool_mutex);
+		while (!pool.is_empty()) {
+			ObjectID id = pool[pool.size() - 1];
+			pool.remove_at(pool.size() - 1);
+			Node *node = Object::cast_to<Node>(ObjectDB::get_instance(id));
+			if (node && !node->is_inside_tree() && !node->get_parent()) {
+				pool_reused++;
+				return node;
+			}
+		}
+	}
+
+	Node *node = instantiate(GEN_EDIT_STATE_DISABLED);
+	if (node) {
+		MutexLock lock(pool_mutex);
+		pool_created++;
+	}
+	return node;
+}
+
+bool PackedScene::release_instance(Node *p_node) {
+	ERR_FAIL_NULL_V(p_node, false);
+	ERR_FAIL_COND_V_MSG(p_node->is_queued_for_deletion(), false, "Can't release an instance that is queued for deletion.");
+	ERR_FAIL_COND_V_MSG(!is_built_in() && p_node->get_scene_file_path() != get_path(), false, vformat("Node \"%s\" is not an instance of scene \"%s\".", p_node->get_name(), get_path()));
+	{
+		MutexLock lock(pool_mutex);
+		ERR_FAIL_COND_V_MSG(pool.find(p_node->get_instance_id()) != -1, false, "Instance was already released to the pool.");
+	}
+
+	if (p_node->get_parent()) {
+		p_node->get_parent()->remove_child(p_node);
+	}
+
+	bool pooled = false;
+	{
+		MutexLock lock(pool_mutex);
+		pooled = pool_max_size <= 0 || (int)pool.size() < pool_max_size;
+	}
+	// Resetting may run script setters, so it's done without holding the lock.
+	if (pooled) {
+		pooled = state->reset_instance(p_node);
+	}
+
+	MutexLock lock(pool_mutex);
+	if (pooled) {
+		pool.push_back(p_node->get_instance_id());
+		pool_released++;
+	} else {
+		pool_discarded++;
+		p_node->queue_free();
+	}
+	return pooled;
+}
+
+void PackedScene::warm_up_pool(int p_count) {
+	ERR_FAIL_COND(p_count < 0);
+
+	int missing = 0;
+	{
+		MutexLock lock(pool_mutex);
+		int count = pool_max_size > 0 ? MIN(p_count, pool_max_size) : p_count;
+		missing = count - (int)pool.size();
+	}
+
+	for (int i = 0; i < missing; i++) {
+		Node *node = instantiate(GEN_EDIT_STATE_DISABLED);
+		ERR_FAIL_NULL(node);
+
+		MutexLock lock(pool_mutex);
+		pool.push_back(node->get_instance_id());
+		pool_created++;
+	}
+}
+
+void PackedScene::clear_pool() {
+	LocalVector<ObjectID> ids;
+	{
+		MutexLock lock(pool_mutex);
+		ids = pool;
+		pool.clear();
+	}
+
+	for (const ObjectID &id : ids) {
+		Node *node = Object::cast_to<Node>(ObjectDB::get_instance(id));
+		if (node && !node->get_parent()) {
+			memdelete(node);
+		}
+	}
+}
+
+void PackedScene::set_pool_max_size(int p_size) {
+	ERR_FAIL_COND(p_size < 0);
+	MutexLock lock(pool_mutex);
+	pool_max_size = p_size;
+}
+
+int PackedScene::get_pool_max_size() const {
+	MutexLock lock(pool_mutex);
+	return pool_max_size;
+}
+
+Dictionary PackedScene::get_pool_statistics() const {
+	MutexLock lock(pool_mutex);
+	Dictionary stats;
+	stats["available"] = pool.size();
+	stats["created"] = pool_created;
+	stats["reused"] = pool_reused;
+	stats["released"] = pool_released;
+	stats["discarded"] = pool_discarded;
+	return stats;
+}
+
 void PackedScene::set_path(const String &p_path, bool p_take_over) {
 	state->set_path(p_path);
 	Resource::set_path(p_path, p_take_over);
@@ -1992,6 +2383,14 @@ void PackedScene::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("_get_bundled_scene"), &PackedScene::_get_bundled_scene);
 	ClassDB::bind_method(D_METHOD("get_state"), &PackedScene::get_state);
 
+	ClassDB::bind_method(D_METHOD("acquire_instance"), &PackedScene::acquire_instance);
+	ClassDB::bind_method(D_METHOD("release_instance", "node"), &PackedScene::release_instance);
+	ClassDB::bind_method(D_METHOD("warm_up_pool", "count"), &PackedScene::warm_up_pool);
+	ClassDB::bind_method(D_METHOD("clear_pool"), &PackedScene::clear_pool);
+	ClassDB::bind_method(D_METHOD("set_pool_max_size", "size"), &PackedScene::set_pool_max_size);
+	ClassDB::bind_method(D_METHOD("get_pool_max_size"), &PackedScene::get_pool_max_size);
+	ClassDB::bind_method(D_METHOD("get_pool_statistics"), &PackedScene::get_pool_statistics);
+
 	ADD_PROPERTY(PropertyInfo(Variant::DICTIONARY, "_bundled"), "_set_bundled_scene", "_get_bundled_scene");
 
 	BIND_ENUM_CONSTANT(GEN_EDIT_STATE_DISABLED);
@@ -2003,3 +2402,7 @@ void PackedScene::_bind_methods() {
 PackedScene::PackedScene() {
 	state = Ref<SceneState>(memnew(SceneState));
 }
+
+PackedScene::~PackedScene() {
+	clear_pool();
+}
@@ -32,6 +32,9 @@
 #define PACKED_SCENE_H
 
 #include "core/io/resource.h"
+#include "core/os/mutex.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
 #include "scene/main/node.h"
 
 class SceneState : public RefCounted {
@@ -89,6 +92,33 @@ class SceneState : public RefCounted {
 
 	Vector<ConnectionData> connections;
 
+	// Constructor and property setters of a node resolved once, so runtime instantiation skips the lookups by name.
+	struct InstantiationNodePlan {
+		Object *(*creation_func)() = nullptr; // Null when ClassDB::instantiate() must be used.
+		LocalVector<MethodBind *> setters; // Per property, null when Object::set() must be used.
+	};
+
+	mutable Mutex instantiation_plan_mutex;
+	mutable SafeFlag instantiation_plan_valid;
+	mutable LocalVector<InstantiationNodePlan> instantiation_plan;
+
+	// Values a pooled node is restored to: class defaults, overridden by the values stored in the scene.
+	struct ResetProperty {
+		StringName name;
+		Variant value;
+		MethodBind *setter = nullptr; // Null when Object::set() must be used.
+		MethodBind *getter = nullptr; // Null when Object::get() must be used.
+		bool is_node_path = false;
+	};
+
+	mutable SafeFlag reset_plan_valid;
+	mutable bool reset_supported = false;
+	mutable LocalVector<LocalVector<ResetProperty>> reset_plan;
+
+	void _build_instantiation_plan() const;
+	void _build_reset_plan() const;
+	void _invalidate_instantiation_plan();
+
 	Error _parse_node(Node *p_owner, Node *p_node, int p_parent_idx, HashMap<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 	Error _parse_connections(Node *p_owner, Node *p_node, HashMap<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 
@@ -156,6 +186,7 @@ public:
 
 	bool can_instantiate() const;
 	Node *instantiate(GenEditState p_edit_state) const;
+	bool reset_instance(Node *p_node) const;
 
 	Ref<SceneState> get_base_scene_state() const;
 
@@ -225,6 +256,14 @@ class PackedScene : public Resource {
 
 	Ref<SceneState> state;
 
+	mutable Mutex pool_mutex;
+	LocalVector<ObjectID> pool;
+	int pool_max_size = 0;
+	uint64_t pool_created = 0;
+	uint64_t pool_reused = 0;
+	uint64_t pool_released = 0;
+	uint64_t pool_discarded = 0;
+
 	void _set_bundled_scene(const Dictionary &p_scene);
 	Dictionary _get_bundled_scene() const;
 
@@ -251,6 +290,14 @@ public:
 	void recreate_state();
 	void replace_state(Ref<SceneState> p_by);
 
+	Node *acquire_instance();
+	bool release_instance(Node *p_node);
+	void warm_up_pool(int p_count);
+	void clear_pool();
+	void set_pool_max_size(int p_size);
+	int get_pool_max_size() const;
+	Dictionary get_pool_statistics() const;
+
 	virtual void reload_from_file() override;
 
 	virtual void set_path(const String &p_path, bool p_take_over = false) override;
@@ -264,6 +311,7 @@ public:
 	Ref<SceneState> get_state() const;
 
 	PackedScene();
+	~PackedScene();
 };
 
 VARIANT_ENUM_CAST(PackedScene::GenEditState)
@@ -78,6 +78,7 @@ void World2D::remove_viewport(Viewport *p_viewport) {
 
 World2D::World2D() {
 	canvas = RenderingServer::get_singleton()->canvas_create();
+	RenderingServer::get_singleton()->canvas_set_use_spatial_index(canvas, GLOBAL_GET("rendering/2d/culling/use_spatial_index"));
 }
 
 World2D::~World2D() {
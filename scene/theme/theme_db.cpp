@@ -62,6 +62,13 @@ void ThemeDB::initialize_theme() {
 	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "gui/theme/lcd_subpixel_layout", PROPERTY_HINT_ENUM, "Disabled,Horizontal RGB,Horizontal BGR,Vertical RGB,Vertical BGR"), 1);
 	ProjectSettings::get_singleton()->set_restart_if_changed("gui/theme/lcd_subpixel_layout", false);
 
+	const bool async_glyph_rasterization = GLOBAL_DEF_RST("gui/theme/async_glyph_rasterization", false);
+	const int shaped_text_cache_size_kb = GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "gui/common/shaped_text_cache_size_kb", PROPERTY_HINT_RANGE, "0,65536,1,or_greater,suffix:KiB"), 1024);
+	if (TextServerManager::get_singleton() && TS.is_valid()) {
+		TS->set_async_glyph_rasterization(async_glyph_rasterization);
+		TS->set_shaped_text_cache_limit((int64_t)shaped_text_cache_size_kb * 1024);
+	}
+
 	// Attempt to load custom project theme and font.
 
 	if (!project_theme_path.is_empty()) {
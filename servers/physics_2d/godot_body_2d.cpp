@@ -604,26 +604,32 @@ void GodotBody2D::integrate_forces(real_t p_step) {
 	biased_linear_velocity = Vector2();
 
 	if (do_motion) { //shapes temporarily extend for raycast
-		_update_shapes_with_motion(motion);
+		pending_motion = motion;
+		pending_shapes_motion_update = true;
 	}
 
 	contact_count = 0;
 }
 
+void GodotBody2D::integrate_forces_finalize() {
+	if (pending_shapes_motion_update) {
+		_update_shapes_with_motion(pending_motion);
+		pending_shapes_motion_update = false;
+	}
+}
+
 void GodotBody2D::integrate_velocities(real_t p_step) {
 	if (mode == PhysicsServer2D::BODY_MODE_STATIC) {
 		return;
 	}
 
-	if (fi_callback_data || body_state_callback.is_valid()) {
-		get_space()->body_add_to_state_query_list(&direct_state_query_list);
-	}
+	pending_state_query = fi_callback_data || body_state_callback.is_valid();
 
 	if (mode == PhysicsServer2D::BODY_MODE_KINEMATIC) {
 		_set_transform(new_transform, false);
 		_set_inv_transform(new_transform.affine_inverse());
 		if (contacts.size() == 0 && linear_velocity == Vector2() && angular_velocity == 0) {
-			set_active(false); //stopped moving, deactivate
+			pending_deactivation = true; //stopped moving, deactivate
 		}
 		return;
 	}
@@ -640,8 +646,9 @@ void GodotBody2D::integrate_velocities(real_t p_step) {
 		pos += center_of_mass - center_of_mass.rotated(angle_delta);
 	}
 
-	_set_transform(Transform2D(angle, pos), continuous_cd_mode == PhysicsServer2D::CCD_MODE_DISABLED);
+	_set_transform(Transform2D(angle, pos), false);
 	_set_inv_transform(get_transform().inverse());
+	pending_shapes_update = continuous_cd_mode == PhysicsServer2D::CCD_MODE_DISABLED;
 
 	if (continuous_cd_mode != PhysicsServer2D::CCD_MODE_DISABLED) {
 		new_transform = get_transform();
@@ -650,6 +657,23 @@ void GodotBody2D::integrate_velocities(real_t p_step) {
 	_update_transform_dependent();
 }
 
+void GodotBody2D::integrate_velocities_finalize() {
+	if (pending_state_query) {
+		get_space()->body_add_to_state_query_list(&direct_state_query_list);
+		pending_state_query = false;
+	}
+
+	if (pending_shapes_update) {
+		_update_shapes();
+		pending_shapes_update = false;
+	}
+
+	if (pending_deactivation) {
+		set_active(false);
+		pending_deactivation = false;
+	}
+}
+
 void GodotBody2D::wakeup_neighbours() {
 	for (const Pair<GodotConstraint2D *, int> &E : constraint_list) {
 		const GodotConstraint2D *c = E.first;
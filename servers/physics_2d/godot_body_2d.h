@@ -151,6 +151,14 @@ class GodotBody2D : public GodotCollisionObject2D {
 	GodotPhysicsDirectBodyState2D *direct_state = nullptr;
 
 	uint64_t island_step = 0;
+	uint32_t island_index = 0;
+
+	// Changes to shared space data requested during integration, applied by the *_finalize() methods.
+	Vector2 pending_motion;
+	bool pending_shapes_motion_update = false;
+	bool pending_shapes_update = false;
+	bool pending_state_query = false;
+	bool pending_deactivation = false;
 
 	void _update_transform_dependent();
 
@@ -202,6 +210,9 @@ public:
 	_FORCE_INLINE_ uint64_t get_island_step() const { return island_step; }
 	_FORCE_INLINE_ void set_island_step(uint64_t p_step) { island_step = p_step; }
 
+	_FORCE_INLINE_ uint32_t get_island_index() const { return island_index; }
+	_FORCE_INLINE_ void set_island_index(uint32_t p_index) { island_index = p_index; }
+
 	_FORCE_INLINE_ void add_constraint(GodotConstraint2D *p_constraint, int p_pos) { constraint_list.push_back({ p_constraint, p_pos }); }
 	_FORCE_INLINE_ void remove_constraint(GodotConstraint2D *p_constraint, int p_pos) { constraint_list.erase({ p_constraint, p_pos }); }
 	const List<Pair<GodotConstraint2D *, int>> &get_constraint_list() const { return constraint_list; }
@@ -315,8 +326,12 @@ public:
 	_FORCE_INLINE_ real_t get_friction() const { return friction; }
 	_FORCE_INLINE_ real_t get_bounce() const { return bounce; }
 
+	// Integration only modifies the body itself, so it can run on multiple threads at once.
+	// The matching *_finalize() method must then be called from a single thread, to update the broadphase and the space lists.
 	void integrate_forces(real_t p_step);
+	void integrate_forces_finalize();
 	void integrate_velocities(real_t p_step);
+	void integrate_velocities_finalize();
 
 	_FORCE_INLINE_ Vector2 get_velocity_in_local_point(const Vector2 &rel_pos) const {
 		return linear_velocity + Vector2(-angular_velocity * rel_pos.y, angular_velocity * rel_pos.x);
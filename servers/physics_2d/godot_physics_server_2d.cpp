@@ -1332,7 +1332,8 @@ void GodotPhysicsServer2D::flush_queries() {
 			"generate_islands",
 			"setup_constraints",
 			"solve_constraints",
-			"integrate_velocities"
+			"integrate_velocities",
+			"sleep_islands"
 		};
 
 		for (int i = 0; i < GodotSpace2D::ELAPSED_TIME_MAX; i++) {
@@ -34,26 +34,41 @@
 #include "core/os/os.h"
 
 #define BODY_ISLAND_COUNT_RESERVE 128
-#define BODY_ISLAND_SIZE_RESERVE 512
 #define ISLAND_COUNT_RESERVE 128
-#define ISLAND_SIZE_RESERVE 512
 #define CONSTRAINT_COUNT_RESERVE 1024
+#define ACTIVE_BODY_COUNT_RESERVE 1024
 
-void GodotStep2D::_populate_island(GodotBody2D *p_body, LocalVector<GodotBody2D *> &p_body_island, LocalVector<GodotConstraint2D *> &p_constraint_island) {
-	p_body->set_island_step(_step);
-
-	if (p_body->get_mode() > PhysicsServer2D::BODY_MODE_KINEMATIC) {
-		// Only rigid bodies are tested for activation.
-		p_body_island.push_back(p_body);
+void GodotStep2D::_fetch_active_bodies(const SelfList<GodotBody2D>::List *p_body_list) {
+	// Snapshot the active list, as bodies may leave it while being integrated.
+	active_bodies.clear();
+	const SelfList<GodotBody2D> *b = p_body_list->first();
+	while (b) {
+		active_bodies.push_back(b->self());
+		b = b->next();
 	}
+}
+
+void GodotStep2D::_integrate_forces(uint32_t p_body_index, void *p_userdata) {
+	active_bodies[p_body_index]->integrate_forces(delta);
+}
+
+void GodotStep2D::_integrate_velocities(uint32_t p_body_index, void *p_userdata) {
+	active_bodies[p_body_index]->integrate_velocities(delta);
+}
+
+void GodotStep2D::_add_island_body(GodotBody2D *p_body) {
+	p_body->set_island_step(_step);
+	p_body->set_island_index(island_bodies.size());
+	island_bodies.push_back(p_body);
+}
 
+void GodotStep2D::_gather_island_body_constraints(GodotBody2D *p_body) {
 	for (const Pair<GodotConstraint2D *, int> &E : p_body->get_constraint_list()) {
 		GodotConstraint2D *constraint = const_cast<GodotConstraint2D *>(E.first);
 		if (constraint->get_island_step() == _step) {
 			continue; // Already processed.
 		}
 		constraint->set_island_step(_step);
-		p_constraint_island.push_back(constraint);
 		all_constraints.push_back(constraint);
 
 		for (int i = 0; i < constraint->get_body_count(); i++) {
@@ -67,11 +82,72 @@ void GodotStep2D::_populate_island(GodotBody2D *p_body, LocalVector<GodotBody2D
 			if (other_body->get_mode() == PhysicsServer2D::BODY_MODE_STATIC) {
 				continue; // Static bodies don't connect islands.
 			}
-			_populate_island(other_body, p_body_island, p_constraint_island);
+			_add_island_body(other_body);
+		}
+	}
+}
+
+uint32_t GodotStep2D::_find_island_root(uint32_t p_body_index) {
+	uint32_t index = p_body_index;
+	while (true) {
+		uint32_t parent = island_parents[index].load(std::memory_order_acquire);
+		if (parent == index) {
+			return index;
+		}
+		uint32_t grand_parent = island_parents[parent].load(std::memory_order_acquire);
+		if (grand_parent != parent) {
+			// Path halving, it doesn't matter if another thread did it first.
+			island_parents[index].compare_exchange_weak(parent, grand_parent, std::memory_order_acq_rel);
+		}
+		index = grand_parent;
+	}
+}
+
+void GodotStep2D::_merge_islands(uint32_t p_body_index_a, uint32_t p_body_index_b) {
+	while (true) {
+		uint32_t root_a = _find_island_root(p_body_index_a);
+		uint32_t root_b = _find_island_root(p_body_index_b);
+		if (root_a == root_b) {
+			return;
+		}
+		// Always link the highest root to the lowest one, so no cycle can be created and the result is deterministic.
+		if (root_a < root_b) {
+			SWAP(root_a, root_b);
+		}
+		uint32_t expected = root_a;
+		if (island_parents[root_a].compare_exchange_strong(expected, root_b, std::memory_order_acq_rel)) {
+			return;
 		}
+		// Another thread linked root_a meanwhile, try again.
 	}
 }
 
+uint32_t GodotStep2D::_get_constraint_island_body(GodotConstraint2D *p_constraint) const {
+	for (int i = 0; i < p_constraint->get_body_count(); i++) {
+		GodotBody2D *body = p_constraint->get_body_ptr()[i];
+		if (body->get_mode() != PhysicsServer2D::BODY_MODE_STATIC) {
+			return body->get_island_index();
+		}
+	}
+	return 0; // Unreachable, constraints are gathered from non-static bodies.
+}
+
+void GodotStep2D::_union_constraint_bodies(uint32_t p_constraint_index, void *p_userdata) {
+	GodotConstraint2D *constraint = all_constraints[island_constraints_begin + p_constraint_index];
+	uint32_t island_body = _get_constraint_island_body(constraint);
+	for (int i = 0; i < constraint->get_body_count(); i++) {
+		GodotBody2D *body = constraint->get_body_ptr()[i];
+		if (body->get_mode() == PhysicsServer2D::BODY_MODE_STATIC) {
+			continue; // Static bodies don't connect islands.
+		}
+		_merge_islands(island_body, body->get_island_index());
+	}
+}
+
+void GodotStep2D::_resolve_island_root(uint32_t p_body_index, void *p_userdata) {
+	island_roots[p_body_index] = _find_island_root(p_body_index);
+}
+
 void GodotStep2D::_setup_constraint(uint32_t p_constraint_index, void *p_userdata) {
 	GodotConstraint2D *constraint = all_constraints[p_constraint_index];
 	constraint->setup(delta);
@@ -101,28 +177,20 @@ void GodotStep2D::_solve_island(uint32_t p_island_index, void *p_userdata) const
 	}
 }
 
-void GodotStep2D::_check_suspend(LocalVector<GodotBody2D *> &p_body_island) const {
+void GodotStep2D::_check_suspend(uint32_t p_island_index, void *p_userdata) {
+	const LocalVector<GodotBody2D *> &body_island = body_islands[p_island_index];
 	bool can_sleep = true;
 
-	uint32_t body_count = p_body_island.size();
+	uint32_t body_count = body_island.size();
 	for (uint32_t body_index = 0; body_index < body_count; ++body_index) {
-		GodotBody2D *body = p_body_island[body_index];
+		GodotBody2D *body = body_island[body_index];
 
 		if (!body->sleep_test(delta)) {
 			can_sleep = false;
 		}
 	}
 
-	// Put all to sleep or wake up everyone.
-	for (uint32_t body_index = 0; body_index < body_count; ++body_index) {
-		GodotBody2D *body = p_body_island[body_index];
-
-		bool active = body->is_active();
-
-		if (active == can_sleep) {
-			body->set_active(!can_sleep);
-		}
-	}
+	island_can_sleep[p_island_index] = can_sleep;
 }
 
 void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
@@ -142,13 +210,15 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 	uint64_t profile_begtime = OS::get_singleton()->get_ticks_usec();
 	uint64_t profile_endtime = 0;
 
-	int active_count = 0;
+	_fetch_active_bodies(body_list);
+	uint32_t active_count = active_bodies.size();
 
-	const SelfList<GodotBody2D> *b = body_list->first();
-	while (b) {
-		b->self()->integrate_forces(p_delta);
-		b = b->next();
-		active_count++;
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep2D::_integrate_forces, nullptr, active_count, -1, true, SNAME("Physics2DIntegrateForces"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	// Broadphase updates can't run on threads.
+	for (uint32_t body_index = 0; body_index < active_count; ++body_index) {
+		active_bodies[body_index]->integrate_forces_finalize();
 	}
 
 	p_space->set_active_objects(active_count);
@@ -192,41 +262,76 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 
 	/* GENERATE CONSTRAINT ISLANDS FOR ACTIVE RIGID BODIES */
 
-	b = body_list->first();
-
-	uint32_t body_island_count = 0;
+	// Gather all the bodies and constraints connected to the active bodies.
+	// Sleeping bodies touching active ones are included, so they can be woken up.
+	island_bodies.clear();
+	island_constraints_begin = all_constraints.size();
 
+	const SelfList<GodotBody2D> *b = body_list->first();
 	while (b) {
 		GodotBody2D *body = b->self();
-
 		if (body->get_island_step() != _step) {
-			++body_island_count;
+			_add_island_body(body);
+		}
+		b = b->next();
+	}
+	for (uint32_t body_index = 0; body_index < island_bodies.size(); ++body_index) {
+		_gather_island_body_constraints(island_bodies[body_index]);
+	}
+
+	uint32_t island_body_count = island_bodies.size();
+	uint32_t island_constraint_count = all_constraints.size() - island_constraints_begin;
+
+	// Merge the bodies sharing constraints into islands, then find each body's island.
+	island_parents.resize(island_body_count);
+	island_roots.resize(island_body_count);
+	for (uint32_t body_index = 0; body_index < island_body_count; ++body_index) {
+		island_parents[body_index].store(body_index, std::memory_order_relaxed);
+	}
+
+	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep2D::_union_constraint_bodies, nullptr, island_constraint_count, -1, true, SNAME("Physics2DUnionIslands"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep2D::_resolve_island_root, nullptr, island_body_count, -1, true, SNAME("Physics2DResolveIslands"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	// Fill the islands, giving them indices in order of discovery.
+	// Body and constraint islands are indexed separately, so islands without rigid bodies or without constraints are skipped.
+	island_body_island_indices.resize(island_body_count);
+	island_constraint_island_indices.resize(island_body_count);
+	for (uint32_t body_index = 0; body_index < island_body_count; ++body_index) {
+		island_body_island_indices[body_index] = UINT32_MAX;
+		island_constraint_island_indices[body_index] = UINT32_MAX;
+	}
+
+	uint32_t body_island_count = 0;
+	for (uint32_t body_index = 0; body_index < island_body_count; ++body_index) {
+		GodotBody2D *body = island_bodies[body_index];
+		if (body->get_mode() <= PhysicsServer2D::BODY_MODE_KINEMATIC) {
+			continue; // Only rigid bodies are tested for activation.
+		}
+		uint32_t &island_index = island_body_island_indices[island_roots[body_index]];
+		if (island_index == UINT32_MAX) {
+			island_index = body_island_count++;
 			if (body_islands.size() < body_island_count) {
 				body_islands.resize(body_island_count);
 			}
-			LocalVector<GodotBody2D *> &body_island = body_islands[body_island_count - 1];
-			body_island.clear();
-			body_island.reserve(BODY_ISLAND_SIZE_RESERVE);
+			body_islands[island_index].clear();
+		}
+		body_islands[island_index].push_back(body);
+	}
 
-			++island_count;
+	for (uint32_t constraint_index = 0; constraint_index < island_constraint_count; ++constraint_index) {
+		GodotConstraint2D *constraint = all_constraints[island_constraints_begin + constraint_index];
+		uint32_t &island_index = island_constraint_island_indices[island_roots[_get_constraint_island_body(constraint)]];
+		if (island_index == UINT32_MAX) {
+			island_index = island_count++;
 			if (constraint_islands.size() < island_count) {
 				constraint_islands.resize(island_count);
 			}
-			LocalVector<GodotConstraint2D *> &constraint_island = constraint_islands[island_count - 1];
-			constraint_island.clear();
-			constraint_island.reserve(ISLAND_SIZE_RESERVE);
-
-			_populate_island(body, body_island, constraint_island);
-
-			if (body_island.is_empty()) {
-				--body_island_count;
-			}
-
-			if (constraint_island.is_empty()) {
-				--island_count;
-			}
+			constraint_islands[island_index].clear();
 		}
-		b = b->next();
+		constraint_islands[island_index].push_back(constraint);
 	}
 
 	p_space->set_island_count((int)island_count);
@@ -240,7 +345,7 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 	/* SETUP CONSTRAINTS / PROCESS COLLISIONS */
 
 	uint32_t total_constraint_count = all_constraints.size();
-	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep2D::_setup_constraint, nullptr, total_constraint_count, -1, true, SNAME("Physics2DConstraintSetup"));
+	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep2D::_setup_constraint, nullptr, total_constraint_count, -1, true, SNAME("Physics2DConstraintSetup"));
 	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 
 	{ //profile
@@ -271,22 +376,44 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 
 	/* INTEGRATE VELOCITIES */
 
-	b = body_list->first();
-	while (b) {
-		const SelfList<GodotBody2D> *n = b->next();
-		b->self()->integrate_velocities(p_delta);
-		b = n; // in case it shuts itself down
+	// Bodies may have been woken up since the forces were integrated.
+	_fetch_active_bodies(body_list);
+	active_count = active_bodies.size();
+
+	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep2D::_integrate_velocities, nullptr, active_count, -1, true, SNAME("Physics2DIntegrateVelocities"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	// Broadphase and active list updates can't run on threads.
+	for (uint32_t body_index = 0; body_index < active_count; ++body_index) {
+		active_bodies[body_index]->integrate_velocities_finalize();
+	}
+
+	{ //profile
+		profile_endtime = OS::get_singleton()->get_ticks_usec();
+		p_space->set_elapsed_time(GodotSpace2D::ELAPSED_TIME_INTEGRATE_VELOCITIES, profile_endtime - profile_begtime);
+		profile_begtime = profile_endtime;
 	}
 
 	/* SLEEP / WAKE UP ISLANDS */
 
+	island_can_sleep.resize(body_island_count);
+	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep2D::_check_suspend, nullptr, body_island_count, -1, true, SNAME("Physics2DCheckSuspend"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	// Put all to sleep or wake up everyone.
+	// Warning: This doesn't run on threads, because it modifies the space's active list.
 	for (uint32_t island_index = 0; island_index < body_island_count; ++island_index) {
-		_check_suspend(body_islands[island_index]);
+		bool can_sleep = island_can_sleep[island_index];
+		for (GodotBody2D *body : body_islands[island_index]) {
+			if (body->is_active() == can_sleep) {
+				body->set_active(!can_sleep);
+			}
+		}
 	}
 
 	{ //profile
 		profile_endtime = OS::get_singleton()->get_ticks_usec();
-		p_space->set_elapsed_time(GodotSpace2D::ELAPSED_TIME_INTEGRATE_VELOCITIES, profile_endtime - profile_begtime);
+		p_space->set_elapsed_time(GodotSpace2D::ELAPSED_TIME_SLEEP_ISLANDS, profile_endtime - profile_begtime);
 		//profile_begtime=profile_endtime;
 	}
 
@@ -300,6 +427,8 @@ GodotStep2D::GodotStep2D() {
 	body_islands.reserve(BODY_ISLAND_COUNT_RESERVE);
 	constraint_islands.reserve(ISLAND_COUNT_RESERVE);
 	all_constraints.reserve(CONSTRAINT_COUNT_RESERVE);
+	active_bodies.reserve(ACTIVE_BODY_COUNT_RESERVE);
+	island_bodies.reserve(ACTIVE_BODY_COUNT_RESERVE);
 }
 
 GodotStep2D::~GodotStep2D() {
@@ -44,12 +44,31 @@ class GodotStep2D {
 	LocalVector<LocalVector<GodotBody2D *>> body_islands;
 	LocalVector<LocalVector<GodotConstraint2D *>> constraint_islands;
 	LocalVector<GodotConstraint2D *> all_constraints;
+	LocalVector<GodotBody2D *> active_bodies;
 
-	void _populate_island(GodotBody2D *p_body, LocalVector<GodotBody2D *> &p_body_island, LocalVector<GodotConstraint2D *> &p_constraint_island);
+	void _fetch_active_bodies(const SelfList<GodotBody2D>::List *p_body_list);
+	void _integrate_forces(uint32_t p_body_index, void *p_userdata = nullptr);
+	void _integrate_velocities(uint32_t p_body_index, void *p_userdata = nullptr);
+	// Island generation, using a lock-free union-find over the bodies reached from the active list.
+	LocalVector<GodotBody2D *> island_bodies;
+	LocalVector<std::atomic<uint32_t>> island_parents;
+	LocalVector<uint32_t> island_roots;
+	LocalVector<uint32_t> island_body_island_indices;
+	LocalVector<uint32_t> island_constraint_island_indices;
+	uint32_t island_constraints_begin = 0;
+	LocalVector<uint8_t> island_can_sleep;
+
+	void _add_island_body(GodotBody2D *p_body);
+	void _gather_island_body_constraints(GodotBody2D *p_body);
+	uint32_t _find_island_root(uint32_t p_body_index);
+	void _merge_islands(uint32_t p_body_index_a, uint32_t p_body_index_b);
+	void _union_constraint_bodies(uint32_t p_constraint_index, void *p_userdata = nullptr);
+	void _resolve_island_root(uint32_t p_body_index, void *p_userdata = nullptr);
+	uint32_t _get_constraint_island_body(GodotConstraint2D *p_constraint) const;
 	void _setup_constraint(uint32_t p_constraint_index, void *p_userdata = nullptr);
 	void _pre_solve_island(LocalVector<GodotConstraint2D *> &p_constraint_island) const;
 	void _solve_island(uint32_t p_island_index, void *p_userdata = nullptr) const;
-	void _check_suspend(LocalVector<GodotBody2D *> &p_body_island) const;
+	void _check_suspend(uint32_t p_island_index, void *p_userdata = nullptr);
 
 public:
 	void step(GodotSpace2D *p_space, real_t p_delta);
@@ -41,3 +41,31 @@ TextureStorage::TextureStorage() {
 TextureStorage::~TextureStorage() {
 	singleton = nullptr;
 }
+
+void TextureStorage::texture_2d_update_region(RID p_texture, const Ref<Image> &p_image, const Vector2i &p_position, int p_mipmap, int p_layer) {
+	DummyTexture *t = texture_owner.get_or_null(p_texture);
+	ERR_FAIL_NULL(t);
+	ERR_FAIL_COND(t->image.is_null() || p_image.is_null() || p_image->is_empty());
+	ERR_FAIL_COND(t->image->get_format() != p_image->get_format());
+	ERR_FAIL_COND(p_image->is_compressed() || p_image->has_mipmaps());
+	ERR_FAIL_INDEX(p_mipmap, t->image->get_mipmap_count() + 1);
+
+	int ofs = 0;
+	int size = 0;
+	int mip_width = 0;
+	int mip_height = 0;
+	t->image->get_mipmap_offset_size_and_dimensions(p_mipmap, ofs, size, mip_width, mip_height);
+	ERR_FAIL_COND(p_position.x < 0 || p_position.y < 0);
+	ERR_FAIL_COND(p_position.x + p_image->get_width() > mip_width || p_position.y + p_image->get_height() > mip_height);
+
+	// Written to a copy, images previously returned by texture_2d_get() are left untouched.
+	Vector<uint8_t> data = t->image->get_data();
+	const Vector<uint8_t> region = p_image->get_data();
+	const int pixel_size = Image::get_format_pixel_size(p_image->get_format());
+	const int row_size = p_image->get_width() * pixel_size;
+	uint8_t *wr = data.ptrw() + ofs;
+	for (int y = 0; y < p_image->get_height(); y++) {
+		memcpy(wr + ((p_position.y + y) * mip_width + p_position.x) * pixel_size, region.ptr() + y * row_size, row_size);
+	}
+	t->image = Image::create_from_data(t->image->get_width(), t->image->get_height(), t->image->has_mipmaps(), t->image->get_format(), data);
+}
@@ -75,14 +75,17 @@ void RendererCanvasCull::_render_canvas_item_tree(RID p_to_render_target, Canvas
 	}
 }
 
-void _collect_ysort_children(RendererCanvasCull::Item *p_canvas_item, Transform2D p_transform, RendererCanvasCull::Item *p_material_owner, const Color &p_modulate, RendererCanvasCull::Item **r_items, int &r_index, int p_z) {
+// When p_refresh is true and r_items is null, the already collected items only get their transforms, modulates and z indices updated.
+void _collect_ysort_children(RendererCanvasCull::Item *p_canvas_item, Transform2D p_transform, RendererCanvasCull::Item *p_material_owner, const Color &p_modulate, RendererCanvasCull::Item **r_items, int &r_index, int p_z, bool p_refresh = false) {
 	int child_item_count = p_canvas_item->child_items.size();
 	RendererCanvasCull::Item **child_items = p_canvas_item->child_items.ptrw();
 	for (int i = 0; i < child_item_count; i++) {
 		int abs_z = 0;
 		if (child_items[i]->visible) {
-			if (r_items) {
-				r_items[r_index] = child_items[i];
+			if (r_items || p_refresh) {
+				if (r_items) {
+					r_items[r_index] = child_items[i];
+				}
 				child_items[i]->ysort_xform = p_transform;
 				child_items[i]->ysort_pos = p_transform.xform(child_items[i]->xform.columns[2]);
 				child_items[i]->material_owner = child_items[i]->use_parent_material ? p_material_owner : nullptr;
@@ -101,7 +104,7 @@ void _collect_ysort_children(RendererCanvasCull::Item *p_canvas_item, Transform2
 			r_index++;
 
 			if (child_items[i]->sort_y) {
-				_collect_ysort_children(child_items[i], p_transform * child_items[i]->xform, child_items[i]->use_parent_material ? p_material_owner : child_items[i], p_modulate * child_items[i]->modulate, r_items, r_index, abs_z);
+				_collect_ysort_children(child_items[i], p_transform * child_items[i]->xform, child_items[i]->use_parent_material ? p_material_owner : child_items[i], p_modulate * child_items[i]->modulate, r_items, r_index, abs_z, p_refresh);
 			}
 		}
 	}
@@ -114,6 +117,255 @@ void _mark_ysort_dirty(RendererCanvasCull::Item *ysort_owner, RID_Owner<Renderer
 	} while (ysort_owner && ysort_owner->sort_y);
 }
 
+void RendererCanvasCull::_mark_ysort_refresh(Item *p_item) {
+	if (p_item->ysort_owner.is_null()) {
+		return;
+	}
+
+	Item *ysort_owner = canvas_item_owner.get_or_null(p_item->ysort_owner);
+	if (ysort_owner) {
+		ysort_owner->ysort_refresh = true;
+	} else {
+		p_item->ysort_owner = RID();
+	}
+}
+
+uint32_t RendererCanvasCull::_repair_ysort_items(LocalVector<Item *> &r_items) {
+	// Items rarely move much between frames, so the list is almost sorted and an insertion sort is close to linear.
+	// Fall back to a full sort when too many items need to be shifted.
+	ItemPtrSort compare;
+	Item **items = r_items.ptr();
+	uint32_t count = r_items.size();
+	uint64_t max_shifts = uint64_t(count) * 8;
+	uint64_t shifts = 0;
+	uint32_t moved = 0;
+
+	for (uint32_t i = 1; i < count; i++) {
+		Item *item = items[i];
+		uint32_t j = i;
+		while (j > 0 && compare(item, items[j - 1])) {
+			items[j] = items[j - 1];
+			j--;
+		}
+		if (j == i) {
+			continue;
+		}
+
+		items[j] = item;
+		moved++;
+		shifts += i - j;
+
+		if (shifts > max_shifts) {
+			SortArray<Item *, ItemPtrSort> sorter;
+			sorter.sort(items, count);
+			return count;
+		}
+	}
+
+	return moved;
+}
+
+bool RendererCanvasCull::_spatial_index_get_bounds(Item *p_item, Rect2 &r_rect) const {
+	// Items with children, or whose rect depends on external state (meshes, particles, skeletons),
+	// can't be indexed reliably and are always visited.
+	if (!p_item->child_items.is_empty() || p_item->copy_back_buffer || p_item->vp_render || p_item->canvas_group || p_item->update_when_visible || p_item->skeleton.is_valid()) {
+		return false;
+	}
+
+	if (!p_item->custom_rect) {
+		const Item::Command *c = p_item->commands;
+		while (c) {
+			if (c->type == Item::Command::TYPE_MESH || c->type == Item::Command::TYPE_MULTIMESH || c->type == Item::Command::TYPE_PARTICLES) {
+				return false;
+			}
+			c = c->next;
+		}
+	}
+
+	Rect2 rect = p_item->get_rect();
+	if (p_item->visibility_notifier && p_item->visibility_notifier->area.size != Vector2()) {
+		rect = rect.merge(p_item->visibility_notifier->area);
+	}
+
+	// Grow by a pixel to account for transform snapping.
+	r_rect = p_item->xform.xform(rect).grow(1.0);
+	return true;
+}
+
+void RendererCanvasCull::_spatial_index_insert(ItemSpatialIndex *p_index, Item *p_item) {
+	p_item->spatial_bounded = _spatial_index_get_bounds(p_item, p_item->spatial_rect);
+
+	if (p_item->spatial_bounded && p_item->spatial_rect.size.x <= p_index->cell_size && p_item->spatial_rect.size.y <= p_index->cell_size) {
+		Vector2 center = p_item->spatial_rect.get_center();
+		p_item->spatial_cell = Vector2i(Math::floor(center.x / p_index->cell_size), Math::floor(center.y / p_index->cell_size));
+		p_item->spatial_in_grid = true;
+
+		LocalVector<Item *> &cell = p_index->cells[p_item->spatial_cell];
+		p_item->spatial_cell_pos = cell.size();
+		cell.push_back(p_item);
+	} else {
+		p_item->spatial_in_grid = false;
+		p_item->spatial_cell_pos = p_index->unbounded.size();
+		p_index->unbounded.push_back(p_item);
+	}
+}
+
+void RendererCanvasCull::_spatial_index_remove(ItemSpatialIndex *p_index, Item *p_item) {
+	LocalVector<Item *> *list = &p_index->unbounded;
+	HashMap<Vector2i, LocalVector<Item *>>::Iterator E;
+	if (p_item->spatial_in_grid) {
+		E = p_index->cells.find(p_item->spatial_cell);
+		ERR_FAIL_COND(!E);
+		list = &E->value;
+	}
+
+	uint32_t pos = p_item->spatial_cell_pos;
+	ERR_FAIL_COND(pos >= list->size() || (*list)[pos] != p_item);
+
+	Item *last = (*list)[list->size() - 1];
+	(*list)[pos] = last;
+	last->spatial_cell_pos = pos;
+	list->resize(list->size() - 1);
+
+	if (E && E->value.is_empty()) {
+		p_index->cells.remove(E);
+	}
+}
+
+void RendererCanvasCull::_spatial_index_rebuild(Item *p_item) {
+	ItemSpatialIndex *index = p_item->spatial_index;
+	index->cells.clear();
+	index->unbounded.clear();
+	index->dirty_items.clear();
+
+	int child_item_count = p_item->child_items.size();
+	Item **child_items = p_item->child_items.ptrw();
+
+	// Size cells after the average child, so most children fit in a single cell.
+	real_t size_accum = 0;
+	int bounded_count = 0;
+	for (int i = 0; i < child_item_count; i++) {
+		Rect2 rect;
+		if (_spatial_index_get_bounds(child_items[i], rect)) {
+			size_accum += MAX(rect.size.x, rect.size.y);
+			bounded_count++;
+		}
+	}
+	index->cell_size = MAX(bounded_count ? 2.0 * size_accum / bounded_count : 0.0, 32.0);
+
+	for (int i = 0; i < child_item_count; i++) {
+		Item *child = child_items[i];
+		child->spatial_slot = i;
+		child->spatial_indexed = true;
+		child->spatial_dirty = false;
+		_spatial_index_insert(index, child);
+	}
+
+	index->dirty = false;
+}
+
+void RendererCanvasCull::_spatial_index_update(Item *p_item) {
+	ItemSpatialIndex *index = p_item->spatial_index;
+	if (index->dirty) {
+		_spatial_index_rebuild(p_item);
+		return;
+	}
+
+	for (Item *child : index->dirty_items) {
+		_spatial_index_remove(index, child);
+		_spatial_index_insert(index, child);
+		child->spatial_dirty = false;
+	}
+	index->dirty_items.clear();
+}
+
+void RendererCanvasCull::_spatial_index_mark_dirty(Item *p_item) {
+	if (!p_item->spatial_indexed || p_item->spatial_dirty) {
+		return;
+	}
+
+	Item *parent = canvas_item_owner.get_or_null(p_item->parent);
+	if (!parent || !parent->spatial_index) {
+		p_item->spatial_indexed = false;
+		return;
+	}
+
+	if (!parent->spatial_index->dirty) {
+		p_item->spatial_dirty = true;
+		parent->spatial_index->dirty_items.push_back(p_item);
+	}
+}
+
+void RendererCanvasCull::_spatial_index_mark_rebuild(Item *p_item) {
+	if (p_item->spatial_index) {
+		p_item->spatial_index->dirty = true;
+		// Pending items may be about to be freed, so drop them now.
+		p_item->spatial_index->dirty_items.clear();
+	}
+}
+
+bool RendererCanvasCull::_spatial_index_cull_children(Item *p_item, const Transform2D &p_xform, const Rect2 &p_clip_rect, LocalVector<Item *> &r_items) {
+	if (Math::is_zero_approx(p_xform.determinant())) {
+		return false;
+	}
+
+	if (!p_item->spatial_index) {
+		p_item->spatial_index = memnew(ItemSpatialIndex);
+	}
+	_spatial_index_update(p_item);
+
+	ItemSpatialIndex *index = p_item->spatial_index;
+
+	// Viewport rect in the local space of the item, which is where children rects are stored.
+	Rect2 local_rect = p_xform.affine_inverse().xform(Rect2(Vector2(), p_clip_rect.size));
+
+	// Children are stored in the cell containing their center and are never bigger than a cell,
+	// so looking half a cell around the rect is enough to find all of them.
+	Rect2 search_rect = local_rect.grow(index->cell_size * 0.5);
+	Vector2i from = Vector2i(Math::floor(search_rect.position.x / index->cell_size), Math::floor(search_rect.position.y / index->cell_size));
+	Vector2i to = Vector2i(Math::floor(search_rect.get_end().x / index->cell_size), Math::floor(search_rect.get_end().y / index->cell_size));
+
+	int64_t cell_count = int64_t(to.x - from.x + 1) * int64_t(to.y - from.y + 1);
+	if (cell_count > (int64_t)index->cells.size()) {
+		for (const KeyValue<Vector2i, LocalVector<Item *>> &E : index->cells) {
+			if (E.key.x < from.x || E.key.x > to.x || E.key.y < from.y || E.key.y > to.y) {
+				continue;
+			}
+			for (Item *child : E.value) {
+				if (child->spatial_rect.intersects(local_rect)) {
+					r_items.push_back(child);
+				}
+			}
+		}
+	} else {
+		for (int y = from.y; y <= to.y; y++) {
+			for (int x = from.x; x <= to.x; x++) {
+				HashMap<Vector2i, LocalVector<Item *>>::ConstIterator E = index->cells.find(Vector2i(x, y));
+				if (!E) {
+					continue;
+				}
+				for (Item *child : E->value) {
+					if (child->spatial_rect.intersects(local_rect)) {
+						r_items.push_back(child);
+					}
+				}
+			}
+		}
+	}
+
+	for (Item *child : index->unbounded) {
+		if (!child->spatial_bounded || child->spatial_rect.intersects(local_rect)) {
+			r_items.push_back(child);
+		}
+	}
+
+	// Restore the draw order.
+	SortArray<Item *, ItemSlotSort> sorter;
+	sorter.sort(r_items.ptr(), r_items.size());
+
+	return true;
+}
+
 void RendererCanvasCull::_attach_canvas_item_for_draw(RendererCanvasCull::Item *ci, RendererCanvasCull::Item *p_canvas_clip, RendererCanvasRender::Item **r_z_list, RendererCanvasRender::Item **r_z_last_list, const Transform2D &xform, const Rect2 &p_clip_rect, Rect2 global_rect, const Color &modulate, int p_z, RendererCanvasCull::Item *p_material_owner, bool p_use_canvas_group, RendererCanvasRender::Item *canvas_group_from, const Transform2D &p_xform) {
 	if (ci->copy_back_buffer) {
 		ci->copy_back_buffer->screen_rect = xform.xform(ci->copy_back_buffer->rect).intersection(p_clip_rect);
@@ -237,6 +489,12 @@ void RendererCanvasCull::_cull_canvas_item(Item *p_canvas_item, const Transform2
 	if (ci->children_order_dirty) {
 		ci->child_items.sort_custom<ItemIndexSort>();
 		ci->children_order_dirty = false;
+		_spatial_index_mark_rebuild(ci);
+
+		if (ci->sort_y) {
+			// Draw order is used to break ties between items at the same height.
+			_mark_ysort_dirty(ci, canvas_item_owner);
+		}
 	}
 
 	Rect2 rect = ci->get_rect();
@@ -299,25 +557,43 @@ void RendererCanvasCull::_cull_canvas_item(Item *p_canvas_item, const Transform2
 
 	if (ci->sort_y) {
 		if (allow_y_sort) {
+			ci->ysort_parent_abs_z_index = parent_z;
+			ci->ysort_xform = ci->xform.affine_inverse();
+			ci->ysort_modulate = Color(1, 1, 1, 1);
+
 			if (ci->ysort_children_count == -1) {
+				// Children were added, removed or hidden, collect and sort them again.
 				ci->ysort_children_count = 0;
 				_collect_ysort_children(ci, Transform2D(), p_material_owner, Color(1, 1, 1, 1), nullptr, ci->ysort_children_count, p_z);
-			}
 
-			child_item_count = ci->ysort_children_count + 1;
-			child_items = (Item **)alloca(child_item_count * sizeof(Item *));
+				ci->ysort_items.resize(ci->ysort_children_count + 1);
+				Item **items = ci->ysort_items.ptr();
+				items[0] = ci;
+				int i = 1;
+				_collect_ysort_children(ci, Transform2D(), p_material_owner, Color(1, 1, 1, 1), items, i, p_z);
+				for (i = 1; i < (int)ci->ysort_items.size(); i++) {
+					items[i]->ysort_owner = ci->self;
+				}
 
-			ci->ysort_parent_abs_z_index = parent_z;
-			child_items[0] = ci;
-			int i = 1;
-			_collect_ysort_children(ci, Transform2D(), p_material_owner, Color(1, 1, 1, 1), child_items, i, p_z);
-			ci->ysort_xform = ci->xform.affine_inverse();
-			ci->ysort_modulate = Color(1, 1, 1, 1);
+				SortArray<Item *, ItemPtrSort> sorter;
+				sorter.sort(items, ci->ysort_items.size());
+				ysort_items_resorted += ci->ysort_items.size();
 
-			SortArray<Item *, ItemPtrSort> sorter;
-			sorter.sort(child_items, child_item_count);
+			} else if (ci->ysort_refresh || ci->ysort_material_owner != p_material_owner || ci->ysort_z != p_z) {
+				// Same children, but some of them moved. Update their positions and repair the previous order.
+				int i = 1;
+				_collect_ysort_children(ci, Transform2D(), p_material_owner, Color(1, 1, 1, 1), nullptr, i, p_z, true);
+				ysort_items_resorted += _repair_ysort_items(ci->ysort_items);
+			}
+
+			ci->ysort_refresh = false;
+			ci->ysort_material_owner = p_material_owner;
+			ci->ysort_z = p_z;
+
+			child_item_count = ci->ysort_items.size();
+			child_items = ci->ysort_items.ptr();
 
-			for (i = 0; i < child_item_count; i++) {
+			for (int i = 0; i < child_item_count; i++) {
 				_cull_canvas_item(child_items[i], xform * child_items[i]->ysort_xform, p_clip_rect, modulate * child_items[i]->ysort_modulate, child_items[i]->ysort_parent_abs_z_index, r_z_list, r_z_last_list, (Item *)ci->final_clip_owner, (Item *)child_items[i]->material_owner, false, canvas_cull_mask);
 			}
 		} else {
@@ -338,6 +614,17 @@ void RendererCanvasCull::_cull_canvas_item(Item *p_canvas_item, const Transform2
 			canvas_group_from = r_z_last_list[zidx];
 		}
 
+		LocalVector<Item *> visible_children;
+		if (spatial_index_enabled && !use_canvas_group && child_item_count >= SPATIAL_INDEX_MIN_CHILDREN) {
+			if (_spatial_index_cull_children(ci, xform, p_clip_rect, visible_children)) {
+				child_item_count = visible_children.size();
+				child_items = visible_children.ptr();
+			}
+		} else if (ci->spatial_index && child_item_count < SPATIAL_INDEX_MIN_CHILDREN) {
+			memdelete(ci->spatial_index);
+			ci->spatial_index = nullptr;
+		}
+
 		for (int i = 0; i < child_item_count; i++) {
 			if (!child_items[i]->behind && !use_canvas_group) {
 				continue;
@@ -359,6 +646,7 @@ void RendererCanvasCull::render_canvas(RID p_render_target, Canvas *p_canvas, co
 
 	sdf_used = false;
 	snapping_2d_transforms_to_pixel = p_snap_2d_transforms_to_pixel;
+	spatial_index_enabled = p_canvas->use_spatial_index;
 
 	if (p_canvas->children_order_dirty) {
 		p_canvas->child_items.sort();
@@ -436,6 +724,12 @@ void RendererCanvasCull::canvas_set_disable_scale(bool p_disable) {
 	disable_scale = p_disable;
 }
 
+void RendererCanvasCull::canvas_set_use_spatial_index(RID p_canvas, bool p_enable) {
+	Canvas *canvas = canvas_owner.get_or_null(p_canvas);
+	ERR_FAIL_NULL(canvas);
+	canvas->use_spatial_index = p_enable;
+}
+
 void RendererCanvasCull::canvas_set_parent(RID p_canvas, RID p_parent, float p_scale) {
 	Canvas *canvas = canvas_owner.get_or_null(p_canvas);
 	ERR_FAIL_NULL(canvas);
@@ -449,6 +743,8 @@ RID RendererCanvasCull::canvas_item_allocate() {
 }
 void RendererCanvasCull::canvas_item_initialize(RID p_rid) {
 	canvas_item_owner.initialize_rid(p_rid);
+	Item *canvas_item = canvas_item_owner.get_or_null(p_rid);
+	canvas_item->self = p_rid;
 }
 
 void RendererCanvasCull::canvas_item_set_parent(RID p_item, RID p_parent) {
@@ -466,9 +762,14 @@ void RendererCanvasCull::canvas_item_set_parent(RID p_item, RID p_parent) {
 			if (item_owner->sort_y) {
 				_mark_ysort_dirty(item_owner, canvas_item_owner);
 			}
+
+			_spatial_index_mark_rebuild(item_owner);
+			_spatial_index_mark_dirty(item_owner);
 		}
 
 		canvas_item->parent = RID();
+		canvas_item->spatial_indexed = false;
+		canvas_item->spatial_dirty = false;
 	}
 
 	if (p_parent.is_valid()) {
@@ -487,6 +788,9 @@ void RendererCanvasCull::canvas_item_set_parent(RID p_item, RID p_parent) {
 				_mark_ysort_dirty(item_owner, canvas_item_owner);
 			}
 
+			_spatial_index_mark_rebuild(item_owner);
+			_spatial_index_mark_dirty(item_owner);
+
 		} else {
 			ERR_FAIL_MSG("Invalid parent.");
 		}
@@ -514,8 +818,11 @@ void RendererCanvasCull::canvas_item_set_light_mask(RID p_item, int p_mask) {
 void RendererCanvasCull::canvas_item_set_transform(RID p_item, const Transform2D &p_transform) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_spatial_index_mark_dirty(canvas_item);
 
 	canvas_item->xform = p_transform;
+
+	_mark_ysort_refresh(canvas_item);
 }
 
 void RendererCanvasCull::canvas_item_set_visibility_layer(RID p_item, uint32_t p_visibility_layer) {
@@ -549,6 +856,7 @@ void RendererCanvasCull::canvas_item_set_distance_field_mode(RID p_item, bool p_
 void RendererCanvasCull::canvas_item_set_custom_rect(RID p_item, bool p_custom_rect, const Rect2 &p_rect) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_spatial_index_mark_dirty(canvas_item);
 
 	canvas_item->custom_rect = p_custom_rect;
 	canvas_item->rect = p_rect;
@@ -559,6 +867,8 @@ void RendererCanvasCull::canvas_item_set_modulate(RID p_item, const Color &p_col
 	ERR_FAIL_NULL(canvas_item);
 
 	canvas_item->modulate = p_color;
+
+	_mark_ysort_refresh(canvas_item);
 }
 
 void RendererCanvasCull::canvas_item_set_self_modulate(RID p_item, const Color &p_color) {
@@ -575,9 +885,45 @@ void RendererCanvasCull::canvas_item_set_draw_behind_parent(RID p_item, bool p_e
 	canvas_item->behind = p_enable;
 }
 
+void RendererCanvasCull::canvas_items_set_transforms(const Vector<RID> &p_items, const Vector<Transform2D> &p_transforms) {
+	ERR_FAIL_COND(p_items.size() != p_transforms.size());
+
+	const RID *items = p_items.ptr();
+	const Transform2D *transforms = p_transforms.ptr();
+	for (int i = 0; i < p_items.size(); i++) {
+		Item *canvas_item = canvas_item_owner.get_or_null(items[i]);
+		if (unlikely(!canvas_item)) {
+			continue; // Freed before the batch got flushed.
+		}
+		_spatial_index_mark_dirty(canvas_item);
+
+		canvas_item->xform = transforms[i];
+
+		_mark_ysort_refresh(canvas_item);
+	}
+}
+
+void RendererCanvasCull::canvas_items_set_modulates(const Vector<RID> &p_items, const Vector<Color> &p_colors) {
+	ERR_FAIL_COND(p_items.size() != p_colors.size());
+
+	const RID *items = p_items.ptr();
+	const Color *colors = p_colors.ptr();
+	for (int i = 0; i < p_items.size(); i++) {
+		Item *canvas_item = canvas_item_owner.get_or_null(items[i]);
+		if (unlikely(!canvas_item)) {
+			continue;
+		}
+
+		canvas_item->modulate = colors[i];
+
+		_mark_ysort_refresh(canvas_item);
+	}
+}
+
 void RendererCanvasCull::canvas_item_set_update_when_visible(RID p_item, bool p_update) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_spatial_index_mark_dirty(canvas_item);
 
 	canvas_item->update_when_visible = p_update;
 }
@@ -585,6 +931,7 @@ void RendererCanvasCull::canvas_item_set_update_when_visible(RID p_item, bool p_
 void RendererCanvasCull::canvas_item_add_line(RID p_item, const Point2 &p_from, const Point2 &p_to, const Color &p_color, float p_width, bool p_antialiased) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_spatial_index_mark_dirty(canvas_item);
 
 	Item::CommandPrimitive *line = canvas_item->alloc_command<Item::CommandPrimitive>();
 	ERR_FAIL_NULL(line);
@@ -817,6 +1164,7 @@ void RendererCanvasCull::canvas_item_add_polyline(RID p_item, const Vector<Point
 	ERR_FAIL_COND(p_points.size() < 2);
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_spatial_index_mark_dirty(canvas_item);
 
 	Color color = Color(1, 1, 1, 1);
 
@@ -1088,6 +1436,7 @@ void RendererCanvasCull::canvas_item_add_multiline(RID p_item, const Vector<Poin
 	if (p_width < 0) {
 		Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 		ERR_FAIL_NULL(canvas_item);
+		_spatial_index_mark_dirty(canvas_item);
 
 		Vector<Color> colors;
 		if (p_colors.size() == 1) {
@@ -1130,6 +1479,7 @@ void RendererCanvasCull::canvas_item_add_multiline(RID p_item, const Vector<Poin
 void RendererCanvasCull::canvas_item_add_rect(RID p_item, const Rect2 &p_rect, const Color &p_color) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_spatial_index_mark_dirty(canvas_item);
 
 	Item::CommandRect *rect = canvas_item->alloc_command<Item::CommandRect>();
 	ERR_FAIL_NULL(rect);
@@ -1140,6 +1490,7 @@ void RendererCanvasCull::canvas_item_add_rect(RID p_item, const Rect2 &p_rect, c
 void RendererCanvasCull::canvas_item_add_circle(RID p_item, const Point2 &p_pos, float p_radius, const Color &p_color) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_spatial_index_mark_dirty(canvas_item);
 
 	Item::CommandPolygon *circle = canvas_item->alloc_command<Item::CommandPolygon>();
 	ERR_FAIL_NULL(circle);
@@ -1179,6 +1530,7 @@ void RendererCanvasCull::canvas_item_add_circle(RID p_item, const Point2 &p_pos,
 void RendererCanvasCull::canvas_item_add_texture_rect(RID p_item, const Rect2 &p_rect, RID p_texture, bool p_tile, const Color &p_modulate, bool p_transpose) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_spatial_index_mark_dirty(canvas_item);
 
 	Item::CommandRect *rect = canvas_item->alloc_command<Item::CommandRect>();
 	ERR_FAIL_NULL(rect);
@@ -1210,6 +1562,7 @@ void RendererCanvasCull::canvas_item_add_texture_rect(RID p_item, const Rect2 &p
 void RendererCanvasCull::canvas_item_add_msdf_texture_rect_region(RID p_item, const Rect2 &p_rect, RID p_texture, const Rect2 &p_src_rect, const Color &p_modulate, int p_outline_size, float p_px_range, float p_scale) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_spatial_index_mark_dirty(canvas_item);
 
 	Item::CommandRect *rect = canvas_item->alloc_command<Item::CommandRect>();
 	ERR_FAIL_NULL(rect);
@@ -1244,6 +1597,7 @@ void RendererCanvasCull::canvas_item_add_msdf_texture_rect_region(RID p_item, co
 void RendererCanvasCull::canvas_item_add_lcd_texture_rect_region(RID p_item, const Rect2 &p_rect, RID p_texture, const Rect2 &p_src_rect, const Color &p_modulate) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_spatial_index_mark_dirty(canvas_item);
 
 	Item::CommandRect *rect = canvas_item->alloc_command<Item::CommandRect>();
 	ERR_FAIL_NULL(rect);
@@ -1276,6 +1630,7 @@ void RendererCanvasCull::canvas_item_add_lcd_texture_rect_region(RID p_item, con
 void RendererCanvasCull::canvas_item_add_texture_rect_region(RID p_item, const Rect2 &p_rect, RID p_texture, const Rect2 &p_src_rect, const Color &p_modulate, bool p_transpose, bool p_clip_uv) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_spatial_index_mark_dirty(canvas_item);
 
 	Item::CommandRect *rect = canvas_item->alloc_command<Item::CommandRect>();
 	ERR_FAIL_NULL(rect);
@@ -1317,6 +1672,7 @@ void RendererCanvasCull::canvas_item_add_texture_rect_region(RID p_item, const R
 void RendererCanvasCull::canvas_item_add_nine_patch(RID p_item, const Rect2 &p_rect, const Rect2 &p_source, RID p_texture, const Vector2 &p_topleft, const Vector2 &p_bottomright, RS::NinePatchAxisMode p_x_axis_mode, RS::NinePatchAxisMode p_y_axis_mode, bool p_draw_center, const Color &p_modulate) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_spatial_index_mark_dirty(canvas_item);
 
 	Item::CommandNinePatch *style = canvas_item->alloc_command<Item::CommandNinePatch>();
 	ERR_FAIL_NULL(style);
@@ -1341,6 +1697,7 @@ void RendererCanvasCull::canvas_item_add_primitive(RID p_item, const Vector<Poin
 
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_spatial_index_mark_dirty(canvas_item);
 
 	Item::CommandPrimitive *prim = canvas_item->alloc_command<Item::CommandPrimitive>();
 	ERR_FAIL_NULL(prim);
@@ -1367,6 +1724,7 @@ void RendererCanvasCull::canvas_item_add_primitive(RID p_item, const Vector<Poin
 void RendererCanvasCull::canvas_item_add_polygon(RID p_item, const Vector<Point2> &p_points, const Vector<Color> &p_colors, const Vector<Point2> &p_uvs, RID p_texture) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_spatial_index_mark_dirty(canvas_item);
 #ifdef DEBUG_ENABLED
 	int pointcount = p_points.size();
 	ERR_FAIL_COND(pointcount < 3);
@@ -1388,6 +1746,7 @@ void RendererCanvasCull::canvas_item_add_polygon(RID p_item, const Vector<Point2
 void RendererCanvasCull::canvas_item_add_triangle_array(RID p_item, const Vector<int> &p_indices, const Vector<Point2> &p_points, const Vector<Color> &p_colors, const Vector<Point2> &p_uvs, const Vector<int> &p_bones, const Vector<float> &p_weights, RID p_texture, int p_count) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_spatial_index_mark_dirty(canvas_item);
 
 	int vertex_count = p_points.size();
 	ERR_FAIL_COND(vertex_count == 0);
@@ -1411,6 +1770,7 @@ void RendererCanvasCull::canvas_item_add_triangle_array(RID p_item, const Vector
 void RendererCanvasCull::canvas_item_add_set_transform(RID p_item, const Transform2D &p_transform) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_spatial_index_mark_dirty(canvas_item);
 
 	Item::CommandTransform *tr = canvas_item->alloc_command<Item::CommandTransform>();
 	ERR_FAIL_NULL(tr);
@@ -1420,6 +1780,7 @@ void RendererCanvasCull::canvas_item_add_set_transform(RID p_item, const Transfo
 void RendererCanvasCull::canvas_item_add_mesh(RID p_item, const RID &p_mesh, const Transform2D &p_transform, const Color &p_modulate, RID p_texture) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_spatial_index_mark_dirty(canvas_item);
 	ERR_FAIL_COND(!p_mesh.is_valid());
 
 	Item::CommandMesh *m = canvas_item->alloc_command<Item::CommandMesh>();
@@ -1439,6 +1800,7 @@ void RendererCanvasCull::canvas_item_add_mesh(RID p_item, const RID &p_mesh, con
 void RendererCanvasCull::canvas_item_add_particles(RID p_item, RID p_particles, RID p_texture) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_spatial_index_mark_dirty(canvas_item);
 
 	Item::CommandParticles *part = canvas_item->alloc_command<Item::CommandParticles>();
 	ERR_FAIL_NULL(part);
@@ -1453,6 +1815,7 @@ void RendererCanvasCull::canvas_item_add_particles(RID p_item, RID p_particles,
 void RendererCanvasCull::canvas_item_add_multimesh(RID p_item, RID p_mesh, RID p_texture) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_spatial_index_mark_dirty(canvas_item);
 
 	Item::CommandMultiMesh *mm = canvas_item->alloc_command<Item::CommandMultiMesh>();
 	ERR_FAIL_NULL(mm);
@@ -1498,6 +1861,8 @@ void RendererCanvasCull::canvas_item_set_z_index(RID p_item, int p_z) {
 	ERR_FAIL_NULL(canvas_item);
 
 	canvas_item->z_index = p_z;
+
+	_mark_ysort_refresh(canvas_item);
 }
 
 void RendererCanvasCull::canvas_item_set_z_as_relative_to_parent(RID p_item, bool p_enable) {
@@ -1505,11 +1870,14 @@ void RendererCanvasCull::canvas_item_set_z_as_relative_to_parent(RID p_item, boo
 	ERR_FAIL_NULL(canvas_item);
 
 	canvas_item->z_relative = p_enable;
+
+	_mark_ysort_refresh(canvas_item);
 }
 
 void RendererCanvasCull::canvas_item_attach_skeleton(RID p_item, RID p_skeleton) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_spatial_index_mark_dirty(canvas_item);
 	if (canvas_item->skeleton == p_skeleton) {
 		return;
 	}
@@ -1539,6 +1907,7 @@ void RendererCanvasCull::canvas_item_attach_skeleton(RID p_item, RID p_skeleton)
 void RendererCanvasCull::canvas_item_set_copy_to_backbuffer(RID p_item, bool p_enable, const Rect2 &p_rect) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_spatial_index_mark_dirty(canvas_item);
 	if (p_enable && (canvas_item->copy_back_buffer == nullptr)) {
 		canvas_item->copy_back_buffer = memnew(RendererCanvasRender::Item::CopyBackBuffer);
 	}
@@ -1556,6 +1925,7 @@ void RendererCanvasCull::canvas_item_set_copy_to_backbuffer(RID p_item, bool p_e
 void RendererCanvasCull::canvas_item_clear(RID p_item) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_spatial_index_mark_dirty(canvas_item);
 
 	canvas_item->clear();
 #ifdef DEBUG_ENABLED
@@ -1596,11 +1966,14 @@ void RendererCanvasCull::canvas_item_set_use_parent_material(RID p_item, bool p_
 	ERR_FAIL_NULL(canvas_item);
 
 	canvas_item->use_parent_material = p_enable;
+
+	_mark_ysort_refresh(canvas_item);
 }
 
 void RendererCanvasCull::canvas_item_set_visibility_notifier(RID p_item, bool p_enable, const Rect2 &p_area, const Callable &p_enter_callable, const Callable &p_exit_callable) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_spatial_index_mark_dirty(canvas_item);
 
 	if (p_enable) {
 		if (!canvas_item->visibility_notifier) {
@@ -1630,6 +2003,7 @@ bool RendererCanvasCull::canvas_item_get_debug_redraw() const {
 void RendererCanvasCull::canvas_item_set_canvas_group_mode(RID p_item, RS::CanvasGroupMode p_mode, float p_clear_margin, bool p_fit_empty, float p_fit_margin, bool p_blur_mipmaps) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_spatial_index_mark_dirty(canvas_item);
 
 	if (p_mode == RS::CANVAS_GROUP_MODE_DISABLED) {
 		if (canvas_item->canvas_group != nullptr) {
@@ -2092,11 +2466,20 @@ bool RendererCanvasCull::free(RID p_rid) {
 				if (item_owner->sort_y) {
 					_mark_ysort_dirty(item_owner, canvas_item_owner);
 				}
+
+				_spatial_index_mark_rebuild(item_owner);
+				_spatial_index_mark_dirty(item_owner);
 			}
 		}
 
 		for (int i = 0; i < canvas_item->child_items.size(); i++) {
 			canvas_item->child_items[i]->parent = RID();
+			canvas_item->child_items[i]->spatial_indexed = false;
+		}
+
+		if (canvas_item->spatial_index) {
+			memdelete(canvas_item->spatial_index);
+			canvas_item->spatial_index = nullptr;
 		}
 
 		if (canvas_item->visibility_notifier != nullptr) {
@@ -37,6 +37,19 @@
 
 class RendererCanvasCull {
 public:
+	struct Item;
+
+	// Loose grid over the local rects of an item's children, used to only visit
+	// children intersecting the viewport when the canvas has the spatial index enabled.
+	struct ItemSpatialIndex {
+		real_t cell_size = 0;
+		bool dirty = true;
+		HashMap<Vector2i, LocalVector<Item *>> cells;
+		// Children that are too big for a cell or whose bounds can't be known ahead of time.
+		LocalVector<Item *> unbounded;
+		LocalVector<Item *> dirty_items;
+	};
+
 	struct Item : public RendererCanvasRender::Item {
 		RID parent; // canvas it belongs to
 		List<Item *>::Element *E;
@@ -56,8 +69,28 @@ public:
 		int ysort_parent_abs_z_index; // Absolute Z index of parent. Only populated and used when y-sorting.
 		uint32_t visibility_layer = 0xffffffff;
 
+		RID self;
+		// Y-sorted parent that collected this item, so it can be told when the item moves.
+		RID ysort_owner;
+		// Collected children, kept sorted between frames and repaired when they move.
+		LocalVector<Item *> ysort_items;
+		bool ysort_refresh = false;
+		Item *ysort_material_owner = nullptr;
+		int ysort_z = 0;
+
 		Vector<Item *> child_items;
 
+		ItemSpatialIndex *spatial_index = nullptr;
+		// State of this item inside its parent's spatial index.
+		bool spatial_indexed = false;
+		bool spatial_dirty = false;
+		bool spatial_bounded = false;
+		bool spatial_in_grid = false;
+		Rect2 spatial_rect;
+		Vector2i spatial_cell;
+		uint32_t spatial_cell_pos = 0;
+		uint32_t spatial_slot = 0;
+
 		struct VisibilityNotifierData {
 			Rect2 area;
 			Callable enter_callable;
@@ -96,6 +129,12 @@ public:
 		}
 	};
 
+	struct ItemSlotSort {
+		_FORCE_INLINE_ bool operator()(const Item *p_left, const Item *p_right) const {
+			return p_left->spatial_slot < p_right->spatial_slot;
+		}
+	};
+
 	struct ItemPtrSort {
 		_FORCE_INLINE_ bool operator()(const Item *p_left, const Item *p_right) const {
 			if (Math::is_equal_approx(p_left->ysort_pos.y, p_right->ysort_pos.y)) {
@@ -139,6 +178,7 @@ public:
 		HashSet<RendererCanvasRender::LightOccluderInstance *> occluders;
 
 		bool children_order_dirty;
+		bool use_spatial_index = false;
 		Vector<ChildItem> child_items;
 		Color modulate;
 		RID parent;
@@ -176,6 +216,10 @@ public:
 	bool disable_scale;
 	bool sdf_used = false;
 	bool snapping_2d_transforms_to_pixel = false;
+	bool spatial_index_enabled = false;
+
+	// Number of y-sorted items that changed position in their sorted list, reset every frame by RendererViewport.
+	uint64_t ysort_items_resorted = 0;
 
 	bool debug_redraw = false;
 	double debug_redraw_time = 0;
@@ -191,6 +235,20 @@ private:
 	void _cull_canvas_item(Item *p_canvas_item, const Transform2D &p_transform, const Rect2 &p_clip_rect, const Color &p_modulate, int p_z, RendererCanvasRender::Item **r_z_list, RendererCanvasRender::Item **r_z_last_list, Item *p_canvas_clip, Item *p_material_owner, bool allow_y_sort, uint32_t canvas_cull_mask);
 
 	static constexpr int z_range = RS::CANVAS_ITEM_Z_MAX - RS::CANVAS_ITEM_Z_MIN + 1;
+	// Items with fewer children than this are always walked linearly.
+	static constexpr int SPATIAL_INDEX_MIN_CHILDREN = 64;
+
+	void _mark_ysort_refresh(Item *p_item);
+	uint32_t _repair_ysort_items(LocalVector<Item *> &r_items);
+
+	bool _spatial_index_get_bounds(Item *p_item, Rect2 &r_rect) const;
+	void _spatial_index_insert(ItemSpatialIndex *p_index, Item *p_item);
+	void _spatial_index_remove(ItemSpatialIndex *p_index, Item *p_item);
+	void _spatial_index_rebuild(Item *p_item);
+	void _spatial_index_update(Item *p_item);
+	void _spatial_index_mark_dirty(Item *p_item);
+	void _spatial_index_mark_rebuild(Item *p_item);
+	bool _spatial_index_cull_children(Item *p_item, const Transform2D &p_xform, const Rect2 &p_clip_rect, LocalVector<Item *> &r_items);
 
 	RendererCanvasRender::Item **z_list;
 	RendererCanvasRender::Item **z_last_list;
@@ -207,6 +265,7 @@ public:
 	void canvas_set_modulate(RID p_canvas, const Color &p_color);
 	void canvas_set_parent(RID p_canvas, RID p_parent, float p_scale);
 	void canvas_set_disable_scale(bool p_disable);
+	void canvas_set_use_spatial_index(RID p_canvas, bool p_enable);
 
 	RID canvas_item_allocate();
 	void canvas_item_initialize(RID p_rid);
@@ -228,6 +287,9 @@ public:
 
 	void canvas_item_set_draw_behind_parent(RID p_item, bool p_enable);
 
+	void canvas_items_set_transforms(const Vector<RID> &p_items, const Vector<Transform2D> &p_transforms);
+	void canvas_items_set_modulates(const Vector<RID> &p_items, const Vector<Color> &p_colors);
+
 	void canvas_item_set_update_when_visible(RID p_item, bool p_update);
 
 	void canvas_item_add_line(RID p_item, const Point2 &p_from, const Point2 &p_to, const Color &p_color, float p_width = -1.0, bool p_antialiased = false);
@@ -504,6 +504,35 @@ public:
 		}
 	};
 
+	// Hashes everything a point light shadow is drawn from: the near and far planes, and the occluders that pass the
+	// light mask with their polygon versions and their transforms relative to the light. Renderers compare it to skip
+	// redrawing unchanged shadows. p_get_version returns the version of an occluder polygon, or 0 if it draws nothing.
+	template <typename F>
+	static uint64_t light_shadow_hash(const Transform2D &p_light_xform, int p_light_mask, float p_near, float p_far, const LightOccluderInstance *p_occluders, const F &p_get_version) {
+		uint64_t hash = hash_djb2_one_float_64(p_near);
+		hash = hash_djb2_one_float_64(p_far, hash);
+
+		for (const LightOccluderInstance *instance = p_occluders; instance; instance = instance->next) {
+			if (!(p_light_mask & instance->light_mask)) {
+				continue;
+			}
+			const uint32_t version = p_get_version(instance->occluder);
+			if (version == 0) {
+				continue;
+			}
+
+			Transform2D modelview = p_light_xform * instance->xform_cache;
+			hash = hash_djb2_one_64(instance->occluder.get_id(), hash);
+			hash = hash_djb2_one_64(version, hash);
+			for (int i = 0; i < 3; i++) {
+				hash = hash_djb2_one_float_64(modelview.columns[i].x, hash);
+				hash = hash_djb2_one_float_64(modelview.columns[i].y, hash);
+			}
+		}
+
+		return hash == 0 ? 1 : hash;
+	}
+
 	virtual RID light_create() = 0;
 	virtual void light_set_texture(RID p_rid, RID p_texture) = 0;
 	virtual void light_set_use_shadow(RID p_rid, bool p_enable) = 0;
@@ -522,6 +551,14 @@ public:
 
 	virtual void set_debug_redraw(bool p_enabled, double p_time, const Color &p_color) = 0;
 
+	// Counters filled in by renderers that track them, reset by RendererViewport every frame.
+	struct RenderInfo {
+		uint64_t draw_calls = 0;
+		uint64_t batch_breaks[RS::CANVAS_BATCH_BREAK_MAX] = {};
+	};
+
+	RenderInfo render_info;
+
 	RendererCanvasRender() { singleton = this; }
 	virtual ~RendererCanvasRender() {}
 };
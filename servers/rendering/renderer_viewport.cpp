@@ -258,6 +258,7 @@ void RendererViewport::_draw_viewport(Viewport *p_viewport) {
 			RENDER_TIMESTAMP("Cull LightOccluder2Ds");
 
 			//make list of occluders
+			shadow_occluders.clear();
 			for (KeyValue<RID, Viewport::CanvasData> &E : p_viewport->canvas_map) {
 				RendererCanvasCull::Canvas *canvas = static_cast<RendererCanvasCull::Canvas *>(E.value.canvas);
 				Transform2D xf = _canvas_get_transform(p_viewport, canvas, &E.value, clip_rect.size);
@@ -268,8 +269,7 @@ void RendererViewport::_draw_viewport(Viewport *p_viewport) {
 					}
 					F->xform_cache = xf * F->xform;
 					if (shadow_rect.intersects_transformed(F->xform_cache, F->aabb_cache)) {
-						F->next = occluders;
-						occluders = F;
+						shadow_occluders.push_back(F);
 					}
 				}
 			}
@@ -279,6 +279,17 @@ void RendererViewport::_draw_viewport(Viewport *p_viewport) {
 			while (light) {
 				RENDER_TIMESTAMP("Render PointLight2D Shadow");
 
+				// Only pass the occluders within reach of this light, so lights whose
+				// surroundings did not change keep hitting the renderer's shadow cache.
+				Rect2 light_rect = light->xform_cache.xform(light->rect_cache.expand(Vector2()));
+				occluders = nullptr;
+				for (RendererCanvasRender::LightOccluderInstance *F : shadow_occluders) {
+					if (light_rect.intersects_transformed(F->xform_cache, F->aabb_cache)) {
+						F->next = occluders;
+						occluders = F;
+					}
+				}
+
 				RSG::canvas_render->light_update_shadow(light->light_internal, shadow_count++, light->xform_cache.affine_inverse(), light->item_shadow_mask, light->radius_cache / 1000.0, light->radius_cache * 1.1, occluders);
 				light = light->shadows_next_ptr;
 			}
@@ -471,6 +482,8 @@ void RendererViewport::draw_viewports(bool p_swap_buffers) {
 	int vertices_drawn = 0;
 	int objects_drawn = 0;
 	int draw_calls_used = 0;
+	RSG::canvas->ysort_items_resorted = 0;
+	RSG::canvas_render->render_info = RendererCanvasRender::RenderInfo();
 
 	for (int i = 0; i < sorted_active_viewports.size(); i++) {
 		Viewport *vp = sorted_active_viewports[i];
@@ -529,6 +542,8 @@ void RendererViewport::draw_viewports(bool p_swap_buffers) {
 	total_objects_drawn = objects_drawn;
 	total_vertices_drawn = vertices_drawn;
 	total_draw_calls_used = draw_calls_used;
+	total_canvas_items_resorted = RSG::canvas->ysort_items_resorted;
+	total_canvas_render_info = RSG::canvas_render->render_info;
 
 	RENDER_TIMESTAMP("< Render Viewports");
 
@@ -913,6 +928,15 @@ int RendererViewport::get_total_primitives_drawn() const {
 int RendererViewport::get_total_draw_calls_used() const {
 	return total_draw_calls_used;
 }
+uint64_t RendererViewport::get_total_canvas_items_resorted() const {
+	return total_canvas_items_resorted;
+}
+uint64_t RendererViewport::get_total_canvas_draw_calls() const {
+	return total_canvas_render_info.draw_calls;
+}
+uint64_t RendererViewport::get_total_canvas_batch_breaks(RS::CanvasBatchBreakReason p_reason) const {
+	return total_canvas_render_info.batch_breaks[p_reason];
+}
 
 int RendererViewport::get_num_viewports_with_motion_vectors() const {
 	return num_viewports_with_motion_vectors;
@@ -34,6 +34,7 @@
 #include "core/templates/local_vector.h"
 #include "core/templates/rid_owner.h"
 #include "core/templates/self_list.h"
+#include "servers/rendering/renderer_canvas_render.h"
 #include "servers/rendering/renderer_scene_render.h"
 #include "servers/rendering/rendering_method.h"
 #include "servers/rendering_server.h"
@@ -165,9 +166,14 @@ public:
 	int total_objects_drawn = 0;
 	int total_vertices_drawn = 0;
 	int total_draw_calls_used = 0;
+	uint64_t total_canvas_items_resorted = 0;
+	RendererCanvasRender::RenderInfo total_canvas_render_info;
 
 	int num_viewports_with_motion_vectors = 0;
 
+	// Occluders near any shadowed point light, reused across frames.
+	LocalVector<RendererCanvasRender::LightOccluderInstance *> shadow_occluders;
+
 private:
 	Vector<Viewport *> _sort_active_viewports();
 	void _viewport_set_size(Viewport *p_viewport, int p_width, int p_height, uint32_t p_view_count);
@@ -238,6 +244,9 @@ public:
 	int get_total_objects_drawn() const;
 	int get_total_primitives_drawn() const;
 	int get_total_draw_calls_used() const;
+	uint64_t get_total_canvas_items_resorted() const;
+	uint64_t get_total_canvas_draw_calls() const;
+	uint64_t get_total_canvas_batch_breaks(RS::CanvasBatchBreakReason p_reason) const;
 	int get_num_viewports_with_motion_vectors() const;
 
 	// Workaround for setting this on thread.
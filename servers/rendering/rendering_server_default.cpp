@@ -242,10 +242,19 @@ uint64_t RenderingServerDefault::get_rendering_info(RenderingInfo p_info) {
 		return RSG::viewport->get_total_primitives_drawn();
 	} else if (p_info == RENDERING_INFO_TOTAL_DRAW_CALLS_IN_FRAME) {
 		return RSG::viewport->get_total_draw_calls_used();
+	} else if (p_info == RENDERING_INFO_TOTAL_CANVAS_ITEMS_RESORTED_IN_FRAME) {
+		return RSG::viewport->get_total_canvas_items_resorted();
+	} else if (p_info == RENDERING_INFO_TOTAL_CANVAS_DRAW_CALLS_IN_FRAME) {
+		return RSG::viewport->get_total_canvas_draw_calls();
 	}
 	return RSG::utilities->get_rendering_info(p_info);
 }
 
+uint64_t RenderingServerDefault::get_canvas_batch_break_count(CanvasBatchBreakReason p_reason) {
+	ERR_FAIL_INDEX_V(p_reason, CANVAS_BATCH_BREAK_MAX, 0);
+	return RSG::viewport->get_total_canvas_batch_breaks(p_reason);
+}
+
 RenderingDevice::DeviceType RenderingServerDefault::get_video_adapter_type() const {
 	return RSG::utilities->get_video_adapter_type();
 }
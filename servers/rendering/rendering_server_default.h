@@ -184,6 +184,7 @@ public:
 
 	//these go through command queue if they are in another thread
 	FUNC3(texture_2d_update, RID, const Ref<Image> &, int)
+	FUNC5(texture_2d_update_region, RID, const Ref<Image> &, const Vector2i &, int, int)
 	FUNC2(texture_3d_update, RID, const Vector<Ref<Image>> &)
 	FUNC2(texture_proxy_update, RID, RID)
 
@@ -526,6 +527,7 @@ public:
 	FUNC2(canvas_set_modulate, RID, const Color &)
 	FUNC3(canvas_set_parent, RID, RID, float)
 	FUNC1(canvas_set_disable_scale, bool)
+	FUNC2(canvas_set_use_spatial_index, RID, bool)
 
 	FUNCRIDSPLIT(canvas_texture)
 	FUNC3(canvas_texture_set_channel, RID, CanvasTextureChannel, RID)
@@ -547,7 +549,18 @@ public:
 
 	FUNC2(canvas_item_set_update_when_visible, RID, bool)
 
-	FUNC2(canvas_item_set_transform, RID, const Transform2D &)
+	virtual void canvas_item_set_transform(RID p_item, const Transform2D &p_transform) override {
+		if (canvas_item_transform_set_callback) {
+			canvas_item_transform_set_callback(p_item);
+		}
+		WRITE_ACTION
+		if (Thread::get_caller_id() != server_thread) {
+			command_queue.push(RSG::canvas, &RendererCanvasCull::canvas_item_set_transform, p_item, p_transform);
+		} else {
+			command_queue.flush_if_pending();
+			RSG::canvas->canvas_item_set_transform(p_item, p_transform);
+		}
+	}
 	FUNC2(canvas_item_set_clip, RID, bool)
 	FUNC2(canvas_item_set_distance_field_mode, RID, bool)
 	FUNC3(canvas_item_set_custom_rect, RID, bool, const Rect2 &)
@@ -556,6 +569,22 @@ public:
 
 	FUNC2(canvas_item_set_draw_behind_parent, RID, bool)
 
+	virtual void canvas_items_set_transforms(const Vector<RID> &p_items, const Vector<Transform2D> &p_transforms) override {
+		if (canvas_item_transform_set_callback) {
+			for (const RID &item : p_items) {
+				canvas_item_transform_set_callback(item);
+			}
+		}
+		WRITE_ACTION
+		if (Thread::get_caller_id() != server_thread) {
+			command_queue.push(RSG::canvas, &RendererCanvasCull::canvas_items_set_transforms, p_items, p_transforms);
+		} else {
+			command_queue.flush_if_pending();
+			RSG::canvas->canvas_items_set_transforms(p_items, p_transforms);
+		}
+	}
+	FUNC2(canvas_items_set_modulates, const Vector<RID> &, const Vector<Color> &)
+
 	FUNC6(canvas_item_add_line, RID, const Point2 &, const Point2 &, const Color &, float, bool)
 	FUNC5(canvas_item_add_polyline, RID, const Vector<Point2> &, const Vector<Color> &, float, bool)
 	FUNC4(canvas_item_add_multiline, RID, const Vector<Point2> &, const Vector<Color> &, float)
@@ -672,6 +701,7 @@ public:
 #undef SYNC_DEBUG
 
 	virtual uint64_t get_rendering_info(RenderingInfo p_info) override;
+	virtual uint64_t get_canvas_batch_break_count(CanvasBatchBreakReason p_reason) override;
 	virtual RenderingDevice::DeviceType get_video_adapter_type() const override;
 
 	virtual void set_frame_profiling_enabled(bool p_enable) override;
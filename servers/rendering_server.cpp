@@ -39,6 +39,7 @@
 
 RenderingServer *RenderingServer::singleton = nullptr;
 RenderingServer *(*RenderingServer::create_func)() = nullptr;
+RenderingServer::CanvasItemTransformSetCallback RenderingServer::canvas_item_transform_set_callback = nullptr;
 
 RenderingServer *RenderingServer::get_singleton() {
 	return singleton;
@@ -1866,6 +1867,34 @@ void RenderingServer::_particles_set_trail_bind_poses(RID p_particles, const Typ
 	particles_set_trail_bind_poses(p_particles, tbposes);
 }
 
+void RenderingServer::_canvas_items_set_transforms(const TypedArray<RID> &p_items, const PackedFloat32Array &p_transforms) {
+	ERR_FAIL_COND_MSG(p_transforms.size() != p_items.size() * 6, "Transforms array must contain 6 floats per canvas item.");
+	Vector<RID> items;
+	Vector<Transform2D> transforms;
+	items.resize(p_items.size());
+	transforms.resize(p_items.size());
+	RID *items_ptrw = items.ptrw();
+	Transform2D *transforms_ptrw = transforms.ptrw();
+	const float *r = p_transforms.ptr();
+	for (int i = 0; i < p_items.size(); i++) {
+		items_ptrw[i] = p_items[i];
+		transforms_ptrw[i] = Transform2D(r[0], r[1], r[2], r[3], r[4], r[5]);
+		r += 6;
+	}
+	canvas_items_set_transforms(items, transforms);
+}
+
+void RenderingServer::_canvas_items_set_modulates(const TypedArray<RID> &p_items, const PackedColorArray &p_colors) {
+	ERR_FAIL_COND_MSG(p_colors.size() != p_items.size(), "Colors array must contain one color per canvas item.");
+	Vector<RID> items;
+	items.resize(p_items.size());
+	RID *items_ptrw = items.ptrw();
+	for (int i = 0; i < p_items.size(); i++) {
+		items_ptrw[i] = p_items[i];
+	}
+	canvas_items_set_modulates(items, p_colors);
+}
+
 void RenderingServer::_bind_methods() {
 	BIND_CONSTANT(NO_INDEX_ARRAY);
 	BIND_CONSTANT(ARRAY_WEIGHTS_SIZE);
@@ -1883,6 +1912,7 @@ void RenderingServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("texture_proxy_create", "base"), &RenderingServer::texture_proxy_create);
 
 	ClassDB::bind_method(D_METHOD("texture_2d_update", "texture", "image", "layer"), &RenderingServer::texture_2d_update);
+	ClassDB::bind_method(D_METHOD("texture_2d_update_region", "texture", "image", "position", "mipmap", "layer"), &RenderingServer::texture_2d_update_region);
 	ClassDB::bind_method(D_METHOD("texture_3d_update", "texture", "data"), &RenderingServer::_texture_3d_update);
 	ClassDB::bind_method(D_METHOD("texture_proxy_update", "texture", "proxy_to"), &RenderingServer::texture_proxy_update);
 
@@ -2354,6 +2384,7 @@ void RenderingServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("canvas_set_item_mirroring", "canvas", "item", "mirroring"), &RenderingServer::canvas_set_item_mirroring);
 	ClassDB::bind_method(D_METHOD("canvas_set_modulate", "canvas", "color"), &RenderingServer::canvas_set_modulate);
 	ClassDB::bind_method(D_METHOD("canvas_set_disable_scale", "disable"), &RenderingServer::canvas_set_disable_scale);
+	ClassDB::bind_method(D_METHOD("canvas_set_use_spatial_index", "canvas", "enable"), &RenderingServer::canvas_set_use_spatial_index);
 
 	/* CANVAS TEXTURE */
 
@@ -2384,6 +2415,8 @@ void RenderingServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("canvas_item_set_modulate", "item", "color"), &RenderingServer::canvas_item_set_modulate);
 	ClassDB::bind_method(D_METHOD("canvas_item_set_self_modulate", "item", "color"), &RenderingServer::canvas_item_set_self_modulate);
 	ClassDB::bind_method(D_METHOD("canvas_item_set_draw_behind_parent", "item", "enabled"), &RenderingServer::canvas_item_set_draw_behind_parent);
+	ClassDB::bind_method(D_METHOD("canvas_items_set_transforms", "items", "transforms"), &RenderingServer::_canvas_items_set_transforms);
+	ClassDB::bind_method(D_METHOD("canvas_items_set_modulates", "items", "colors"), &RenderingServer::_canvas_items_set_modulates);
 
 	/* Primitives */
 
@@ -2550,6 +2583,7 @@ void RenderingServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("request_frame_drawn_callback", "callable"), &RenderingServer::request_frame_drawn_callback);
 	ClassDB::bind_method(D_METHOD("has_changed"), &RenderingServer::has_changed);
 	ClassDB::bind_method(D_METHOD("get_rendering_info", "info"), &RenderingServer::get_rendering_info);
+	ClassDB::bind_method(D_METHOD("get_canvas_batch_break_count", "reason"), &RenderingServer::get_canvas_batch_break_count);
 	ClassDB::bind_method(D_METHOD("get_video_adapter_name"), &RenderingServer::get_video_adapter_name);
 	ClassDB::bind_method(D_METHOD("get_video_adapter_vendor"), &RenderingServer::get_video_adapter_vendor);
 	ClassDB::bind_method(D_METHOD("get_video_adapter_type"), &RenderingServer::get_video_adapter_type);
@@ -2579,6 +2613,19 @@ void RenderingServer::_bind_methods() {
 	BIND_ENUM_CONSTANT(RENDERING_INFO_TEXTURE_MEM_USED);
 	BIND_ENUM_CONSTANT(RENDERING_INFO_BUFFER_MEM_USED);
 	BIND_ENUM_CONSTANT(RENDERING_INFO_VIDEO_MEM_USED);
+	BIND_ENUM_CONSTANT(RENDERING_INFO_TOTAL_CANVAS_ITEMS_RESORTED_IN_FRAME);
+	BIND_ENUM_CONSTANT(RENDERING_INFO_TOTAL_CANVAS_DRAW_CALLS_IN_FRAME);
+
+	BIND_ENUM_CONSTANT(CANVAS_BATCH_BREAK_TEXTURE);
+	BIND_ENUM_CONSTANT(CANVAS_BATCH_BREAK_SAMPLER);
+	BIND_ENUM_CONSTANT(CANVAS_BATCH_BREAK_MATERIAL);
+	BIND_ENUM_CONSTANT(CANVAS_BATCH_BREAK_CLIP);
+	BIND_ENUM_CONSTANT(CANVAS_BATCH_BREAK_BLEND_MODE);
+	BIND_ENUM_CONSTANT(CANVAS_BATCH_BREAK_LIGHTS);
+	BIND_ENUM_CONSTANT(CANVAS_BATCH_BREAK_COMMAND_TYPE);
+	BIND_ENUM_CONSTANT(CANVAS_BATCH_BREAK_UNBATCHABLE_COMMAND);
+	BIND_ENUM_CONSTANT(CANVAS_BATCH_BREAK_BUFFER_FULL);
+	BIND_ENUM_CONSTANT(CANVAS_BATCH_BREAK_MAX);
 
 	BIND_ENUM_CONSTANT(FEATURE_SHADERS);
 	BIND_ENUM_CONSTANT(FEATURE_MULTITHREADED);
@@ -2662,9 +2709,11 @@ void RenderingServer::init() {
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "rendering/limits/time/time_rollover_secs", PROPERTY_HINT_RANGE, "0,10000,1,or_greater"), 3600);
 
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/2d/shadow_atlas/size", PROPERTY_HINT_RANGE, "128,16384"), 2048);
+	GLOBAL_DEF("rendering/2d/culling/use_spatial_index", false);
 
 	// Number of commands that can be drawn per frame.
 	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "rendering/gl_compatibility/item_buffer_size", PROPERTY_HINT_RANGE, "128,1048576,1"), 16384);
+	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "rendering/gl_compatibility/canvas_texture_atlas_size", PROPERTY_HINT_RANGE, "0,8192,1"), 2048);
 
 	GLOBAL_DEF("rendering/shader_compiler/shader_cache/enabled", true);
 	GLOBAL_DEF("rendering/shader_compiler/shader_cache/compress", true);
@@ -108,6 +108,7 @@ public:
 	virtual RID texture_proxy_create(RID p_base) = 0;
 
 	virtual void texture_2d_update(RID p_texture, const Ref<Image> &p_image, int p_layer = 0) = 0;
+	virtual void texture_2d_update_region(RID p_texture, const Ref<Image> &p_image, const Vector2i &p_position, int p_mipmap = 0, int p_layer = 0) = 0;
 	virtual void texture_3d_update(RID p_texture, const Vector<Ref<Image>> &p_data) = 0;
 	virtual void texture_proxy_update(RID p_texture, RID p_proxy_to) = 0;
 
@@ -777,6 +778,7 @@ public:
 	virtual void canvas_set_parent(RID p_canvas, RID p_parent, float p_scale) = 0;
 
 	virtual void canvas_set_disable_scale(bool p_disable) = 0;
+	virtual void canvas_set_use_spatial_index(RID p_canvas, bool p_enable) = 0;
 
 	/* CANVAS TEXTURE */
 	virtual RID canvas_texture_create() = 0;
@@ -816,6 +818,15 @@ public:
 
 	virtual void canvas_item_set_draw_behind_parent(RID p_item, bool p_enable) = 0;
 
+	// Bulk versions of the setters above, updating many items in a single call.
+	virtual void canvas_items_set_transforms(const Vector<RID> &p_items, const Vector<Transform2D> &p_transforms) = 0;
+	virtual void canvas_items_set_modulates(const Vector<RID> &p_items, const Vector<Color> &p_colors) = 0;
+
+	// Called on the calling thread whenever a canvas item transform is set, before it is queued. Lets the
+	// scene drop a transform it batched for the item, which would otherwise overwrite this one.
+	typedef void (*CanvasItemTransformSetCallback)(RID);
+	static CanvasItemTransformSetCallback canvas_item_transform_set_callback;
+
 	enum NinePatchAxisMode {
 		NINE_PATCH_STRETCH,
 		NINE_PATCH_TILE,
@@ -1017,10 +1028,26 @@ public:
 		RENDERING_INFO_TEXTURE_MEM_USED,
 		RENDERING_INFO_BUFFER_MEM_USED,
 		RENDERING_INFO_VIDEO_MEM_USED,
+		RENDERING_INFO_TOTAL_CANVAS_ITEMS_RESORTED_IN_FRAME,
+		RENDERING_INFO_TOTAL_CANVAS_DRAW_CALLS_IN_FRAME,
 		RENDERING_INFO_MAX
 	};
 
+	enum CanvasBatchBreakReason {
+		CANVAS_BATCH_BREAK_TEXTURE,
+		CANVAS_BATCH_BREAK_SAMPLER,
+		CANVAS_BATCH_BREAK_MATERIAL,
+		CANVAS_BATCH_BREAK_CLIP,
+		CANVAS_BATCH_BREAK_BLEND_MODE,
+		CANVAS_BATCH_BREAK_LIGHTS,
+		CANVAS_BATCH_BREAK_COMMAND_TYPE,
+		CANVAS_BATCH_BREAK_UNBATCHABLE_COMMAND,
+		CANVAS_BATCH_BREAK_BUFFER_FULL,
+		CANVAS_BATCH_BREAK_MAX
+	};
+
 	virtual uint64_t get_rendering_info(RenderingInfo p_info) = 0;
+	virtual uint64_t get_canvas_batch_break_count(CanvasBatchBreakReason p_reason) = 0;
 	virtual String get_video_adapter_name() const = 0;
 	virtual String get_video_adapter_vendor() const = 0;
 	virtual RenderingDevice::DeviceType get_video_adapter_type() const = 0;
@@ -1091,6 +1118,8 @@ private:
 	void _mesh_add_surface(RID p_mesh, const Dictionary &p_surface);
 	Dictionary _mesh_get_surface(RID p_mesh, int p_idx);
 	void _particles_set_trail_bind_poses(RID p_particles, const TypedArray<Transform3D> &p_bind_poses);
+	void _canvas_items_set_transforms(const TypedArray<RID> &p_items, const PackedFloat32Array &p_transforms);
+	void _canvas_items_set_modulates(const TypedArray<RID> &p_items, const PackedColorArray &p_colors);
 };
 
 // Make variant understand the enums.
@@ -1135,6 +1164,7 @@ VARIANT_ENUM_CAST(RenderingServer::CanvasLightShadowFilter);
 VARIANT_ENUM_CAST(RenderingServer::CanvasOccluderPolygonCullMode);
 VARIANT_ENUM_CAST(RenderingServer::GlobalShaderParameterType);
 VARIANT_ENUM_CAST(RenderingServer::RenderingInfo);
+VARIANT_ENUM_CAST(RenderingServer::CanvasBatchBreakReason);
 VARIANT_ENUM_CAST(RenderingServer::Features);
 VARIANT_ENUM_CAST(RenderingServer::CanvasTextureChannel);
 
@@ -45,6 +45,16 @@ void TextServerExtension::_bind_methods() {
 
 	GDVIRTUAL_BIND(_is_locale_right_to_left, "locale");
 
+	GDVIRTUAL_BIND(_set_async_glyph_rasterization, "enabled");
+	GDVIRTUAL_BIND(_is_async_glyph_rasterization);
+	GDVIRTUAL_BIND(_get_deferred_glyph_count);
+
+	GDVIRTUAL_BIND(_set_shaped_text_cache_limit, "bytes");
+	GDVIRTUAL_BIND(_get_shaped_text_cache_limit);
+	GDVIRTUAL_BIND(_get_shaped_text_cache_usage);
+	GDVIRTUAL_BIND(_get_shaped_text_cache_hits);
+	GDVIRTUAL_BIND(_get_shaped_text_cache_misses);
+
 	GDVIRTUAL_BIND(_name_to_tag, "name");
 	GDVIRTUAL_BIND(_tag_to_name, "tag");
 
@@ -194,6 +204,9 @@ void TextServerExtension::_bind_methods() {
 	GDVIRTUAL_BIND(_font_render_range, "font_rid", "size", "start", "end");
 	GDVIRTUAL_BIND(_font_render_glyph, "font_rid", "size", "index");
 
+	GDVIRTUAL_BIND(_font_prerender_characters, "font_rid", "size", "characters");
+	GDVIRTUAL_BIND(_font_is_prerendering, "font_rid");
+
 	GDVIRTUAL_BIND(_font_draw_glyph, "font_rid", "canvas", "size", "pos", "index", "color");
 	GDVIRTUAL_BIND(_font_draw_glyph_outline, "font_rid", "canvas", "size", "outline_size", "pos", "index", "color");
 
@@ -394,6 +407,50 @@ bool TextServerExtension::is_locale_right_to_left(const String &p_locale) const
 	return ret;
 }
 
+void TextServerExtension::set_async_glyph_rasterization(bool p_enabled) {
+	GDVIRTUAL_CALL(_set_async_glyph_rasterization, p_enabled);
+}
+
+bool TextServerExtension::is_async_glyph_rasterization() const {
+	bool ret = false;
+	GDVIRTUAL_CALL(_is_async_glyph_rasterization, ret);
+	return ret;
+}
+
+int64_t TextServerExtension::get_deferred_glyph_count() const {
+	int64_t ret = 0;
+	GDVIRTUAL_CALL(_get_deferred_glyph_count, ret);
+	return ret;
+}
+
+void TextServerExtension::set_shaped_text_cache_limit(int64_t p_bytes) {
+	GDVIRTUAL_CALL(_set_shaped_text_cache_limit, p_bytes);
+}
+
+int64_t TextServerExtension::get_shaped_text_cache_limit() const {
+	int64_t ret = 0;
+	GDVIRTUAL_CALL(_get_shaped_text_cache_limit, ret);
+	return ret;
+}
+
+int64_t TextServerExtension::get_shaped_text_cache_usage() const {
+	int64_t ret = 0;
+	GDVIRTUAL_CALL(_get_shaped_text_cache_usage, ret);
+	return ret;
+}
+
+int64_t TextServerExtension::get_shaped_text_cache_hits() const {
+	int64_t ret = 0;
+	GDVIRTUAL_CALL(_get_shaped_text_cache_hits, ret);
+	return ret;
+}
+
+int64_t TextServerExtension::get_shaped_text_cache_misses() const {
+	int64_t ret = 0;
+	GDVIRTUAL_CALL(_get_shaped_text_cache_misses, ret);
+	return ret;
+}
+
 int64_t TextServerExtension::name_to_tag(const String &p_name) const {
 	int64_t ret = 0;
 	GDVIRTUAL_CALL(_name_to_tag, p_name, ret);
@@ -898,6 +955,16 @@ void TextServerExtension::font_render_glyph(const RID &p_font_rid, const Vector2
 	GDVIRTUAL_CALL(_font_render_glyph, p_font_rid, p_size, p_index);
 }
 
+void TextServerExtension::font_prerender_characters(const RID &p_font_rid, const Vector2i &p_size, const String &p_characters) {
+	GDVIRTUAL_CALL(_font_prerender_characters, p_font_rid, p_size, p_characters);
+}
+
+bool TextServerExtension::font_is_prerendering(const RID &p_font_rid) const {
+	bool ret = false;
+	GDVIRTUAL_CALL(_font_is_prerendering, p_font_rid, ret);
+	return ret;
+}
+
 void TextServerExtension::font_draw_glyph(const RID &p_font_rid, const RID &p_canvas, int64_t p_size, const Vector2 &p_pos, int64_t p_index, const Color &p_color) const {
 	GDVIRTUAL_CALL(_font_draw_glyph, p_font_rid, p_canvas, p_size, p_pos, p_index, p_color);
 }
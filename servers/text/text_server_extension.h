@@ -70,6 +70,24 @@ public:
 	virtual bool is_locale_right_to_left(const String &p_locale) const override;
 	GDVIRTUAL1RC(bool, _is_locale_right_to_left, const String &);
 
+	virtual void set_async_glyph_rasterization(bool p_enabled) override;
+	virtual bool is_async_glyph_rasterization() const override;
+	virtual int64_t get_deferred_glyph_count() const override;
+	GDVIRTUAL1(_set_async_glyph_rasterization, bool);
+	GDVIRTUAL0RC(bool, _is_async_glyph_rasterization);
+	GDVIRTUAL0RC(int64_t, _get_deferred_glyph_count);
+
+	virtual void set_shaped_text_cache_limit(int64_t p_bytes) override;
+	virtual int64_t get_shaped_text_cache_limit() const override;
+	virtual int64_t get_shaped_text_cache_usage() const override;
+	virtual int64_t get_shaped_text_cache_hits() const override;
+	virtual int64_t get_shaped_text_cache_misses() const override;
+	GDVIRTUAL1(_set_shaped_text_cache_limit, int64_t);
+	GDVIRTUAL0RC(int64_t, _get_shaped_text_cache_limit);
+	GDVIRTUAL0RC(int64_t, _get_shaped_text_cache_usage);
+	GDVIRTUAL0RC(int64_t, _get_shaped_text_cache_hits);
+	GDVIRTUAL0RC(int64_t, _get_shaped_text_cache_misses);
+
 	virtual int64_t name_to_tag(const String &p_name) const override;
 	virtual String tag_to_name(int64_t p_tag) const override;
 	GDVIRTUAL1RC(int64_t, _name_to_tag, const String &);
@@ -321,6 +339,11 @@ public:
 	GDVIRTUAL4(_font_render_range, RID, const Vector2i &, int64_t, int64_t);
 	GDVIRTUAL3(_font_render_glyph, RID, const Vector2i &, int64_t);
 
+	virtual void font_prerender_characters(const RID &p_font_rid, const Vector2i &p_size, const String &p_characters) override;
+	virtual bool font_is_prerendering(const RID &p_font_rid) const override;
+	GDVIRTUAL3(_font_prerender_characters, RID, const Vector2i &, const String &);
+	GDVIRTUAL1RC(bool, _font_is_prerendering, RID);
+
 	virtual void font_draw_glyph(const RID &p_font, const RID &p_canvas, int64_t p_size, const Vector2 &p_pos, int64_t p_index, const Color &p_color = Color(1, 1, 1)) const override;
 	virtual void font_draw_glyph_outline(const RID &p_font, const RID &p_canvas, int64_t p_size, int64_t p_outline_size, const Vector2 &p_pos, int64_t p_index, const Color &p_color = Color(1, 1, 1)) const override;
 	GDVIRTUAL6C(_font_draw_glyph, RID, RID, int64_t, const Vector2 &, int64_t, const Color &);
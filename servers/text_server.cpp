@@ -197,6 +197,16 @@ void TextServer::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("is_locale_right_to_left", "locale"), &TextServer::is_locale_right_to_left);
 
+	ClassDB::bind_method(D_METHOD("set_async_glyph_rasterization", "enabled"), &TextServer::set_async_glyph_rasterization);
+	ClassDB::bind_method(D_METHOD("is_async_glyph_rasterization"), &TextServer::is_async_glyph_rasterization);
+	ClassDB::bind_method(D_METHOD("get_deferred_glyph_count"), &TextServer::get_deferred_glyph_count);
+
+	ClassDB::bind_method(D_METHOD("set_shaped_text_cache_limit", "bytes"), &TextServer::set_shaped_text_cache_limit);
+	ClassDB::bind_method(D_METHOD("get_shaped_text_cache_limit"), &TextServer::get_shaped_text_cache_limit);
+	ClassDB::bind_method(D_METHOD("get_shaped_text_cache_usage"), &TextServer::get_shaped_text_cache_usage);
+	ClassDB::bind_method(D_METHOD("get_shaped_text_cache_hits"), &TextServer::get_shaped_text_cache_hits);
+	ClassDB::bind_method(D_METHOD("get_shaped_text_cache_misses"), &TextServer::get_shaped_text_cache_misses);
+
 	ClassDB::bind_method(D_METHOD("name_to_tag", "name"), &TextServer::name_to_tag);
 	ClassDB::bind_method(D_METHOD("tag_to_name", "tag"), &TextServer::tag_to_name);
 
@@ -348,6 +358,9 @@ void TextServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("font_render_range", "font_rid", "size", "start", "end"), &TextServer::font_render_range);
 	ClassDB::bind_method(D_METHOD("font_render_glyph", "font_rid", "size", "index"), &TextServer::font_render_glyph);
 
+	ClassDB::bind_method(D_METHOD("font_prerender_characters", "font_rid", "size", "characters"), &TextServer::font_prerender_characters);
+	ClassDB::bind_method(D_METHOD("font_is_prerendering", "font_rid"), &TextServer::font_is_prerendering);
+
 	ClassDB::bind_method(D_METHOD("font_draw_glyph", "font_rid", "canvas", "size", "pos", "index", "color"), &TextServer::font_draw_glyph, DEFVAL(Color(1, 1, 1)));
 	ClassDB::bind_method(D_METHOD("font_draw_glyph_outline", "font_rid", "canvas", "size", "outline_size", "pos", "index", "color"), &TextServer::font_draw_glyph_outline, DEFVAL(Color(1, 1, 1)));
 
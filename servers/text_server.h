@@ -237,6 +237,16 @@ public:
 
 	virtual bool is_locale_right_to_left(const String &p_locale) const = 0;
 
+	virtual void set_async_glyph_rasterization(bool p_enabled) = 0;
+	virtual bool is_async_glyph_rasterization() const = 0;
+	virtual int64_t get_deferred_glyph_count() const = 0;
+
+	virtual void set_shaped_text_cache_limit(int64_t p_bytes) = 0;
+	virtual int64_t get_shaped_text_cache_limit() const = 0;
+	virtual int64_t get_shaped_text_cache_usage() const = 0;
+	virtual int64_t get_shaped_text_cache_hits() const = 0;
+	virtual int64_t get_shaped_text_cache_misses() const = 0;
+
 	virtual int64_t name_to_tag(const String &p_name) const { return 0; };
 	virtual String tag_to_name(int64_t p_tag) const { return ""; };
 
@@ -385,6 +395,9 @@ public:
 	virtual void font_render_range(const RID &p_font, const Vector2i &p_size, int64_t p_start, int64_t p_end) = 0;
 	virtual void font_render_glyph(const RID &p_font_rid, const Vector2i &p_size, int64_t p_index) = 0;
 
+	virtual void font_prerender_characters(const RID &p_font_rid, const Vector2i &p_size, const String &p_characters) = 0;
+	virtual bool font_is_prerendering(const RID &p_font_rid) const = 0;
+
 	virtual void font_draw_glyph(const RID &p_font, const RID &p_canvas, int64_t p_size, const Vector2 &p_pos, int64_t p_index, const Color &p_color = Color(1, 1, 1)) const = 0;
 	virtual void font_draw_glyph_outline(const RID &p_font, const RID &p_canvas, int64_t p_size, int64_t p_outline_size, const Vector2 &p_pos, int64_t p_index, const Color &p_color = Color(1, 1, 1)) const = 0;
 
@@ -0,0 +1,236 @@
+/**************************************************************************/
+/*  test_astar.h                                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+
+#ifndef TEST_ASTAR_H
+#define TEST_ASTAR_H
+
+#include "core/math/a_star_grid_2d.h"
+
+#include "tests/test_macros.h"
+
+namespace TestAStar {
+
+static bool is_valid_grid_path(const Ref<AStarGrid2D> &p_grid, const TypedArray<Vector2i> &p_path, const Vector2i &p_from, const Vector2i &p_to) {
+	if (p_path.is_empty() || Vector2i(p_path[0]) != p_from || Vector2i(p_path[p_path.size() - 1]) != p_to) {
+		return false;
+	}
+	for (int i = 0; i < p_path.size(); i++) {
+		const Vector2i id = p_path[i];
+		if (p_grid->is_point_solid(id)) {
+			return false;
+		}
+		if (i > 0) {
+			const Vector2i step = (id - Vector2i(p_path[i - 1])).abs();
+			if (step.x > 1 || step.y > 1 || step == Vector2i()) {
+				return false;
+			}
+			if (p_grid->get_diagonal_mode() == AStarGrid2D::DIAGONAL_MODE_NEVER && step.x + step.y != 1) {
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+static real_t get_grid_path_cost(const TypedArray<Vector2i> &p_path) {
+	real_t cost = 0;
+	for (int i = 1; i < p_path.size(); i++) {
+		cost += Vector2(Vector2i(p_path[i]) - Vector2i(p_path[i - 1])).length();
+	}
+	return cost;
+}
+
+// Compares the paths of a grid using clusters against the ones of the same grid without, between open points of a few rows.
+// Hierarchical paths go through the cluster entrances, so they may be longer than the optimal ones, but only by a bounded detour.
+static void check_hierarchical_paths(const Ref<AStarGrid2D> &p_grid, const Ref<AStarGrid2D> &p_reference) {
+	const Rect2i region = p_grid->get_region();
+	for (int32_t y0 = region.position.y; y0 < region.get_end().y; y0 += 3) {
+		for (int32_t x0 = region.position.x; x0 < region.get_end().x; x0 += 2) {
+			const Vector2i from(x0, y0);
+			if (p_grid->is_point_solid(from)) {
+				continue;
+			}
+			for (int32_t y1 = region.get_end().y - 1; y1 >= region.position.y; y1 -= 3) {
+				for (int32_t x1 = region.get_end().x - 1; x1 >= region.position.x; x1 -= 2) {
+					const Vector2i to(x1, y1);
+					if (p_grid->is_point_solid(to)) {
+						continue;
+					}
+					const TypedArray<Vector2i> expected = p_reference->get_id_path(from, to);
+					const TypedArray<Vector2i> path = p_grid->get_id_path(from, to);
+
+					INFO(vformat("From %s to %s.", from, to).utf8().get_data());
+					CHECK(path.is_empty() == expected.is_empty());
+					if (!expected.is_empty()) {
+						CHECK(is_valid_grid_path(p_grid, path, from, to));
+						const real_t optimal_cost = get_grid_path_cost(expected);
+						const real_t cost = get_grid_path_cost(path);
+						CHECK(cost >= optimal_cost - CMP_EPSILON);
+						CHECK(cost <= optimal_cost * 1.5 + p_grid->get_cluster_size() * 2);
+					}
+				}
+			}
+		}
+	}
+}
+
+TEST_CASE("[AStarGrid2D] Distance and flow fields") {
+	Ref<AStarGrid2D> grid;
+	grid.instantiate();
+	grid->set_region(Rect2i(0, 0, 10, 8));
+	grid->set_diagonal_mode(AStarGrid2D::DIAGONAL_MODE_NEVER);
+	grid->set_default_compute_heuristic(AStarGrid2D::HEURISTIC_MANHATTAN);
+	grid->set_default_estimate_heuristic(AStarGrid2D::HEURISTIC_MANHATTAN);
+	grid->update();
+	for (int32_t y = 0; y < 7; y++) {
+		grid->set_point_solid(Vector2i(4, y)); // A wall with a gap at the bottom.
+	}
+	grid->set_point_solid(Vector2i(8, 0)); // Isolates the top-right corner.
+	grid->set_point_solid(Vector2i(9, 1));
+
+	const Vector2i goal(7, 3);
+	TypedArray<Vector2i> goals;
+	goals.push_back(goal);
+	const PackedFloat32Array distances = grid->get_distance_field(goals);
+	const PackedVector2Array directions = grid->get_flow_field(goals);
+	REQUIRE(distances.size() == 10 * 8);
+	REQUIRE(directions.size() == 10 * 8);
+
+	for (int32_t y = 0; y < 8; y++) {
+		for (int32_t x = 0; x < 10; x++) {
+			const Vector2i id(x, y);
+			const int index = y * 10 + x;
+			INFO(vformat("Point %s.", id).utf8().get_data());
+			if (grid->is_point_solid(id)) {
+				continue;
+			}
+
+			const TypedArray<Vector2i> path = grid->get_id_path(id, goal);
+			if (path.is_empty()) {
+				CHECK(distances[index] == INFINITY);
+				CHECK(directions[index] == Vector2());
+				continue;
+			}
+			// Steps cost 1, so the distance is the length of the shortest path.
+			CHECK(distances[index] == doctest::Approx(path.size() - 1));
+
+			// Following the field reaches the goal in that many steps.
+			Vector2i current = id;
+			int steps = 0;
+			while (current != goal && steps <= 10 * 8) {
+				current += Vector2i(directions[(current.y * 10) + current.x]);
+				steps++;
+			}
+			CHECK(current == goal);
+			CHECK(steps == path.size() - 1);
+		}
+	}
+	CHECK(distances[9] == INFINITY);
+	CHECK(distances[0] == doctest::Approx(11 + 7)); // Through the gap at (4, 7).
+}
+
+TEST_CASE("[AStarGrid2D] Hierarchical paths match regular paths") {
+	Ref<AStarGrid2D> grids[2];
+	for (Ref<AStarGrid2D> &grid : grids) {
+		grid.instantiate();
+		grid->set_region(Rect2i(0, 0, 18, 14));
+		grid->update();
+		for (int32_t y = 0; y < 14; y++) {
+			for (int32_t x = 0; x < 18; x++) {
+				if ((x * 7 + y * 13) % 5 == 0 || (x == 9 && y != 6) || (y == 5 && x < 12 && x != 2)) {
+					grid->set_point_solid(Vector2i(x, y));
+				}
+			}
+		}
+	}
+	grids[0]->set_cluster_size(4);
+
+	const AStarGrid2D::DiagonalMode modes[] = {
+		AStarGrid2D::DIAGONAL_MODE_NEVER,
+		AStarGrid2D::DIAGONAL_MODE_ALWAYS,
+		AStarGrid2D::DIAGONAL_MODE_AT_LEAST_ONE_WALKABLE,
+		AStarGrid2D::DIAGONAL_MODE_ONLY_IF_NO_OBSTACLES,
+	};
+	for (AStarGrid2D::DiagonalMode mode : modes) {
+		INFO(vformat("Diagonal mode %d.", mode).utf8().get_data());
+		for (Ref<AStarGrid2D> &grid : grids) {
+			grid->set_diagonal_mode(mode);
+		}
+		check_hierarchical_paths(grids[0], grids[1]);
+	}
+
+	// Clusters are rebuilt around changed points.
+	for (Ref<AStarGrid2D> &grid : grids) {
+		grid->fill_solid_region(Rect2i(0, 8, 18, 1));
+	}
+	check_hierarchical_paths(grids[0], grids[1]);
+	for (Ref<AStarGrid2D> &grid : grids) {
+		grid->fill_solid_region(Rect2i(0, 8, 18, 1), false);
+	}
+	check_hierarchical_paths(grids[0], grids[1]);
+}
+
+TEST_CASE("[AStarGrid2D] Hierarchical paths through diagonal gaps") {
+	Ref<AStarGrid2D> grid;
+	grid.instantiate();
+	grid->set_cluster_size(4);
+
+	SUBCASE("Between clusters touching by a corner") {
+		grid->set_region(Rect2i(0, 0, 8, 8));
+		grid->update();
+		grid->fill_solid_region(Rect2i(4, 0, 4, 4));
+		grid->fill_solid_region(Rect2i(0, 4, 4, 4));
+
+		grid->set_diagonal_mode(AStarGrid2D::DIAGONAL_MODE_ALWAYS);
+		TypedArray<Vector2i> path = grid->get_id_path(Vector2i(0, 0), Vector2i(7, 7));
+		CHECK(is_valid_grid_path(grid, path, Vector2i(0, 0), Vector2i(7, 7)));
+
+		grid->set_diagonal_mode(AStarGrid2D::DIAGONAL_MODE_AT_LEAST_ONE_WALKABLE);
+		CHECK(grid->get_id_path(Vector2i(0, 0), Vector2i(7, 7)).is_empty());
+	}
+
+	SUBCASE("Across a cluster border") {
+		grid->set_region(Rect2i(0, 0, 8, 4));
+		grid->update();
+		grid->fill_solid_region(Rect2i(3, 0, 2, 4));
+		grid->set_point_solid(Vector2i(3, 1), false);
+		grid->set_point_solid(Vector2i(4, 2), false);
+
+		grid->set_diagonal_mode(AStarGrid2D::DIAGONAL_MODE_ALWAYS);
+		TypedArray<Vector2i> path = grid->get_id_path(Vector2i(0, 0), Vector2i(7, 3));
+		CHECK(is_valid_grid_path(grid, path, Vector2i(0, 0), Vector2i(7, 3)));
+
+		grid->set_diagonal_mode(AStarGrid2D::DIAGONAL_MODE_ONLY_IF_NO_OBSTACLES);
+		CHECK(grid->get_id_path(Vector2i(0, 0), Vector2i(7, 3)).is_empty());
+	}
+}
+
+} // namespace TestAStar
+
+#endif // TEST_ASTAR_H
@@ -0,0 +1,171 @@
+/**************************************************************************/
+/*  test_message_queue.h                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_MESSAGE_QUEUE_H
+#define TEST_MESSAGE_QUEUE_H
+
+#include "core/object/message_queue.h"
+#include "core/os/os.h"
+
+#include "tests/test_macros.h"
+
+namespace TestMessageQueue {
+
+class DeferredTarget : public Object {
+public:
+	int calls = 0;
+	int last_value = 0;
+	uint64_t delay_usec = 0;
+
+	void update() {
+		calls++;
+		if (delay_usec) {
+			OS::get_singleton()->delay_usec(delay_usec);
+		}
+	}
+
+	void update_value(int p_value) {
+		calls++;
+		last_value = p_value;
+	}
+};
+
+TEST_CASE("[MessageQueue] Coalesced calls") {
+	CallQueue queue;
+	DeferredTarget target;
+
+	queue.push_callable_coalesced(callable_mp(&target, &DeferredTarget::update_value), 1);
+	queue.push_callable_coalesced(callable_mp(&target, &DeferredTarget::update_value), 2);
+	queue.push_callable_coalesced(callable_mp(&target, &DeferredTarget::update_value), 3);
+	CHECK(queue.get_pending_message_count() == 1);
+	CHECK(queue.get_flush_statistics().coalesced == 2);
+
+	queue.flush();
+	CHECK_MESSAGE(target.calls == 1, "Coalesced calls should run once per flush.");
+	CHECK_MESSAGE(target.last_value == 3, "Coalesced calls should use the arguments of the last push.");
+	CHECK_FALSE(queue.has_messages());
+
+	queue.push_callable_coalesced(callable_mp(&target, &DeferredTarget::update_value), 4);
+	queue.flush();
+	CHECK_MESSAGE(target.calls == 2, "A call pushed after the flush should run again.");
+	CHECK(target.last_value == 4);
+}
+
+TEST_CASE("[MessageQueue] Coalescing mode") {
+	CallQueue queue;
+	DeferredTarget target;
+
+	queue.push_callable(callable_mp(&target, &DeferredTarget::update));
+	queue.push_callable(callable_mp(&target, &DeferredTarget::update));
+	queue.flush();
+	CHECK_MESSAGE(target.calls == 2, "Calls are not coalesced by default.");
+
+	queue.set_coalesce_calls(true);
+	queue.push_callable(callable_mp(&target, &DeferredTarget::update));
+	queue.push_callable(callable_mp(&target, &DeferredTarget::update));
+	CHECK_MESSAGE(queue.get_pending_message_count() == 1, "Calls without arguments should be coalesced.");
+
+	queue.push_callable(callable_mp(&target, &DeferredTarget::update_value), 5);
+	queue.push_callable(callable_mp(&target, &DeferredTarget::update_value), 5);
+	CHECK_MESSAGE(queue.get_pending_message_count() == 2, "Calls with the same arguments should be coalesced.");
+
+	queue.push_callable(callable_mp(&target, &DeferredTarget::update_value), 6);
+	queue.push_callable(callable_mp(&target, &DeferredTarget::update_value), 5);
+	CHECK_MESSAGE(queue.get_pending_message_count() == 4, "Calls with other arguments should all be kept.");
+
+	queue.flush();
+	CHECK(target.calls == 6);
+	CHECK_MESSAGE(target.last_value == 5, "Calls should run in the order they were pushed.");
+	CHECK_FALSE(queue.has_messages());
+}
+
+TEST_CASE("[MessageQueue] Budgeted flush") {
+	CallQueue queue;
+	DeferredTarget target;
+	target.delay_usec = 100;
+
+	for (int i = 0; i < 4; i++) {
+		queue.push_callable(callable_mp(&target, &DeferredTarget::update));
+	}
+	CHECK(queue.get_pending_message_count() == 4);
+
+	queue.flush(1);
+	CHECK_MESSAGE(target.calls == 1, "A budgeted flush should stop once its budget is spent.");
+	CHECK(queue.has_messages());
+	CHECK(queue.get_pending_message_count() == 3);
+
+	queue.push_callable(callable_mp(&target, &DeferredTarget::update));
+	queue.flush();
+	CHECK_MESSAGE(target.calls == 5, "A regular flush should run the remaining and newly pushed messages.");
+	CHECK_FALSE(queue.has_messages());
+	CHECK(queue.get_pending_message_count() == 0);
+	CHECK(queue.get_pending_bytes() == 0);
+
+	const CallQueue::FlushStatistics stats = queue.get_flush_statistics();
+	CHECK(stats.max_depth == 4);
+	CHECK(stats.max_flush_usec > 0);
+	queue.reset_flush_statistics();
+	CHECK(queue.get_flush_statistics().max_depth == 0);
+}
+
+TEST_CASE("[MessageQueue] Budgeted flushes keep up with pushes") {
+	// Two pages only, so a queue that doesn't reuse its consumed pages runs out of memory.
+	CallQueue queue(nullptr, 2);
+	DeferredTarget target;
+	target.delay_usec = 10;
+
+	const int backlog = 4;
+	for (int i = 0; i < backlog; i++) {
+		queue.push_callable(callable_mp(&target, &DeferredTarget::update));
+	}
+
+	// Each frame pushes one message and a budgeted flush runs one, so the queue is never fully drained.
+	const int frames = 1000;
+	int failed_pushes = 0;
+	for (int i = 0; i < frames; i++) {
+		if (queue.push_callable(callable_mp(&target, &DeferredTarget::update)) != OK) {
+			failed_pushes++;
+		}
+		queue.flush(1);
+		REQUIRE(queue.has_messages());
+	}
+	CHECK_MESSAGE(failed_pushes == 0, "Budgeted flushes that keep up with pushes should not run out of memory.");
+	CHECK(target.calls == frames);
+	CHECK(queue.get_pending_message_count() == backlog);
+	CHECK(queue.get_max_buffer_usage() <= 2 * CallQueue::PAGE_SIZE_BYTES);
+
+	queue.flush();
+	CHECK(target.calls == frames + backlog);
+	CHECK_FALSE(queue.has_messages());
+}
+
+} // namespace TestMessageQueue
+
+#endif // TEST_MESSAGE_QUEUE_H
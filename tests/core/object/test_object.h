@@ -35,6 +35,7 @@
 #include "core/object/class_db.h"
 #include "core/object/object.h"
 #include "core/object/script_language.h"
+#include "core/os/os.h"
 
 #include "tests/test_macros.h"
 
@@ -284,6 +285,13 @@ TEST_CASE("[Object] Absent name getter") {
 			"The returned value should equal nil variant.");
 }
 
+class SignalCounterObject : public Object {
+public:
+	int emitted = 0;
+
+	void on_emitted() { emitted++; }
+};
+
 TEST_CASE("[Object] Signals") {
 	Object object;
 
@@ -424,6 +432,112 @@ TEST_CASE("[Object] Signals") {
 		object.get_all_signal_connections(&signal_connections);
 		CHECK(signal_connections.size() == 0);
 	}
+
+	SUBCASE("Connecting and disconnecting between emissions should update the called targets") {
+		SignalCounterObject first;
+		SignalCounterObject second;
+
+		object.connect("my_custom_signal", callable_mp(&first, &SignalCounterObject::on_emitted), Object::CONNECT_ONE_SHOT);
+		object.emit_signal("my_custom_signal");
+		object.connect("my_custom_signal", callable_mp(&second, &SignalCounterObject::on_emitted));
+		object.emit_signal("my_custom_signal");
+		object.disconnect("my_custom_signal", callable_mp(&second, &SignalCounterObject::on_emitted));
+		object.emit_signal("my_custom_signal");
+
+		CHECK(first.emitted == 1);
+		CHECK(second.emitted == 1);
+	}
+}
+
+TEST_CASE("[Stress][Object] Signal emission throughput") {
+	const int emissions = 100000;
+	const int connection_counts[] = { 0, 1, 8 };
+	const StringName signal_name = "benchmark_signal";
+
+	for (int connection_count : connection_counts) {
+		Object emitter;
+		emitter.add_user_signal(MethodInfo(signal_name));
+
+		SignalCounterObject targets[8];
+		for (int i = 0; i < connection_count; i++) {
+			emitter.connect(signal_name, callable_mp(&targets[i], &SignalCounterObject::on_emitted));
+		}
+
+		uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < emissions; i++) {
+			emitter.emit_signalp(signal_name, nullptr, 0);
+		}
+		uint64_t elapsed = MAX(OS::get_singleton()->get_ticks_usec() - begin, (uint64_t)1);
+		MESSAGE(vformat("%d connection(s): %d emissions/s.", connection_count, int64_t(emissions * 1000000.0 / elapsed)).utf8().get_data());
+
+		int total_emitted = 0;
+		for (const SignalCounterObject &target : targets) {
+			total_emitted += target.emitted;
+		}
+		CHECK(total_emitted == connection_count * emissions);
+	}
+}
+
+class SignalDisconnectingObject : public Object {
+public:
+	Object *emitter = nullptr;
+	Callable to_disconnect;
+	int emitted = 0;
+
+	void on_emitted() {
+		emitted++;
+		if (emitter->is_connected("my_custom_signal", to_disconnect)) {
+			emitter->disconnect("my_custom_signal", to_disconnect);
+		}
+	}
+};
+
+class SignalBoundObject : public Object {
+public:
+	int emitted = 0;
+
+	void on_emitted(const Ref<RefCounted> &p_bound) { emitted++; }
+};
+
+TEST_CASE("[Object] Disconnecting signals invalidates the emission snapshot") {
+	Object object;
+	object.add_user_signal(MethodInfo("my_custom_signal"));
+
+	SUBCASE("Disconnecting inside an emission should take effect on the next emission") {
+		SignalDisconnectingObject first;
+		SignalCounterObject second;
+		Callable second_callable = callable_mp(&second, &SignalCounterObject::on_emitted);
+		first.emitter = &object;
+		first.to_disconnect = second_callable;
+
+		object.connect("my_custom_signal", callable_mp(&first, &SignalDisconnectingObject::on_emitted));
+		object.connect("my_custom_signal", second_callable);
+		object.emit_signal("my_custom_signal");
+		CHECK(first.emitted == 1);
+		CHECK_FALSE(object.is_connected("my_custom_signal", second_callable));
+
+		int second_emitted = second.emitted;
+		object.emit_signal("my_custom_signal");
+		CHECK(first.emitted == 2);
+		CHECK_MESSAGE(second.emitted == second_emitted,
+				"A callable disconnected during an emission should not be called again.");
+	}
+
+	SUBCASE("Disconnecting should release bound references without another emission") {
+		SignalBoundObject target;
+		Ref<RefCounted> bound;
+		bound.instantiate();
+		Callable callable = callable_mp(&target, &SignalBoundObject::on_emitted).bind(bound);
+
+		object.connect("my_custom_signal", callable);
+		object.emit_signal("my_custom_signal");
+		CHECK(target.emitted == 1);
+
+		object.disconnect("my_custom_signal", callable);
+		callable = Callable();
+		CHECK_MESSAGE(bound->get_reference_count() == 1,
+				"The emission snapshot should not keep a disconnected callable alive.");
+	}
 }
 
 class NotificationObject1 : public Object {
@@ -151,7 +151,10 @@ public:
 			if (message_count_to_read < 0) {
 				command_queue.flush_all();
 			}
-			for (int i = 0; i < message_count_to_read; i++) {
+			// Wakeups for pushes made while one is owed are coalesced, so wait
+			// until the messages have been read rather than once per message.
+			int read_target = func1_count + message_count_to_read;
+			while (func1_count < read_target) {
 				command_queue.wait_and_flush();
 			}
 			message_count_to_read = 0;
@@ -422,6 +425,145 @@ TEST_CASE("[Stress][CommandQueue] Stress test command queue") {
 	ProjectSettings::get_singleton()->set_setting(COMMAND_QUEUE_SETTING,
 			ProjectSettings::get_singleton()->property_get_revert(COMMAND_QUEUE_SETTING));
 }
+
+class ShortLivedProducers {
+public:
+	CommandQueueMT command_queue = CommandQueueMT(false);
+	LocalVector<int> executed;
+
+	void execute(int p_index) {
+		executed.push_back(p_index);
+	}
+
+	struct Producer {
+		ShortLivedProducers *owner = nullptr;
+		int index = 0;
+	};
+
+	static void producer_func(void *p_ud) {
+		Producer *producer = static_cast<Producer *>(p_ud);
+		producer->owner->command_queue.push(producer->owner, &ShortLivedProducers::execute, producer->index);
+	}
+};
+
+TEST_CASE("[CommandQueue] Commands pushed by exited threads") {
+	ShortLivedProducers slp;
+
+	// Each thread pushes once and exits before the next one starts, so the
+	// commands have to run in thread order, including across flushes.
+	const int thread_count = 64;
+	for (int i = 0; i < thread_count; i++) {
+		ShortLivedProducers::Producer producer;
+		producer.owner = &slp;
+		producer.index = i;
+		Thread thread;
+		thread.start(&ShortLivedProducers::producer_func, &producer);
+		thread.wait_to_finish();
+		if (i % 16 == 15) {
+			slp.command_queue.flush_all();
+		}
+	}
+	slp.command_queue.flush_all();
+
+	REQUIRE(slp.executed.size() == (uint32_t)thread_count);
+	for (int i = 0; i < thread_count; i++) {
+		CHECK(slp.executed[i] == i);
+	}
+}
+
+class ProducerBenchmark {
+public:
+	static const int COMMANDS_PER_PRODUCER = 100000;
+
+	CommandQueueMT command_queue = CommandQueueMT(true);
+	Thread consumer_thread;
+	SafeFlag start;
+	bool exit = false;
+
+	LocalVector<int> last_index;
+	int consumed = 0;
+	int order_errors = 0;
+
+	void consume(int p_producer, int p_index, Transform2D p_transform) {
+		if (p_index <= last_index[p_producer]) {
+			order_errors++;
+		}
+		last_index[p_producer] = p_index;
+		consumed++;
+	}
+	void stop() {
+		exit = true;
+	}
+
+	static void consumer_loop(void *p_ud) {
+		ProducerBenchmark *pb = static_cast<ProducerBenchmark *>(p_ud);
+		while (!pb->exit) {
+			pb->command_queue.wait_and_flush();
+		}
+		pb->command_queue.flush_all();
+	}
+
+	struct Producer {
+		ProducerBenchmark *benchmark = nullptr;
+		int index = 0;
+		Thread thread;
+	};
+
+	static void producer_loop(void *p_ud) {
+		Producer *producer = static_cast<Producer *>(p_ud);
+		ProducerBenchmark *pb = producer->benchmark;
+		while (!pb->start.is_set()) {
+			// Spin, so all producers start pushing at once.
+		}
+		Transform2D transform;
+		for (int i = 0; i < COMMANDS_PER_PRODUCER; i++) {
+			pb->command_queue.push(pb, &ProducerBenchmark::consume, producer->index, i, transform);
+		}
+	}
+
+	// Returns the commands per second processed with the given amount of producers.
+	double run(int p_producers) {
+		last_index.resize(p_producers);
+		for (int &index : last_index) {
+			index = -1;
+		}
+		consumer_thread.start(&ProducerBenchmark::consumer_loop, this);
+
+		LocalVector<Producer> producers;
+		producers.resize(p_producers);
+		for (int i = 0; i < p_producers; i++) {
+			producers[i].benchmark = this;
+			producers[i].index = i;
+			producers[i].thread.start(&ProducerBenchmark::producer_loop, &producers[i]);
+		}
+
+		uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		start.set();
+		for (Producer &producer : producers) {
+			producer.thread.wait_to_finish();
+		}
+		command_queue.push(this, &ProducerBenchmark::stop);
+		consumer_thread.wait_to_finish();
+		uint64_t elapsed = MAX(OS::get_singleton()->get_ticks_usec() - begin, (uint64_t)1);
+
+		return double(consumed) * 1000000.0 / double(elapsed);
+	}
+};
+
+TEST_CASE("[Stress][CommandQueue] Benchmark throughput with multiple producers") {
+	int max_producers = CLAMP(OS::get_singleton()->get_processor_count(), 1, 8);
+
+	for (int producers = 1; producers <= max_producers; producers++) {
+		ProducerBenchmark pb;
+		double commands_per_second = pb.run(producers);
+		MESSAGE(vformat("%d producer(s): %d commands/s.", producers, int64_t(commands_per_second)).utf8().get_data());
+
+		CHECK_MESSAGE(pb.consumed == producers * ProducerBenchmark::COMMANDS_PER_PRODUCER,
+				"Consumer should have executed every pushed command.");
+		CHECK_MESSAGE(pb.order_errors == 0,
+				"Commands pushed by the same producer should execute in order.");
+	}
+}
 } // namespace TestCommandQueue
 
 #endif // TEST_COMMAND_QUEUE_H
@@ -90,6 +90,45 @@ TEST_CASE("[Animation] Create value track") {
 	ERR_PRINT_ON;
 }
 
+TEST_CASE("[Animation] Value track interpolation with a key cursor") {
+	Ref<Animation> animation = memnew(Animation);
+	animation->set_length(2.0);
+	const int track_index = animation->add_track(Animation::TYPE_VALUE);
+	animation->track_set_path(track_index, NodePath("Enemy:position"));
+	for (int i = 0; i <= 8; i++) {
+		animation->track_insert_key(track_index, i * 0.25, Vector2(i * 10, -i * 5));
+	}
+	animation->track_set_interpolation_type(track_index, Animation::INTERPOLATION_CUBIC);
+
+	// Sequential playback, a backward seek and a jump far ahead must all match the search without a cursor.
+	int cursor = -1;
+	const double times[] = { -0.1, 0.0, 0.1, 0.2, 0.25, 0.3, 0.6, 0.1, 1.9, 2.0, 2.5 };
+	for (double time : times) {
+		Vector2 expected = animation->value_track_interpolate(track_index, time);
+
+		Vector2 typed;
+		int typed_cursor = cursor;
+		CHECK(animation->value_track_interpolate_cursor(track_index, time, typed_cursor, typed));
+		CHECK(typed.is_equal_approx(expected));
+
+		Variant value;
+		CHECK(animation->value_track_interpolate_cursor(track_index, time, cursor, value));
+		CHECK(Vector2(value).is_equal_approx(expected));
+		CHECK(cursor == typed_cursor);
+	}
+	CHECK(cursor == 8);
+
+	// Keys of another numeric type are converted.
+	const int float_track = animation->add_track(Animation::TYPE_VALUE);
+	animation->track_insert_key(float_track, 0.0, 0);
+	animation->track_insert_key(float_track, 1.0, 100);
+	cursor = -1;
+	real_t value = 0.0;
+	CHECK(animation->value_track_interpolate_cursor(float_track, 0.25, cursor, value));
+	CHECK(value == doctest::Approx(real_t(25.0)));
+	CHECK(cursor == 0);
+}
+
 TEST_CASE("[Animation] Create 3D position track") {
 	Ref<Animation> animation = memnew(Animation);
 	const int track_index = animation->add_track(Animation::TYPE_POSITION_3D);
@@ -279,6 +318,78 @@ TEST_CASE("[Animation] Create blend shape track") {
 	ERR_PRINT_ON;
 }
 
+TEST_CASE("[Animation] Create 2D position track") {
+	Ref<Animation> animation = memnew(Animation);
+	const int track_index = animation->add_track(Animation::TYPE_POSITION_2D);
+	animation->track_set_path(track_index, NodePath("Enemy"));
+	animation->position_2d_track_insert_key(track_index, 0.0, Vector2(0, 1));
+	animation->position_2d_track_insert_key(track_index, 0.5, Vector2(3.5, 4));
+
+	CHECK(animation->get_track_count() == 1);
+	CHECK(!animation->track_is_compressed(0));
+	CHECK(Vector2(animation->track_get_key_value(0, 0)).is_equal_approx(Vector2(0, 1)));
+	CHECK(Vector2(animation->track_get_key_value(0, 1)).is_equal_approx(Vector2(3.5, 4)));
+
+	Vector2 r_interpolation;
+
+	CHECK(animation->try_position_2d_track_interpolate(0, -0.2, &r_interpolation) == OK);
+	CHECK(r_interpolation.is_equal_approx(Vector2(0, 1)));
+
+	CHECK(animation->try_position_2d_track_interpolate(0, 0.2, &r_interpolation) == OK);
+	CHECK(r_interpolation.is_equal_approx(Vector2(1.4, 2.2)));
+
+	// Sampling forward with a cursor must give the same results as a plain search.
+	int cursor = -1;
+	CHECK(animation->try_position_2d_track_interpolate(0, 0.4, &r_interpolation, &cursor) == OK);
+	CHECK(r_interpolation.is_equal_approx(Vector2(2.8, 3.4)));
+	CHECK(animation->try_position_2d_track_interpolate(0, 0.6, &r_interpolation, &cursor) == OK);
+	CHECK(r_interpolation.is_equal_approx(Vector2(3.5, 4)));
+
+	// This is a 2D position track, so the methods below should return errors.
+	ERR_PRINT_OFF;
+	CHECK(animation->try_position_track_interpolate(0, 0.0, nullptr) == ERR_INVALID_PARAMETER);
+	CHECK(animation->try_rotation_2d_track_interpolate(0, 0.0, nullptr) == ERR_INVALID_PARAMETER);
+	CHECK(animation->try_scale_2d_track_interpolate(0, 0.0, nullptr) == ERR_INVALID_PARAMETER);
+	ERR_PRINT_ON;
+
+	// Compressed 2D tracks keep their keys within the quantization error.
+	animation->compress();
+	CHECK(animation->track_is_compressed(0));
+
+	Vector2 r_position;
+	CHECK(animation->position_2d_track_get_key(0, 0, &r_position) == OK);
+	CHECK(r_position.x == doctest::Approx(0.0).epsilon(0.001));
+	CHECK(r_position.y == doctest::Approx(1.0).epsilon(0.001));
+
+	CHECK(animation->try_position_2d_track_interpolate(0, 0.2, &r_interpolation) == OK);
+	CHECK(r_interpolation.x == doctest::Approx(1.4).epsilon(0.001));
+	CHECK(r_interpolation.y == doctest::Approx(2.2).epsilon(0.001));
+}
+
+TEST_CASE("[Animation] Create 2D rotation and scale tracks") {
+	Ref<Animation> animation = memnew(Animation);
+	animation->add_track(Animation::TYPE_ROTATION_2D);
+	animation->add_track(Animation::TYPE_SCALE_2D);
+	animation->rotation_2d_track_insert_key(0, 0.0, 0.0);
+	animation->rotation_2d_track_insert_key(0, 1.0, Math_PI);
+	animation->scale_2d_track_insert_key(1, 0.0, Vector2(1, 1));
+	animation->scale_2d_track_insert_key(1, 1.0, Vector2(2, 3));
+
+	CHECK(animation->rotation_2d_track_interpolate(0, 0.5) == doctest::Approx(real_t(Math_PI * 0.5)));
+	CHECK(animation->scale_2d_track_interpolate(1, 0.5).is_equal_approx(Vector2(1.5, 2)));
+
+	// Keys survive a round trip through the serialized packed arrays.
+	bool valid = false;
+	Variant keys = animation->get("tracks/1/keys", &valid);
+	CHECK(valid);
+	CHECK(Vector<real_t>(keys).size() == 8);
+	Ref<Animation> copy = memnew(Animation);
+	copy->set("tracks/0/type", "scale_2d");
+	copy->set("tracks/0/keys", keys);
+	CHECK(copy->track_get_type(0) == Animation::TYPE_SCALE_2D);
+	CHECK(copy->scale_2d_track_interpolate(0, 1.0).is_equal_approx(Vector2(2, 3)));
+}
+
 TEST_CASE("[Animation] Create Bezier track") {
 	Ref<Animation> animation = memnew(Animation);
 	const int track_index = animation->add_track(Animation::TYPE_BEZIER);
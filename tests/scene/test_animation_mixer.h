@@ -0,0 +1,105 @@
+/**************************************************************************/
+/*  test_animation_mixer.h                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+
+#ifndef TEST_ANIMATION_MIXER_H
+#define TEST_ANIMATION_MIXER_H
+
+#include "scene/2d/node_2d.h"
+#include "scene/animation/animation_player.h"
+#include "scene/main/window.h"
+#include "scene/resources/animation_library.h"
+
+#include "tests/test_macros.h"
+
+namespace TestAnimationMixer {
+
+TEST_CASE("[SceneTree][AnimationMixer] Blend and apply 2D transform tracks") {
+	Node2D *root = memnew(Node2D);
+	Node2D *sprite = memnew(Node2D);
+	sprite->set_name("Sprite");
+	root->add_child(sprite);
+	AnimationPlayer *player = memnew(AnimationPlayer);
+	root->add_child(player);
+	SceneTree::get_singleton()->get_root()->add_child(root);
+
+	Ref<Animation> right;
+	right.instantiate();
+	right->set_length(10.0);
+	int track = right->add_track(Animation::TYPE_POSITION_2D);
+	right->track_set_path(track, NodePath("Sprite"));
+	right->position_2d_track_insert_key(track, 0.0, Vector2(100, 0));
+	track = right->add_track(Animation::TYPE_ROTATION_2D);
+	right->track_set_path(track, NodePath("Sprite"));
+	right->rotation_2d_track_insert_key(track, 0.0, 1.0);
+	track = right->add_track(Animation::TYPE_SCALE_2D);
+	right->track_set_path(track, NodePath("Sprite"));
+	right->scale_2d_track_insert_key(track, 0.0, Vector2(3, 3));
+
+	// No scale track, so only the first animation moves the scale away from its rest value.
+	Ref<Animation> down;
+	down.instantiate();
+	down->set_length(10.0);
+	track = down->add_track(Animation::TYPE_POSITION_2D);
+	down->track_set_path(track, NodePath("Sprite"));
+	down->position_2d_track_insert_key(track, 0.0, Vector2(0, 100));
+	track = down->add_track(Animation::TYPE_ROTATION_2D);
+	down->track_set_path(track, NodePath("Sprite"));
+	down->rotation_2d_track_insert_key(track, 0.0, 0.0);
+
+	Ref<AnimationLibrary> library;
+	library.instantiate();
+	library->add_animation("right", right);
+	library->add_animation("down", down);
+	player->add_animation_library("", library);
+
+	player->play("right");
+	player->advance(0.0);
+	CHECK(sprite->get_position().is_equal_approx(Vector2(100, 0)));
+	CHECK(sprite->get_rotation() == doctest::Approx(1.0));
+	CHECK(sprite->get_scale().is_equal_approx(Vector2(3, 3)));
+
+	// Halfway through the cross-fade, both animations weigh the same.
+	player->play("down", 1.0);
+	player->advance(0.5);
+	CHECK(sprite->get_position().is_equal_approx(Vector2(50, 50)));
+	CHECK(sprite->get_rotation() == doctest::Approx(0.5));
+	CHECK(sprite->get_scale().is_equal_approx(Vector2(2, 2)));
+
+	// Once the cross-fade is over, only the second animation is left.
+	player->advance(1.0);
+	player->advance(0.1);
+	CHECK(sprite->get_position().is_equal_approx(Vector2(0, 100)));
+	CHECK(sprite->get_rotation() == doctest::Approx(0.0));
+
+	memdelete(root);
+}
+
+} // namespace TestAnimationMixer
+
+#endif // TEST_ANIMATION_MIXER_H
@@ -0,0 +1,108 @@
+/**************************************************************************/
+/*  test_cpu_particles_2d.h                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_CPU_PARTICLES_2D_H
+#define TEST_CPU_PARTICLES_2D_H
+
+#include "scene/2d/cpu_particles_2d.h"
+#include "scene/resources/curve.h"
+#include "scene/resources/gradient.h"
+
+#include "tests/test_macros.h"
+
+namespace TestCPUParticles2D {
+
+TEST_CASE("[CPUParticles2D] Curve lookup tables match baked curve sampling") {
+	Ref<Curve> curve = memnew(Curve);
+	// A smooth rise followed by a step, which interpolating a fixed-size table would blur.
+	curve->add_point(Vector2(0, 0));
+	curve->add_point(Vector2(0.3, 0.8));
+	curve->add_point(Vector2(0.5, 0.2), 0, 0, Curve::TangentMode::TANGENT_LINEAR, Curve::TangentMode::TANGENT_LINEAR);
+	curve->add_point(Vector2(0.505, 1), 0, 0, Curve::TangentMode::TANGENT_LINEAR, Curve::TangentMode::TANGENT_LINEAR);
+	curve->add_point(Vector2(1, 1));
+
+	for (int resolution : { 1, 100, 1000 }) {
+		curve->set_bake_resolution(resolution);
+		CPUParticles2D::CurveLUT lut;
+		lut.bake(curve);
+		REQUIRE(lut.is_valid());
+
+		for (int i = -10; i <= 1010; i++) {
+			real_t offset = i / 1000.0;
+			CHECK_MESSAGE(Math::is_equal_approx(lut.sample(offset), curve->sample_baked(offset)),
+					vformat("Curve lookup table should match Curve::sample_baked() at offset %f with bake resolution %d.", offset, resolution));
+		}
+	}
+
+	CPUParticles2D::CurveLUT lut;
+	lut.bake(Ref<Curve>());
+	CHECK_FALSE(lut.is_valid());
+}
+
+TEST_CASE("[CPUParticles2D] Gradient lookup tables match gradient sampling") {
+	Ref<Gradient> gradient = memnew(Gradient);
+	gradient->add_point(0.33, Color(1, 0, 0));
+	gradient->add_point(0.5, Color(0, 1, 0));
+	gradient->add_point(0.501, Color(0, 0, 1));
+
+	SUBCASE("Constant interpolation is sampled exactly") {
+		gradient->set_interpolation_mode(Gradient::GRADIENT_INTERPOLATE_CONSTANT);
+		CPUParticles2D::GradientLUT lut;
+		lut.bake(gradient);
+		REQUIRE(lut.is_valid());
+
+		const real_t offsets[] = { -1.0, 0.0, 0.3299, 0.33, 0.3301, 0.4999, 0.5, 0.5005, 0.501, 0.75, 1.0, 2.0 };
+		for (real_t offset : offsets) {
+			CHECK_MESSAGE(lut.sample(offset) == gradient->get_color_at_offset(offset),
+					vformat("Constant gradient lookup should match Gradient::get_color_at_offset() at offset %f.", offset));
+		}
+	}
+
+	SUBCASE("Linear interpolation matches at every table entry") {
+		gradient->set_interpolation_mode(Gradient::GRADIENT_INTERPOLATE_LINEAR);
+		CPUParticles2D::GradientLUT lut;
+		lut.bake(gradient);
+		REQUIRE(lut.is_valid());
+
+		for (int i = 0; i < CPUParticles2D::GradientLUT::SIZE; i++) {
+			real_t offset = real_t(i) / (CPUParticles2D::GradientLUT::SIZE - 1);
+			CHECK_MESSAGE(lut.sample(offset).is_equal_approx(gradient->get_color_at_offset(offset)),
+					vformat("Linear gradient lookup should match Gradient::get_color_at_offset() at offset %f.", offset));
+		}
+	}
+
+	CPUParticles2D::GradientLUT lut;
+	lut.bake(Ref<Gradient>());
+	CHECK_FALSE(lut.is_valid());
+}
+
+} // namespace TestCPUParticles2D
+
+#endif // TEST_CPU_PARTICLES_2D_H
@@ -32,6 +32,9 @@
 #define TEST_NODE_2D_H
 
 #include "scene/2d/node_2d.h"
+#include "scene/main/window.h"
+#include "servers/rendering/renderer_canvas_cull.h"
+#include "servers/rendering/rendering_server_globals.h"
 
 #include "tests/test_macros.h"
 
@@ -58,6 +61,74 @@ TEST_CASE("[SceneTree][Node2D]") {
 	}
 }
 
+static Transform2D get_server_transform(const Node2D *p_node) {
+	const RendererCanvasCull::Item *item = RSG::canvas->canvas_item_owner.get_or_null(p_node->get_canvas_item());
+	return item ? item->xform : Transform2D();
+}
+
+TEST_CASE("[SceneTree][Node2D] Batched canvas item transforms") {
+	Node2D *node = memnew(Node2D);
+	SceneTree::get_singleton()->get_root()->add_child(node);
+	SceneTree::get_singleton()->flush_canvas_item_transforms();
+
+	SUBCASE("Transforms are sent when the batch is flushed") {
+		node->set_position(Point2(10, 20));
+		SceneTree::get_singleton()->flush_canvas_item_transforms();
+		CHECK(get_server_transform(node) == node->get_transform());
+
+		// Flushing transform notifications, as the tree does during the frame, also sends them.
+		node->set_position(Point2(30, 40));
+		SceneTree::get_singleton()->flush_transform_notifications();
+		CHECK(get_server_transform(node) == node->get_transform());
+	}
+
+	SUBCASE("Transforms set directly through the server are not overwritten by batched ones") {
+		node->set_position(Point2(10, 20));
+		const Transform2D direct = Transform2D(0, Point2(-5, 5));
+		RenderingServer::get_singleton()->call("canvas_item_set_transform", node->get_canvas_item(), direct);
+		SceneTree::get_singleton()->flush_canvas_item_transforms();
+		CHECK_MESSAGE(get_server_transform(node) == direct,
+				"A direct transform set after the node moved should not be replaced by the batched transform.");
+
+		node->set_position(Point2(30, 40));
+		SceneTree::get_singleton()->flush_canvas_item_transforms();
+		CHECK_MESSAGE(get_server_transform(node) == node->get_transform(),
+				"Moving the node again should batch its transform again.");
+	}
+
+	SUBCASE("Transforms set directly in C++ are not overwritten by batched ones") {
+		node->set_position(Point2(10, 20));
+		const Transform2D direct = Transform2D(0, Point2(7, -7));
+		RenderingServer::get_singleton()->canvas_item_set_transform(node->get_canvas_item(), direct);
+		SceneTree::get_singleton()->flush_canvas_item_transforms();
+		CHECK(get_server_transform(node) == direct);
+
+		// Same through the bulk setter, with the node batched alongside another one.
+		Node2D *other = memnew(Node2D);
+		SceneTree::get_singleton()->get_root()->add_child(other);
+		node->set_position(Point2(30, 40));
+		other->set_position(Point2(50, 60));
+		Vector<RID> items;
+		items.push_back(node->get_canvas_item());
+		Vector<Transform2D> transforms;
+		transforms.push_back(direct);
+		RenderingServer::get_singleton()->canvas_items_set_transforms(items, transforms);
+		SceneTree::get_singleton()->flush_canvas_item_transforms();
+		CHECK(get_server_transform(node) == direct);
+		CHECK(get_server_transform(other) == other->get_transform());
+		memdelete(other);
+	}
+
+	SUBCASE("Pending transforms are sent when the node leaves the tree") {
+		node->set_position(Point2(50, 60));
+		SceneTree::get_singleton()->get_root()->remove_child(node);
+		CHECK(get_server_transform(node) == node->get_transform());
+		SceneTree::get_singleton()->get_root()->add_child(node);
+	}
+
+	memdelete(node);
+}
+
 } // namespace TestNode2D
 
 #endif // TEST_NODE_2D_H
@@ -31,6 +31,9 @@
 #ifndef TEST_PACKED_SCENE_H
 #define TEST_PACKED_SCENE_H
 
+#include "core/os/os.h"
+#include "scene/2d/node_2d.h"
+#include "scene/main/window.h"
 #include "scene/resources/packed_scene.h"
 
 #include "tests/test_macros.h"
@@ -150,6 +153,171 @@ TEST_CASE("[PackedScene] Instantiate Packed Scene With Children") {
 	memdelete(instance);
 }
 
+TEST_CASE("[PackedScene] Repeated instantiation restores packed properties") {
+	Node2D *scene = memnew(Node2D);
+	scene->set_name("TestScene");
+	scene->set_position(Vector2(10, 20));
+	scene->set_rotation(0.5);
+	scene->set_z_index(3);
+	Node2D *child = memnew(Node2D);
+	child->set_name("Child");
+	child->set_scale(Vector2(2, 3));
+	child->set_visible(false);
+	scene->add_child(child);
+	child->set_owner(scene);
+
+	PackedScene packed_scene;
+	CHECK(packed_scene.pack(scene) == OK);
+
+	for (int i = 0; i < 2; i++) {
+		Node2D *instance = Object::cast_to<Node2D>(packed_scene.instantiate());
+		REQUIRE(instance != nullptr);
+		CHECK(instance->get_position() == Vector2(10, 20));
+		CHECK(instance->get_rotation() == doctest::Approx(0.5));
+		CHECK(instance->get_z_index() == 3);
+
+		Node2D *instance_child = Object::cast_to<Node2D>(instance->get_node(NodePath("Child")));
+		REQUIRE(instance_child != nullptr);
+		CHECK(instance_child->get_scale() == Vector2(2, 3));
+		CHECK_FALSE(instance_child->is_visible());
+		memdelete(instance);
+	}
+
+	// Packing again must not replay the plan of the previous state.
+	scene->remove_child(child);
+	memdelete(child);
+	scene->set_position(Vector2(-1, -2));
+	CHECK(packed_scene.pack(scene) == OK);
+
+	Node2D *instance = Object::cast_to<Node2D>(packed_scene.instantiate());
+	REQUIRE(instance != nullptr);
+	CHECK(instance->get_position() == Vector2(-1, -2));
+	CHECK(instance->get_child_count() == 0);
+
+	memdelete(instance);
+	memdelete(scene);
+}
+
+TEST_CASE("[SceneTree][PackedScene] Instance pool") {
+	Node2D *scene = memnew(Node2D);
+	scene->set_name("TestScene");
+	scene->set_position(Vector2(10, 20));
+	Node2D *child = memnew(Node2D);
+	child->set_name("Child");
+	child->set_scale(Vector2(2, 3));
+	scene->add_child(child);
+	child->set_owner(scene);
+
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	CHECK(packed_scene->pack(scene) == OK);
+	memdelete(scene);
+
+	packed_scene->warm_up_pool(2);
+	Dictionary stats = packed_scene->get_pool_statistics();
+	CHECK(int(stats["available"]) == 2);
+	CHECK(int(stats["created"]) == 2);
+
+	SUBCASE("Released instances are reset and reused") {
+		Node2D *instance = Object::cast_to<Node2D>(packed_scene->acquire_instance());
+		REQUIRE(instance != nullptr);
+		CHECK(int(packed_scene->get_pool_statistics()["reused"]) == 1);
+
+		SceneTree::get_singleton()->get_root()->add_child(instance);
+		instance->set_position(Vector2(-5, -5));
+		instance->set_z_index(7);
+		Node2D *instance_child = Object::cast_to<Node2D>(instance->get_node(NodePath("Child")));
+		instance_child->set_scale(Vector2(1, 1));
+		instance_child->set_visible(false);
+
+		CHECK(packed_scene->release_instance(instance));
+		CHECK_FALSE(instance->is_inside_tree());
+		CHECK(instance->get_position() == Vector2(10, 20));
+		CHECK(instance->get_z_index() == 0);
+		CHECK(instance_child->get_scale() == Vector2(2, 3));
+		CHECK(instance_child->is_visible());
+
+		stats = packed_scene->get_pool_statistics();
+		CHECK(int(stats["available"]) == 2);
+		CHECK(int(stats["released"]) == 1);
+		CHECK(packed_scene->acquire_instance() == instance);
+		memdelete(instance);
+	}
+
+	SUBCASE("Instances that no longer match the scene are discarded") {
+		Node *instance = packed_scene->acquire_instance();
+		REQUIRE(instance != nullptr);
+		instance->add_child(memnew(Node));
+
+		ObjectID instance_id = instance->get_instance_id();
+		CHECK_FALSE(packed_scene->release_instance(instance));
+		CHECK(instance->is_queued_for_deletion());
+		stats = packed_scene->get_pool_statistics();
+		CHECK(int(stats["available"]) == 1);
+		CHECK(int(stats["discarded"]) == 1);
+
+		// Processing a frame flushes the delete queue.
+		SceneTree::get_singleton()->process(0);
+		CHECK(ObjectDB::get_instance(instance_id) == nullptr);
+	}
+
+	SUBCASE("Pool size is limited") {
+		packed_scene->set_pool_max_size(1);
+		Node *first = packed_scene->acquire_instance();
+		Node *second = packed_scene->acquire_instance();
+		Node *third = packed_scene->acquire_instance();
+
+		CHECK(packed_scene->release_instance(first));
+		CHECK_FALSE(packed_scene->release_instance(second));
+		CHECK_FALSE(packed_scene->release_instance(third));
+		CHECK(int(packed_scene->get_pool_statistics()["available"]) == 1);
+		SceneTree::get_singleton()->process(0);
+	}
+
+	packed_scene->clear_pool();
+	CHECK(int(packed_scene->get_pool_statistics()["available"]) == 0);
+}
+
+TEST_CASE("[PackedScene] Failed instantiations are not counted in the pool statistics") {
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+
+	ERR_PRINT_OFF;
+	CHECK(packed_scene->acquire_instance() == nullptr);
+	ERR_PRINT_ON;
+	CHECK(int(packed_scene->get_pool_statistics()["created"]) == 0);
+}
+
+TEST_CASE("[Stress][PackedScene] Instantiation throughput") {
+	const int instances = 10000;
+	const int child_counts[] = { 0, 8, 32 };
+
+	for (int child_count : child_counts) {
+		Node2D *scene = memnew(Node2D);
+		scene->set_name("BenchmarkScene");
+		for (int i = 0; i < child_count; i++) {
+			Node2D *child = memnew(Node2D);
+			child->set_name(vformat("Child%d", i));
+			child->set_position(Vector2(i, i));
+			child->set_rotation(i * 0.1);
+			child->set_z_index(i % 4);
+			scene->add_child(child);
+			child->set_owner(scene);
+		}
+
+		PackedScene packed_scene;
+		CHECK(packed_scene.pack(scene) == OK);
+		memdelete(scene);
+
+		uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < instances; i++) {
+			memdelete(packed_scene.instantiate());
+		}
+		uint64_t elapsed = MAX(OS::get_singleton()->get_ticks_usec() - begin, (uint64_t)1);
+		MESSAGE(vformat("%d child node(s): %d instances/s.", child_count, int64_t(instances * 1000000.0 / elapsed)).utf8().get_data());
+	}
+}
+
 } // namespace TestPackedScene
 
 #endif // TEST_PACKED_SCENE_H
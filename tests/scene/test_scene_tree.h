@@ -0,0 +1,130 @@
+/**************************************************************************/
+/*  test_scene_tree.h                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+
+#ifndef TEST_SCENE_TREE_H
+#define TEST_SCENE_TREE_H
+
+#include "core/config/project_settings.h"
+#include "core/os/os.h"
+#include "scene/main/scene_tree.h"
+
+#include "tests/test_macros.h"
+
+namespace TestSceneTree {
+
+class LowPriorityTarget : public Object {
+public:
+	Vector<int> calls;
+	uint64_t delay_usec = 0;
+
+	void work(int p_index) {
+		calls.push_back(p_index);
+		if (delay_usec) {
+			OS::get_singleton()->delay_usec(delay_usec);
+		}
+	}
+};
+
+TEST_CASE("[SceneTree] Low priority calls") {
+	SceneTree *tree = SceneTree::get_singleton();
+	LowPriorityTarget target;
+
+	SUBCASE("Calls within the budget run in the same frame") {
+		for (int i = 0; i < 3; i++) {
+			tree->queue_low_priority_call(callable_mp(&target, &LowPriorityTarget::work).bind(i));
+		}
+		CHECK(target.calls.is_empty());
+
+		tree->process(0);
+		REQUIRE(target.calls.size() == 3);
+		CHECK(target.calls[0] == 0);
+		CHECK(target.calls[2] == 2);
+	}
+
+	SUBCASE("Calls over the budget are spread over frames") {
+		// Each call spends the whole budget, so one runs per frame.
+		target.delay_usec = uint64_t(GLOBAL_GET("application/run/low_priority_calls_budget_usec")) + 1000;
+		for (int i = 0; i < 3; i++) {
+			tree->queue_low_priority_call(callable_mp(&target, &LowPriorityTarget::work).bind(i));
+		}
+
+		tree->process(0);
+		CHECK(target.calls.size() == 1);
+		tree->process(0);
+		CHECK(target.calls.size() == 2);
+
+		tree->queue_low_priority_call(callable_mp(&target, &LowPriorityTarget::work).bind(3));
+		tree->process(0);
+		tree->process(0);
+		REQUIRE(target.calls.size() == 4);
+		CHECK_MESSAGE(target.calls[3] == 3, "Calls queued later should run after the earlier ones.");
+	}
+}
+
+TEST_CASE("[SceneTree] Timer flags changed after creation") {
+	SceneTree *tree = SceneTree::get_singleton();
+
+	SUBCASE("Process in physics") {
+		Ref<SceneTreeTimer> timer = tree->create_timer(1.0);
+		timer->set_process_in_physics(true);
+
+		tree->process(2.0);
+		CHECK_MESSAGE(timer->get_time_left() == doctest::Approx(1.0), "The timer should have moved to the physics frames.");
+		tree->physics_process(0.5);
+		CHECK(timer->get_time_left() == doctest::Approx(0.5));
+
+		timer->set_process_in_physics(false);
+		CHECK_MESSAGE(timer->get_time_left() == doctest::Approx(0.5), "Moving the timer should keep its time left.");
+		tree->physics_process(2.0);
+		CHECK(timer->get_time_left() == doctest::Approx(0.5));
+		tree->process(0.5);
+		CHECK(timer->get_time_left() == doctest::Approx(0.0));
+	}
+
+	SUBCASE("Process always") {
+		Ref<SceneTreeTimer> timer = tree->create_timer(1.0);
+		Ref<SceneTreeTimer> other_timer = tree->create_timer(2.0);
+		timer->set_process_always(false);
+
+		tree->set_pause(true);
+		tree->process(0.5);
+		CHECK_MESSAGE(timer->get_time_left() == doctest::Approx(1.0), "The timer should be paused with the tree.");
+		CHECK(other_timer->get_time_left() == doctest::Approx(1.5));
+
+		timer->set_process_always(true);
+		tree->process(0.5);
+		tree->set_pause(false);
+		CHECK(timer->get_time_left() == doctest::Approx(0.5));
+		CHECK(other_timer->get_time_left() == doctest::Approx(1.0));
+	}
+}
+
+} // namespace TestSceneTree
+
+#endif // TEST_SCENE_TREE_H
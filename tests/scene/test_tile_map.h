@@ -0,0 +1,226 @@
+/**************************************************************************/
+/*  test_tile_map.h                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+
+#ifndef TEST_TILE_MAP_H
+#define TEST_TILE_MAP_H
+
+#include "scene/2d/tile_map.h"
+#include "scene/main/window.h"
+#include "scene/resources/image_texture.h"
+#include "scene/resources/world_2d.h"
+#include "servers/physics_server_2d.h"
+#include "servers/rendering/renderer_canvas_cull.h"
+#include "servers/rendering/rendering_server_globals.h"
+
+#include "tests/test_macros.h"
+
+namespace TestTileMap {
+
+// A tile set of 16x16 tiles, with a full square tile at (0, 0) and a tile filling its bottom half at (1, 0).
+static Ref<TileSet> create_physics_tile_set(int &r_source_id) {
+	Ref<TileSet> tile_set;
+	tile_set.instantiate();
+	tile_set->set_tile_size(Size2i(16, 16));
+	tile_set->add_physics_layer();
+
+	Ref<TileSetAtlasSource> atlas_source;
+	atlas_source.instantiate();
+	atlas_source->set_texture(ImageTexture::create_from_image(Image::create_empty(32, 16, false, Image::FORMAT_RGBA8)));
+	atlas_source->set_texture_region_size(Vector2i(16, 16));
+	r_source_id = tile_set->add_source(atlas_source);
+
+	atlas_source->create_tile(Vector2i(0, 0));
+	TileData *full = atlas_source->get_tile_data(Vector2i(0, 0), 0);
+	full->add_collision_polygon(0);
+	full->set_collision_polygon_points(0, 0, { Vector2(-8, -8), Vector2(8, -8), Vector2(8, 8), Vector2(-8, 8) });
+
+	atlas_source->create_tile(Vector2i(1, 0));
+	TileData *half = atlas_source->get_tile_data(Vector2i(1, 0), 0);
+	half->add_collision_polygon(0);
+	half->set_collision_polygon_points(0, 0, { Vector2(-8, 0), Vector2(8, 0), Vector2(8, 8), Vector2(-8, 8) });
+
+	return tile_set;
+}
+
+static bool cast_ray(TileMap *p_tile_map, const Vector2 &p_from, const Vector2 &p_to, PhysicsDirectSpaceState2D::RayResult &r_result) {
+	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
+	// Let the physics server put the new shapes in the broadphase.
+	ps->step(1.0 / 60.0);
+	PhysicsDirectSpaceState2D *space_state = ps->space_get_direct_state(p_tile_map->get_world_2d()->get_space());
+	PhysicsDirectSpaceState2D::RayParameters parameters;
+	parameters.from = p_from;
+	parameters.to = p_to;
+	return space_state->intersect_ray(parameters, r_result);
+}
+
+TEST_CASE("[SceneTree][TileMap] Physics quadrants") {
+	int source_id = TileSet::INVALID_SOURCE;
+	Ref<TileSet> tile_set = create_physics_tile_set(source_id);
+	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
+
+	TileMap *tile_map = memnew(TileMap);
+	tile_map->set_tileset(tile_set);
+	tile_map->set_layer_physics_quadrant_size(0, 16);
+	SceneTree::get_singleton()->get_root()->add_child(tile_map);
+
+	SUBCASE("Tiles are merged into one body") {
+		for (int x = 0; x < 3; x++) {
+			tile_map->set_cell(0, Vector2i(x, 0), source_id, Vector2i(0, 0));
+		}
+		tile_map->update_internals();
+
+		PhysicsDirectSpaceState2D::RayResult result;
+		REQUIRE(cast_ray(tile_map, Vector2(24, -20), Vector2(24, 20), result));
+		CHECK(result.position.is_equal_approx(Vector2(24, 0)));
+		CHECK(tile_map->get_layer_for_body_rid(result.rid) == 0);
+		CHECK_MESSAGE(tile_map->get_coords_for_body_contact(result.rid, result.position) == Vector2i(1, 0), "The tile should be found from the contact on the merged body.");
+
+		REQUIRE(ps->body_get_shape_count(result.rid) == 1);
+		Vector<Vector2> segments = ps->shape_get_data(ps->body_get_shape(result.rid, 0));
+		CHECK_MESSAGE(segments.size() == 4 * 2, "The edges between the tiles should be removed, and the top and bottom ones joined.");
+
+		PhysicsDirectSpaceState2D::RayResult other_result;
+		REQUIRE(cast_ray(tile_map, Vector2(40, -20), Vector2(40, 20), other_result));
+		CHECK(other_result.rid == result.rid);
+		CHECK(tile_map->get_coords_for_body_contact(other_result.rid, other_result.position) == Vector2i(2, 0));
+
+		// Only the dirty quadrant is rebuilt, without the erased tile.
+		tile_map->erase_cell(0, Vector2i(1, 0));
+		tile_map->update_internals();
+		CHECK_FALSE(cast_ray(tile_map, Vector2(24, -20), Vector2(24, 20), result));
+		REQUIRE(cast_ray(tile_map, Vector2(40, -20), Vector2(40, 20), result));
+		CHECK(tile_map->get_coords_for_body_contact(result.rid, result.position) == Vector2i(2, 0));
+	}
+
+	SUBCASE("Partially shared edges keep their uncovered part only") {
+		tile_map->set_cell(0, Vector2i(0, 0), source_id, Vector2i(0, 0));
+		tile_map->set_cell(0, Vector2i(1, 0), source_id, Vector2i(1, 0));
+		tile_map->update_internals();
+
+		PhysicsDirectSpaceState2D::RayResult result;
+		REQUIRE(cast_ray(tile_map, Vector2(24, -20), Vector2(24, 20), result));
+		CHECK(result.position.is_equal_approx(Vector2(24, 8)));
+		CHECK(tile_map->get_coords_for_body_contact(result.rid, result.position) == Vector2i(1, 0));
+
+		// Relative to the body, positioned on the center of the (0, 0) tile, the shared edge lies on x = 8.
+		Vector<Vector2> segments = ps->shape_get_data(ps->body_get_shape(result.rid, 0));
+		CHECK(segments.size() == 6 * 2);
+		bool shared_edge_found = false;
+		for (int i = 0; i < segments.size(); i += 2) {
+			if (Math::is_equal_approx(segments[i].x, 8) && Math::is_equal_approx(segments[i + 1].x, 8)) {
+				shared_edge_found = true;
+				CHECK_MESSAGE(MAX(segments[i].y, segments[i + 1].y) <= 0.01, "Only the part of the edge above the half tile should be kept.");
+				CHECK(MIN(segments[i].y, segments[i + 1].y) == doctest::Approx(-8));
+			}
+		}
+		CHECK(shared_edge_found);
+	}
+
+	memdelete(tile_map);
+}
+
+// Returns the canvas items of the rendering quadrants, sorted by draw index.
+// They are children of the layer canvas items, while debug quadrant items are directly under the TileMap one.
+static LocalVector<const RendererCanvasCull::Item *> get_rendering_quadrant_items(const TileMap *p_tile_map) {
+	LocalVector<const RendererCanvasCull::Item *> items;
+	const RendererCanvasCull::Item *tile_map_item = RSG::canvas->canvas_item_owner.get_or_null(p_tile_map->get_canvas_item());
+	if (tile_map_item) {
+		for (const RendererCanvasCull::Item *layer_item : tile_map_item->child_items) {
+			for (const RendererCanvasCull::Item *item : layer_item->child_items) {
+				items.push_back(item);
+			}
+		}
+	}
+	items.sort_custom<RendererCanvasCull::ItemIndexSort>();
+	return items;
+}
+
+TEST_CASE("[SceneTree][TileMap] Rendering quadrants") {
+	int source_id = TileSet::INVALID_SOURCE;
+	Ref<TileSet> tile_set = create_physics_tile_set(source_id);
+
+	TileMap *tile_map = memnew(TileMap);
+	tile_map->set_tileset(tile_set);
+	tile_map->set_rendering_quadrant_size(4);
+	SceneTree::get_singleton()->get_root()->add_child(tile_map);
+
+	// Two quadrants, one above the other.
+	tile_map->set_cell(0, Vector2i(0, 0), source_id, Vector2i(0, 0));
+	tile_map->set_cell(0, Vector2i(0, 4), source_id, Vector2i(0, 0));
+	tile_map->update_internals();
+
+	LocalVector<const RendererCanvasCull::Item *> items = get_rendering_quadrant_items(tile_map);
+	REQUIRE(items.size() == 2);
+	CHECK_MESSAGE(items[0]->xform.get_origin().y < items[1]->xform.get_origin().y, "Quadrants should be drawn from top to bottom.");
+	const RID top = items[0]->self;
+	const RID bottom = items[1]->self;
+	const int top_index = items[0]->index;
+	const int bottom_index = items[1]->index;
+
+	SUBCASE("Redrawn quadrants keep their canvas items") {
+		tile_map->set_cell(0, Vector2i(1, 0), source_id, Vector2i(1, 0));
+		tile_map->set_cell(0, Vector2i(0, 4), source_id, Vector2i(1, 0));
+		tile_map->update_internals();
+
+		items = get_rendering_quadrant_items(tile_map);
+		REQUIRE(items.size() == 2);
+		CHECK(items[0]->self == top);
+		CHECK(items[1]->self == bottom);
+		CHECK_MESSAGE(items[0]->index == top_index, "The draw order should not change when no quadrant is added or removed.");
+		CHECK(items[1]->index == bottom_index);
+	}
+
+	SUBCASE("New quadrants are drawn in order") {
+		tile_map->set_cell(0, Vector2i(0, -4), source_id, Vector2i(0, 0));
+		tile_map->update_internals();
+
+		items = get_rendering_quadrant_items(tile_map);
+		REQUIRE(items.size() == 3);
+		CHECK_MESSAGE(items[0]->self != top, "The quadrant above the others should be drawn first.");
+		CHECK(items[0]->self != bottom);
+		CHECK(items[1]->self == top);
+		CHECK(items[2]->self == bottom);
+	}
+
+	SUBCASE("Emptied quadrants free their canvas items") {
+		tile_map->erase_cell(0, Vector2i(0, 0));
+		tile_map->update_internals();
+
+		items = get_rendering_quadrant_items(tile_map);
+		REQUIRE(items.size() == 1);
+		CHECK(items[0]->self == bottom);
+		CHECK_FALSE(RSG::canvas->canvas_item_owner.owns(top));
+	}
+
+	memdelete(tile_map);
+}
+
+} // namespace TestTileMap
+
+#endif // TEST_TILE_MAP_H
@@ -0,0 +1,99 @@
+/**************************************************************************/
+/*  test_renderer_canvas_render.h                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+
+#ifndef TEST_RENDERER_CANVAS_RENDER_H
+#define TEST_RENDERER_CANVAS_RENDER_H
+
+#include "servers/rendering/renderer_canvas_render.h"
+
+#include "tests/test_macros.h"
+
+namespace TestRendererCanvasRender {
+
+TEST_CASE("[RendererCanvasRender] Point light shadow hash") {
+	typedef RendererCanvasRender::LightOccluderInstance LightOccluderInstance;
+
+	HashMap<RID, uint32_t> versions;
+	auto get_version = [&versions](RID p_occluder) -> uint32_t {
+		const uint32_t *version = versions.getptr(p_occluder);
+		return version ? *version : 0;
+	};
+
+	LightOccluderInstance occluders[2];
+	occluders[0].occluder = RID::from_uint64(1);
+	occluders[0].xform_cache = Transform2D(0, Vector2(64, 0));
+	occluders[0].next = &occluders[1];
+	occluders[1].occluder = RID::from_uint64(2);
+	occluders[1].xform_cache = Transform2D(0, Vector2(0, -32));
+	versions[occluders[0].occluder] = 1;
+	versions[occluders[1].occluder] = 1;
+
+	// The shadow renderer receives the inverse of the light transform.
+	const Transform2D light_xform = Transform2D(0, Vector2(16, 16));
+	const uint64_t hash = RendererCanvasRender::light_shadow_hash(light_xform.affine_inverse(), 1, 1, 100, occluders, get_version);
+	CHECK(hash != 0);
+	CHECK_MESSAGE(RendererCanvasRender::light_shadow_hash(light_xform.affine_inverse(), 1, 1, 100, occluders, get_version) == hash, "The same light and occluders should hit the cache.");
+
+	SUBCASE("Moving the light and its occluders together keeps the shadow") {
+		const Transform2D camera = Transform2D(0, Vector2(-128, 256));
+		for (LightOccluderInstance &occluder : occluders) {
+			occluder.xform_cache = camera * occluder.xform_cache;
+		}
+		CHECK(RendererCanvasRender::light_shadow_hash((camera * light_xform).affine_inverse(), 1, 1, 100, occluders, get_version) == hash);
+	}
+
+	SUBCASE("Changes to what the shadow is drawn from invalidate it") {
+		CHECK(RendererCanvasRender::light_shadow_hash(light_xform.affine_inverse(), 1, 1, 200, occluders, get_version) != hash);
+
+		occluders[1].xform_cache = Transform2D(0, Vector2(0, -48));
+		CHECK_MESSAGE(RendererCanvasRender::light_shadow_hash(light_xform.affine_inverse(), 1, 1, 100, occluders, get_version) != hash, "Moving an occluder should invalidate the shadow.");
+		occluders[1].xform_cache = Transform2D(0, Vector2(0, -32));
+
+		versions[occluders[0].occluder] = 2;
+		CHECK_MESSAGE(RendererCanvasRender::light_shadow_hash(light_xform.affine_inverse(), 1, 1, 100, occluders, get_version) != hash, "Changing an occluder polygon should invalidate the shadow.");
+	}
+
+	SUBCASE("Occluders the light does not draw are ignored") {
+		occluders[1].light_mask = 2;
+		const uint64_t masked_hash = RendererCanvasRender::light_shadow_hash(light_xform.affine_inverse(), 1, 1, 100, occluders, get_version);
+		CHECK(masked_hash != hash);
+		occluders[1].xform_cache = Transform2D(0, Vector2(0, -48));
+		versions[occluders[1].occluder] = 2;
+		CHECK_MESSAGE(RendererCanvasRender::light_shadow_hash(light_xform.affine_inverse(), 1, 1, 100, occluders, get_version) == masked_hash, "Occluders outside the light mask should not affect the shadow.");
+
+		// Same for polygons without a shape.
+		versions[occluders[1].occluder] = 0;
+		occluders[1].light_mask = 1;
+		CHECK(RendererCanvasRender::light_shadow_hash(light_xform.affine_inverse(), 1, 1, 100, occluders, get_version) == masked_hash);
+	}
+}
+
+} // namespace TestRendererCanvasRender
+
+#endif // TEST_RENDERER_CANVAS_RENDER_H
@@ -33,6 +33,8 @@
 
 #ifdef TOOLS_ENABLED
 
+#include "core/os/os.h"
+#include "core/os/thread.h"
 #include "editor/builtin_fonts.gen.h"
 #include "servers/text_server.h"
 #include "tests/test_macros.h"
@@ -616,6 +618,64 @@ TEST_SUITE("[TextServer]") {
 			}
 		}
 
+		SUBCASE("[TextServer] Text layout: Shaped text cache") {
+			for (int i = 0; i < TextServerManager::get_singleton()->get_interface_count(); i++) {
+				Ref<TextServer> ts = TextServerManager::get_singleton()->get_interface(i);
+				CHECK_FALSE_MESSAGE(ts.is_null(), "Invalid TS interface.");
+
+				if (!ts->has_feature(TextServer::FEATURE_FONT_DYNAMIC) || ts->get_shaped_text_cache_limit() == 0) {
+					continue;
+				}
+
+				RID font1 = ts->create_font();
+				ts->font_set_data_ptr(font1, _font_NotoSans_Regular, _font_NotoSans_Regular_size);
+				ts->font_set_allow_system_fallback(font1, false);
+
+				Array font;
+				font.push_back(font1);
+
+				String test = U"Gold: 100";
+
+				RID ctx = ts->create_shaped_text();
+				ts->shaped_text_add_string(ctx, test, font, 16);
+				int64_t misses = ts->get_shaped_text_cache_misses();
+				double width = ts->shaped_text_get_width(ctx);
+				int gl_size = ts->shaped_text_get_glyph_count(ctx);
+				CHECK_MESSAGE(ts->get_shaped_text_cache_misses() == misses + 1, "First shaping should miss the cache.");
+				CHECK_MESSAGE(ts->get_shaped_text_cache_usage() > 0, "Shaped text should be cached.");
+				ts->free_rid(ctx);
+
+				ctx = ts->create_shaped_text();
+				ts->shaped_text_add_string(ctx, test, font, 16);
+				int64_t hits = ts->get_shaped_text_cache_hits();
+				CHECK_MESSAGE(ts->shaped_text_get_width(ctx) == width, "Cached width should match.");
+				CHECK_MESSAGE(ts->shaped_text_get_glyph_count(ctx) == gl_size, "Cached glyph count should match.");
+				CHECK_MESSAGE(ts->get_shaped_text_cache_hits() == hits + 1, "Identical text should hit the cache.");
+				ts->free_rid(ctx);
+
+				// Different size and changed font properties should not reuse the cached glyphs.
+				ctx = ts->create_shaped_text();
+				ts->shaped_text_add_string(ctx, test, font, 20);
+				misses = ts->get_shaped_text_cache_misses();
+				CHECK_MESSAGE(ts->shaped_text_get_width(ctx) > width, "Larger font should produce wider text.");
+				CHECK_MESSAGE(ts->get_shaped_text_cache_misses() == misses + 1, "Different font size should miss the cache.");
+				ts->free_rid(ctx);
+
+				ts->font_set_spacing(font1, TextServer::SPACING_GLYPH, 4);
+				ctx = ts->create_shaped_text();
+				ts->shaped_text_add_string(ctx, test, font, 16);
+				CHECK_MESSAGE(ts->shaped_text_get_width(ctx) > width, "Font change should invalidate the cache.");
+				ts->free_rid(ctx);
+
+				ts->set_shaped_text_cache_limit(0);
+				CHECK_MESSAGE(ts->get_shaped_text_cache_usage() == 0, "Disabling the cache should release it.");
+				ts->set_shaped_text_cache_limit(1024 * 1024);
+
+				ts->free_rid(font1);
+				font.clear();
+			}
+		}
+
 		SUBCASE("[TextServer] Unicode identifiers") {
 			for (int i = 0; i < TextServerManager::get_singleton()->get_interface_count(); i++) {
 				Ref<TextServer> ts = TextServerManager::get_singleton()->get_interface(i);
@@ -767,6 +827,109 @@ TEST_SUITE("[TextServer]") {
 			}
 		}
 	}
+
+	TEST_CASE("[TextServer] Background glyph rasterization") {
+		struct DrawOnThread {
+			Ref<TextServer> ts;
+			RID font;
+			int64_t glyph = 0;
+			int64_t deferred_before = 0;
+			int64_t deferred_after = 0;
+
+			static void draw(void *p_ud) {
+				DrawOnThread *dt = static_cast<DrawOnThread *>(p_ud);
+				dt->deferred_before = dt->ts->get_deferred_glyph_count();
+				dt->ts->font_draw_glyph(dt->font, RID(), 24, Vector2(), dt->glyph);
+				dt->deferred_after = dt->ts->get_deferred_glyph_count();
+			}
+		};
+
+		for (int i = 0; i < TextServerManager::get_singleton()->get_interface_count(); i++) {
+			Ref<TextServer> ts = TextServerManager::get_singleton()->get_interface(i);
+			CHECK_FALSE_MESSAGE(ts.is_null(), "Invalid TS interface.");
+
+			if (!ts->has_feature(TextServer::FEATURE_FONT_DYNAMIC)) {
+				continue;
+			}
+
+			RID font = ts->create_font();
+			ts->font_set_data_ptr(font, _font_NotoSans_Regular, _font_NotoSans_Regular_size);
+
+			// Pre-rendering fills the font cache in the background.
+			ts->font_prerender_characters(font, Vector2i(16, 0), "Godot");
+			uint64_t begin = OS::get_singleton()->get_ticks_msec();
+			while (ts->font_is_prerendering(font) && OS::get_singleton()->get_ticks_msec() - begin < 10000) {
+				OS::get_singleton()->delay_usec(1000);
+			}
+			CHECK_FALSE_MESSAGE(ts->font_is_prerendering(font), "Pre-rendering should finish.");
+			int64_t glyph = ts->font_get_glyph_index(font, 16, 'G', 0);
+			CHECK_MESSAGE(ts->font_get_glyph_list(font, Vector2i(16, 0)).has(glyph), "Pre-rendered glyphs should be cached.");
+
+			// Uncached glyphs are skipped when drawn, and counted on the drawing thread only.
+			ts->set_async_glyph_rasterization(true);
+			int64_t deferred = ts->get_deferred_glyph_count();
+			ts->font_draw_glyph(font, RID(), 24, Vector2(), ts->font_get_glyph_index(font, 24, 'W', 0));
+			CHECK_MESSAGE(ts->get_deferred_glyph_count() == deferred + 1, "Drawing an uncached glyph should defer it.");
+
+			DrawOnThread dt;
+			dt.ts = ts;
+			dt.font = font;
+			dt.glyph = ts->font_get_glyph_index(font, 24, 'Q', 0);
+			Thread thread;
+			thread.start(&DrawOnThread::draw, &dt);
+			thread.wait_to_finish();
+			CHECK_MESSAGE(dt.deferred_after == dt.deferred_before + 1, "Drawing thread should count its deferred glyph.");
+			CHECK_MESSAGE(ts->get_deferred_glyph_count() == deferred + 1, "Glyphs deferred by other threads should not be counted.");
+			ts->set_async_glyph_rasterization(false);
+
+			// Freeing a font waits for its background task.
+			ts->font_prerender_characters(font, Vector2i(32, 0), "The quick brown fox jumps over the lazy dog.");
+			ts->free_rid(font);
+		}
+	}
+
+	TEST_CASE("[SceneTree][TextServer] Glyph atlas region updates") {
+		for (int i = 0; i < TextServerManager::get_singleton()->get_interface_count(); i++) {
+			Ref<TextServer> ts = TextServerManager::get_singleton()->get_interface(i);
+			CHECK_FALSE_MESSAGE(ts.is_null(), "Invalid TS interface.");
+
+			if (!ts->has_feature(TextServer::FEATURE_FONT_DYNAMIC)) {
+				continue;
+			}
+
+			for (bool mipmaps : { false, true }) {
+				RID font = ts->create_font();
+				ts->font_set_data_ptr(font, _font_NotoSans_Regular, _font_NotoSans_Regular_size);
+				ts->font_set_generate_mipmaps(font, mipmaps);
+
+				const Vector2i size = Vector2i(16, 0);
+				const int64_t first_glyph = ts->font_get_glyph_index(font, 16, 'G', 0);
+				ts->font_render_glyph(font, size, first_glyph);
+				const RID texture = ts->font_get_glyph_texture_rid(font, size, first_glyph);
+				REQUIRE(texture.is_valid());
+
+				// Glyphs added to the same atlas are uploaded as regions of the existing texture.
+				const String text = "odot Engine";
+				for (int j = 0; j < text.length(); j++) {
+					ts->font_render_glyph(font, size, ts->font_get_glyph_index(font, 16, text[j], 0));
+				}
+				const int64_t last_glyph = ts->font_get_glyph_index(font, 16, 'E', 0);
+				REQUIRE(ts->font_get_glyph_texture_idx(font, size, last_glyph) == ts->font_get_glyph_texture_idx(font, size, first_glyph));
+				CHECK_MESSAGE(ts->font_get_glyph_texture_rid(font, size, last_glyph) == texture, "The atlas texture should be updated in place.");
+
+				Ref<Image> expected = ts->font_get_texture_image(font, size, ts->font_get_glyph_texture_idx(font, size, first_glyph));
+				REQUIRE(expected.is_valid());
+				if (mipmaps) {
+					expected->generate_mipmaps();
+				}
+				Ref<Image> uploaded = RenderingServer::get_singleton()->texture_2d_get(texture);
+				REQUIRE(uploaded.is_valid());
+				CHECK_MESSAGE(uploaded->get_data() == expected->get_data(), vformat("The uploaded atlas should match the font atlas (mipmaps: %s).", mipmaps));
+
+				ts->free_rid(font);
+			}
+		}
+	}
 }
 }; // namespace TestTextServer
 